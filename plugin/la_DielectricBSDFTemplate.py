@@ -9,6 +9,7 @@ class AEla_DielectricBSDFTemplate(ShaderAETemplate):
 
         self.addControl('ior', label='Index of Refraction')
         self.addControl('roughness', label='Roughness')
+        self.addControl('multiple_scattering', label='Multiple Scattering')
 
         maya.mel.eval('AEdependNodeTemplate '+self.nodeName)
         self.addExtraControls()
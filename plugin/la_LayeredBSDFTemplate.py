@@ -9,13 +9,32 @@ class AEla_LayeredBSDFTemplate(ShaderAETemplate):
 
         self.addControl('thickness', label='Layer Thickness')
         self.addControl('g', label='G')
+        self.addControl('phase_file', label='Phase File')
         self.addControl('albedo', label='Albedo')
+        self.addControl('fast_math', label='Fast Math')
+        self.addControl('baked_file', label='Baked File')
+        self.addControl('fit_lobes', label='Fit Analytic Lobes')
+        self.addControl('split_coat', label='Split Coat Reflection')
+
+        self.beginLayout('Regularization', collapse=True)
+        self.addControl('regularize', label='Regularize')
+        self.addControl('regularize_depth', label='Depth')
+        self.addControl('regularize_roughness', label='Min Roughness')
+        self.endLayout()
+
+        self.beginLayout('Sampling', collapse=True)
+        self.addControl('walk_samples', label='Walk Samples')
+        self.addControl('estimator', label='Estimator')
+        self.addControl('clamp_scale', label='Clamp Scale')
+        self.addControl('progressive_ramp', label='Progressive Ramp')
+        self.endLayout()
 
         self.beginLayout('Top BSDF', collapse=False)
         self.addControl('top_node', label='Top BSDF')
         self.addControl('top_normal', label='Top Normal')
         self.addControl('top_correct_normal', label='Gamma Correct')
         self.addControl('top_flip_normal', label='Flip Normal')
+        self.addControl('top_normal_moments', label='Normal Moments')
         self.endLayout()
 
         self.beginLayout('Bottom BSDF', collapse=False)
@@ -23,6 +42,7 @@ class AEla_LayeredBSDFTemplate(ShaderAETemplate):
         self.addControl('bottom_normal', label='Bottom Normal')
         self.addControl('bottom_correct_normal', label='Gamma Correct')
         self.addControl('bottom_flip_normal', label='Flip Normal')
+        self.addControl('bottom_normal_moments', label='Normal Moments')
         self.endLayout()
 
         maya.mel.eval('AEdependNodeTemplate '+self.nodeName)
@@ -7,6 +7,9 @@ class AEla_MetalBSDFTemplate(ShaderAETemplate):
     def changeFresnel(self, nodeName):
         aeUtils.arnoldDimControlIfTrue(nodeName, 'ior', 'schlick_f')
         aeUtils.arnoldDimControlIfTrue(nodeName, 'k', 'schlick_f')
+        aeUtils.arnoldDimControlIfTrue(nodeName, 'use_rgb_ior', 'schlick_f')
+        aeUtils.arnoldDimControlIfTrue(nodeName, 'ior_rgb', 'schlick_f')
+        aeUtils.arnoldDimControlIfTrue(nodeName, 'k_rgb', 'schlick_f')
 
     def setup(self):
         self.addSwatch()
@@ -18,6 +21,10 @@ class AEla_MetalBSDFTemplate(ShaderAETemplate):
         self.addControl('k', label='Index of Refraction (Img)')
         self.addControl('roughness', label='Roughness')
         self.addControl('schlick_f', label='Use Schlick Fresnel', changeCommand=self.changeFresnel)
+        self.addControl('use_rgb_ior', label='Use RGB Index of Refraction')
+        self.addControl('ior_rgb', label='Index of Refraction RGB (Real)')
+        self.addControl('k_rgb', label='Index of Refraction RGB (Img)')
+        self.addControl('multiple_scattering', label='Multiple Scattering')
 
         self.suppress('normalCamera')
 
@@ -0,0 +1,284 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "baked_table.h"
+
+static const char BakedTableMagic[8] = { 'L', 'M', 'B', 'A', 'K', 'E', 'D', '\0' };
+
+static int Cell(float v, float range, int n)
+{
+	return AiClamp(int(v / range * n), 0, n - 1);
+}
+
+static int CosCell(float cosTheta, int n)
+{
+	return Cell(cosTheta + 1.f, 2.f, n);
+}
+
+// azimuth between the projections of wo and wi, in [0, pi]
+static float RelativePhi(Vec3f wo, Vec3f wi)
+{
+	float c = wo.x * wi.x + wo.y * wi.y;
+	float s = std::abs(wo.x * wi.y - wo.y * wi.x);
+	return (c == 0 && s == 0) ? 0.f : std::atan2(s, c);
+}
+
+// index of the CDF interval containing u, u is remapped to [0, 1) inside it
+static int SampleCDF(const float* cdf, int n, float& u)
+{
+	int i = int(std::upper_bound(cdf, cdf + n + 1, u) - cdf) - 1;
+	i = AiClamp(i, 0, n - 1);
+	float width = cdf[i + 1] - cdf[i];
+	u = (width > 0) ? AiMin((u - cdf[i]) / width, .99999994f) : .5f;
+	return i;
+}
+
+AtRGB BakedTable::F(Vec3f wo, Vec3f wi) const
+{
+	int nCosI = header->nCosI, nPhi = header->nPhi;
+	int o = CosCell(wo.z, header->nCosO);
+	int i = CosCell(wi.z, nCosI);
+	int p = Cell(RelativePhi(wo, wi), AI_PI, nPhi);
+
+	const float* v = values + ((size_t(o) * nCosI + i) * nPhi + p) * 3;
+	return AtRGB(v[0], v[1], v[2]);
+}
+
+float BakedTable::PDF(Vec3f wo, Vec3f wi) const
+{
+	int nCosI = header->nCosI, nPhi = header->nPhi;
+	int o = CosCell(wo.z, header->nCosO);
+	int i = CosCell(wi.z, nCosI);
+	int p = Cell(RelativePhi(wo, wi), AI_PI, nPhi);
+
+	const float* m = marginal + size_t(o) * (nCosI + 1);
+	const float* c = conditional + (size_t(o) * nCosI + i) * (nPhi + 1);
+	// a cell covers both signs of the azimuth
+	float area = (2.f / nCosI) * (2.f * AI_PI / nPhi);
+	return (m[i + 1] - m[i]) * (c[p + 1] - c[p]) / area;
+}
+
+BSDFSample BakedTable::Sample(Vec3f wo, RandomEngine& rng) const
+{
+	int nCosI = header->nCosI, nPhi = header->nPhi;
+	int o = CosCell(wo.z, header->nCosO);
+
+	Vec3f u = Sample3D(rng);
+	int i = SampleCDF(marginal + size_t(o) * (nCosI + 1), nCosI, u.x);
+	int p = SampleCDF(conditional + (size_t(o) * nCosI + i) * (nPhi + 1), nPhi, u.y);
+
+	float cosTheta = -1.f + (i + u.x) * 2.f / nCosI;
+	float phi = (p + u.y) * AI_PI / nPhi;
+	if (u.z < .5f)
+		phi = -phi;
+	phi += std::atan2(wo.y, wo.x);
+
+	float sinTheta = Sqrt(1.f - cosTheta * cosTheta);
+	Vec3f wi(sinTheta * std::cos(phi), sinTheta * std::sin(phi), cosTheta);
+
+	int type = SameHemisphere(wo, wi) ? AI_RAY_DIFFUSE_REFLECT : AI_RAY_DIFFUSE_TRANSMIT;
+	return BSDFSample(wi, F(wo, wi), PDF(wo, wi), type);
+}
+
+static std::shared_ptr<const void> MapFile(const std::string& path, size_t& size)
+{
+#ifdef _WIN32
+	HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		return nullptr;
+
+	LARGE_INTEGER fileSize;
+	HANDLE mapping = nullptr;
+	if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0)
+		mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle(file);
+	if (!mapping)
+		return nullptr;
+
+	const void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+	if (!data)
+		return nullptr;
+
+	size = size_t(fileSize.QuadPart);
+	return std::shared_ptr<const void>(data, [](const void* p) { UnmapViewOfFile(p); });
+#else
+	int fd = open(path.c_str(), O_RDONLY);
+	if (fd < 0)
+		return nullptr;
+
+	struct stat st;
+	void* data = MAP_FAILED;
+	if (fstat(fd, &st) == 0 && st.st_size > 0)
+		data = mmap(nullptr, size_t(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED)
+		return nullptr;
+
+	size = size_t(st.st_size);
+	return std::shared_ptr<const void>(data, [size](const void* p) { munmap(const_cast<void*>(p), size); });
+#endif
+}
+
+static bool SectionFits(uint64_t offset, uint64_t count, uint64_t size)
+{
+	return offset % BakedTableAlignment == 0 && offset <= size && count * sizeof(float) <= size - offset;
+}
+
+static bool Validate(const BakedTableHeader* h, size_t size)
+{
+	if (size < sizeof(BakedTableHeader) || std::memcmp(h->magic, BakedTableMagic, sizeof(h->magic)) != 0)
+		return false;
+	if (h->version != BakedTableVersion || h->size != size)
+		return false;
+	if (h->nCosO == 0 || h->nCosI == 0 || h->nPhi == 0 || h->nCosO > 4096 || h->nCosI > 4096 || h->nPhi > 4096)
+		return false;
+
+	uint64_t cells = uint64_t(h->nCosO) * h->nCosI;
+	return SectionFits(h->valuesOffset, cells * h->nPhi * 3, size) &&
+		SectionFits(h->marginalOffset, h->nCosO * uint64_t(h->nCosI + 1), size) &&
+		SectionFits(h->conditionalOffset, cells * (h->nPhi + 1), size);
+}
+
+static std::shared_ptr<const BakedTable> MapBakedTable(const std::string& path)
+{
+	size_t size = 0;
+	auto mapping = MapFile(path, size);
+	if (!mapping)
+	{
+		AiMsgWarning("[LayerMatNode] cannot map baked table %s", path.c_str());
+		return nullptr;
+	}
+
+	auto base = static_cast<const char*>(mapping.get());
+	auto header = reinterpret_cast<const BakedTableHeader*>(base);
+	if (!Validate(header, size))
+	{
+		AiMsgWarning("[LayerMatNode] %s is not a version %u baked table", path.c_str(), BakedTableVersion);
+		return nullptr;
+	}
+
+	auto table = std::make_shared<BakedTable>();
+	table->header = header;
+	table->values = reinterpret_cast<const float*>(base + header->valuesOffset);
+	table->marginal = reinterpret_cast<const float*>(base + header->marginalOffset);
+	table->conditional = reinterpret_cast<const float*>(base + header->conditionalOffset);
+	table->mapping = std::move(mapping);
+	return table;
+}
+
+std::shared_ptr<const BakedTable> OpenBakedTable(const std::string& path)
+{
+	static std::mutex mutex;
+	static std::unordered_map<std::string, std::weak_ptr<const BakedTable>> tables;
+
+	std::lock_guard<std::mutex> lock(mutex);
+	auto table = tables[path].lock();
+	if (!table)
+	{
+		table = MapBakedTable(path);
+		tables[path] = table;
+	}
+	return table;
+}
+
+// Normalized running sum of weights into cdf[0, n], uniform if all weights are 0
+static void BuildCDF(const float* weights, int n, float* cdf)
+{
+	double sum = 0;
+	cdf[0] = 0;
+	for (int i = 0; i < n; i++)
+		sum += weights[i];
+
+	double run = 0;
+	for (int i = 0; i < n; i++)
+	{
+		run += (sum > 0) ? weights[i] : 1.;
+		cdf[i + 1] = float(run / ((sum > 0) ? sum : n));
+	}
+	cdf[n] = 1.f;
+}
+
+static uint64_t Align(uint64_t offset)
+{
+	return (offset + BakedTableAlignment - 1) / BakedTableAlignment * BakedTableAlignment;
+}
+
+bool WriteBakedTable(const char* path, int nCosO, int nCosI, int nPhi, const std::vector<AtRGB>& values)
+{
+	if (values.size() != size_t(nCosO) * nCosI * nPhi)
+		return false;
+
+	std::vector<float> flat(values.size() * 3);
+	std::vector<float> marginal(size_t(nCosO) * (nCosI + 1));
+	std::vector<float> conditional(size_t(nCosO) * nCosI * (nPhi + 1));
+	std::vector<float> rowWeights(nCosI), cellWeights(nPhi);
+
+	for (int o = 0; o < nCosO; o++)
+	{
+		for (int i = 0; i < nCosI; i++)
+		{
+			float cosTheta = std::abs(-1.f + (i + .5f) * 2.f / nCosI);
+			rowWeights[i] = 0;
+
+			for (int p = 0; p < nPhi; p++)
+			{
+				size_t cell = (size_t(o) * nCosI + i) * nPhi + p;
+				AtRGB f = values[cell];
+				flat[cell * 3 + 0] = f.r;
+				flat[cell * 3 + 1] = f.g;
+				flat[cell * 3 + 2] = f.b;
+
+				cellWeights[p] = AiMax(Luminance(f), 0.f) * cosTheta;
+				rowWeights[i] += cellWeights[p];
+			}
+			BuildCDF(cellWeights.data(), nPhi, &conditional[(size_t(o) * nCosI + i) * (nPhi + 1)]);
+		}
+		BuildCDF(rowWeights.data(), nCosI, &marginal[size_t(o) * (nCosI + 1)]);
+	}
+
+	BakedTableHeader header = {};
+	std::memcpy(header.magic, BakedTableMagic, sizeof(header.magic));
+	header.version = BakedTableVersion;
+	header.nCosO = nCosO;
+	header.nCosI = nCosI;
+	header.nPhi = nPhi;
+	header.valuesOffset = Align(sizeof(BakedTableHeader));
+	header.marginalOffset = Align(header.valuesOffset + flat.size() * sizeof(float));
+	header.conditionalOffset = Align(header.marginalOffset + marginal.size() * sizeof(float));
+	header.size = header.conditionalOffset + conditional.size() * sizeof(float);
+
+	FILE* file = fopen(path, "wb");
+	if (!file)
+		return false;
+
+	auto writeAt = [&](uint64_t offset, const void* data, size_t bytes)
+	{
+		static const char zeros[BakedTableAlignment] = {};
+		long pos = ftell(file);
+		fwrite(zeros, 1, size_t(offset - pos), file);
+		return fwrite(data, 1, bytes, file) == bytes;
+	};
+
+	bool ok = writeAt(0, &header, sizeof(header)) &&
+		writeAt(header.valuesOffset, flat.data(), flat.size() * sizeof(float)) &&
+		writeAt(header.marginalOffset, marginal.data(), marginal.size() * sizeof(float)) &&
+		writeAt(header.conditionalOffset, conditional.data(), conditional.size() * sizeof(float));
+	return fclose(file) == 0 && ok;
+}
@@ -0,0 +1,55 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "bsdfs.h"
+
+// Layered BSDF tabulated offline by tools/layer_bake.cpp and mapped read-only by the plugin,
+// which uses the file in place without parsing or copying it.
+// Cells are uniform in (cos theta_o, cos theta_i, phi), cosines over [-1, 1] and phi, the azimuth
+// of wi relative to wo, over [0, pi]. F is constant per cell so sampling the CDFs has exactly the
+// density of Luminance(F) |cos theta_i|.
+//
+// Little endian, every section starts on a 64 byte boundary:
+//   BakedTableHeader
+//   float values[nCosO][nCosI][nPhi][3]          F in radiance mode
+//   float marginal[nCosO][nCosI + 1]             CDF over cos theta_i
+//   float conditional[nCosO][nCosI][nPhi + 1]    CDF over phi
+const uint32_t BakedTableVersion = 1;
+const uint64_t BakedTableAlignment = 64;
+
+struct BakedTableHeader
+{
+	char magic[8];
+	uint32_t version;
+	uint32_t nCosO;
+	uint32_t nCosI;
+	uint32_t nPhi;
+	uint64_t valuesOffset;
+	uint64_t marginalOffset;
+	uint64_t conditionalOffset;
+	uint64_t size;
+};
+
+struct BakedTable
+{
+	AtRGB F(Vec3f wo, Vec3f wi) const;
+	float PDF(Vec3f wo, Vec3f wi) const;
+	BSDFSample Sample(Vec3f wo, RandomEngine& rng) const;
+
+	const BakedTableHeader* header = nullptr;
+	const float* values = nullptr;
+	const float* marginal = nullptr;
+	const float* conditional = nullptr;
+	// keeps the file mapped
+	std::shared_ptr<const void> mapping;
+};
+
+// Maps path or shares the mapping of an earlier call, null with a warning if the file can't be
+// mapped or is not a valid table
+std::shared_ptr<const BakedTable> OpenBakedTable(const std::string& path);
+
+// Builds the CDFs of values, laid out as in the file, and writes the table
+bool WriteBakedTable(const char* path, int nCosO, int nCosI, int nPhi, const std::vector<AtRGB>& values);
@@ -1,16 +1,24 @@
+#include <algorithm>
+
 #include "bsdfs.h"
+#include "fastmath.h"
 #include "microfacet.h"
+#include "energy_compensation.h"
+#include "material_program.h"
+#include "layered_walk.h"
+#include "baked_table.h"
 
-float Transmittance(float z0, float z1, Vec3f w) {
-	return std::exp(-std::abs((z0 - z1) / w.z));
+float Transmittance(float z0, float z1, Vec3f w, bool fast) {
+	return Transmittance(z0 - z1, w, fast);
 }
 
-float Transmittance(float dz, Vec3f w) {
-	return std::exp(-std::abs(dz / w.z));
+float Transmittance(float dz, Vec3f w, bool fast) {
+	float x = -std::abs(dz / w.z);
+	return fast ? FastExp(x) : std::exp(x);
 }
 
-float SampleExponential(float a, float u) {
-	return -std::log(1 - u) / a;
+float SampleExponential(float a, float u, bool fast) {
+	return -(fast ? FastLog(1 - u) : std::log(1 - u)) / a;
 }
 
 bool Refract(Vec3f& wt, Vec3f n, Vec3f wi, float eta)
@@ -49,40 +57,11 @@ bool Refract(Vec3f& wt, Vec3f wi, float eta)
 	return true;
 }
 
-float FresnelDielectric(float cosTi, float eta)
-{
-	cosTi = AiClamp(cosTi, -1.f, 1.f);
-	if (cosTi < 0.0f)
-	{
-		eta = 1.f / eta;
-		cosTi = -cosTi;
-	}
-
-	float sinTi = Sqrt(1.f - cosTi * cosTi);
-	float sinTt = sinTi / eta;
-	if (sinTt >= 1.f)
-		return 1.f;
-
-	float cosTt = Sqrt(1.f - sinTt * sinTt);
-
-	float rPa = (cosTi - eta * cosTt) / (cosTi + eta * cosTt);
-	float rPe = (eta * cosTi - cosTt) / (eta * cosTi + cosTt);
-	return (rPa * rPa + rPe * rPe) * .5f;
-}
-
 AtRGB FresnelSchlick(float cosTheta, AtRGB f0, float roughness)
 {
 	return f0 + (Max(AtRGB(1.f - roughness), f0) - f0) * Pow5(1.f - cosTheta);
 }
 
-struct PhaseSample
-{
-	PhaseSample(Vec3f w, float pdf) : wi(w), pdf(pdf), p(pdf) {}
-	float p;
-	Vec3f wi;
-	float pdf;
-};
-
 float HGPhaseFunction(float cosTheta, float g)
 {
 	float denom = 1.f + g * (g + 2 * cosTheta);
@@ -94,115 +73,131 @@ float HGPhasePDF(Vec3f wo, Vec3f wi, float g)
 	return HGPhaseFunction(Dot(wo, wi), g);
 }
 
-PhaseSample HGPhaseSample(Vec3f wo, float g, Vec2f u)
+// w rotated to the given angles around itself, in the branchless frame of Duff et al. which needs
+// no normalization or matrix. Phase functions are symmetric about w so the frame's orientation
+// doesn't matter
+static Vec3f AroundAxis(Vec3f w, float cosTheta, float sinTheta, float cosPhi, float sinPhi)
+{
+	float sign = std::copysign(1.f, w.z);
+	float a = -1.f / (sign + w.z);
+	float b = w.x * w.y * a;
+	Vec3f t(1.f + sign * w.x * w.x * a, sign * b, -sign * w.x);
+	Vec3f s(b, sign + w.y * w.y * a, -w.y);
+	return t * (sinTheta * cosPhi) + s * (sinTheta * sinPhi) + w * cosTheta;
+}
+
+PhaseSample HGPhaseSample(Vec3f wo, float g, Vec2f u, bool fast)
 {
 	float g2 = g * g;
 	float cosTheta = (Abs(g) < 1e-3f) ?
 		1.f - 2.f * u.x :
-		-(1 + g2 - Sqr((1 - g2) / (1 + g - 2 * g * u.x)) / (2.f * g));
+		-(1 + g2 - Sqr((1 - g2) / (1 + g - 2 * g * u.x))) / (2.f * g);
 
 	float sinTheta = Sqrt(1.f - cosTheta * cosTheta);
 	float phi = AI_PI * 2.f * u.y;
-	Vec3f wiLocal(std::cos(phi) * sinTheta, std::sin(phi) * sinTheta, cosTheta);
+	float sinPhi, cosPhi;
+
+	if (fast)
+		FastSinCos(phi, sinPhi, cosPhi);
+	else
+		sinPhi = std::sin(phi), cosPhi = std::cos(phi);
 
-	return PhaseSample(ToWorld(wo, wiLocal), HGPhaseFunction(cosTheta, g));
+	return PhaseSample(AroundAxis(wo, cosTheta, sinTheta, cosPhi, sinPhi), HGPhaseFunction(cosTheta, g));
 }
 
-float FresnelConductor(float cosI, float eta, float k)
+void BSDFState::SetInterfaces(const BSDF* topBSDF, const BSDF* bottomBSDF)
 {
-	Vec2c etak(eta, k);
-	Vec2c cosThetaI(AiClamp(cosI, 0.f, 1.f), 0.f);
-
-	Vec2c sin2ThetaI(1.f - cosThetaI.LengthSqr(), 0.f);
-	Vec2c sin2ThetaT = sin2ThetaI / (etak * etak);
-	Vec2c cosThetaT = (Vec2c(1.f, 0.f) - sin2ThetaT).Sqrt();
-
-	Vec2c rPa = (etak * cosThetaI - cosThetaT) / (etak * cosThetaI + cosThetaT);
-	Vec2c rPe = (cosThetaI - etak * cosThetaT) / (cosThetaI + etak * cosThetaT);
-	return (rPa.LengthSqr() + rPe.LengthSqr()) * .5f;
+	top = topBSDF;
+	bottom = bottomBSDF;
+	topDelta = ::IsDelta(top, *this);
+	bottomDelta = ::IsDelta(bottom, *this);
 }
 
 BSDFSample LambertBSDF::Sample(Vec3f wo, RandomEngine& rng) const
 {
 	Vec2f r = ToConcentricDisk(Sample2D(rng));
 	float z = Sqrt(1.f - Dot(r, r));
-	Vec3f w(r.x, r.y, z);
+	Vec3f w(r.x, r.y, (wo.z < 0) ? -z : z);
 	return BSDFSample(w, albedo * AI_ONEOVERPI, Abs(z) * AI_ONEOVERPI, AI_RAY_DIFFUSE_REFLECT);
 }
 
+// Generalized half vector of a dielectric pair, facing up. etap is the relative ior of the side
+// opposite wo, 1 for reflection. False if the pair has no microfacet that could connect them
+static bool DielectricHalfVector(Vec3f wo, Vec3f wi, float ior, Vec3f& wm, float& etap)
+{
+	bool refl = wo.z * wi.z > 0;
+	etap = refl ? 1.f : (wo.z > 0 ? ior : 1.f / ior);
+	wm = wi * etap + wo;
+
+	if (wo.z == 0 || wi.z == 0 || Dot(wm, wm) == 0)
+		return false;
+
+	wm = Normalize(wm);
+	if (wm.z < 0)
+		wm = -wm;
+
+	// back-facing microfacets
+	return Dot(wm, wi) * wi.z > 0 && Dot(wm, wo) * wo.z > 0;
+}
+
 AtRGB DielectricBSDF::F(Vec3f wo, Vec3f wi, bool adjoint) const
 {
-	if (ApproxDelta())
+	Vec3f wm;
+	float etap;
+	if (ApproxDelta() || !DielectricHalfVector(wo, wi, ior, wm, etap))
 		return AtRGB(0.f);
 
-	Vec3f wh = Normalize(wo + wi);
-	float whCosWo = AbsDot(wh, wo);
-	float whCosWi = AbsDot(wh, wi);
+	float fr = Fresnel(Dot(wo, wm));
+	float dg = GTR2(wm.z, alpha) * SmithGCorrelated(wo.z, wi.z, alpha);
 
-	if (SameHemisphere(wo, wi))
-	{
-		float fr = FresnelDielectric(whCosWi, ior);
-		return AtRGB((whCosWi * whCosWo < 1e-7f) ? 0.f :
-			GTR2(wh.z, alpha) * SmithG(wo.z, wi.z, alpha) / (4.f * whCosWo * whCosWi) * fr);
-	}
-	else
-	{
-		float eta = wi.z > 0 ? ior : 1.f / ior;
-		float sqrtDenom = Dot(wh, wo) + eta * Dot(wh, wi);
-		float denom = sqrtDenom * sqrtDenom;
-		float dHdWi = whCosWi / denom;
+	dg *= Compensation(wo.z, wi.z);
 
-		denom *= std::abs(wi.z) * std::abs(wo.z);
-		float fr = FresnelDielectric(Dot(wh, wi), eta);
-		float factor = adjoint ? 1.f : Sqr(1.0f / eta);
+	if (SameHemisphere(wo, wi))
+		return AtRGB(dg * fr / std::abs(4.f * wi.z * wo.z));
 
-		return AtRGB((denom < 1e-7f) ? 0.f :
-			std::abs(GTR2(wh.z, alpha) * SmithG(wo.z, wi.z, alpha) * whCosWo * whCosWi) / denom * (1.f - fr) * factor);
-	}
+	float denom = Sqr(Dot(wi, wm) + Dot(wo, wm) / etap) * wi.z * wo.z;
+	float factor = adjoint ? 1.f : Sqr(1.f / etap);
+	return AtRGB(dg * (1.f - fr) * std::abs(Dot(wi, wm) * Dot(wo, wm) / denom) * factor);
 }
 
-float DielectricBSDF::PDF(Vec3f wo, Vec3f wi, bool adjoint, BSDFFlag flag) const
+float DielectricBSDF::PDF(Vec3f wo, Vec3f wi, bool, BSDFFlag flag) const
 {
-	if (ApproxDelta())
+	Vec3f wm;
+	float etap;
+	if (ApproxDelta() || !DielectricHalfVector(wo, wi, ior, wm, etap))
 		return 0;
 
-	if (SameHemisphere(wo, wi))
-	{
-		Vec3f wh = Normalize(wo + wi);
-		if (Dot(wo, wh) < 0)
-			return 0;
+	float fr = Fresnel(Dot(wo, wm));
+	float refl = flag.refl ? fr : 0;
+	float tran = flag.tran ? 1.f - fr : 0;
+	if (refl + tran == 0)
+		return 0;
 
-		float fr = flag.refl ? FresnelDielectric(AbsDot(wh, wi), ior) : 0;
-		float tr = flag.tran ? 1.f - fr : 0;
-		return GTR2(wh.z, alpha) / (4.f * AbsDot(wh, wo)) * fr / (fr + tr);
-	}
-	else
-	{
-		float eta = wo.z > 0 ? ior : 1.0f / ior;
-		Vec3f wh = Normalize(wo + wi * eta);
-		if (SameHemisphere(wh, wo, wi))
-			return 0;
+	float pdfWm = GTR2VisibleSmith(wm, wo, alpha);
 
-		float fr = flag.refl ? FresnelDielectric(Dot(wh, wo), eta) : 0;
-		float tr = flag.tran ? 1.f - fr : 0;
-		float dHdWi = AbsDot(wh, wi) / Sqr(Dot(wh, wo) + eta * Dot(wh, wi));
-		return GTR2(wh.z, alpha) * dHdWi * tr / (fr + tr);
-	}
+	if (SameHemisphere(wo, wi))
+		return pdfWm / (4.f * AbsDot(wo, wm)) * refl / (refl + tran);
+
+	float dWmdWi = AbsDot(wi, wm) / Sqr(Dot(wi, wm) + Dot(wo, wm) / etap);
+	return pdfWm * dWmdWi * tran / (refl + tran);
 }
 
 BSDFSample DielectricBSDF::Sample(Vec3f wo, bool adjoint, BSDFFlag flag, RandomEngine& rng) const
 {
 	if (ApproxDelta())
 	{
-		float refl = flag.refl ? FresnelDielectric(wo.z, ior) : 0;
-		float tran = flag.tran ? 1.f - refl : 0;
+		float fr = Fresnel(wo.z);
+		float refl = flag.refl ? fr : 0;
+		float tran = flag.tran ? 1.f - fr : 0;
+		if (refl + tran == 0)
+			return BSDFInvalidSample;
 
-		float fr = refl / (refl + tran);
+		float pr = refl / (refl + tran);
 
-		if (Sample1D(rng) < fr)
+		if (Sample1D(rng) < pr)
 		{
 			Vec3f wi(-wo.x, -wo.y, wo.z);
-			return BSDFSample(wi, AtRGB(fr), fr, AI_RAY_SPECULAR_REFLECT);
+			return BSDFSample(wi, AtRGB(refl), pr, AI_RAY_SPECULAR_REFLECT);
 		}
 		else
 		{
@@ -213,65 +208,120 @@ BSDFSample DielectricBSDF::Sample(Vec3f wo, bool adjoint, BSDFFlag flag, RandomE
 				return BSDFInvalidSample;
 
 			float factor = adjoint ? 1.f : Sqr(1.0f / eta);
-			return BSDFSample(wi, AtRGB(factor * (1.f - fr)), 1.f - fr, AI_RAY_SPECULAR_TRANSMIT, eta);
+			return BSDFSample(wi, AtRGB(factor * tran), 1.f - pr, AI_RAY_SPECULAR_TRANSMIT, eta);
 		}
 	}
 	else
 	{
-		Vec3f wh = GTR2Sample(wo, Sample2D(rng), alpha);
-		if (wh.z < 0)
-			wh = -wh;
+		Vec3f wm = GTR2SampleVisibleCap(wo, Sample2D(rng), alpha);
+		float pdfWm = GTR2VisibleSmith(wm, wo, alpha);
+
+		float fr = Fresnel(Dot(wo, wm));
+		float refl = flag.refl ? fr : 0;
+		float tran = flag.tran ? 1.f - fr : 0;
+		if (refl + tran == 0)
+			return BSDFInvalidSample;
 
-		float refl = flag.refl ? FresnelDielectric(Dot(wh, wo), ior) : 0;
-		float tran = flag.tran ? 1.f - refl : 0;
-		float fr = refl / (refl + tran);
+		float pr = refl / (refl + tran);
 
-		if (Sample1D(rng) < fr)
+		if (Sample1D(rng) < pr)
 		{
-			Vec3f wi = -AiReflect(wo, wh);
+			Vec3f wi = -AiReflect(wo, wm);
 			if (!SameHemisphere(wo, wi))
 				return BSDFInvalidSample;
 
-			float p = GTR2(wh.z, alpha) / (4.f * AbsDot(wh, wo));
-			float whCosWo = AbsDot(wh, wo);
-			float whCosWi = AbsDot(wh, wi);
-
-			float r = (whCosWo * whCosWi < 1e-7f) ? 0.f :
-				GTR2(wh.z, alpha) * SmithG(wo.z, wi.z, alpha) / (4.0f * whCosWo * whCosWi);
-
-			if (isnan(p))
-				p = 0;
-			return BSDFSample(wi, AtRGB(r * fr), p * fr, AI_RAY_DIFFUSE_REFLECT);
+			float p = pdfWm / (4.f * AbsDot(wo, wm)) * pr;
+			float r = GTR2(wm.z, alpha) * SmithGCorrelated(wo.z, wi.z, alpha) * refl / std::abs(4.f * wi.z * wo.z) *
+				Compensation(wo.z, wi.z);
+			return BSDFSample(wi, AtRGB(r), p, AI_RAY_DIFFUSE_REFLECT);
 		}
 		else
 		{
-			float eta = (Dot(wh, wo) > 0.0f) ? ior : 1.0f / ior;
+			float etap = (wo.z > 0.0f) ? ior : 1.0f / ior;
 
 			Vec3f wi;
-			bool refr = Refract(wi, wh, wo, ior);
-			if (!refr || SameHemisphere(wo, wi) || std::abs(wi.z) < 1e-10f)
+			bool refr = Refract(wi, wm, wo, ior);
+			if (!refr || SameHemisphere(wo, wi) || wi.z == 0)
 				return BSDFInvalidSample;
 
-			float whCosWo = AbsDot(wh, wo);
-			float whCosWi = AbsDot(wh, wi);
+			float denom = Sqr(Dot(wi, wm) + Dot(wo, wm) / etap);
+			float dWmdWi = AbsDot(wi, wm) / denom;
+			float factor = adjoint ? 1.f : Sqr(1.0f / etap);
 
-			float sqrtDenom = Dot(wh, wo) + eta * Dot(wh, wi);
-			float denom = sqrtDenom * sqrtDenom;
-			float dHdWi = whCosWi / denom;
-			float factor = adjoint ? 1.f : Sqr(1.0f / eta);
+			float p = pdfWm * dWmdWi * (1.f - pr);
+			float r = GTR2(wm.z, alpha) * SmithGCorrelated(wo.z, wi.z, alpha) * tran *
+				std::abs(Dot(wi, wm) * Dot(wo, wm) / (wi.z * wo.z * denom)) * factor * Compensation(wo.z, wi.z);
+			return BSDFSample(wi, AtRGB(r), p, AI_RAY_DIFFUSE_TRANSMIT, etap);
+		}
+	}
+}
 
-			denom *= std::abs(wi.z) * std::abs(wo.z);
+float DielectricBSDF::Fresnel(float cosTheta) const
+{
+	return fresnel ? fresnel->Eval(cosTheta).r : FresnelDielectric(cosTheta, ior);
+}
 
-			float r = (denom < 1e-7f) ? 0.f :
-				std::abs(GTR2(wh.z, alpha) * SmithG(wo.z, wi.z, alpha) * whCosWo * whCosWi) / denom * factor;
+float DielectricBSDF::Compensation(float cosWo, float cosWi) const
+{
+	if (!multiScatter || ApproxDelta())
+		return 1.f;
+	float eo = AiMax(DielectricAlbedo(cosWo, alpha, ior), .1f);
+	float ei = AiMax(DielectricAlbedo(cosWi, alpha, ior), .1f);
+	return 1.f / AiMax(eo, ei);
+}
 
-			float p = GTR2(wh.z, alpha) * dHdWi;
+AtRGB MetalBSDF::Fresnel(float cosTheta) const
+{
+	if (SchlickFresnel)
+		return FresnelSchlick(cosTheta, albedo, Sqrt(alpha));
+	return fresnel ? fresnel->Eval(cosTheta) : FresnelConductor(cosTheta, ior, k);
+}
 
-			if (isnan(p))
-				p = 0.0f;
-			return BSDFSample(wi, AtRGB(r * (1.f - fr)), p * (1.f - fr), AI_RAY_DIFFUSE_TRANSMIT, eta);
-		}
+AtRGB MetalBSDF::FresnelAverage() const
+{
+	if (SchlickFresnel)
+	{
+		// closed form of 2 integral of F(mu) mu for the Schlick curve used above
+		AtRGB f90 = Max(AtRGB(1.f - Sqrt(alpha)), albedo);
+		return albedo + (f90 - albedo) / 21.f;
 	}
+	if (fresnel)
+		return fresnel->average;
+
+	AtRGB sum(0.f);
+	const int n = 16;
+	for (int i = 0; i < n; i++)
+	{
+		float mu = (i + .5f) / n;
+		sum += FresnelConductor(mu, ior, k) * mu;
+	}
+	return sum * (2.f / n);
+}
+
+float MetalBSDF::G(float cosWo, float cosWi) const
+{
+	return multiScatter ? SmithGCorrelated(cosWo, cosWi, alpha) : SmithG(cosWo, cosWi, alpha);
+}
+
+AtRGB MetalBSDF::MultiScatterScale() const
+{
+	float eAvg = ConductorAverageAlbedo(alpha);
+	if (eAvg > .9999f)
+		return AtRGB(0.f);
+
+	AtRGB fAvg = FresnelAverage();
+	AtRGB fms = fAvg * fAvg * eAvg / (AtRGB(1.f) - fAvg * (1.f - eAvg));
+	return albedo * fms / (AI_PI * (1.f - eAvg));
+}
+
+AtRGB MetalBSDF::MultiScatterF(float cosWo, float cosWi) const
+{
+	return MultiScatterScale() * (1.f - ConductorAlbedo(cosWo, alpha)) * (1.f - ConductorAlbedo(cosWi, alpha));
+}
+
+float MetalBSDF::MultiScatterProb(float cosWo) const
+{
+	return multiScatter ? 1.f - ConductorAlbedo(cosWo, alpha) : 0;
 }
 
 AtRGB MetalBSDF::F(Vec3f wo, Vec3f wi) const
@@ -286,10 +336,12 @@ AtRGB MetalBSDF::F(Vec3f wo, Vec3f wi) const
 		return AtRGB(0.f);
 
 	Vec3f wh = Normalize(wo + wi);
-	AtRGB fr = SchlickFresnel ? FresnelSchlick(AbsDot(wh, wo), albedo, Sqrt(alpha)) :
-		AtRGB(FresnelConductor(AbsDot(wh, wo), ior, k));
+	AtRGB fr = Fresnel(AbsDot(wh, wo));
+	AtRGB f = albedo * GTR2(wh.z, alpha) * fr * G(wo.z, wi.z) / (4.f * cosWo * cosWi);
 
-	return albedo * GTR2(wh.z, alpha) * fr * SmithG(wo.z, wi.z, alpha) / (4.f * cosWo * cosWi);
+	if (multiScatter)
+		f += MultiScatterF(cosWo, cosWi);
+	return f;
 }
 
 float MetalBSDF::PDF(Vec3f wo, Vec3f wi) const
@@ -298,7 +350,9 @@ float MetalBSDF::PDF(Vec3f wo, Vec3f wi) const
 		return 0;
 
 	Vec3f wh = Normalize(wo + wi);
-	return GTR2Visible(wh, wo, alpha) / (4.f * AbsDot(wh, wo));
+	float pMs = MultiScatterProb(std::abs(wo.z));
+	float spec = GTR2VisibleSmith(wh, wo, alpha) / (4.f * AbsDot(wh, wo));
+	return spec * (1.f - pMs) + std::abs(wi.z) * AI_ONEOVERPI * pMs;
 }
 
 BSDFSample MetalBSDF::Sample(Vec3f wo, RandomEngine& rng) const
@@ -306,13 +360,22 @@ BSDFSample MetalBSDF::Sample(Vec3f wo, RandomEngine& rng) const
 	if (ApproxDelta())
 	{
 		Vec3f wi(-wo.x, -wo.y, wo.z);
-		float fr = FresnelConductor(std::abs(wo.z), ior, k);
-		return BSDFSample(wi, albedo * fr, 1.f, AI_RAY_SPECULAR_REFLECT);
+		return BSDFSample(wi, albedo * Fresnel(std::abs(wo.z)), 1.f, AI_RAY_SPECULAR_REFLECT);
 	}
 	else
 	{
-		Vec3f wh = GTR2SampleVisible(wo, Sample2D(rng), alpha);
-		Vec3f wi = AiReflect(-wo, wh);
+		Vec3f wi;
+		if (Sample1D(rng) < MultiScatterProb(std::abs(wo.z)))
+		{
+			Vec2f d = ToConcentricDisk(Sample2D(rng));
+			float z = Sqrt(AiMax(1.f - Dot(d, d), 0.f));
+			wi = Vec3f(d.x, d.y, (wo.z < 0) ? -z : z);
+		}
+		else
+		{
+			Vec3f wh = GTR2SampleVisibleCap(wo, Sample2D(rng), alpha);
+			wi = -AiReflect(wo, wh);
+		}
 
 		if (!SameHemisphere(wo, wi))
 			return BSDFInvalidSample;
@@ -321,152 +384,153 @@ BSDFSample MetalBSDF::Sample(Vec3f wo, RandomEngine& rng) const
 	}
 }
 
-AtRGB LayeredBSDF::F(Vec3f wo, Vec3f wi, const BSDFState& s, RandomEngine& rng, bool adjoint) const
+void LayeredBSDF::Bind(BSDFState& s) const
 {
-	if (twoSided && wo.z < 0)
-	{
-		wo = -wo;
-		wi = -wi;
-	}
-	bool entTop = twoSided || wo.z > 0;
-	BSDF* ent = entTop ? s.top : s.bottom;
-	BSDF* oth = entTop ? s.bottom : s.top;
-	BSDF* ext = SameHemisphere(wo, wi) ? ent : oth;
+	if (program && s.medium != medium)
+		program->Bind(s, medium);
+}
 
-	Vec3f entNorm = entTop ? s.nTop : s.nBottom;
-	Vec3f othNorm = entTop ? s.nBottom : s.nTop;
-	Vec3f extNorm = (ent == ext) ? entNorm : othNorm;
+float LayeredBSDF::Phase(Vec3f wo, Vec3f wi) const
+{
+	return phaseTable ? phaseTable->Eval(-Dot(wo, wi)) : HGPhasePDF(wo, wi, g);
+}
 
-	float zEnt = entTop ? 0 : thickness;
-	float zExt = (ext == ent) ? zEnt : thickness - zEnt;
+PhaseSample LayeredBSDF::SamplePhase(Vec3f wo, Vec2f u) const
+{
+	if (!phaseTable)
+		return HGPhaseSample(wo, g, u, fastMath);
 
-	AtRGB f(0.f);
+	// the table is over the scattering angle, wo points back along the incoming direction
+	float cosTheta = -phaseTable->Sample(u.x);
+	float sinTheta = Sqrt(1.f - cosTheta * cosTheta);
+	float sinPhi, cosPhi;
 
-	if (SameHemisphere(wo, wi))
-		f += ::F(ent, entNorm, wo, wi, s, rng, adjoint) * float(nSamples);
+	if (fastMath)
+		FastSinCos(AI_PI * 2.f * u.y, sinPhi, cosPhi);
+	else
+		sinPhi = std::sin(AI_PI * 2.f * u.y), cosPhi = std::cos(AI_PI * 2.f * u.y);
 
-	for (int i = 0; i < nSamples; i++)
+	return PhaseSample(AroundAxis(wo, cosTheta, sinTheta, cosPhi, sinPhi), phaseTable->Eval(-cosTheta));
+}
+
+float LayeredBSDF::Roughness(const BSDFState& state) const
+{
+	if (!IsSmall(albedo))
+		return 1.f;
+
+	BSDFState s = state;
+	Bind(s);
+	return AiMax(::Roughness(s.top, s), ::Roughness(s.bottom, s));
+}
+
+float LayeredBSDF::MaxAlbedo(const BSDFState& state) const
+{
+	BSDFState s = state;
+	Bind(s);
+	float medium = AiMax(albedo.r, AiMax(albedo.g, albedo.b));
+	return AiMax(medium, AiMax(::MaxAlbedo(s.top, s), ::MaxAlbedo(s.bottom, s)));
+}
+
+AtRGB LayeredBSDF::ClampWeight(AtRGB weight, const BSDFState& s) const
+{
+	if (estimator != LayeredEstimator::Clamp)
+		return weight;
+
+	// a lobe sampled in proportion to f cos has weights of its albedo, much larger ones come from
+	// the walk's F and PDF estimates missing each other
+	float bound = clampScale * MaxAlbedo(s);
+	float m = AiMax(weight.r, AiMax(weight.g, weight.b));
+	if (m <= bound)
+		return weight;
+
+	if (stats)
+		stats->clamped.fetch_add(1, std::memory_order_relaxed);
+	return weight * (bound / m);
+}
+
+// summed contribution of count walks
+static AtRGB RunWalks(const LayeredEvalSetup& e, BSDFState& s, RandomEngine& rng, int count, float parentThroughput)
+{
+	if (count == 1)
 	{
-		auto wos = ::Sample(ent, entNorm, wo, s, rng, adjoint, BSDFFlagTransmission);
+		LayeredWalk walk;
+		walk.parentThroughput = parentThroughput;
 
-		if (wos.IsInvalid() || IsSmall(wos.f) || wos.pdf < 1e-8f || wos.wi.z == 0)
-			continue;
-		
-		auto wis = ::Sample(ext, extNorm, wi, s, rng, !adjoint, BSDFFlagTransmission);
+		if (!walk.Start(e, s, rng))
+			return AtRGB(0.f);
+		while (walk.Advance(e, s, rng));
+		return walk.f;
+	}
 
-		if (wis.IsInvalid() || IsSmall(wis.f) || wis.pdf < 1e-8f || wis.wi.z == 0)
-			continue;
+	AtRGB f(0.f);
+	for (int i = 0; i < count; i += PacketWidth)
+	{
+		LayeredWalkPacket packet;
+		f += packet.Run(e, s, rng, Min(PacketWidth, count - i), parentThroughput);
+	}
+	return f;
+}
 
-		AtRGB throughput = wos.f / wos.pdf * (::IsDeltaRay(wos.type) ? 1.f : Abs(wos.wi.z));
-		float z = entTop ? 0 : thickness;
-		Vec3f w = wos.wi;
+AtRGB LayeredBSDF::MedianOfMeans(const AtRGB* groupSums) const
+{
+	AtRGB means[MedianGroups];
+	AtRGB sum(0.f);
 
-		for (int depth = 1; depth <= maxDepth; depth++)
-		{
-			if (depth > 4 && Luminance(throughput) < .25f)
-			{
-				float rr = AiMax(0.f, 1.f - Luminance(throughput));
-				if (Sample1D(rng) < rr)
-					break;
-				throughput /= (1.f - rr);
-			}
+	for (int i = 0; i < MedianGroups; i++)
+	{
+		int count = MedianGroupBegin(nSamples, i + 1) - MedianGroupBegin(nSamples, i);
+		means[i] = groupSums[i] / float(count);
+		sum += groupSums[i];
+	}
 
-			if (IsSmall(albedo))
-			{
-				z = (z == thickness) ? 0 : thickness;
-				throughput *= Transmittance(thickness, w);
-			}
-			else
-			{
-				float sigT = 1.f;
-				float dz = SampleExponential(sigT / Abs(w.z), Sample1D(rng));
+	std::sort(means, means + MedianGroups, [](AtRGB a, AtRGB b) { return Luminance(a) < Luminance(b); });
+	AtRGB median = means[MedianGroups / 2];
 
-				if (dz == 0)
-					continue;
-				
-				float zNext = (w.z > 0) ? z - dz : z + dz;
+	if (stats && Luminance(sum) > 2.f * Luminance(median) * nSamples)
+		stats->outliers.fetch_add(1, std::memory_order_relaxed);
+	return median;
+}
 
-				if (zNext < thickness && zNext > 0)
-				{
-					float weight = 1.f;
-					if (!::IsDelta(ext))
-						weight = PowerHeuristic(wis.pdf, HGPhasePDF(-w, -wis.wi, g));
-					
-					f += wis.f / wis.pdf * Transmittance(zNext, zExt, wis.wi) * albedo *
-						HGPhaseFunction(Dot(-w, -wis.wi), g) * weight * throughput;
-
-					auto phaseSample = HGPhaseSample(-w, g, Sample2D(rng));
-
-					if (phaseSample.pdf == 0 || phaseSample.wi.z == 0)
-						continue;
-					
-					throughput *= albedo * phaseSample.p / phaseSample.pdf;
-					w = phaseSample.wi;
-					z = zNext;
-
-					if (((z > zExt && w.z > 0) || (z < zExt && w.z < 0)) && !::IsDelta(ext)) {
-						AtRGB fExt = ::F(ext, extNorm, -w, wi, s, rng, adjoint);
-
-						if (!IsSmall(fExt))
-						{
-							float pExt = ::PDF(ext, extNorm, -w, wi, s, rng, adjoint, BSDFFlagTransmission);
-							float weight = PowerHeuristic(phaseSample.pdf, pExt);
-							f += fExt * Transmittance(zNext, zExt, phaseSample.wi) * weight * throughput;
-						}
-					}
-					continue;
-				}
-				z = AiClamp(zNext, 0.f, thickness);
-			}
+AtRGB LayeredBSDF::F(Vec3f wo, Vec3f wi, const BSDFState& state, RandomEngine& rng, bool adjoint) const
+{
+	if (baked)
+		return baked->F(wo, wi);
+	if (UsesClosedForm(state))
+		return ClosedFormF(wo, wi, state, rng, adjoint);
 
-			if (z == zExt)
-			{
-				auto es = ::Sample(ext, extNorm, -w, s, rng, adjoint, BSDFFlagReflection);
-				if (es.IsInvalid() || IsSmall(es.f) || es.pdf < 1e-8f || es.wi.z == 0)
-					break;
-				throughput *= es.f / es.pdf * (::IsDeltaRay(es.type) ? 1.f : Abs(es.wi.z));
-				w = es.wi;
-			}
-			else
-			{
-				if (!::IsDelta(oth))
-				{
-					float weight = 1.f;
-					if (!::IsDelta(ext))
-						weight = PowerHeuristic(wis.pdf, ::PDF(oth, othNorm, -w, -wis.wi, s, rng, adjoint));
+	BSDFState s = state;
+	Bind(s);
+	WalkBudgetScope budget(s, maxDepth * nSamples);
 
-					f += ::F(oth, othNorm, -w, -wis.wi, s, rng, adjoint) * Abs(wis.wi.z) *
-						Transmittance(thickness, wis.wi) * wis.f / wis.pdf * throughput * weight;
-				}
+	LayeredEvalSetup e(*this, s, wo, wi, adjoint);
+	AtRGB f(0.f);
 
-				auto os = ::Sample(oth, othNorm, -w, s, rng, adjoint, BSDFFlagReflection);
-				if (os.IsInvalid() || IsSmall(os.f) || os.pdf < 1e-8f || os.wi.z == 0)
-					break;
-				
-				throughput *= os.f / os.pdf * (::IsDeltaRay(os.type) ? 1.f : Abs(os.wi.z));
-				w = os.wi;
+	if (e.extIsEnt && !splitCoat)
+		f += ::F(e.ent, e.entNorm, e.wo, e.wi, s, rng, adjoint);
 
-				if (!::IsDelta(ext))
-				{
-					AtRGB fExt = ::F(ext, extNorm, -w, wi, s, rng, adjoint);
-					if (!IsSmall(fExt)) {
-						float weight = 1.f;
-						if (!::IsDelta(oth))
-						{
-							float pExt = ::PDF(ext, extNorm, -w, wi, s, rng, adjoint, BSDFFlagTransmission);
-							weight = PowerHeuristic(os.pdf, pExt);
-						}
-						f += fExt * Transmittance(thickness, os.wi) * weight * throughput;
-					}
-				}
-			}
-		}
+	if (estimator == LayeredEstimator::MedianOfMeans && nSamples >= MedianGroups)
+	{
+		AtRGB groupSums[MedianGroups];
+		for (int i = 0; i < MedianGroups; i++)
+			groupSums[i] = RunWalks(e, s, rng, MedianGroupBegin(nSamples, i + 1) - MedianGroupBegin(nSamples, i),
+				budget.parentThroughput);
+		return f + MedianOfMeans(groupSums);
 	}
-	return f / float(nSamples);
+
+	return f + RunWalks(e, s, rng, nSamples, budget.parentThroughput) / float(nSamples);
 }
 
-float LayeredBSDF::PDF(Vec3f wo, Vec3f wi, const BSDFState& s, RandomEngine& rng, bool adjoint) const
+float LayeredBSDF::PDF(Vec3f wo, Vec3f wi, const BSDFState& state, RandomEngine& rng, bool adjoint) const
 {
+	if (baked)
+		return baked->PDF(wo, wi);
+	if (UsesClosedForm(state))
+		return ClosedFormPDF(wo, wi, state, rng, adjoint);
+
+	BSDFState s = state;
+	Bind(s);
+	WalkBudgetScope budget(s, maxDepth * nSamples);
+
 	if (twoSided && wo.z < 0)
 	{
 		wo = -wo;
@@ -476,7 +540,7 @@ float LayeredBSDF::PDF(Vec3f wo, Vec3f wi, const BSDFState& s, RandomEngine& rng
 
 	float pdfSum = 0.f;
 
-	if (SameHemisphere(wo, wi))
+	if (SameHemisphere(wo, wi) && !splitCoat)
 		pdfSum += (entTop ? ::PDF(s.top, s.nTop, wo, wi, s, rng, adjoint, BSDFFlagReflection) :
 			::PDF(s.bottom, s.nBottom, wo, wi, s, rng, adjoint, BSDFFlagReflection)) * nSamples;
 
@@ -484,8 +548,10 @@ float LayeredBSDF::PDF(Vec3f wo, Vec3f wi, const BSDFState& s, RandomEngine& rng
 	{
 		if (SameHemisphere(wo, wi))
 		{
-			BSDF* tBSDF = entTop ? s.top : s.bottom;
-			BSDF* rBSDF = entTop ? s.bottom : s.top;
+			const BSDF* tBSDF = entTop ? s.top : s.bottom;
+			const BSDF* rBSDF = entTop ? s.bottom : s.top;
+			bool tDelta = entTop ? s.topDelta : s.bottomDelta;
+			bool rDelta = entTop ? s.bottomDelta : s.topDelta;
 
 			Vec3f tNorm = entTop ? s.nTop : s.nBottom;
 			Vec3f rNorm = entTop ? s.nBottom : s.nTop;
@@ -496,14 +562,14 @@ float LayeredBSDF::PDF(Vec3f wo, Vec3f wi, const BSDFState& s, RandomEngine& rng
 			if (!wos.IsInvalid() && !IsSmall(wos.f) && wos.pdf > 1e-8f &&
 				!wis.IsInvalid() && !IsSmall(wis.f) && wis.pdf > 1e-8f)
 			{
-				if (::IsDelta(tBSDF))
+				if (tDelta)
 					pdfSum += ::PDF(rBSDF, rNorm, -wos.wi, wis.wi, s, rng, adjoint);
 				else
 				{
 					auto rs = ::Sample(rBSDF, rNorm, -wos.wi, s, rng, adjoint);
 					if (!rs.IsInvalid() && !IsSmall(rs.f) && rs.pdf > 1e-8f)
 					{
-						if (::IsDelta(rBSDF)) {
+						if (rDelta) {
 							pdfSum += ::PDF(tBSDF, tNorm, -rs.wi, wi, s, rng, adjoint);
 						}
 						else {
@@ -519,8 +585,10 @@ float LayeredBSDF::PDF(Vec3f wo, Vec3f wi, const BSDFState& s, RandomEngine& rng
 		}
 		else
 		{
-			BSDF* oBSDF = entTop ? s.top : s.bottom;
-			BSDF* iBSDF = entTop ? s.bottom : s.top;
+			const BSDF* oBSDF = entTop ? s.top : s.bottom;
+			const BSDF* iBSDF = entTop ? s.bottom : s.top;
+			bool oDelta = entTop ? s.topDelta : s.bottomDelta;
+			bool iDelta = entTop ? s.bottomDelta : s.topDelta;
 
 			Vec3f oNorm = entTop ? s.nTop : s.nBottom;
 			Vec3f iNorm = entTop ? s.nBottom : s.nTop;
@@ -537,9 +605,9 @@ float LayeredBSDF::PDF(Vec3f wo, Vec3f wi, const BSDFState& s, RandomEngine& rng
 				!IsTransmitRay(wis.type))
 				continue;
 
-			if (::IsDelta(oBSDF))
+			if (oDelta)
 				pdfSum += ::PDF(iBSDF, iNorm, -wos.wi, wi, s, rng, adjoint);
-			else if (::IsDelta(iBSDF))
+			else if (iDelta)
 				pdfSum += ::PDF(oBSDF, oNorm, wo, -wis.wi, s, rng, adjoint);
 			else
 			{
@@ -551,13 +619,21 @@ float LayeredBSDF::PDF(Vec3f wo, Vec3f wi, const BSDFState& s, RandomEngine& rng
 	return AiLerp(.25f * AI_ONEOVERPI, pdfSum / nSamples, .9f);
 }
 
-BSDFSample LayeredBSDF::Sample(Vec3f wo, const BSDFState& s, RandomEngine& rng, bool adjoint) const
+BSDFSample LayeredBSDF::Sample(Vec3f wo, const BSDFState& state, RandomEngine& rng, bool adjoint) const
 {
-	bool entTop = wo.z > 0;
-	BSDF* ent = entTop ? s.top : s.bottom;
-	BSDF* oth = entTop ? s.bottom : s.top;
+	if (baked)
+		return baked->Sample(wo, rng);
+	if (UsesClosedForm(state))
+		return ClosedFormSample(wo, state, rng, adjoint);
+
+	BSDFState s = state;
+	Bind(s);
+	WalkBudgetScope budget(s, maxDepth);
 
-	auto ins = ::Sample(ent, entTop ? s.nTop : s.nBottom, wo, s, rng, adjoint);
+	bool entTop = wo.z > 0;
+	const BSDF* ent = entTop ? s.top : s.bottom;
+	auto ins = ::Sample(ent, entTop ? s.nTop : s.nBottom, wo, s, rng, adjoint,
+		splitCoat ? BSDFFlagTransmission : BSDFFlagAll);
 
 	if (ins.IsInvalid() || ins.pdf < 1e-8f || ins.wi.z == 0 || IsSmall(ins.f))
 		return BSDFInvalidSample;
@@ -573,13 +649,19 @@ BSDFSample LayeredBSDF::Sample(Vec3f wo, const BSDFState& s, RandomEngine& rng,
 
 	for (int depth = 1; depth <= maxDepth; depth++)
 	{
+		float survival;
+		if (!budget.Continue(Sample1D(rng), f / pdf, survival))
+			return BSDFInvalidSample;
+		pdf *= survival;
+
 		if (depth > 3)
 		{
-			float rr = AiMax(0.f, 1.f - Luminance(f) / pdf);
+			float rr = AiMax(0.f, 1.f - budget.PathLuminance(f / pdf));
 			if (Sample1D(rng) < rr)
 				return BSDFInvalidSample;
 			pdf *= 1.f - rr;
 		}
+		budget.Enter(f / pdf);
 
 		if (w.z == 0)
 			return BSDFInvalidSample;
@@ -587,12 +669,12 @@ BSDFSample LayeredBSDF::Sample(Vec3f wo, const BSDFState& s, RandomEngine& rng,
 		if (IsSmall(albedo))
 		{
 			z = (z == thickness) ? 0 : thickness;
-			f *= Transmittance(thickness, w);
+			f *= Transmittance(thickness, w, fastMath);
 		}
 		else
 		{
 			float sigT = 1.f;
-			float dz = SampleExponential(sigT / Abs(w.z), Sample1D(rng));
+			float dz = SampleExponential(sigT / Abs(w.z), Sample1D(rng), fastMath);
 
 			if (dz == 0)
 				continue;
@@ -601,7 +683,7 @@ BSDFSample LayeredBSDF::Sample(Vec3f wo, const BSDFState& s, RandomEngine& rng,
 
 			if (zNext < thickness && zNext > 0)
 			{
-				auto phaseSample = HGPhaseSample(-w, g, Sample2D(rng));
+				auto phaseSample = SamplePhase(-w, Sample2D(rng));
 
 				if (phaseSample.pdf == 0 || phaseSample.wi.z == 0)
 					return BSDFInvalidSample;
@@ -615,7 +697,7 @@ BSDFSample LayeredBSDF::Sample(Vec3f wo, const BSDFState& s, RandomEngine& rng,
 			}
 			z = AiClamp(zNext, 0.f, thickness);
 		}
-		BSDF* interf = (z == 0) ? s.top : s.bottom;
+		const BSDF* interf = (z == 0) ? s.top : s.bottom;
 		auto bsdfSample = ::Sample(interf, (z == 0) ? s.nTop : s.nBottom, -w, s, rng, adjoint);
 
 		if (bsdfSample.IsInvalid() || IsSmall(bsdfSample.f) || bsdfSample.pdf < 1e-8f ||
@@ -644,6 +726,237 @@ BSDFSample LayeredBSDF::Sample(Vec3f wo, const BSDFState& s, RandomEngine& rng,
 	return BSDFInvalidSample;
 }
 
+// entrance interface for wo and its normal, with wo and wi flipped like the walk's for a two sided
+// stack hit from below
+static const BSDF* CoatEntrance(bool twoSided, const BSDFState& s, Vec3f& wo, Vec3f& wi, Vec3f& n)
+{
+	if (twoSided && wo.z < 0)
+	{
+		wo = -wo;
+		wi = -wi;
+	}
+	bool entTop = twoSided || wo.z > 0;
+	n = entTop ? s.nTop : s.nBottom;
+	return entTop ? s.top : s.bottom;
+}
+
+AtRGB CoatBSDF::F(Vec3f wo, Vec3f wi, const BSDFState& s, RandomEngine& rng) const
+{
+	Vec3f n;
+	const BSDF* ent = CoatEntrance(twoSided, s, wo, wi, n);
+	return SameHemisphere(wo, wi) ? ::F(ent, n, wo, wi, s, rng, false) : AtRGB(0.f);
+}
+
+float CoatBSDF::PDF(Vec3f wo, Vec3f wi, const BSDFState& s, RandomEngine& rng) const
+{
+	Vec3f n;
+	const BSDF* ent = CoatEntrance(twoSided, s, wo, wi, n);
+	return SameHemisphere(wo, wi) ? ::PDF(ent, n, wo, wi, s, rng, false, BSDFFlagReflection) : 0.f;
+}
+
+BSDFSample CoatBSDF::Sample(Vec3f wo, const BSDFState& s, RandomEngine& rng) const
+{
+	Vec3f n, wi;
+	bool flip = twoSided && wo.z < 0;
+	const BSDF* ent = CoatEntrance(twoSided, s, wo, wi, n);
+
+	auto sample = ::Sample(ent, n, wo, s, rng, false, BSDFFlagReflection);
+	if (sample.IsInvalid() || !SameHemisphere(wo, sample.wi))
+		return BSDFInvalidSample;
+
+	if (flip)
+		sample.wi = -sample.wi;
+	return sample;
+}
+
+float CoatBSDF::Roughness(Vec3f wo, const BSDFState& s) const
+{
+	Vec3f wi, n;
+	return ::Roughness(CoatEntrance(twoSided, s, wo, wi, n), s);
+}
+
+static Vec3f MirrorThroughSurface(Vec3f w)
+{
+	return Vec3f(w.x, w.y, -w.z);
+}
+
+float FittedBSDF::LobeF(int lobe, float alpha, Vec3f wo, Vec3f wi)
+{
+	bool refl = wi.z > 0;
+
+	switch (lobe)
+	{
+	case DiffuseReflect:
+		return refl ? AI_ONEOVERPI : 0.f;
+	case DiffuseTransmit:
+		return refl ? 0.f : AI_ONEOVERPI;
+	case GlossyReflect0:
+	case GlossyReflect1:
+	case GlossyTransmit:
+	{
+		if (refl != (lobe != GlossyTransmit))
+			return 0.f;
+		if (!refl)
+			wi = MirrorThroughSurface(wi);
+
+		float cosWo = wo.z, cosWi = wi.z;
+		if (cosWo * cosWi < 1e-7f)
+			return 0.f;
+
+		Vec3f wh = Normalize(wo + wi);
+		return GTR2(wh.z, alpha) * SmithGCorrelated(cosWo, cosWi, alpha) / (4.f * cosWo * cosWi);
+	}
+	default:
+		return 0.f;
+	}
+}
+
+float FittedBSDF::LobePDF(int lobe, float alpha, Vec3f wo, Vec3f wi)
+{
+	bool refl = wi.z > 0;
+
+	switch (lobe)
+	{
+	case DiffuseReflect:
+		return refl ? wi.z * AI_ONEOVERPI : 0.f;
+	case DiffuseTransmit:
+		return refl ? 0.f : -wi.z * AI_ONEOVERPI;
+	case GlossyReflect0:
+	case GlossyReflect1:
+	case GlossyTransmit:
+	{
+		if (refl != (lobe != GlossyTransmit))
+			return 0.f;
+		if (!refl)
+			wi = MirrorThroughSurface(wi);
+
+		Vec3f wh = Normalize(wo + wi);
+		return GTR2VisibleSmith(wh, wo, alpha) / (4.f * AbsDot(wh, wo));
+	}
+	default:
+		return 0.f;
+	}
+}
+
+float FittedBSDF::LobeAlpha(int side, int lobe) const
+{
+	return (lobe >= GlossyReflect0 && lobe <= GlossyTransmit) ? alpha[side][lobe - GlossyReflect0] : 0.f;
+}
+
+float FittedBSDF::Roughness(Vec3f wo) const
+{
+	int side = wo.z < 0;
+	return AiMin(alpha[side][GlossyReflect0 - GlossyReflect0], alpha[side][GlossyReflect1 - GlossyReflect0]);
+}
+
+void FittedBSDF::LobeWeights(int side, float cosWo, AtRGB* w, float* prob) const
+{
+	float x = AiClamp(cosWo * Bins - .5f, 0.f, float(Bins - 1));
+	int i = AiMin(int(x), Bins - 2);
+	float t = x - float(i);
+
+	float sum = 0;
+	for (int lobe = 0; lobe < NumLobes; lobe++)
+	{
+		w[lobe] = weights[side][i][lobe] * (1.f - t) + weights[side][i + 1][lobe] * t;
+
+		// glossy lobes lose energy at grazing angles, weighting by their albedo spends fewer samples there
+		float albedo = (lobe >= GlossyReflect0 && lobe <= GlossyTransmit) ?
+			ConductorAlbedo(cosWo, LobeAlpha(side, lobe)) : 1.f;
+		prob[lobe] = AiMax(Luminance(w[lobe]), 0.f) * albedo;
+		sum += prob[lobe];
+	}
+
+	for (int lobe = 0; lobe < NumLobes; lobe++)
+		prob[lobe] = (sum > 0) ? prob[lobe] / sum : 0.f;
+}
+
+AtRGB FittedBSDF::F(Vec3f wo, Vec3f wi) const
+{
+	int side = wo.z < 0;
+	if (side)
+	{
+		wo = -wo;
+		wi = -wi;
+	}
+
+	AtRGB w[NumLobes];
+	float prob[NumLobes];
+	LobeWeights(side, wo.z, w, prob);
+
+	AtRGB f(0.f);
+	for (int lobe = 0; lobe < DeltaReflect; lobe++)
+		f += w[lobe] * LobeF(lobe, LobeAlpha(side, lobe), wo, wi);
+	return f;
+}
+
+float FittedBSDF::PDF(Vec3f wo, Vec3f wi) const
+{
+	int side = wo.z < 0;
+	if (side)
+	{
+		wo = -wo;
+		wi = -wi;
+	}
+
+	AtRGB w[NumLobes];
+	float prob[NumLobes];
+	LobeWeights(side, wo.z, w, prob);
+
+	float pdf = 0;
+	for (int lobe = 0; lobe < DeltaReflect; lobe++)
+		pdf += prob[lobe] * LobePDF(lobe, LobeAlpha(side, lobe), wo, wi);
+	return pdf;
+}
+
+BSDFSample FittedBSDF::Sample(Vec3f wo, RandomEngine& rng) const
+{
+	int side = wo.z < 0;
+	float flip = side ? -1.f : 1.f;
+	Vec3f woUp = wo * flip;
+
+	AtRGB w[NumLobes];
+	float prob[NumLobes];
+	LobeWeights(side, woUp.z, w, prob);
+
+	float u = Sample1D(rng);
+	int lobe = 0;
+	while (lobe < NumLobes - 1 && (u >= prob[lobe] || prob[lobe] == 0))
+		u -= prob[lobe++];
+
+	if (prob[lobe] == 0)
+		return BSDFInvalidSample;
+
+	if (lobe == DeltaReflect)
+	{
+		Vec3f wi(-wo.x, -wo.y, wo.z);
+		return BSDFSample(wi, w[lobe], prob[lobe], AI_RAY_SPECULAR_REFLECT);
+	}
+
+	Vec3f wi;
+	if (lobe == DiffuseReflect || lobe == DiffuseTransmit)
+	{
+		Vec2f d = ToConcentricDisk(Sample2D(rng));
+		float z = Sqrt(AiMax(1.f - Dot(d, d), 0.f));
+		wi = Vec3f(d.x, d.y, (lobe == DiffuseReflect) ? z : -z);
+	}
+	else
+	{
+		Vec3f wh = GTR2SampleVisibleCap(woUp, Sample2D(rng), LobeAlpha(side, lobe));
+		wi = -AiReflect(woUp, wh);
+		if (lobe == GlossyTransmit)
+			wi = MirrorThroughSurface(wi);
+	}
+
+	bool refl = lobe == DiffuseReflect || lobe == GlossyReflect0 || lobe == GlossyReflect1;
+	if (wi.z == 0 || refl != (wi.z > 0))
+		return BSDFInvalidSample;
+
+	wi = wi * flip;
+	int type = SameHemisphere(wo, wi) ? AI_RAY_DIFFUSE_REFLECT : AI_RAY_DIFFUSE_TRANSMIT;
+	return BSDFSample(wi, F(wo, wi), PDF(wo, wi), type);
+}
+
 AtRGB F(const BSDF* bsdf, Vec3f wo, Vec3f wi, const BSDFState& s, RandomEngine& rng, bool adjoint)
 {
 	if (std::get_if<FakeBSDF>(bsdf)) {
@@ -653,10 +966,12 @@ AtRGB F(const BSDF* bsdf, Vec3f wo, Vec3f wi, const BSDFState& s, RandomEngine&
 		return std::get_if<LambertBSDF>(bsdf)->F(wo, wi);
 	}
 	else if (std::get_if<DielectricBSDF>(bsdf)) {
-		return std::get_if<DielectricBSDF>(bsdf)->F(wo, wi, adjoint);
+		DielectricBSDF storage;
+		return Roughen(*std::get_if<DielectricBSDF>(bsdf), s, storage).F(wo, wi, adjoint);
 	}
 	else if (std::get_if<MetalBSDF>(bsdf)) {
-		return std::get_if<MetalBSDF>(bsdf)->F(wo, wi);
+		MetalBSDF storage;
+		return Roughen(*std::get_if<MetalBSDF>(bsdf), s, storage).F(wo, wi);
 	}
 	else if (std::get_if<LayeredBSDF>(bsdf)) {
 		return std::get_if<LayeredBSDF>(bsdf)->F(wo, wi, s, rng, adjoint);
@@ -673,10 +988,12 @@ float PDF(const BSDF* bsdf, Vec3f wo, Vec3f wi, const BSDFState& s, RandomEngine
 		return std::get_if<LambertBSDF>(bsdf)->PDF(wo, wi);
 	}
 	else if (std::get_if<DielectricBSDF>(bsdf)) {
-		return std::get_if<DielectricBSDF>(bsdf)->PDF(wo, wi, adjoint, flag);
+		DielectricBSDF storage;
+		return Roughen(*std::get_if<DielectricBSDF>(bsdf), s, storage).PDF(wo, wi, adjoint, flag);
 	}
 	else if (std::get_if<MetalBSDF>(bsdf)) {
-		return std::get_if<MetalBSDF>(bsdf)->PDF(wo, wi);
+		MetalBSDF storage;
+		return Roughen(*std::get_if<MetalBSDF>(bsdf), s, storage).PDF(wo, wi);
 	}
 	else if (std::get_if<LayeredBSDF>(bsdf)) {
 		return std::get_if<LayeredBSDF>(bsdf)->PDF(wo, wi, s, rng, adjoint);
@@ -686,17 +1003,20 @@ float PDF(const BSDF* bsdf, Vec3f wo, Vec3f wi, const BSDFState& s, RandomEngine
 
 BSDFSample Sample(const BSDF* bsdf, Vec3f wo, const BSDFState& s, RandomEngine& rng, bool adjoint, BSDFFlag flag)
 {
+	// interfaces with a single kind of event have nothing to sample when the flag excludes it
 	if (std::get_if<FakeBSDF>(bsdf)) {
-		return std::get_if<FakeBSDF>(bsdf)->Sample(wo);
+		return flag.tran ? std::get_if<FakeBSDF>(bsdf)->Sample(wo) : BSDFInvalidSample;
 	}
 	else if (std::get_if<LambertBSDF>(bsdf)) {
-		return std::get_if<LambertBSDF>(bsdf)->Sample(wo, rng);
+		return flag.refl ? std::get_if<LambertBSDF>(bsdf)->Sample(wo, rng) : BSDFInvalidSample;
 	}
 	else if (std::get_if<DielectricBSDF>(bsdf)) {
-		return std::get_if<DielectricBSDF>(bsdf)->Sample(wo, adjoint, flag, rng);
+		DielectricBSDF storage;
+		return Roughen(*std::get_if<DielectricBSDF>(bsdf), s, storage).Sample(wo, adjoint, flag, rng);
 	}
 	else if (std::get_if<MetalBSDF>(bsdf)) {
-		return std::get_if<MetalBSDF>(bsdf)->Sample(wo, rng);
+		MetalBSDF storage;
+		return flag.refl ? Roughen(*std::get_if<MetalBSDF>(bsdf), s, storage).Sample(wo, rng) : BSDFInvalidSample;
 	}
 	else if (std::get_if<LayeredBSDF>(bsdf)) {
 		return std::get_if<LayeredBSDF>(bsdf)->Sample(wo, s, rng, adjoint);
@@ -736,6 +1056,44 @@ BSDFSample Sample(const BSDF* bsdf, Vec3f n, Vec3f wo, const BSDFState& s, Rando
 	return sample;
 }
 
+// widest angle a lobe spreads a ray's footprint by, a diffuse bounce is already blurred at this width
+static const float MaxLobeSpread = .5f;
+
+AtVectorDv SampledDirection(const BSDFState& s, const BSDFSample& sample, float alpha)
+{
+	Vec3f wi = ToWorld(s.nf, sample.wi);
+	Vec3f dx = s.dDdx;
+	Vec3f dy = s.dDdy;
+
+	// locally flat interface: refraction scales the tangential change by the relative ior
+	if (IsTransmitRay(sample.type))
+	{
+		dx = (dx - s.nf * Dot(dx, s.nf)) / sample.eta;
+		dy = (dy - s.nf * Dot(dy, s.nf)) / sample.eta;
+	}
+	else
+	{
+		dx = dx - s.nf * (2.f * Dot(dx, s.nf));
+		dy = dy - s.nf * (2.f * Dot(dy, s.nf));
+	}
+
+	float spread = AiMin(alpha, MaxLobeSpread);
+	if (spread > 0)
+	{
+		Vec3f t, b;
+		AiV3BuildLocalFrame(t, b, wi);
+		dx += t * spread;
+		dy += b * spread;
+	}
+	return AtVectorDv(wi, dx, dy);
+}
+
+float EquivalentRoughness(const BSDFSample& sample)
+{
+	// a GGX reflection lobe peaks at 1 / (4 pi alpha^2)
+	return IsDeltaRay(sample.type) ? 0.f : AiMin(1.f / Sqrt(4.f * AI_PI * sample.pdf), 1.f);
+}
+
 bool IsDelta(const BSDF* bsdf)
 {
 	if (std::get_if<FakeBSDF>(bsdf)) {
@@ -756,6 +1114,73 @@ bool IsDelta(const BSDF* bsdf)
 	return false;
 }
 
+float Roughness(const BSDF* bsdf, const BSDFState& s)
+{
+	if (IsDelta(bsdf, s) || std::get_if<FakeBSDF>(bsdf)) {
+		return 0.f;
+	}
+	else if (std::get_if<LambertBSDF>(bsdf)) {
+		return 1.f;
+	}
+	else if (std::get_if<DielectricBSDF>(bsdf)) {
+		DielectricBSDF storage;
+		return Roughen(*std::get_if<DielectricBSDF>(bsdf), s, storage).alpha;
+	}
+	else if (std::get_if<MetalBSDF>(bsdf)) {
+		MetalBSDF storage;
+		return Roughen(*std::get_if<MetalBSDF>(bsdf), s, storage).alpha;
+	}
+	else if (std::get_if<LayeredBSDF>(bsdf)) {
+		return std::get_if<LayeredBSDF>(bsdf)->Roughness(s);
+	}
+	return 0.f;
+}
+
+float MaxAlbedo(const BSDF* bsdf, const BSDFState& s)
+{
+	if (auto lambert = std::get_if<LambertBSDF>(bsdf))
+		return AiMax(lambert->albedo.r, AiMax(lambert->albedo.g, lambert->albedo.b));
+	else if (auto layered = std::get_if<LayeredBSDF>(bsdf))
+		return layered->MaxAlbedo(s);
+	else if (std::get_if<FakeBSDF>(bsdf))
+		return 0.f;
+	// Fresnel reflection and transmission sum to at most 1
+	return 1.f;
+}
+
+const AtBSDFLobeInfo ClosureLobes[NumClosureLobes] = {
+	{ AI_RAY_SPECULAR_REFLECT, AI_BSDF_LOBE_SINGULAR, AtString() },
+	{ AI_RAY_SPECULAR_TRANSMIT, AI_BSDF_LOBE_SINGULAR, AtString() },
+	{ AI_RAY_SPECULAR_REFLECT, 0, AtString() },
+	{ AI_RAY_SPECULAR_TRANSMIT, 0, AtString() },
+	{ AI_RAY_DIFFUSE_REFLECT, 0, AtString() },
+	{ AI_RAY_DIFFUSE_TRANSMIT, 0, AtString() },
+};
+
+int ClosureLobe(bool delta, bool transmit, float roughness)
+{
+	int category = delta ? 0 : (roughness <= GlossyRoughness ? 1 : 2);
+	return category * 2 + transmit;
+}
+
+bool IsDelta(const BSDF* bsdf, const BSDFState& s)
+{
+	if (auto dielectric = std::get_if<DielectricBSDF>(bsdf))
+	{
+		DielectricBSDF storage;
+		return Roughen(*dielectric, s, storage).IsDelta();
+	}
+	else if (auto metal = std::get_if<MetalBSDF>(bsdf))
+	{
+		MetalBSDF storage;
+		return Roughen(*metal, s, storage).IsDelta();
+	}
+	// a stack's delta lobes come from its closed form, which regularisation turns off
+	else if (auto layered = std::get_if<LayeredBSDF>(bsdf))
+		return layered->UsesClosedForm(s) && layered->IsDelta();
+	return IsDelta(bsdf);
+}
+
 bool HasTransmit(const BSDF* bsdf)
 {
 	if (std::get_if<FakeBSDF>(bsdf)) {
@@ -1,4 +1,5 @@
 #pragma once
+#include <atomic>
 #include <variant>
 #include <optional>
 #include <vector>
@@ -8,6 +9,10 @@
 
 #include "common.h"
 #include "random.h"
+#include "packet.h"
+#include "fresnel_table.h"
+#include "phase_table.h"
+#include "microfacet.h"
 
 enum class TransportMode { Radiance, Importance };
 
@@ -65,9 +70,40 @@ struct LambertBSDF;
 struct DielectricBSDF;
 struct MetalBSDF;
 struct LayeredBSDF;
+struct MaterialProgram;
+struct BakedTable;
 
 using BSDF = std::variant<FakeBSDF, LambertBSDF, DielectricBSDF, MetalBSDF, LayeredBSDF>;
 
+// Bounce budget shared by a layered walk and all walks nested in its interfaces.
+// Running low on it roulettes walks instead of cutting them, so walks after nested ones that used
+// it up come out noisier rather than darker. Only HardLimit times the budget stops them outright
+struct WalkBudget
+{
+	static const int HardLimit = 2;
+	// walks are rouletted once RouletteShare of the budget is left
+	static constexpr float RouletteShare = .25f;
+	static constexpr float MinSurvival = .1f;
+
+	WalkBudget(int bounces) : bounces(bounces), total(AiMax(bounces, 1)) {}
+
+	// Charges one bounce, true if the walk takes it with probability survival, by which it divides.
+	// Survival is the larger of the share of the budget left and the path's luminance, so that
+	// survivors of an exhausted budget carry bounded weights
+	bool Continue(float u, float luminance, float& survival)
+	{
+		int left = bounces--;
+		float share = float(left) / (RouletteShare * float(total));
+		survival = (left <= (1 - HardLimit) * total) ? 0.f : AiClamp(AiMax(share, luminance), MinSurvival, 1.f);
+		return u < survival;
+	}
+
+	int bounces;
+	int total;
+	// luminance of the enclosing walks' throughput, used for roulette in nested walks
+	float throughput = 1.f;
+};
+
 struct BSDFState
 {
 	BSDFState() = default;
@@ -87,6 +123,8 @@ struct BSDFState
 
 		ns = sg->Ns * Dot(sg->Ngf, sg->Ng);
 		wo = ToLocal(n, -sg->Rd);
+		dDdx = sg->dDdx;
+		dDdy = sg->dDdy;
 	}
 
 	void SetDirectionsAndRng(const AtShaderGlobals* sg, bool keepNormalFacing)
@@ -100,20 +138,40 @@ struct BSDFState
 	// front-facing smooth normal without normal map
 	Vec3f ns;
 	Vec3f wo;
+	// screen space derivatives of the incoming ray direction, world space
+	Vec3f dDdx;
+	Vec3f dDdy;
 	int seed;
 
-	BSDF* top = nullptr;
-	BSDF* bottom = nullptr;
+	void SetInterfaces(const BSDF* topBSDF, const BSDF* bottomBSDF);
+
+	const BSDF* top = nullptr;
+	const BSDF* bottom = nullptr;
+	bool topDelta = false;
+	bool bottomDelta = false;
+	// medium of MaterialProgram the interfaces are bound to, -1 if not bound by a program
+	int medium = -1;
+	// level of the program's previews to bind at, 0 for the walks as compiled
+	int preview = 0;
 	Vec3f nTop;
 	Vec3f nBottom;
+	// slope variance of the filtered top and bottom normal maps, added to the interfaces' alpha^2.
+	// Like the normals these belong to the bound medium and are reset by binding another
+	float topVariance = 0.f;
+	float bottomVariance = 0.f;
 	AtRGB topAlbedo;
 	AtRGB bottomAlbedo;
+
+	// set by the outermost layered walk, nullptr outside of a walk
+	WalkBudget* budget = nullptr;
+	// path regularisation: dielectric and metal interfaces are at least this rough, 0 if off
+	float minAlpha = 0.f;
 };
 
 struct FakeBSDF
 {
-	AtRGB F(Vec3f wo, Vec3f wi) const { return AtRGB(0.f); }
-	float PDF(Vec3f wo, Vec3f wi) const { return 0.f; }
+	AtRGB F(Vec3f, Vec3f) const { return AtRGB(0.f); }
+	float PDF(Vec3f, Vec3f) const { return 0.f; }
 	BSDFSample Sample(Vec3f wo) const { return BSDFSample(-wo, AtRGB(1.f), 1.f, AI_RAY_SPECULAR_TRANSMIT); }
 	bool IsDelta() const { return true; }
 	bool HasTransmit() const { return true; }
@@ -121,12 +179,15 @@ struct FakeBSDF
 
 struct LambertBSDF
 {
-	AtRGB F(Vec3f wo, Vec3f wi) const { return albedo * AI_ONEOVERPI; }
-	float PDF(Vec3f wo, Vec3f wi) const { return Abs(wi.z) * AI_ONEOVERPI; }
+	AtRGB F(Vec3f, Vec3f) const { return albedo * AI_ONEOVERPI; }
+	float PDF(Vec3f, Vec3f wi) const { return Abs(wi.z) * AI_ONEOVERPI; }
 	BSDFSample Sample(Vec3f wo, RandomEngine& rng) const;
 	bool IsDelta() const { return false; }
 	bool HasTransmit() const { return false; }
 
+	void F(Vec3f wo, const Vec3Packet& wi, RGBPacket& f) const;
+	void PDF(Vec3f wo, const Vec3Packet& wi, FloatPacket& pdf) const;
+
 	AtRGB albedo = AtRGB(.8f);
 };
 
@@ -136,12 +197,23 @@ struct DielectricBSDF
 	float PDF(Vec3f wo, Vec3f wi, bool adjoint, BSDFFlag flag) const;
 	BSDFSample Sample(Vec3f wo, bool adjoint, BSDFFlag flag, RandomEngine& rng) const;
 
+	void F(Vec3f wo, const Vec3Packet& wi, bool adjoint, RGBPacket& f) const;
+	void PDF(Vec3f wo, const Vec3Packet& wi, bool adjoint, BSDFFlag flag, FloatPacket& pdf) const;
+
 	bool IsDelta() const { return ApproxDelta(); }
 	bool HasTransmit() const { return true; }
 	bool ApproxDelta() const { return alpha < 1e-4f; }
 
+	// from the table if one is attached, cosTheta < 0 on the inside
+	float Fresnel(float cosTheta) const;
+	// 1 / albedo of the single-scattering lobes for the energy lost between microfacets. The larger
+	// albedo of wo and wi keeps the BSDF reciprocal and never adds energy, inside it compensates less
+	float Compensation(float cosWo, float cosWi) const;
+
 	float ior = 1.5f;
 	float alpha = 0.f;
+	bool multiScatter = false;
+	const FresnelTable* fresnel = nullptr;
 };
 
 struct MetalBSDF
@@ -153,11 +225,70 @@ struct MetalBSDF
 	bool HasTransmit() const { return true; }
 	bool ApproxDelta() const { return alpha < 1e-4f; }
 
+	void F(Vec3f wo, const Vec3Packet& wi, RGBPacket& f) const;
+	void PDF(Vec3f wo, const Vec3Packet& wi, FloatPacket& pdf) const;
+
+	AtRGB Fresnel(float cosTheta) const;
+	AtRGB FresnelAverage() const;
+	// height-correlated Smith when compensating, which the albedo tables assume, separable otherwise
+	float G(float cosWo, float cosWi) const;
+	// Kulla-Conty lobe for the energy lost between microfacets, sampled with probability
+	// 1 - E(wo) by a cosine lobe
+	AtRGB MultiScatterF(float cosWo, float cosWi) const;
+	AtRGB MultiScatterScale() const;
+	float MultiScatterProb(float cosWo) const;
+
 	AtRGB albedo = AtRGB(.8f);
-	float ior = .4f;
-	float k = .5f;
+	// complex ior per channel
+	AtRGB ior = AtRGB(.4f);
+	AtRGB k = AtRGB(.5f);
 	float alpha = .04f;
 	bool SchlickFresnel = false;
+	bool multiScatter = false;
+	const FresnelTable* fresnel = nullptr;
+};
+
+struct PhaseSample
+{
+	PhaseSample(Vec3f w, float pdf) : p(pdf), wi(w), pdf(pdf) {}
+	float p;
+	Vec3f wi;
+	float pdf;
+};
+
+// Stacks whose medium doesn't scatter and whose interfaces are smooth or Lambertian, with
+// unperturbed normals. Internal transport is then a geometric series of interface reflections
+// and Beer-Lambert attenuation, evaluated exactly instead of by the walk
+enum class LayeredClosedForm
+{
+	None,
+	// both interfaces smooth, the stack is a pair of delta lobes
+	Delta,
+	// at least one Lambertian interface
+	Diffuse,
+};
+
+// How a stack guards against the rare huge estimates of its walks that show as fireflies
+enum class LayeredEstimator
+{
+	Mean,
+	// F is the median of the means of MedianGroups groups of walks
+	MedianOfMeans,
+	// closure weights are clamped to clampScale times the stack's maximum albedo
+	Clamp,
+};
+
+const int MedianGroups = 3;
+
+// first of the nSamples walks in median of means group i
+inline int MedianGroupBegin(int nSamples, int i) { return nSamples * i / MedianGroups; }
+
+// Counts of the estimates LayeredEstimator altered, shared by all threads shading a program
+struct EstimatorStats
+{
+	std::atomic<uint64_t> clamped{ 0 };
+	// median of means estimates below half the plain mean
+	std::atomic<uint64_t> outliers{ 0 };
 };
 
 struct LayeredBSDF
@@ -166,15 +297,114 @@ struct LayeredBSDF
 	float PDF(Vec3f wo, Vec3f wi, const BSDFState& s, RandomEngine& rng, bool adjoint) const;
 	BSDFSample Sample(Vec3f wo, const BSDFState& s, RandomEngine& rng, bool adjoint) const;
 
-	bool IsDelta() const { return false; }
+	// walks shared by the directions of the packet, each with the scalar F's estimator
+	void F(Vec3f wo, const Vec3Packet& wi, const BSDFState& s, RandomEngine& rng, bool adjoint, RGBPacket& f) const;
+
+	bool IsDelta() const { return closedForm == LayeredClosedForm::Delta; }
 	bool HasTransmit() const { return true; }
+	// regularised interfaces are rough, which no closed form covers
+	bool UsesClosedForm(const BSDFState& s) const { return closedForm != LayeredClosedForm::None && s.minAlpha == 0; }
+	// roughest interface of the stack, 1 with a scattering medium
+	float Roughness(const BSDFState& s) const;
+	// bound of the stack's albedo over all channels from the albedos of its medium and interfaces
+	float MaxAlbedo(const BSDFState& s) const;
+	// f cos / pdf of a closure as bounded by estimator
+	AtRGB ClampWeight(AtRGB weight, const BSDFState& s) const;
+	// mean of the median luminance group given the summed walks of each group, counts outliers in stats
+	AtRGB MedianOfMeans(const AtRGB* groupSums) const;
+
+	// phase function of the medium for wo and wi pointing away from the scattering point
+	float Phase(Vec3f wo, Vec3f wi) const;
+	PhaseSample SamplePhase(Vec3f wo, Vec2f u) const;
+
+	// binds the interfaces of this layer's medium if the state is bound to another one
+	void Bind(BSDFState& s) const;
+
+	// sets closedForm for the current albedo and the interfaces and normals of s
+	void DetectClosedForm(const BSDFState& s);
+	AtRGB ClosedFormF(Vec3f wo, Vec3f wi, const BSDFState& s, RandomEngine& rng, bool adjoint) const;
+	float ClosedFormPDF(Vec3f wo, Vec3f wi, const BSDFState& s, RandomEngine& rng, bool adjoint) const;
+	BSDFSample ClosedFormSample(Vec3f wo, const BSDFState& s, RandomEngine& rng, bool adjoint) const;
 
 	float thickness = .1f;
 	float g = .4f;
 	AtRGB albedo = AtRGB(.8f);
+	// bounce limit of one walk, nested walks also draw from the outermost walk's budget
 	int maxDepth = 32;
 	int nSamples = 1;
+	LayeredEstimator estimator = LayeredEstimator::Mean;
+	float clampScale = 4.f;
+	EstimatorStats* stats = nullptr;
 	bool twoSided = false;
+	// walk uses the approximations of fastmath.h for transmittance, free flights and phase sampling
+	bool fastMath = false;
+
+	const MaterialProgram* program = nullptr;
+	int medium = 0;
+	// replaces the walk by the table of a baked stack when set
+	const BakedTable* baked = nullptr;
+	// replaces Henyey-Greenstein with g when set
+	const PhaseTable* phaseTable = nullptr;
+
+	// the entrance interface's own reflection is left out, it is shaded by a CoatBSDF closure
+	bool splitCoat = false;
+
+	LayeredClosedForm closedForm = LayeredClosedForm::None;
+	// cosine weighted fraction of light leaving the Lambertian interface that the smooth one
+	// reflects back to it, for Diffuse
+	AtRGB internalReflectance = AtRGB(0.f);
+};
+
+// Reflection of a stack's entrance interface alone. Emitted next to the stack's LayeredBSDF
+// with splitCoat set, so that coat highlights get the interface's exact F and PDF instead of
+// the walk's estimates
+struct CoatBSDF
+{
+	AtRGB F(Vec3f wo, Vec3f wi, const BSDFState& s, RandomEngine& rng) const;
+	float PDF(Vec3f wo, Vec3f wi, const BSDFState& s, RandomEngine& rng) const;
+	BSDFSample Sample(Vec3f wo, const BSDFState& s, RandomEngine& rng) const;
+	float Roughness(Vec3f wo, const BSDFState& s) const;
+
+	// of the stack, which makes the top interface the entrance from both sides
+	bool twoSided = false;
+};
+
+// Analytic stand-in for a layered stack, fitted by FitLayeredBSDF. RGB lobe weights are tabulated
+// over cos theta_o for each side and interpolated linearly. Glossy transmission is a GGX lobe around
+// the straight-through direction, the reflection lobe mirrored through the surface
+struct FittedBSDF
+{
+	static const int Bins = 8;
+	static const int NumAlphas = 3;
+
+	enum Lobe
+	{
+		DiffuseReflect,
+		DiffuseTransmit,
+		GlossyReflect0,
+		GlossyReflect1,
+		GlossyTransmit,
+		// weight of a smooth entrance interface's mirror reflection, not fitted
+		DeltaReflect,
+		NumLobes
+	};
+
+	AtRGB F(Vec3f wo, Vec3f wi) const;
+	float PDF(Vec3f wo, Vec3f wi) const;
+	BSDFSample Sample(Vec3f wo, RandomEngine& rng) const;
+
+	// unit weight lobe seen from above, wo.z > 0
+	static float LobeF(int lobe, float alpha, Vec3f wo, Vec3f wi);
+	static float LobePDF(int lobe, float alpha, Vec3f wo, Vec3f wi);
+	float LobeAlpha(int side, int lobe) const;
+	// sharpest glossy reflection lobe of wo's side
+	float Roughness(Vec3f wo) const;
+	// interpolated weights and selection probabilities at cos theta_o of one side
+	void LobeWeights(int side, float cosWo, AtRGB* w, float* prob) const;
+
+	AtRGB weights[2][Bins][NumLobes];
+	// of GlossyReflect0, GlossyReflect1 and GlossyTransmit per side
+	float alpha[2][NumAlphas];
 };
 
 template<typename BSDFT>
@@ -185,6 +415,23 @@ struct WithState
 	BSDFState state;
 };
 
+// Dielectric or metal interface as the state sees it: roughened by the variance of its filtered
+// normal map if it is the bound top or bottom interface, then raised to the regularisation's
+// roughness. Copied into storage if changed
+template<typename T>
+const T& Roughen(const T& bsdf, const BSDFState& s, T& storage)
+{
+	float variance = (&bsdf == std::get_if<T>(s.top)) ? s.topVariance :
+		(&bsdf == std::get_if<T>(s.bottom)) ? s.bottomVariance : 0.f;
+	float alpha = AiMax((variance > 0) ? Sqrt(Sqr(bsdf.alpha) + variance) : bsdf.alpha, s.minAlpha);
+	if (alpha == bsdf.alpha)
+		return bsdf;
+
+	storage = bsdf;
+	storage.alpha = alpha;
+	return storage;
+}
+
 AtRGB F(const BSDF* bsdf, Vec3f wo, Vec3f wi, const BSDFState& s, RandomEngine& rng, bool adjoint);
 float PDF(const BSDF* bsdf, Vec3f wo, Vec3f wi, const BSDFState& s, RandomEngine& rng, bool adjoint, BSDFFlag flag = {});
 BSDFSample Sample(const BSDF* bsdf, Vec3f wo, const BSDFState& s, RandomEngine& rng, bool adjoint, BSDFFlag flag = {});
@@ -193,15 +440,52 @@ AtRGB F(const BSDF* bsdf, Vec3f n, Vec3f wo, Vec3f wi, const BSDFState& s, Rando
 float PDF(const BSDF* bsdf, Vec3f n, Vec3f wo, Vec3f wi, const BSDFState& s, RandomEngine& rng, bool adjoint, BSDFFlag flag = {});
 BSDFSample Sample(const BSDF* bsdf, Vec3f n, Vec3f wo, const BSDFState& s, RandomEngine& rng, bool adjoint, BSDFFlag flag = {});
 
+void F(const BSDF* bsdf, Vec3f n, Vec3f wo, const Vec3Packet& wi, const BSDFState& s, RandomEngine& rng, bool adjoint, RGBPacket& f);
+void PDF(const BSDF* bsdf, Vec3f n, Vec3f wo, const Vec3Packet& wi, const BSDFState& s, RandomEngine& rng, bool adjoint, FloatPacket& pdf, BSDFFlag flag = {});
+
 bool IsDelta(const BSDF* bsdf);
+// as roughened by s, see Roughen
+bool IsDelta(const BSDF* bsdf, const BSDFState& s);
 bool HasTransmit(const BSDF* bsdf);
+// GGX alpha of a BSDF's lobes, 0 for delta and 1 for Lambertian ones
+float Roughness(const BSDF* bsdf, const BSDFState& s);
+// largest fraction of energy a BSDF may return in any channel
+float MaxAlbedo(const BSDF* bsdf, const BSDFState& s);
+
+// Lobes reported to Arnold by all closures but Lambert's, indexed by ClosureLobe: singular, glossy and
+// diffuse, each reflection then transmission. Arnold's specular ray types stand for glossy lobes too,
+// so that its per ray type depths and samples apply to them
+extern const AtBSDFLobeInfo ClosureLobes[];
+const int NumClosureLobes = 6;
+// lobes up to this GGX alpha are glossy, rougher ones diffuse
+const float GlossyRoughness = .25f;
+
+int ClosureLobe(bool delta, bool transmit, float roughness);
 
 bool Refract(Vec3f& wt, Vec3f n, Vec3f wi, float eta);
 bool Refract(Vec3f& wt, Vec3f wi, float eta);
-float FresnelDielectric(float cosThetaI, float eta);
-float FresnelConductor(float cosThetaI, float eta, float k);
+
+// fast switches to the polynomial approximations of fastmath.h
+float Transmittance(float z0, float z1, Vec3f w, bool fast = false);
+float Transmittance(float dz, Vec3f w, bool fast = false);
+float SampleExponential(float a, float u, bool fast = false);
+
+float HGPhaseFunction(float cosTheta, float g);
+float HGPhasePDF(Vec3f wo, Vec3f wi, float g);
+PhaseSample HGPhaseSample(Vec3f wo, float g, Vec2f u, bool fast = false);
+
+// World space wi of a closure's sample with derivatives for Arnold's ray differentials. The incoming
+// ray's derivatives are carried through the mirror or refracted direction and widened by the angular
+// width of a lobe of roughness alpha, so that rough bounces read coarser texture levels
+AtVectorDv SampledDirection(const BSDFState& s, const BSDFSample& sample, float alpha);
+
+// Roughness of the GGX lobe whose peak density is the sample's pdf, for samples that have no single
+// lobe such as those of a layered walk. 0 for delta samples
+float EquivalentRoughness(const BSDFSample& sample);
 
 AtBSDF* AiLambertBSDF(const AtShaderGlobals* sg, const WithState<LambertBSDF>& lambertBSDF);
 AtBSDF* AiDielectricBSDF(const AtShaderGlobals* sg, const WithState<DielectricBSDF>& dielectricBSDF);
 AtBSDF* AiMetalBSDF(const AtShaderGlobals* sg, const WithState<MetalBSDF>& metalBSDF);
-AtBSDF* AiLayeredBSDF(const AtShaderGlobals* sg, const WithState<LayeredBSDF>& layeredBDSF);
\ No newline at end of file
+AtBSDF* AiLayeredBSDF(const AtShaderGlobals* sg, const WithState<LayeredBSDF>& layeredBDSF);
+AtBSDF* AiCoatBSDF(const AtShaderGlobals* sg, const WithState<CoatBSDF>& coatBSDF);
+AtBSDF* AiFittedBSDF(const AtShaderGlobals* sg, const WithState<const FittedBSDF*>& fittedBSDF);
\ No newline at end of file
@@ -0,0 +1,57 @@
+﻿#include "bsdfs.h"
+
+AI_BSDF_EXPORT_METHODS(CoatBSDFMtd);
+
+bsdf_init
+{
+	auto fs = GetAtBSDFCustomDataPtr<WithState<CoatBSDF>>(bsdf);
+	fs->state.SetDirectionsAndRng(sg, true);
+
+	AiBSDFInitLobes(bsdf, ClosureLobes, NumClosureLobes);
+	AiBSDFInitNormal(bsdf, fs->state.nf, false);
+}
+
+bsdf_sample
+{
+	auto fs = GetAtBSDFCustomDataPtr<WithState<CoatBSDF>>(bsdf);
+	auto& state = fs->state;
+
+	RandomEngine rng(FloatBitsToInt(rnd.x) ^ state.seed);
+	BSDFSample sample = fs->bsdf.Sample(state.wo, state, rng);
+
+	if (sample.IsInvalid())
+		return AI_BSDF_LOBE_MASK_NONE;
+
+	float cosWi = IsDeltaRay(sample.type) ? 1.f : Abs(sample.wi.z);
+
+	out_wi = SampledDirection(state, sample, EquivalentRoughness(sample));
+	out_lobe_index = ClosureLobe(IsDeltaRay(sample.type), IsTransmitRay(sample.type), fs->bsdf.Roughness(state.wo, state));
+	out_lobes[out_lobe_index] = AtBSDFLobeSample(sample.f * cosWi / sample.pdf, sample.pdf, sample.pdf);
+	return lobe_mask & LobeMask(out_lobe_index);
+}
+
+bsdf_eval
+{
+	auto fs = GetAtBSDFCustomDataPtr<WithState<CoatBSDF>>(bsdf);
+	auto& state = fs->state;
+	Vec3f wiLocal = ToLocal(state.nf, wi);
+
+	RandomEngine rng(FloatBitsToInt(wi.x) ^ FloatBitsToInt(wi.y) ^ state.seed);
+	AtRGB f = fs->bsdf.F(state.wo, wiLocal, state, rng);
+	float pdf = fs->bsdf.PDF(state.wo, wiLocal, state, rng);
+
+	// a smooth coat has no lobe to evaluate, its pdf is 0
+	if (pdf < 1e-6f || isnan(pdf) || IsInvalid(f) || Luminance(f) > 1e8f)
+		return AI_BSDF_LOBE_MASK_NONE;
+
+	int lobe = ClosureLobe(false, false, fs->bsdf.Roughness(state.wo, state));
+	out_lobes[lobe] = AtBSDFLobeSample(f * Abs(wiLocal.z) / pdf, pdf, pdf);
+	return lobe_mask & LobeMask(lobe);
+}
+
+AtBSDF* AiCoatBSDF(const AtShaderGlobals* sg, const WithState<CoatBSDF>& coatBSDF)
+{
+	AtBSDF* bsdf = AiBSDF(sg, AI_RGB_WHITE, CoatBSDFMtd, sizeof(WithState<CoatBSDF>));
+	GetAtBSDFCustomDataRef<WithState<CoatBSDF>>(bsdf) = coatBSDF;
+	return bsdf;
+}
@@ -190,6 +190,11 @@ inline float Abs(float x)
 	return std::abs(x);
 }
 
+inline bool IsLocalUp(Vec3f n)
+{
+	return Abs(n.z - 1.f) < 1e-5f && Abs(Length(n) - 1.f) < 1e-5f;
+}
+
 template<typename T>
 T Max(const T& a, const T& b)
 {
@@ -258,9 +263,7 @@ struct Vec2c
 
 	Vec2c operator * (const Vec2c& r) const
 	{
-		float pReal = real * r.real;
-		float pImg = img * r.img;
-		return Vec2c(pReal - pImg, pReal + pImg);
+		return Vec2c(real * r.real - img * r.img, real * r.img + img * r.real);
 	}
 
 	Vec2c operator * (float v) const
@@ -270,10 +273,8 @@ struct Vec2c
 
 	Vec2c operator / (const Vec2c& r) const
 	{
-		float pReal = real * r.real;
-		float pImg = img * r.img;
 		float scale = 1.f / r.LengthSqr();
-		return Vec2c(pReal + pImg, pReal - pImg) * scale;
+		return Vec2c(real * r.real + img * r.img, img * r.real - real * r.img) * scale;
 	}
 
 	Vec2c Sqrt() const
@@ -1,4 +1,6 @@
 ﻿#include "bsdfs.h"
+#include "material_program.h"
+#include "node_cache.h"
 
 AI_SHADER_NODE_EXPORT_METHODS(DielectricNodeMtd);
 
@@ -6,6 +8,7 @@ enum DielectricNodeParams
 {
 	p_ior = 1,
 	p_roughness,
+	p_multiple_scattering,
 };
 
 node_parameters
@@ -13,22 +16,25 @@ node_parameters
 	AiParameterStr(NodeParamTypeName, DielectricNodeName);
 	AiParameterFlt("ior", 1.5f);
 	AiParameterFlt("roughness", 0.f);
+	AiParameterBool("multiple_scattering", false);
 }
 
 node_initialize
 {
-	auto bsdf = new BSDF;
-	*bsdf = DielectricBSDF();
-	AiNodeSetLocalData(node, bsdf);
+	AiNodeSetLocalData(node, new FresnelNodeData);
 }
 
 node_update
 {
+	BuildNodeFresnelTable(node, GetNodeLocalDataRef<FresnelNodeData>(node));
+	UpdateNodeRevision(node, HashNodeParams(node));
+	RebuildStaleDependents(node);
 }
 
 node_finish
 {
-	//delete GetNodeLocalDataPtr<BSDF>(node);
+	RemoveNodeFromCache(node);
+	delete GetNodeLocalDataPtr<FresnelNodeData>(node);
 }
 
 shader_evaluate
@@ -36,7 +42,11 @@ shader_evaluate
 	DielectricBSDF dielectricBSDF;
 	dielectricBSDF.ior = AiShaderEvalParamFlt(p_ior);
 	dielectricBSDF.alpha = AiSqr(AiShaderEvalParamFlt(p_roughness));
-	GetNodeLocalDataRef<BSDF>(node) = dielectricBSDF;
+	dielectricBSDF.multiScatter = AiShaderEvalParamBool(p_multiple_scattering);
+
+	auto& fresnel = GetNodeLocalDataRef<FresnelNodeData>(node);
+	if (fresnel.table)
+		dielectricBSDF.fresnel = fresnel.table.get();
 
 	if (sg->Rt & AI_RAY_SHADOW)
 		return;
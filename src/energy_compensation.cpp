@@ -0,0 +1,58 @@
+#include "energy_compensation.h"
+#include "ms_tables.h"
+
+// position of v in [0, 1] on a grid of n points
+static void GridCoord(float v, int n, int& i, float& t)
+{
+	float x = AiClamp(v, 0.f, 1.f) * (n - 1);
+	i = AiMin(int(x), n - 2);
+	t = x - float(i);
+}
+
+static float Bilerp(const float* table, float cosTheta, float alpha)
+{
+	int c, r;
+	float tc, tr;
+	GridCoord(std::abs(cosTheta), MSTableCos, c, tc);
+	GridCoord(std::sqrt(alpha), MSTableRoughness, r, tr);
+
+	const float* row0 = table + r * MSTableCos;
+	const float* row1 = row0 + MSTableCos;
+	float e0 = row0[c] * (1.f - tc) + row0[c + 1] * tc;
+	float e1 = row1[c] * (1.f - tc) + row1[c + 1] * tc;
+	return e0 * (1.f - tr) + e1 * tr;
+}
+
+float ConductorAlbedo(float cosTheta, float alpha)
+{
+	return Bilerp(ConductorAlbedoTable, cosTheta, alpha);
+}
+
+float ConductorAverageAlbedo(float alpha)
+{
+	int r;
+	float t;
+	GridCoord(std::sqrt(alpha), MSTableRoughness, r, t);
+	return ConductorAverageAlbedoTable[r] * (1.f - t) + ConductorAverageAlbedoTable[r + 1] * t;
+}
+
+float DielectricAlbedo(float cosTheta, float alpha, float ior)
+{
+	// an interface with ior < 1 is the same interface seen from the other side
+	if (ior < 1.f)
+	{
+		ior = 1.f / ior;
+		cosTheta = -cosTheta;
+	}
+
+	const float* table = (cosTheta >= 0) ? DielectricEnterAlbedoTable : DielectricExitAlbedoTable;
+	const int slice = MSTableCos * MSTableRoughness;
+
+	int k;
+	float t;
+	GridCoord((ior - MSTableIorMin) / (MSTableIorMax - MSTableIorMin), MSTableIor, k, t);
+
+	float e0 = Bilerp(table + k * slice, cosTheta, alpha);
+	float e1 = Bilerp(table + (k + 1) * slice, cosTheta, alpha);
+	return e0 * (1.f - t) + e1 * t;
+}
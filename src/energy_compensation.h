@@ -0,0 +1,19 @@
+#pragma once
+
+#include "common.h"
+
+// Directional albedo of the single-scattering GTR2 interfaces, tabulated by tools/ms_tables.cpp
+// over cos(theta) and roughness = sqrt(alpha), plus ior for dielectrics.
+// Used to add back the energy lost to multiple scattering between microfacets:
+// a Kulla-Conty lobe for conductors, a 1 / E scale (Turquin 2019) for dielectrics, made reciprocal
+const int MSTableCos = 32;
+const int MSTableRoughness = 32;
+const int MSTableIor = 16;
+const float MSTableIorMin = 1.f;
+const float MSTableIorMax = 3.f;
+
+// reflectance with F = 1
+float ConductorAlbedo(float cosTheta, float alpha);
+float ConductorAverageAlbedo(float alpha);
+// reflectance plus transmittance, cosTheta < 0 from the inside
+float DielectricAlbedo(float cosTheta, float alpha, float ior);
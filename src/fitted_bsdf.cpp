@@ -0,0 +1,55 @@
+﻿#include "bsdfs.h"
+
+AI_BSDF_EXPORT_METHODS(FittedBSDFMtd);
+
+bsdf_init
+{
+	auto fs = GetAtBSDFCustomDataPtr<WithState<const FittedBSDF*>>(bsdf);
+	fs->state.SetDirectionsAndRng(sg, true);
+
+	AiBSDFInitLobes(bsdf, ClosureLobes, NumClosureLobes);
+	AiBSDFInitNormal(bsdf, fs->state.nf, false);
+}
+
+bsdf_sample
+{
+	auto fs = GetAtBSDFCustomDataPtr<WithState<const FittedBSDF*>>(bsdf);
+	auto& state = fs->state;
+
+	RandomEngine rng(FloatBitsToInt(rnd.x) ^ state.seed);
+	BSDFSample sample = fs->bsdf->Sample(state.wo, rng);
+
+	if (sample.IsInvalid())
+		return AI_BSDF_LOBE_MASK_NONE;
+
+	float cosWi = IsDeltaRay(sample.type) ? 1.f : Abs(sample.wi.z);
+
+	out_wi = SampledDirection(state, sample, EquivalentRoughness(sample));
+	out_lobe_index = ClosureLobe(IsDeltaRay(sample.type), IsTransmitRay(sample.type), fs->bsdf->Roughness(state.wo));
+	out_lobes[out_lobe_index] = AtBSDFLobeSample(sample.f * cosWi / sample.pdf, sample.pdf, sample.pdf);
+	return lobe_mask & LobeMask(out_lobe_index);
+}
+
+bsdf_eval
+{
+	auto fs = GetAtBSDFCustomDataPtr<WithState<const FittedBSDF*>>(bsdf);
+	auto& state = fs->state;
+	Vec3f wiLocal = ToLocal(state.nf, wi);
+
+	AtRGB f = fs->bsdf->F(state.wo, wiLocal);
+	float pdf = fs->bsdf->PDF(state.wo, wiLocal);
+
+	if (pdf < 1e-6f || isnan(pdf) || IsInvalid(f))
+		return AI_BSDF_LOBE_MASK_NONE;
+
+	int lobe = ClosureLobe(false, !SameHemisphere(state.wo, wiLocal), fs->bsdf->Roughness(state.wo));
+	out_lobes[lobe] = AtBSDFLobeSample(f * Abs(wiLocal.z) / pdf, pdf, pdf);
+	return lobe_mask & LobeMask(lobe);
+}
+
+AtBSDF* AiFittedBSDF(const AtShaderGlobals* sg, const WithState<const FittedBSDF*>& fittedBSDF)
+{
+	AtBSDF* bsdf = AiBSDF(sg, AI_RGB_WHITE, FittedBSDFMtd, sizeof(WithState<const FittedBSDF*>));
+	GetAtBSDFCustomDataRef<WithState<const FittedBSDF*>>(bsdf) = fittedBSDF;
+	return bsdf;
+}
@@ -0,0 +1,25 @@
+#include "fresnel_table.h"
+#include "bsdfs.h"
+
+void FresnelTable::BuildConductor(AtRGB eta, AtRGB k)
+{
+	dielectric = false;
+	for (int i = 0; i < Size; i++)
+		values[i] = FresnelConductor(Sqr(float(i) / (Size - 1)), eta, k);
+
+	// 2 integral of F(mu) mu over mu = s^2, trapezoidal in s
+	average = AtRGB(0.f);
+	for (int i = 1; i < Size; i++)
+	{
+		float s0 = float(i - 1) / (Size - 1), s1 = float(i) / (Size - 1);
+		average += (values[i - 1] * s0 * s0 * s0 + values[i] * s1 * s1 * s1) * (2.f / (Size - 1));
+	}
+}
+
+void FresnelTable::BuildDielectric(float ior)
+{
+	dielectric = true;
+	this->ior = ior;
+	for (int i = 0; i < Size; i++)
+		values[i] = AtRGB(FresnelDielectric(Sqr(float(i) / (Size - 1)), ior));
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include <memory>
+
+#include "common.h"
+
+// Fresnel reflectance tabulated over cos(theta), built from a material's parameters in node_update
+// and evaluated with one lookup and a linear interpolation.
+// Bins are spaced in sqrt(cos) to follow the steep part near grazing angles. Dielectric tables
+// only store the outside, the inside is looked up at the cosine of the refracted direction
+struct FresnelTable
+{
+	static const int Size = 256;
+
+	void BuildConductor(AtRGB eta, AtRGB k);
+	void BuildDielectric(float ior);
+
+	AtRGB Eval(float cosTheta) const
+	{
+		if (cosTheta < 0 && dielectric)
+		{
+			float sin2Tt = (1.f - cosTheta * cosTheta) * ior * ior;
+			if (sin2Tt >= 1.f)
+				return AtRGB(1.f);
+			cosTheta = std::sqrt(1.f - sin2Tt);
+		}
+
+		float x = AiMin(std::sqrt(std::abs(cosTheta)), 1.f) * (Size - 1);
+		int i = AiMin(int(x), Size - 2);
+		float t = x - float(i);
+		return values[i] * (1.f - t) + values[i + 1] * t;
+	}
+
+	AtRGB values[Size];
+	// cosine weighted hemispherical average, conductors only
+	AtRGB average = AtRGB(0.f);
+	bool dielectric = false;
+	float ior = 1.f;
+};
+
+// Local data of interface nodes, the table is only used while the parameters it was built from
+// are constant over the surface. Pooled with the nodes and programs of equal parameters
+struct FresnelNodeData
+{
+	// null when invalid
+	std::shared_ptr<const FresnelTable> table;
+};
@@ -1,4 +1,6 @@
 ﻿#include "bsdfs.h"
+#include "material_program.h"
+#include "node_cache.h"
 
 AI_SHADER_NODE_EXPORT_METHODS(LambertNodeMtd);
 
@@ -15,28 +17,24 @@ node_parameters
 
 node_initialize
 {
-	auto bsdf = new BSDF;
-	*bsdf = LambertBSDF();
-	AiNodeSetLocalData(node, bsdf);
+	AiNodeSetLocalData(node, nullptr);
 }
 
 node_update
 {
-	LambertBSDF lambertBSDF;
-	lambertBSDF.albedo = AiNodeGetRGB(node, "albedo");
-	GetNodeLocalDataRef<BSDF>(node) = lambertBSDF;
+	UpdateNodeRevision(node, HashNodeParams(node));
+	RebuildStaleDependents(node);
 }
 
 node_finish
 {
-	//delete GetNodeLocalDataPtr<BSDF>(node);
+	RemoveNodeFromCache(node);
 }
 
 shader_evaluate
 {
 	LambertBSDF lambertBSDF;
 	lambertBSDF.albedo = AiShaderEvalParamRGB(p_albedo);
-	GetNodeLocalDataRef<BSDF>(node) = lambertBSDF;
 
 	if (sg->Rt & AI_RAY_SHADOW)
 		return;
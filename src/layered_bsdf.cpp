@@ -6,15 +6,9 @@ bsdf_init
 {
 	auto fs = GetAtBSDFCustomDataPtr<WithState<LayeredBSDF>>(bsdf);
 	fs->state.SetDirectionsAndRng(sg, true);
+	fs->bsdf.DetectClosedForm(fs->state);
 
-	static const AtBSDFLobeInfo lobe_info[] = {
-		{ AI_RAY_SPECULAR_REFLECT, 0, AtString() },
-		{ AI_RAY_SPECULAR_TRANSMIT, 0, AtString() },
-		{ AI_RAY_DIFFUSE_REFLECT, 0, AtString() },
-		{ AI_RAY_DIFFUSE_TRANSMIT, 0, AtString() },
-	};
-
-	AiBSDFInitLobes(bsdf, lobe_info, 4);
+	AiBSDFInitLobes(bsdf, ClosureLobes, NumClosureLobes);
 	AiBSDFInitNormal(bsdf, fs->state.nf, false);
 }
 
@@ -31,9 +25,10 @@ bsdf_sample
 
 	float cosWi = IsDeltaRay(sample.type) ? 1.f : Abs(sample.wi.z);
 
-	out_wi = AtVectorDv(ToWorld(state.nf, sample.wi));
-	out_lobe_index = (!IsDeltaRay(sample.type)) * 2 + IsTransmitRay(sample.type);
-	out_lobes[out_lobe_index] = AtBSDFLobeSample(sample.f * cosWi / sample.pdf, sample.pdf, sample.pdf);
+	out_wi = SampledDirection(state, sample, EquivalentRoughness(sample));
+	out_lobe_index = ClosureLobe(IsDeltaRay(sample.type), IsTransmitRay(sample.type), fs->bsdf.Roughness(state));
+	out_lobes[out_lobe_index] = AtBSDFLobeSample(fs->bsdf.ClampWeight(sample.f * cosWi / sample.pdf, state),
+		sample.pdf, sample.pdf);
 	return lobe_mask & LobeMask(out_lobe_index);
 }
 
@@ -51,8 +46,8 @@ bsdf_eval
 	if (pdf < 1e-6f || isnan(pdf) || IsInvalid(f) || Luminance(f) > 1e8f)
 		return AI_BSDF_LOBE_MASK_NONE;
 
-	int lobe = (!fs->bsdf.IsDelta()) * 2 + (!SameHemisphere(state.wo, wiLocal));
-	out_lobes[lobe] = AtBSDFLobeSample(f * cosWiOverPdf, pdf, pdf);
+	int lobe = ClosureLobe(fs->bsdf.IsDelta(), !SameHemisphere(state.wo, wiLocal), fs->bsdf.Roughness(state));
+	out_lobes[lobe] = AtBSDFLobeSample(fs->bsdf.ClampWeight(f * cosWiOverPdf, state), pdf, pdf);
 	return lobe_mask & LobeMask(lobe);
 }
 
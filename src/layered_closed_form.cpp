@@ -0,0 +1,243 @@
+#include "bsdfs.h"
+
+// Closed forms of LayeredBSDF, see LayeredClosedForm. Event weights are the walk's throughput
+// factors, taken from the interfaces' own sampling, so both evaluate the same F
+
+static const int InternalReflectanceSamples = 64;
+
+// weight f / pdf and direction of the reflection or transmission of a smooth interface,
+// invalid if the interface has no such event
+static BSDFSample DeltaEvent(const BSDF* interf, Vec3f wo, const BSDFState& s, RandomEngine& rng, bool adjoint,
+	bool transmit)
+{
+	auto sample = ::Sample(interf, wo, s, rng, adjoint, transmit ? BSDFFlagTransmission : BSDFFlagReflection);
+	if (sample.IsInvalid() || IsTransmitRay(sample.type) != transmit)
+		return BSDFInvalidSample;
+
+	sample.f /= sample.pdf;
+	sample.pdf = 1.f;
+	return sample;
+}
+
+static AtRGB Weight(const BSDFSample& sample)
+{
+	return sample.IsInvalid() ? AtRGB(0.f) : sample.f;
+}
+
+// sum of ratio^k over k >= 0
+static AtRGB GeometricSeries(AtRGB ratio)
+{
+	return AtRGB(1.f / AiMax(1.f - ratio.r, 1e-4f), 1.f / AiMax(1.f - ratio.g, 1e-4f), 1.f / AiMax(1.f - ratio.b, 1e-4f));
+}
+
+static Vec3f Mirror(Vec3f w)
+{
+	return Vec3f(-w.x, -w.y, w.z);
+}
+
+// smooth as roughened by s, see Roughen
+static bool IsClosedFormInterface(const BSDF* bsdf, const BSDFState& s)
+{
+	return std::get_if<LambertBSDF>(bsdf) || (::IsDelta(bsdf, s) && !std::get_if<LayeredBSDF>(bsdf));
+}
+
+// entrance and opposite interface for wo, flipped like the walk when a two sided stack is hit from below
+struct ClosedFormSetup
+{
+	ClosedFormSetup(const LayeredBSDF& bsdf, const BSDFState& s, Vec3f wo)
+	{
+		flip = bsdf.twoSided && wo.z < 0;
+		this->wo = flip ? -wo : wo;
+		bool entTop = bsdf.twoSided || wo.z > 0;
+		ent = entTop ? s.top : s.bottom;
+		oth = entTop ? s.bottom : s.top;
+	}
+
+	Vec3f wo;
+	bool flip;
+	const BSDF* ent;
+	const BSDF* oth;
+};
+
+// Delta lobes of two smooth interfaces: the mirror reflection and the transmission through both,
+// summed over all round trips inside
+struct SmoothPair
+{
+	SmoothPair(const LayeredBSDF& bsdf, const ClosedFormSetup& e, const BSDFState& s, RandomEngine& rng, bool adjoint)
+	{
+		if (!bsdf.splitCoat)
+			reflect = Weight(DeltaEvent(e.ent, e.wo, s, rng, adjoint, false));
+		auto in = DeltaEvent(e.ent, e.wo, s, rng, adjoint, true);
+		if (in.IsInvalid())
+			return;
+
+		float tr = Transmittance(bsdf.thickness, in.wi, bsdf.fastMath);
+		auto down = DeltaEvent(e.oth, -in.wi, s, rng, adjoint, false);
+		auto out = DeltaEvent(e.oth, -in.wi, s, rng, adjoint, true);
+		AtRGB series(1.f);
+
+		if (!down.IsInvalid())
+		{
+			AtRGB back = Weight(DeltaEvent(e.ent, -down.wi, s, rng, adjoint, false));
+			series = GeometricSeries(down.f * back * Sqr(tr));
+			reflect += in.f * down.f * Sqr(tr) * Weight(DeltaEvent(e.ent, -down.wi, s, rng, adjoint, true)) * series;
+		}
+
+		if (!out.IsInvalid())
+		{
+			transmit = in.f * tr * out.f * series;
+			transmitDir = out.wi;
+		}
+	}
+
+	AtRGB reflect = AtRGB(0.f);
+	AtRGB transmit = AtRGB(0.f);
+	Vec3f transmitDir;
+};
+
+// diffuse reflection of a Lambertian interface under a smooth entrance, wo and wi as in e
+static AtRGB CoatedDiffuseF(const LayeredBSDF& bsdf, const ClosedFormSetup& e, const LambertBSDF& lambert, Vec3f wi,
+	const BSDFState& s, RandomEngine& rng, bool adjoint)
+{
+	if (!SameHemisphere(e.wo, wi))
+		return AtRGB(0.f);
+
+	auto in = DeltaEvent(e.ent, e.wo, s, rng, adjoint, true);
+	auto out = DeltaEvent(e.ent, wi, s, rng, !adjoint, true);
+	if (in.IsInvalid() || out.IsInvalid())
+		return AtRGB(0.f);
+
+	return in.f * Transmittance(bsdf.thickness, in.wi, bsdf.fastMath) * lambert.F(-in.wi, -out.wi) *
+		Transmittance(bsdf.thickness, out.wi, bsdf.fastMath) * out.f *
+		GeometricSeries(lambert.albedo * bsdf.internalReflectance);
+}
+
+// probability of picking the mirror reflection of a smooth entrance over the diffuse lobe below it,
+// 0 when the reflection is shaded by a separate closure
+static float CoatedDeltaProb(const LayeredBSDF& bsdf, AtRGB reflect, const LambertBSDF& lambert)
+{
+	if (bsdf.splitCoat)
+		return 0.f;
+
+	float r = Luminance(reflect);
+	float d = Luminance(lambert.albedo) * AiMax(1.f - r, 0.f);
+	return (r + d > 0) ? r / (r + d) : 0.f;
+}
+
+void LayeredBSDF::DetectClosedForm(const BSDFState& state)
+{
+	closedForm = LayeredClosedForm::None;
+	internalReflectance = AtRGB(0.f);
+
+	BSDFState s = state;
+	Bind(s);
+
+	if (baked || !IsSmall(albedo) || !IsLocalUp(s.nTop) || !IsLocalUp(s.nBottom) ||
+		!IsClosedFormInterface(s.top, s) || !IsClosedFormInterface(s.bottom, s))
+		return;
+
+	bool topDelta = ::IsDelta(s.top);
+	bool bottomDelta = ::IsDelta(s.bottom);
+	closedForm = (topDelta && bottomDelta) ? LayeredClosedForm::Delta : LayeredClosedForm::Diffuse;
+
+	if (topDelta == bottomDelta)
+		return;
+
+	// light leaving the Lambertian interface is cosine distributed, so the average is taken
+	// uniformly in cos^2 theta, with directions pointing from the smooth interface into the medium
+	const BSDF* smooth = topDelta ? s.top : s.bottom;
+	float inside = topDelta ? -1.f : 1.f;
+	RandomEngine rng;
+	AtRGB sum(0.f);
+
+	for (int i = 0; i < InternalReflectanceSamples; i++)
+	{
+		float cosTheta = Sqrt((i + .5f) / InternalReflectanceSamples);
+		Vec3f w(Sqrt(1.f - cosTheta * cosTheta), 0.f, cosTheta * inside);
+		sum += Weight(DeltaEvent(smooth, w, s, rng, false, false)) * Sqr(Transmittance(thickness, w, fastMath));
+	}
+	internalReflectance = sum / float(InternalReflectanceSamples);
+}
+
+AtRGB LayeredBSDF::ClosedFormF(Vec3f wo, Vec3f wi, const BSDFState& state, RandomEngine& rng, bool adjoint) const
+{
+	BSDFState s = state;
+	Bind(s);
+
+	ClosedFormSetup e(*this, s, wo);
+	if (e.flip)
+		wi = -wi;
+
+	// a Lambertian entrance is opaque
+	if (!::IsDelta(e.ent))
+		return splitCoat ? AtRGB(0.f) : ::F(e.ent, e.wo, wi, s, rng, adjoint);
+
+	auto lambert = std::get_if<LambertBSDF>(e.oth);
+	return lambert ? CoatedDiffuseF(*this, e, *lambert, wi, s, rng, adjoint) : AtRGB(0.f);
+}
+
+float LayeredBSDF::ClosedFormPDF(Vec3f wo, Vec3f wi, const BSDFState& state, RandomEngine& rng, bool adjoint) const
+{
+	BSDFState s = state;
+	Bind(s);
+
+	ClosedFormSetup e(*this, s, wo);
+	if (e.flip)
+		wi = -wi;
+
+	if (!::IsDelta(e.ent))
+		return splitCoat ? 0.f : ::PDF(e.ent, e.wo, wi, s, rng, adjoint);
+
+	auto lambert = std::get_if<LambertBSDF>(e.oth);
+	if (!lambert || !SameHemisphere(e.wo, wi))
+		return 0.f;
+
+	AtRGB reflect = Weight(DeltaEvent(e.ent, e.wo, s, rng, adjoint, false));
+	return (1.f - CoatedDeltaProb(*this, reflect, *lambert)) * Abs(wi.z) * AI_ONEOVERPI;
+}
+
+BSDFSample LayeredBSDF::ClosedFormSample(Vec3f wo, const BSDFState& state, RandomEngine& rng, bool adjoint) const
+{
+	BSDFState s = state;
+	Bind(s);
+
+	ClosedFormSetup e(*this, s, wo);
+	BSDFSample sample;
+
+	if (!::IsDelta(e.ent))
+		sample = splitCoat ? BSDFInvalidSample : ::Sample(e.ent, e.wo, s, rng, adjoint);
+	else if (auto lambert = std::get_if<LambertBSDF>(e.oth))
+	{
+		AtRGB reflect = Weight(DeltaEvent(e.ent, e.wo, s, rng, adjoint, false));
+		float pDelta = CoatedDeltaProb(*this, reflect, *lambert);
+
+		if (Sample1D(rng) < pDelta)
+			sample = BSDFSample(Mirror(e.wo), reflect, pDelta, AI_RAY_SPECULAR_REFLECT);
+		else
+		{
+			Vec2f d = ToConcentricDisk(Sample2D(rng));
+			float z = Sqrt(1.f - Dot(d, d));
+			Vec3f wi(d.x, d.y, (e.wo.z < 0) ? -z : z);
+			sample = BSDFSample(wi, CoatedDiffuseF(*this, e, *lambert, wi, s, rng, adjoint),
+				(1.f - pDelta) * z * AI_ONEOVERPI, AI_RAY_DIFFUSE_REFLECT);
+		}
+	}
+	else
+	{
+		SmoothPair pair(*this, e, s, rng, adjoint);
+		float r = Luminance(pair.reflect);
+		float t = Luminance(pair.transmit);
+		if (r + t <= 0)
+			return BSDFInvalidSample;
+
+		float pr = r / (r + t);
+		if (Sample1D(rng) < pr)
+			sample = BSDFSample(Mirror(e.wo), pair.reflect, pr, AI_RAY_SPECULAR_REFLECT);
+		else
+			sample = BSDFSample(pair.transmitDir, pair.transmit, 1.f - pr, AI_RAY_SPECULAR_TRANSMIT);
+	}
+
+	if (e.flip && !sample.IsInvalid())
+		sample.wi = -sample.wi;
+	return sample;
+}
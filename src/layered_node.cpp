@@ -1,8 +1,12 @@
 ﻿#include <ai_shader_bsdf.h>
+#include <memory>
 #include <vector>
 
 #include "common.h"
 #include "bsdfs.h"
+#include "material_pool.h"
+#include "node_cache.h"
+#include "progressive_passes.h"
 
 AI_SHADER_NODE_EXPORT_METHODS(LayeredNodeMtd);
 
@@ -19,17 +23,23 @@ enum LayeredNodeParams
 	p_bottom_normal,
 	p_bottom_correct_normal,
 	p_bottom_flip_normal,
+	p_fast_math,
+	p_baked_file,
+	p_fit_lobes,
+	p_split_coat,
+	p_regularize,
+	p_regularize_depth,
+	p_regularize_roughness,
+	p_top_normal_moments,
+	p_bottom_normal_moments,
+	p_phase_file,
+	p_estimator,
+	p_walk_samples,
+	p_clamp_scale,
+	p_progressive_ramp,
 };
 
-BSDF* GetNodeBSDF(const AtNode* node)
-{
-	if (!node)
-		return nullptr;
-	else if (AiNodeGetStr(node, NodeParamTypeName).empty())
-		return nullptr;
-	else
-		return GetNodeLocalDataPtr<BSDF>(node);
-}
+static const char* EstimatorNames[] = { "mean", "median_of_means", "clamp", nullptr };
 
 node_parameters
 {
@@ -45,40 +55,105 @@ node_parameters
 	AiParameterVec("bottom_normal", 0.f, 0.f, 0.f);
 	AiParameterBool("bottom_correct_normal", false);
 	AiParameterBool("bottom_flip_normal", false);
+	AiParameterBool("fast_math", false);
+	AiParameterStr("baked_file", "");
+	AiParameterBool("fit_lobes", false);
+	AiParameterBool("split_coat", true);
+	AiParameterBool("regularize", false);
+	AiParameterInt("regularize_depth", 2);
+	AiParameterFlt("regularize_roughness", .3f);
+	AiParameterRGB("top_normal_moments", 0.f, 0.f, 0.f);
+	AiParameterRGB("bottom_normal_moments", 0.f, 0.f, 0.f);
+	AiParameterStr("phase_file", "");
+	AiParameterEnum("estimator", 0, EstimatorNames);
+	AiParameterInt("walk_samples", 1);
+	AiParameterFlt("clamp_scale", 4.f);
+	AiParameterBool("progressive_ramp", true);
 }
 
+// The program is shared with the layered nodes of equal content
+struct LayeredNodeData
+{
+	std::shared_ptr<MaterialProgram> program;
+	// null with progressive_ramp off
+	std::shared_ptr<ProgressivePasses> passes;
+};
+
 node_initialize
 {
-	auto bsdf = new BSDF;
-	*bsdf = LayeredBSDF();
-	AiNodeSetLocalData(node, bsdf);
+	AiNodeSetLocalData(node, new LayeredNodeData);
+}
+
+static std::vector<const AtNode*> RebuildProgram(AtNode* node)
+{
+	std::vector<const AtNode*> sources;
+	auto& data = GetNodeLocalDataRef<LayeredNodeData>(node);
+	// let go first, the old program is freed before the new one is compiled unless others hold it
+	data.program.reset();
+	data.program = AcquireMaterialProgram(node, &sources);
+	return sources;
+}
+
+// Progressive renders start with negative AA_samples, each pass halving the walks' depth down from
+// full quality at 1 sample. Final renders and passes past the first sample walk as compiled
+static int PreviewLevel(int aa)
+{
+	return (aa >= 1) ? 0 : AiMin(1 - aa, MaxPreviewLevel);
 }
 
 node_update
 {
+	bool changed = UpdateNodeRevision(node, HashNodeParams(node));
+	auto& data = GetNodeLocalDataRef<LayeredNodeData>(node);
+
+	// other nodes' updates may rebuild this one as their dependent
+	{
+		auto lock = LockNodeCache();
+
+		if (changed || !data.program || !AreNodeSourcesCurrent(node))
+			RebuildNode(node, RebuildProgram);
+
+		RebuildStaleDependents(node);
+	}
+
+	data.passes = AiNodeGetBool(node, "progressive_ramp") ? AcquireProgressivePasses(node) : nullptr;
+	if (data.passes)
+		data.passes->Begin(render_session, AiUniverseGetOptions(AiNodeGetUniverse(node)));
 }
 
 node_finish
 {
-	//delete GetNodeLocalDataPtr<LayeredBSDF>(node);
+	RemoveNodeFromCache(node);
+	delete GetNodeLocalDataPtr<LayeredNodeData>(node);
+}
+
+// LEAN variance of the slopes under the footprint from the filtered moments (E[sx], E[sy], E[sx^2 + sy^2])
+// of tools/normal_moments.cpp. Summed over both axes, which for an isotropic interface is the alpha^2 to
+// add. The mean slope is filtered with the moments, the slope of the filtered normal differs from it
+static float NormalVariance(AtRGB moments)
+{
+	return AiMax(moments.b - moments.r * moments.r - moments.g * moments.g, 0.f);
 }
 
 shader_evaluate
 {
-	BSDF* top = GetNodeBSDF(reinterpret_cast<AtNode*>(AiShaderEvalParamPtr(p_top_node)));
-	BSDF* bottom = GetNodeBSDF(reinterpret_cast<AtNode*>(AiShaderEvalParamPtr(p_bottom_node)));
+	const auto& data = GetNodeLocalDataRef<LayeredNodeData>(node);
+	const MaterialProgram* program = data.program.get();
 
-	static BSDF fakeBSDF = FakeBSDF();
+	BSDFState state;
+	state.preview = data.passes ? PreviewLevel(data.passes->Observe(sg)) : 0;
 
-	LayeredBSDF layeredBSDF;
+	LayeredBSDF layeredBSDF = program->Root(state.preview).bsdf;
 	layeredBSDF.thickness = AiShaderEvalParamFlt(p_thickness);
 	layeredBSDF.g = AiShaderEvalParamFlt(p_g);
 	layeredBSDF.albedo = AiShaderEvalParamRGB(p_albedo);
 
-	GetNodeLocalDataRef<BSDF>(node) = layeredBSDF;
-	BSDFState state;
-	state.top = top ? top : &fakeBSDF;
-	state.bottom = bottom ? bottom : &fakeBSDF;
+	// smooth interfaces seen after a diffuse bounce or deep in a path are raised to a glossy roughness,
+	// trading bias for the caustic paths that only a lucky light sample would find
+	if (AiShaderEvalParamBool(p_regularize) &&
+		(sg->bounces >= AiShaderEvalParamInt(p_regularize_depth) || sg->bounces_diffuse > 0))
+		state.minAlpha = AiSqr(AiShaderEvalParamFlt(p_regularize_roughness));
+	program->Bind(state, 0);
 
 	state.nTop = AiShaderEvalParamVec(p_top_normal);
 	state.nBottom = AiShaderEvalParamVec(p_bottom_normal);
@@ -103,6 +178,11 @@ shader_evaluate
 		state.nBottom = state.nBottom * 2.f - 1.f;
 	}
 
+	state.topVariance = NormalVariance(AiShaderEvalParamRGB(p_top_normal_moments));
+	state.bottomVariance = NormalVariance(AiShaderEvalParamRGB(p_bottom_normal_moments));
+	// rough enough interfaces are no longer delta
+	state.SetInterfaces(state.top, state.bottom);
+
 	if (AiShaderEvalParamBool(p_top_flip_normal))
 		state.nTop = -state.nTop;
 
@@ -111,5 +191,30 @@ shader_evaluate
 
 	if (sg->Rt & AI_RAY_SHADOW)
 		return;
-	sg->out.CLOSURE() = AiLayeredBSDF(sg, { layeredBSDF, state });
+
+	if (program->fitted)
+	{
+		sg->out.CLOSURE() = AiFittedBSDF(sg, { program->fitted.get(), state });
+		return;
+	}
+
+	// a nested stack's reflection is a walk of its own, it stays in the enclosing walk
+	const ProgramMedium& root = program->Root();
+	bool split = AiShaderEvalParamBool(p_split_coat) && !layeredBSDF.baked &&
+		!program->interfaces[root.top].IsLayered() && !program->interfaces[root.bottom].IsLayered();
+
+	if (!split)
+	{
+		sg->out.CLOSURE() = AiLayeredBSDF(sg, { layeredBSDF, state });
+		return;
+	}
+
+	CoatBSDF coatBSDF;
+	coatBSDF.twoSided = layeredBSDF.twoSided;
+	layeredBSDF.splitCoat = true;
+
+	AtClosureList closures;
+	closures.add(AiCoatBSDF(sg, { coatBSDF, state }));
+	closures.add(AiLayeredBSDF(sg, { layeredBSDF, state }));
+	sg->out.CLOSURE() = closures;
 }
\ No newline at end of file
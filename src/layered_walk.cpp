@@ -0,0 +1,614 @@
+#include <algorithm>
+
+#include "layered_walk.h"
+
+static bool IsUsable(const BSDFSample& s)
+{
+	return !(s.IsInvalid() || IsSmall(s.f) || s.pdf < 1e-8f || s.wi.z == 0);
+}
+
+LayeredEvalSetup::LayeredEvalSetup(const LayeredBSDF& bsdf, const BSDFState& s, Vec3f wo, Vec3f wi, bool adjoint) :
+	bsdf(bsdf), wo(wo), wi(wi), adjoint(adjoint)
+{
+	if (bsdf.twoSided && wo.z < 0)
+	{
+		this->wo = -wo;
+		this->wi = -wi;
+	}
+	entTop = bsdf.twoSided || this->wo.z > 0;
+	extIsEnt = SameHemisphere(this->wo, this->wi);
+
+	ent = entTop ? s.top : s.bottom;
+	oth = entTop ? s.bottom : s.top;
+	ext = extIsEnt ? ent : oth;
+
+	bool entDelta = entTop ? s.topDelta : s.bottomDelta;
+	othDelta = entTop ? s.bottomDelta : s.topDelta;
+	extDelta = extIsEnt ? entDelta : othDelta;
+
+	entNorm = entTop ? s.nTop : s.nBottom;
+	othNorm = entTop ? s.nBottom : s.nTop;
+	extNorm = extIsEnt ? entNorm : othNorm;
+
+	zEnt = entTop ? 0 : bsdf.thickness;
+	zExt = extIsEnt ? zEnt : bsdf.thickness - zEnt;
+}
+
+bool LayeredWalk::Start(const LayeredEvalSetup& e, BSDFState& s, RandomEngine& rng)
+{
+	f = AtRGB(0.f);
+	depth = 0;
+	s.budget->throughput = parentThroughput;
+
+	// opaque exit, as in the packet evaluation
+	if (!e.extIsEnt && !::HasTransmit(e.ext))
+		return false;
+
+	auto wos = ::Sample(e.ent, e.entNorm, e.wo, s, rng, e.adjoint, BSDFFlagTransmission);
+	if (!IsUsable(wos))
+		return false;
+
+	wis = ::Sample(e.ext, e.extNorm, e.wi, s, rng, !e.adjoint, BSDFFlagTransmission);
+	if (!IsUsable(wis))
+		return false;
+
+	throughput = wos.f / wos.pdf * (::IsDeltaRay(wos.type) ? 1.f : Abs(wos.wi.z));
+	z = e.zEnt;
+	w = wos.wi;
+	firstFlight = true;
+	return true;
+}
+
+// The connection to wis from a scattering event depends on the sampled distance only through the
+// transmittances to the event and on to the exit, which on the first flight integrate in closed form
+// over the medium. Adding that expectation in place of the sampled connection is a control variate
+// with its exact mean (Rao-Blackwellization): unbiased, and single scattering no longer varies with
+// the distance
+void LayeredWalk::AddFirstFlight(const LayeredEvalSetup& e)
+{
+	f += FirstFlight(e, wis);
+}
+
+AtRGB LayeredWalk::FirstFlight(const LayeredEvalSetup& e, const BSDFSample& wis) const
+{
+	const LayeredBSDF& bsdf = e.bsdf;
+	if (IsSmall(bsdf.albedo))
+		return AtRGB(0.f);
+
+	float phase = bsdf.Phase(-w, -wis.wi);
+	float weight = 1.f / Abs(wis.wi.z);
+	if (!e.extDelta)
+		weight = PowerHeuristic(wis.pdf, phase);
+
+	// scattering at depth t below the entrance has density a exp(-a t), the exit is t or L - t away
+	float L = bsdf.thickness;
+	float a = 1.f / Abs(w.z);
+	float b = 1.f / Abs(wis.wi.z);
+	float mean;
+
+	if (e.extIsEnt)
+		mean = a * (1.f - std::exp(-(a + b) * L)) / (a + b);
+	else if (Abs(a - b) * L < 1e-4f)
+		mean = a * L * std::exp(-a * L);
+	else
+		mean = a * (std::exp(-b * L) - std::exp(-a * L)) / (a - b);
+
+	return wis.f / wis.pdf * bsdf.albedo * phase * weight * throughput * mean;
+}
+
+WalkEvent LayeredWalk::FreeFlight(const LayeredEvalSetup& e, BSDFState& s, RandomEngine& rng)
+{
+	WalkEvent event = FreeFlightPath(e, s, rng);
+
+	// past roulette the flight only changes the throughput of a clear medium, which has no first flight
+	if (event != WalkEvent::Terminated && depth == 1)
+		AddFirstFlight(e);
+	return event;
+}
+
+WalkEvent LayeredWalk::FreeFlightPath(const LayeredEvalSetup& e, BSDFState& s, RandomEngine& rng)
+{
+	const LayeredBSDF& bsdf = e.bsdf;
+
+	float survival;
+	if (++depth > bsdf.maxDepth || !s.budget->Continue(Sample1D(rng), PathLuminance(throughput), survival))
+		return WalkEvent::Terminated;
+	throughput /= survival;
+
+	if (depth > 4 && PathLuminance(throughput) < .25f)
+	{
+		float rr = AiMax(0.f, 1.f - PathLuminance(throughput));
+		if (Sample1D(rng) < rr)
+			return WalkEvent::Terminated;
+		throughput /= (1.f - rr);
+	}
+	s.budget->throughput = PathLuminance(throughput);
+
+	if (IsSmall(bsdf.albedo))
+	{
+		z = (z == bsdf.thickness) ? 0 : bsdf.thickness;
+		throughput *= Transmittance(bsdf.thickness, w, bsdf.fastMath);
+		return WalkEvent::Interface;
+	}
+
+	float sigT = 1.f;
+	float dz = SampleExponential(sigT / Abs(w.z), Sample1D(rng), bsdf.fastMath);
+
+	if (dz == 0)
+		return WalkEvent::Null;
+
+	zNext = (w.z > 0) ? z - dz : z + dz;
+
+	if (zNext < bsdf.thickness && zNext > 0)
+		return WalkEvent::Scatter;
+
+	z = AiClamp(zNext, 0.f, bsdf.thickness);
+	return WalkEvent::Interface;
+}
+
+void LayeredWalk::ConnectScatter(const LayeredEvalSetup& e)
+{
+	if (!firstFlight)
+		f += ScatterConnection(e, wis);
+	firstFlight = false;
+}
+
+AtRGB LayeredWalk::ScatterConnection(const LayeredEvalSetup& e, const BSDFSample& wis) const
+{
+	const LayeredBSDF& bsdf = e.bsdf;
+
+	// a smooth exit's weight is per projected solid angle of wis.wi here
+	float weight = 1.f / Abs(wis.wi.z);
+	if (!e.extDelta)
+		weight = PowerHeuristic(wis.pdf, bsdf.Phase(-w, -wis.wi));
+
+	return wis.f / wis.pdf * Transmittance(zNext, e.zExt, wis.wi, bsdf.fastMath) * bsdf.albedo *
+		bsdf.Phase(-w, -wis.wi) * weight * throughput;
+}
+
+bool LayeredWalk::TakeScatter(const LayeredEvalSetup& e, BSDFState& s, RandomEngine& rng, const PhaseSample& phaseSample)
+{
+	const LayeredBSDF& bsdf = e.bsdf;
+
+	if (phaseSample.pdf == 0 || phaseSample.wi.z == 0)
+		return true;
+
+	throughput *= bsdf.albedo * phaseSample.p / phaseSample.pdf;
+	w = phaseSample.wi;
+	z = zNext;
+
+	if (((z > e.zExt && w.z > 0) || (z < e.zExt && w.z < 0)) && !e.extDelta)
+	{
+		AtRGB fExt = ::F(e.ext, e.extNorm, -w, e.wi, s, rng, e.adjoint);
+
+		if (!IsSmall(fExt))
+		{
+			float pExt = ::PDF(e.ext, e.extNorm, -w, e.wi, s, rng, e.adjoint, BSDFFlagTransmission);
+			float weight = PowerHeuristic(phaseSample.pdf, pExt);
+			f += fExt * Transmittance(zNext, e.zExt, phaseSample.wi, bsdf.fastMath) * weight * throughput;
+		}
+	}
+	return true;
+}
+
+bool LayeredWalk::Scatter(const LayeredEvalSetup& e, BSDFState& s, RandomEngine& rng)
+{
+	ConnectScatter(e);
+	return TakeScatter(e, s, rng, e.bsdf.SamplePhase(-w, Sample2D(rng)));
+}
+
+void LayeredWalk::ConnectInterface(const LayeredEvalSetup& e, BSDFState& s, RandomEngine& rng)
+{
+	const LayeredBSDF& bsdf = e.bsdf;
+	firstFlight = false;
+
+	if (z == e.zExt || e.othDelta)
+		return;
+
+	// the cosine at the exit cancels a smooth exit's
+	float weight = 1.f / Abs(wis.wi.z);
+	if (!e.extDelta)
+		weight = PowerHeuristic(wis.pdf, ::PDF(e.oth, e.othNorm, -w, -wis.wi, s, rng, e.adjoint));
+
+	f += ::F(e.oth, e.othNorm, -w, -wis.wi, s, rng, e.adjoint) * Abs(wis.wi.z) *
+		Transmittance(bsdf.thickness, wis.wi, bsdf.fastMath) * wis.f / wis.pdf * throughput * weight;
+}
+
+bool LayeredWalk::TakeInterface(const LayeredEvalSetup& e, BSDFState& s, RandomEngine& rng, const BSDFSample& rs)
+{
+	const LayeredBSDF& bsdf = e.bsdf;
+
+	if (!IsUsable(rs))
+		return false;
+
+	throughput *= rs.f / rs.pdf * (::IsDeltaRay(rs.type) ? 1.f : Abs(rs.wi.z));
+	w = rs.wi;
+
+	if (z == e.zExt || e.extDelta)
+		return true;
+
+	AtRGB fExt = ::F(e.ext, e.extNorm, -w, e.wi, s, rng, e.adjoint);
+	if (!IsSmall(fExt))
+	{
+		float weight = 1.f;
+		if (!e.othDelta)
+		{
+			float pExt = ::PDF(e.ext, e.extNorm, -w, e.wi, s, rng, e.adjoint, BSDFFlagTransmission);
+			weight = PowerHeuristic(rs.pdf, pExt);
+		}
+		f += fExt * Transmittance(bsdf.thickness, rs.wi, bsdf.fastMath) * weight * throughput;
+	}
+	return true;
+}
+
+bool LayeredWalk::Interface(const LayeredEvalSetup& e, BSDFState& s, RandomEngine& rng)
+{
+	bool atExit = z == e.zExt;
+	ConnectInterface(e, s, rng);
+	return TakeInterface(e, s, rng, ::Sample(atExit ? e.ext : e.oth, atExit ? e.extNorm : e.othNorm, -w, s, rng,
+		e.adjoint, BSDFFlagReflection));
+}
+
+bool LayeredWalk::Advance(const LayeredEvalSetup& e, BSDFState& s, RandomEngine& rng)
+{
+	switch (FreeFlight(e, s, rng))
+	{
+	case WalkEvent::Scatter:
+		return Scatter(e, s, rng);
+	case WalkEvent::Interface:
+		return Interface(e, s, rng);
+	case WalkEvent::Null:
+		return true;
+	default:
+		return false;
+	}
+}
+
+bool LayeredSharedWalk::Start(const LayeredEvalSetup& e, const Vec3Packet& wi, const bool* group, BSDFState& s,
+	RandomEngine& rng)
+{
+	path.f = AtRGB(0.f);
+	path.depth = 0;
+	s.budget->throughput = path.parentThroughput;
+	Fill(f, AtRGB(0.f));
+
+	if (!e.extIsEnt && !::HasTransmit(e.ext))
+		return false;
+
+	auto wos = ::Sample(e.ent, e.entNorm, e.wo, s, rng, e.adjoint, BSDFFlagTransmission);
+	if (!IsUsable(wos))
+		return false;
+
+	bool any = false;
+	for (int i = 0; i < PacketWidth; i++)
+	{
+		live[i] = group[i];
+		if (!live[i])
+			continue;
+
+		wis[i] = ::Sample(e.ext, e.extNorm, wi.Get(i), s, rng, !e.adjoint, BSDFFlagTransmission);
+		live[i] = IsUsable(wis[i]);
+		any |= live[i];
+	}
+	if (!any)
+		return false;
+
+	path.throughput = wos.f / wos.pdf * (::IsDeltaRay(wos.type) ? 1.f : Abs(wos.wi.z));
+	path.z = e.zEnt;
+	path.w = wos.wi;
+	path.firstFlight = true;
+	return true;
+}
+
+void LayeredSharedWalk::ConnectExit(const LayeredEvalSetup& e, const Vec3Packet& wi, BSDFState& s, RandomEngine& rng,
+	float pdf, float transmittance)
+{
+	RGBPacket fExt;
+	FloatPacket pExt;
+	::F(e.ext, e.extNorm, -path.w, wi, s, rng, e.adjoint, fExt);
+	if (pdf > 0)
+		::PDF(e.ext, e.extNorm, -path.w, wi, s, rng, e.adjoint, pExt, BSDFFlagTransmission);
+
+	for (int i = 0; i < PacketWidth; i++)
+	{
+		AtRGB fi = fExt.Get(i);
+		if (!live[i] || IsSmall(fi))
+			continue;
+
+		float weight = (pdf > 0) ? PowerHeuristic(pdf, pExt[i]) : 1.f;
+		f.Set(i, f.Get(i) + fi * transmittance * weight * path.throughput);
+	}
+}
+
+bool LayeredSharedWalk::Scatter(const LayeredEvalSetup& e, const Vec3Packet& wi, BSDFState& s, RandomEngine& rng)
+{
+	const LayeredBSDF& bsdf = e.bsdf;
+
+	for (int i = 0; i < PacketWidth && !path.firstFlight; i++)
+	{
+		if (live[i])
+			f.Set(i, f.Get(i) + path.ScatterConnection(e, wis[i]));
+	}
+	path.firstFlight = false;
+
+	PhaseSample phaseSample = bsdf.SamplePhase(-path.w, Sample2D(rng));
+	if (phaseSample.pdf == 0 || phaseSample.wi.z == 0)
+		return true;
+
+	path.throughput *= bsdf.albedo * phaseSample.p / phaseSample.pdf;
+	path.w = phaseSample.wi;
+	path.z = path.zNext;
+
+	if (((path.z > e.zExt && path.w.z > 0) || (path.z < e.zExt && path.w.z < 0)) && !e.extDelta)
+		ConnectExit(e, wi, s, rng, phaseSample.pdf, Transmittance(path.zNext, e.zExt, path.w, bsdf.fastMath));
+	return true;
+}
+
+bool LayeredSharedWalk::Interface(const LayeredEvalSetup& e, const Vec3Packet& wi, BSDFState& s, RandomEngine& rng)
+{
+	const LayeredBSDF& bsdf = e.bsdf;
+	bool atExit = path.z == e.zExt;
+	path.firstFlight = false;
+
+	// as LayeredWalk::ConnectInterface, with the other interface evaluated toward every lane's wis at once
+	if (!atExit && !e.othDelta)
+	{
+		Vec3Packet toWis;
+		FloatPacket cosWis, tr, pOth;
+		RGBPacket fOth;
+
+		for (int i = 0; i < PacketWidth; i++)
+		{
+			toWis.Set(i, live[i] ? -wis[i].wi : LocalUp);
+			cosWis[i] = toWis.z[i];
+		}
+
+		::F(e.oth, e.othNorm, -path.w, toWis, s, rng, e.adjoint, fOth);
+		if (!e.extDelta)
+			::PDF(e.oth, e.othNorm, -path.w, toWis, s, rng, e.adjoint, pOth);
+		Transmittance(bsdf.thickness, cosWis, tr, bsdf.fastMath);
+
+		for (int i = 0; i < PacketWidth; i++)
+		{
+			if (!live[i])
+				continue;
+
+			float weight = e.extDelta ? 1.f / Abs(wis[i].wi.z) : PowerHeuristic(wis[i].pdf, pOth[i]);
+			f.Set(i, f.Get(i) + fOth.Get(i) * Abs(wis[i].wi.z) * tr[i] * wis[i].f / wis[i].pdf * path.throughput * weight);
+		}
+	}
+
+	auto rs = ::Sample(atExit ? e.ext : e.oth, atExit ? e.extNorm : e.othNorm, -path.w, s, rng, e.adjoint,
+		BSDFFlagReflection);
+	if (!IsUsable(rs))
+		return false;
+
+	path.throughput *= rs.f / rs.pdf * (::IsDeltaRay(rs.type) ? 1.f : Abs(rs.wi.z));
+	path.w = rs.wi;
+
+	if (!atExit && !e.extDelta)
+		ConnectExit(e, wi, s, rng, e.othDelta ? 0.f : rs.pdf, Transmittance(bsdf.thickness, rs.wi, bsdf.fastMath));
+	return true;
+}
+
+bool LayeredSharedWalk::Advance(const LayeredEvalSetup& e, const Vec3Packet& wi, BSDFState& s, RandomEngine& rng)
+{
+	WalkEvent event = path.FreeFlightPath(e, s, rng);
+
+	for (int i = 0; i < PacketWidth && event != WalkEvent::Terminated && path.depth == 1; i++)
+	{
+		if (live[i])
+			f.Set(i, f.Get(i) + path.FirstFlight(e, wis[i]));
+	}
+
+	switch (event)
+	{
+	case WalkEvent::Scatter:
+		return Scatter(e, wi, s, rng);
+	case WalkEvent::Interface:
+		return Interface(e, wi, s, rng);
+	case WalkEvent::Null:
+		return true;
+	default:
+		return false;
+	}
+}
+
+AtRGB LayeredWalkPacket::Run(const LayeredEvalSetup& e, BSDFState& s, RandomEngine& rng, int count, float parentThroughput)
+{
+	for (int i = 0; i < PacketWidth; i++)
+	{
+		LayeredWalk& lane = lanes[i];
+		lane.parentThroughput = parentThroughput;
+		alive[i] = (i < count) && lane.Start(e, s, rng);
+
+		if (!alive[i])
+		{
+			// keep masked lanes well-defined for the SoA stage
+			lane.throughput = AtRGB(0.f);
+			lane.w = Vec3f(0.f, 0.f, 1.f);
+			lane.z = 0;
+			lane.depth = 0;
+		}
+	}
+
+	while (std::any_of(alive, alive + PacketWidth, [](bool a) { return a; }))
+	{
+		FreeFlight(e, s, rng);
+		Scatter(e, s, rng);
+		Interface(e, s, rng);
+	}
+
+	AtRGB f(0.f);
+	for (int i = 0; i < count; i++)
+		f += lanes[i].f;
+	return f;
+}
+
+void LayeredWalkPacket::FreeFlight(const LayeredEvalSetup& e, BSDFState& s, RandomEngine& rng)
+{
+	const LayeredBSDF& bsdf = e.bsdf;
+	FloatPacket uRR, uDist, lum, wz, z, dz, survival;
+
+	for (int i = 0; i < PacketWidth; i++)
+	{
+		uRR[i] = Sample1D(rng);
+		uDist[i] = Sample1D(rng);
+		wz[i] = lanes[i].w.z;
+		z[i] = lanes[i].z;
+		survival[i] = 1.f;
+
+		if (alive[i])
+			alive[i] = (++lanes[i].depth <= bsdf.maxDepth) && s.budget->Continue(Sample1D(rng), lanes[i].PathLuminance(lanes[i].throughput), survival[i]);
+		if (alive[i])
+			lanes[i].throughput /= survival[i];
+		lum[i] = lanes[i].PathLuminance(lanes[i].throughput);
+	}
+
+	FloatPacket scale;
+	for (int i = 0; i < PacketWidth; i++)
+	{
+		float rr = AiMax(0.f, 1.f - lum[i]);
+		bool roulette = lanes[i].depth > 4 && lum[i] < .25f;
+		alive[i] = alive[i] && !(roulette && uRR[i] < rr);
+		scale[i] = roulette ? 1.f / (1.f - rr) : 1.f;
+
+		if (alive[i] && lanes[i].depth == 1)
+			lanes[i].AddFirstFlight(e);
+	}
+
+	if (IsSmall(bsdf.albedo))
+	{
+		FloatPacket tr;
+		Transmittance(bsdf.thickness, wz, tr, bsdf.fastMath);
+
+		for (int i = 0; i < PacketWidth; i++)
+		{
+			if (!alive[i])
+				continue;
+			lanes[i].throughput *= scale[i] * tr[i];
+			lanes[i].z = (z[i] == bsdf.thickness) ? 0 : bsdf.thickness;
+			events[i] = WalkEvent::Interface;
+		}
+		return;
+	}
+
+	FreeFlightDistance(uDist, wz, dz, bsdf.fastMath);
+	for (int i = 0; i < PacketWidth; i++)
+		z[i] = (wz[i] > 0) ? z[i] - dz[i] : z[i] + dz[i];
+
+	for (int i = 0; i < PacketWidth; i++)
+	{
+		if (!alive[i])
+			continue;
+
+		LayeredWalk& lane = lanes[i];
+		lane.throughput *= scale[i];
+
+		if (dz[i] == 0)
+			events[i] = WalkEvent::Null;
+		else if (z[i] < bsdf.thickness && z[i] > 0)
+		{
+			lane.zNext = z[i];
+			events[i] = WalkEvent::Scatter;
+		}
+		else
+		{
+			lane.z = AiClamp(z[i], 0.f, bsdf.thickness);
+			events[i] = WalkEvent::Interface;
+		}
+	}
+}
+
+void LayeredWalkPacket::Scatter(const LayeredEvalSetup& e, BSDFState& s, RandomEngine& rng)
+{
+	const LayeredBSDF& bsdf = e.bsdf;
+	FloatPacket u0, u1, p;
+	Vec3Packet wo, wi;
+	bool scatter[PacketWidth];
+	bool any = false;
+
+	for (int i = 0; i < PacketWidth; i++)
+	{
+		u0[i] = Sample1D(rng);
+		u1[i] = Sample1D(rng);
+		scatter[i] = alive[i] && events[i] == WalkEvent::Scatter;
+		wo.Set(i, scatter[i] ? -lanes[i].w : Vec3f(0.f, 0.f, 1.f));
+		any |= scatter[i];
+
+		if (scatter[i])
+			lanes[i].ConnectScatter(e);
+	}
+	if (!any)
+		return;
+
+	// tabulated phase functions are sampled lane by lane
+	if (!bsdf.phaseTable)
+		SampleHGPhase(wo, u0, u1, bsdf.g, wi, p, bsdf.fastMath);
+
+	for (int i = 0; i < PacketWidth; i++)
+	{
+		if (!scatter[i])
+			continue;
+
+		PhaseSample phaseSample = bsdf.phaseTable ? bsdf.SamplePhase(wo.Get(i), Vec2f(u0[i], u1[i])) :
+			PhaseSample(wi.Get(i), p[i]);
+		// nested walks started by this event see the throughput of its own lane
+		s.budget->throughput = lanes[i].PathLuminance(lanes[i].throughput);
+		alive[i] = lanes[i].TakeScatter(e, s, rng, phaseSample);
+	}
+}
+
+void LayeredWalkPacket::Interface(const LayeredEvalSetup& e, BSDFState& s, RandomEngine& rng)
+{
+	FloatPacket u0, u1, side;
+	Vec3Packet wi;
+	bool reflect[PacketWidth];
+	bool lambert[PacketWidth];
+	bool anyLambert = false;
+
+	for (int i = 0; i < PacketWidth; i++)
+	{
+		u0[i] = Sample1D(rng);
+		u1[i] = Sample1D(rng);
+		side[i] = -lanes[i].w.z;
+		reflect[i] = alive[i] && events[i] == WalkEvent::Interface;
+		lambert[i] = false;
+
+		if (!reflect[i])
+			continue;
+
+		bool atExit = lanes[i].z == e.zExt;
+		lambert[i] = std::holds_alternative<LambertBSDF>(atExit ? *e.ext : *e.oth) && IsLocalUp(atExit ? e.extNorm : e.othNorm);
+		anyLambert |= lambert[i];
+
+		s.budget->throughput = lanes[i].PathLuminance(lanes[i].throughput);
+		lanes[i].ConnectInterface(e, s, rng);
+	}
+
+	// Lambertian interfaces are sampled for all lanes at once, other interfaces lane by lane
+	if (anyLambert)
+		SampleCosineHemisphere(u0, u1, side, wi);
+
+	for (int i = 0; i < PacketWidth; i++)
+	{
+		if (!reflect[i])
+			continue;
+
+		bool atExit = lanes[i].z == e.zExt;
+		const BSDF* interf = atExit ? e.ext : e.oth;
+		BSDFSample rs;
+
+		if (lambert[i])
+		{
+			// as LambertBSDF::Sample
+			Vec3f w = wi.Get(i);
+			rs = BSDFSample(w, std::get_if<LambertBSDF>(interf)->albedo * AI_ONEOVERPI, Abs(w.z) * AI_ONEOVERPI, AI_RAY_DIFFUSE_REFLECT);
+		}
+		else
+			rs = ::Sample(interf, atExit ? e.extNorm : e.othNorm, -lanes[i].w, s, rng, e.adjoint, BSDFFlagReflection);
+
+		s.budget->throughput = lanes[i].PathLuminance(lanes[i].throughput);
+		alive[i] = lanes[i].TakeInterface(e, s, rng, rs);
+	}
+}
@@ -0,0 +1,157 @@
+#pragma once
+
+#include "bsdfs.h"
+
+// Binds a walk to the budget of the walk enclosing it, or opens a new budget at the outermost level
+struct WalkBudgetScope
+{
+	WalkBudgetScope(BSDFState& s, int bounces) :
+		root(bounces), budget(s.budget ? s.budget : &root), parentThroughput(budget->throughput)
+	{
+		s.budget = budget;
+	}
+
+	~WalkBudgetScope()
+	{
+		budget->throughput = parentThroughput;
+	}
+
+	bool Continue(float u, AtRGB throughput, float& survival)
+	{
+		return budget->Continue(u, PathLuminance(throughput), survival);
+	}
+
+	// luminance of the full nested path, so inner walks of dim outer paths are terminated early
+	float PathLuminance(AtRGB throughput) const
+	{
+		return parentThroughput * Luminance(throughput);
+	}
+
+	void Enter(AtRGB throughput)
+	{
+		budget->throughput = PathLuminance(throughput);
+	}
+
+	WalkBudget root;
+	WalkBudget* budget;
+	float parentThroughput;
+};
+
+// Directions and interfaces of one LayeredBSDF::F evaluation, shared by all walks for the same (wo, wi)
+struct LayeredEvalSetup
+{
+	LayeredEvalSetup(const LayeredBSDF& bsdf, const BSDFState& s, Vec3f wo, Vec3f wi, bool adjoint);
+
+	const LayeredBSDF& bsdf;
+	Vec3f wo;
+	Vec3f wi;
+	bool adjoint;
+
+	bool entTop;
+	bool extIsEnt;
+	const BSDF* ent;
+	const BSDF* oth;
+	const BSDF* ext;
+	bool othDelta;
+	bool extDelta;
+	Vec3f entNorm;
+	Vec3f othNorm;
+	Vec3f extNorm;
+	float zEnt;
+	float zExt;
+};
+
+enum class WalkEvent { Terminated, Null, Scatter, Interface };
+
+// One random walk of LayeredBSDF::F, split into the stages of a bounce so that walks can either be
+// advanced one at a time or in lockstep over a batch.
+// The walk draws from the budget bound in BSDFState::budget when a stage is run
+struct LayeredWalk
+{
+	// samples transmission through the entrance interface and toward wi at the exit, false if the walk is dead
+	bool Start(const LayeredEvalSetup& e, BSDFState& s, RandomEngine& rng);
+
+	// roulette and free-flight sampling, moves the walk to a scattering event or an interface
+	WalkEvent FreeFlight(const LayeredEvalSetup& e, BSDFState& s, RandomEngine& rng);
+	// FreeFlight without the first flight's connection to wis, for paths shared by several wis
+	WalkEvent FreeFlightPath(const LayeredEvalSetup& e, BSDFState& s, RandomEngine& rng);
+	// connection to wi and phase function sampling in the medium
+	bool Scatter(const LayeredEvalSetup& e, BSDFState& s, RandomEngine& rng);
+	// connection to wi and reflection sampling at an interface
+	bool Interface(const LayeredEvalSetup& e, BSDFState& s, RandomEngine& rng);
+
+	// Scatter and Interface split around their sampling, so that lanes of a packet can sample at once.
+	// Connect adds the connection to wis from the event, Take moves the walk along the sample and
+	// adds the connection to wi through the exit
+	void ConnectScatter(const LayeredEvalSetup& e);
+	bool TakeScatter(const LayeredEvalSetup& e, BSDFState& s, RandomEngine& rng, const PhaseSample& phaseSample);
+	void ConnectInterface(const LayeredEvalSetup& e, BSDFState& s, RandomEngine& rng);
+	bool TakeInterface(const LayeredEvalSetup& e, BSDFState& s, RandomEngine& rng, const BSDFSample& rs);
+
+	bool Advance(const LayeredEvalSetup& e, BSDFState& s, RandomEngine& rng);
+
+	// expected connection to wis from scattering on the first flight, see FreeFlight
+	void AddFirstFlight(const LayeredEvalSetup& e);
+	AtRGB FirstFlight(const LayeredEvalSetup& e, const BSDFSample& wis) const;
+	// connection to wis from the scattering event at zNext
+	AtRGB ScatterConnection(const LayeredEvalSetup& e, const BSDFSample& wis) const;
+
+	float PathLuminance(AtRGB t) const { return parentThroughput * Luminance(t); }
+
+	// contribution to F accumulated so far, not yet divided by nSamples
+	AtRGB f;
+	AtRGB throughput;
+	Vec3f w;
+	float z;
+	float zNext;
+	int depth;
+	// still on the flight from the entrance, whose connection to wis Scatter leaves out
+	bool firstFlight;
+	float parentThroughput = 1.f;
+	BSDFSample wis;
+	// shading point the walk belongs to when run in a batch
+	int point = 0;
+};
+
+// One walk of LayeredBSDF::F shared by a packet of directions wi that leave through the same interface.
+// The path is sampled as by LayeredWalk and does not depend on wi. Each lane samples its own exit wis
+// and connects every vertex to its wi with its own MIS weight against the path's sampling pdfs, so its
+// estimate has the expectation of the scalar walk's. Connections through the interfaces are evaluated
+// for all lanes at once with the packet BSDFs
+struct LayeredSharedWalk
+{
+	// wi as flipped by LayeredEvalSetup, false if no lane in group has a usable exit sample
+	bool Start(const LayeredEvalSetup& e, const Vec3Packet& wi, const bool* group, BSDFState& s, RandomEngine& rng);
+	bool Advance(const LayeredEvalSetup& e, const Vec3Packet& wi, BSDFState& s, RandomEngine& rng);
+
+	bool Scatter(const LayeredEvalSetup& e, const Vec3Packet& wi, BSDFState& s, RandomEngine& rng);
+	bool Interface(const LayeredEvalSetup& e, const Vec3Packet& wi, BSDFState& s, RandomEngine& rng);
+	// connection to wi through the exit along the sampled path.w, pdf 0 for no MIS
+	void ConnectExit(const LayeredEvalSetup& e, const Vec3Packet& wi, BSDFState& s, RandomEngine& rng, float pdf,
+		float transmittance);
+
+	// shared path, its f and wis are unused
+	LayeredWalk path;
+	BSDFSample wis[PacketWidth];
+	// lanes with a usable exit sample, the others add nothing as their scalar walk would have ended
+	bool live[PacketWidth];
+	// contributions to F accumulated so far, not yet divided by nSamples
+	RGBPacket f;
+};
+
+// Up to PacketWidth walks for the same (wo, wi) run in lockstep with masked termination.
+// Roulette, free flights, Henyey-Greenstein phase sampling and Lambertian reflection sampling are
+// computed for all lanes at once in SoA form, masked to the lanes that reached each event. Connections,
+// tabulated phase functions and other interfaces, which may nest walks of their own, run lane by lane
+struct LayeredWalkPacket
+{
+	// returns the summed contribution of count walks
+	AtRGB Run(const LayeredEvalSetup& e, BSDFState& s, RandomEngine& rng, int count, float parentThroughput);
+	void FreeFlight(const LayeredEvalSetup& e, BSDFState& s, RandomEngine& rng);
+	void Scatter(const LayeredEvalSetup& e, BSDFState& s, RandomEngine& rng);
+	void Interface(const LayeredEvalSetup& e, BSDFState& s, RandomEngine& rng);
+
+	LayeredWalk lanes[PacketWidth];
+	WalkEvent events[PacketWidth];
+	bool alive[PacketWidth];
+};
@@ -2,6 +2,7 @@
 #include <ai.h>
 
 #include "common.h"
+#include "packet.h"
 
 #define DECL_METHOD(method, number) \
     extern const AtNodeMethods* method; \
@@ -24,6 +25,10 @@ DECL_METHOD(MetalNodeMtd, 3);
 //node_loader
 node_loader
 {
+	// Arnold calls the loader once per node, pick the kernels on the first call
+	if (i == 0)
+		SelectPacketKernels();
+
 	switch (i)
 	{
 	DECL_CASE(LayeredNodeMtd, LayeredNodeName);
@@ -0,0 +1,244 @@
+#include <algorithm>
+#include <vector>
+
+#include "lobe_fit.h"
+
+static const float AlphaCandidates[] = { .005f, .02f, .05f, .1f, .2f, .35f, .55f, .8f };
+static const int NumCandidates = 8;
+
+// diffuse reflection and transmission, then glossy reflection and transmission for each candidate
+static const int NumBasis = 2 + 2 * NumCandidates;
+
+// Reference directions: stratified over the sphere plus GGX cones around the mirror and
+// straight-through directions, where narrow lobes would fall between the strata
+static const int UniformZ = 12;
+static const int UniformPhi = 8;
+static const float ConeAlphas[] = { .05f, .25f };
+static const int NumCones = 2;
+static const int PerCone = 16;
+static const int NumDirections = UniformZ * UniformPhi + NumCones * 2 * PerCone;
+
+// Fitted lobes in the order of FittedBSDF::Lobe
+static const int NumFitted = FittedBSDF::DeltaReflect;
+
+struct FitBin
+{
+	double gram[NumBasis][NumBasis] = {};
+	double proj[3][NumBasis] = {};
+	double norm[3] = {};
+	AtRGB delta = AtRGB(0.f);
+};
+
+static int GlossyBasis(int candidate, bool transmit)
+{
+	return 2 + candidate + (transmit ? NumCandidates : 0);
+}
+
+static void BasisValues(Vec3f wo, Vec3f wi, double* phi)
+{
+	phi[0] = FittedBSDF::LobeF(FittedBSDF::DiffuseReflect, 0.f, wo, wi);
+	phi[1] = FittedBSDF::LobeF(FittedBSDF::DiffuseTransmit, 0.f, wo, wi);
+	for (int c = 0; c < NumCandidates; c++)
+	{
+		phi[GlossyBasis(c, false)] = FittedBSDF::LobeF(FittedBSDF::GlossyReflect0, AlphaCandidates[c], wo, wi);
+		phi[GlossyBasis(c, true)] = FittedBSDF::LobeF(FittedBSDF::GlossyTransmit, AlphaCandidates[c], wo, wi);
+	}
+}
+
+static float DirectionPDF(Vec3f wo, Vec3f wi)
+{
+	float pdf = float(UniformZ * UniformPhi) / NumDirections * .25f * AI_ONEOVERPI;
+	for (int c = 0; c < NumCones; c++)
+	{
+		float cone = FittedBSDF::LobePDF(FittedBSDF::GlossyReflect0, ConeAlphas[c], wo, wi) +
+			FittedBSDF::LobePDF(FittedBSDF::GlossyTransmit, ConeAlphas[c], wo, wi);
+		pdf += float(PerCone) / NumDirections * cone;
+	}
+	return pdf;
+}
+
+static std::vector<Vec3f> ReferenceDirections(Vec3f wo, RandomEngine& rng)
+{
+	std::vector<Vec3f> dirs;
+
+	for (int i = 0; i < UniformZ; i++)
+	{
+		for (int j = 0; j < UniformPhi; j++)
+		{
+			float z = -1.f + 2.f * (i + Sample1D(rng)) / UniformZ;
+			float phi = 2.f * AI_PI * (j + Sample1D(rng)) / UniformPhi;
+			float r = Sqrt(1.f - z * z);
+			dirs.push_back(Vec3f(r * std::cos(phi), r * std::sin(phi), z));
+		}
+	}
+
+	for (int c = 0; c < NumCones; c++)
+	{
+		for (int i = 0; i < 2 * PerCone; i++)
+		{
+			Vec3f wh = GTR2SampleVisibleCap(wo, Sample2D(rng), ConeAlphas[c]);
+			Vec3f wi = -AiReflect(wo, wh);
+			// samples below the surface carry no density of their cone, drop them
+			if (wi.z <= 0)
+				continue;
+			dirs.push_back((i < PerCone) ? wi : Vec3f(wi.x, wi.y, -wi.z));
+		}
+	}
+	return dirs;
+}
+
+static FitBin BuildBin(const LayeredBSDF& bsdf, const BSDFState& state, int side, float cosWo, int walks,
+	RandomEngine& rng)
+{
+	FitBin bin;
+	float flip = side ? -1.f : 1.f;
+	Vec3f wo(Sqrt(1.f - cosWo * cosWo), 0.f, cosWo);
+
+	std::vector<Vec3f> dirs = ReferenceDirections(wo, rng);
+	std::vector<AtRGB> ref(dirs.size(), AtRGB(0.f));
+
+	for (size_t i = 0; i < dirs.size(); i += PacketWidth)
+	{
+		Vec3Packet wi;
+		for (int k = 0; k < PacketWidth; k++)
+			wi.Set(k, dirs[AiMin(i + k, dirs.size() - 1)] * flip);
+
+		for (int n = 0; n < walks; n++)
+		{
+			RGBPacket f;
+			bsdf.F(wo * flip, wi, state, rng, false, f);
+			for (int k = 0; k < PacketWidth && i + k < dirs.size(); k++)
+				ref[i + k] += f.Get(k) / float(walks);
+		}
+	}
+
+	for (size_t i = 0; i < dirs.size(); i++)
+	{
+		double phi[NumBasis];
+		BasisValues(wo, dirs[i], phi);
+		double r = std::abs(dirs[i].z) / (DirectionPDF(wo, dirs[i]) * dirs.size());
+
+		for (int a = 0; a < NumBasis; a++)
+		{
+			for (int b = 0; b < NumBasis; b++)
+				bin.gram[a][b] += r * phi[a] * phi[b];
+		}
+		for (int c = 0; c < 3; c++)
+		{
+			for (int a = 0; a < NumBasis; a++)
+				bin.proj[c][a] += r * phi[a] * ref[i][c];
+			bin.norm[c] += r * ref[i][c] * ref[i][c];
+		}
+	}
+
+	// F of the walk leaves out the mirror reflection of a smooth entrance
+	BSDFState s = state;
+	bsdf.Bind(s);
+	bool entTop = bsdf.twoSided || !side;
+	if (entTop ? s.topDelta : s.bottomDelta)
+	{
+		auto rs = ::Sample(entTop ? s.top : s.bottom, wo * flip, s, rng, false, BSDFFlagReflection);
+		if (!rs.IsInvalid() && IsDeltaRay(rs.type) && SameHemisphere(wo * flip, rs.wi))
+			bin.delta = rs.f / rs.pdf;
+	}
+	return bin;
+}
+
+// min x^T H x - 2 x^T g over x >= 0 by coordinate descent, returns the residual with norm = |b|^2
+static double SolveNNLS(const double H[NumFitted][NumFitted], const double g[NumFitted], double norm,
+	double x[NumFitted])
+{
+	for (int i = 0; i < NumFitted; i++)
+		x[i] = 0;
+
+	for (int iter = 0; iter < 64; iter++)
+	{
+		for (int i = 0; i < NumFitted; i++)
+		{
+			if (H[i][i] <= 0)
+				continue;
+
+			double hx = 0;
+			for (int j = 0; j < NumFitted; j++)
+				hx += H[i][j] * x[j];
+			x[i] = AiMax(0., x[i] + (g[i] - hx) / H[i][i]);
+		}
+	}
+
+	double res = norm;
+	for (int i = 0; i < NumFitted; i++)
+	{
+		res -= 2. * x[i] * g[i];
+		for (int j = 0; j < NumFitted; j++)
+			res += x[i] * H[i][j] * x[j];
+	}
+	return res;
+}
+
+// weights of one bin and channel for the basis functions in basis, returns the residual
+static double SolveBin(const FitBin& bin, int channel, const int basis[NumFitted], double x[NumFitted])
+{
+	double H[NumFitted][NumFitted], g[NumFitted];
+	for (int i = 0; i < NumFitted; i++)
+	{
+		g[i] = bin.proj[channel][basis[i]];
+		for (int j = 0; j < NumFitted; j++)
+			H[i][j] = bin.gram[basis[i]][basis[j]];
+	}
+	return SolveNNLS(H, g, bin.norm[channel], x);
+}
+
+void FitLayeredBSDF(const LayeredBSDF& bsdf, const BSDFState& state, FittedBSDF& fitted, int walks)
+{
+	RandomEngine rng(1);
+
+	for (int side = 0; side < 2; side++)
+	{
+		FitBin bins[FittedBSDF::Bins];
+		for (int b = 0; b < FittedBSDF::Bins; b++)
+			bins[b] = BuildBin(bsdf, state, side, (b + .5f) / FittedBSDF::Bins, walks, rng);
+
+		double bestError = 1e30;
+		int best[NumFitted] = {};
+
+		for (int r0 = 0; r0 < NumCandidates; r0++)
+		{
+			for (int r1 = r0 + 1; r1 < NumCandidates; r1++)
+			{
+				for (int t = 0; t < NumCandidates; t++)
+				{
+					int basis[NumFitted] = { 0, 1, GlossyBasis(r0, false), GlossyBasis(r1, false), GlossyBasis(t, true) };
+					double error = 0, x[NumFitted];
+
+					for (int b = 0; b < FittedBSDF::Bins; b++)
+					{
+						for (int c = 0; c < 3; c++)
+							error += SolveBin(bins[b], c, basis, x);
+					}
+
+					if (error < bestError)
+					{
+						bestError = error;
+						std::copy(basis, basis + NumFitted, best);
+					}
+				}
+			}
+		}
+
+		fitted.alpha[side][0] = AlphaCandidates[best[2] - 2];
+		fitted.alpha[side][1] = AlphaCandidates[best[3] - 2];
+		fitted.alpha[side][2] = AlphaCandidates[best[4] - 2 - NumCandidates];
+
+		for (int b = 0; b < FittedBSDF::Bins; b++)
+		{
+			for (int c = 0; c < 3; c++)
+			{
+				double x[NumFitted];
+				SolveBin(bins[b], c, best, x);
+				for (int lobe = 0; lobe < NumFitted; lobe++)
+					fitted.weights[side][b][lobe][c] = float(x[lobe]);
+			}
+			fitted.weights[side][b][FittedBSDF::DeltaReflect] = bins[b].delta;
+		}
+	}
+}
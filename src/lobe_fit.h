@@ -0,0 +1,9 @@
+#pragma once
+
+#include "bsdfs.h"
+
+// Fits the lobe weights and roughness of fitted to F of a layered stack, with the walk's packet
+// evaluation as reference. The error is the cosine weighted L2 distance over the sphere for each
+// cos theta_o bin; weights are solved with non-negative least squares for every roughness combination
+// of a fixed candidate set. walks is the number of walks averaged per reference direction
+void FitLayeredBSDF(const LayeredBSDF& bsdf, const BSDFState& state, FittedBSDF& fitted, int walks = 256);
@@ -0,0 +1,115 @@
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "material_pool.h"
+#include "node_cache.h"
+
+// The words hashed into a key, so content whose hashes collide is not shared
+struct PoolKey
+{
+	bool operator == (const PoolKey& other) const { return hash == other.hash && content == other.content; }
+
+	uint64_t hash;
+	std::vector<uint64_t> content;
+};
+
+struct PoolKeyHash
+{
+	size_t operator () (const PoolKey& key) const { return size_t(key.hash); }
+};
+
+// Entries are weak, the deleter of the last holder removes its entry unless it was replaced since
+template<typename T>
+struct SharedPool
+{
+	// create returns null for content without derived data, retire runs before the data is freed
+	template<typename Create, typename Retire>
+	std::shared_ptr<T> Acquire(const PoolKey& key, Create create, Retire retire)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		if (auto shared = entries[key].lock())
+			return shared;
+
+		T* data = create();
+		if (!data)
+		{
+			entries.erase(key);
+			return nullptr;
+		}
+
+		std::shared_ptr<T> shared(data, [this, key, retire](T* data)
+		{
+			retire(*data);
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				auto it = entries.find(key);
+				if (it != entries.end() && it->second.expired())
+					entries.erase(it);
+			}
+			delete data;
+		});
+		entries[key] = shared;
+		return shared;
+	}
+
+	std::mutex mutex;
+	std::unordered_map<PoolKey, std::weak_ptr<T>, PoolKeyHash> entries;
+};
+
+static SharedPool<const FresnelTable> FresnelTables;
+static SharedPool<MaterialProgram> Programs;
+
+std::shared_ptr<const FresnelTable> AcquireFresnelTable(const BSDF& bsdf)
+{
+	PoolKey key;
+	ParamHasher h;
+	h.content = &key.content;
+	h.Add(uint64_t(bsdf.index()));
+
+	if (auto dielectric = std::get_if<DielectricBSDF>(&bsdf))
+		h.Add(dielectric->ior);
+	else if (auto metal = std::get_if<MetalBSDF>(&bsdf))
+	{
+		if (metal->SchlickFresnel)
+			return nullptr;
+		h.Add(metal->ior);
+		h.Add(metal->k);
+	}
+	else
+		return nullptr;
+
+	key.hash = h.hash;
+	return FresnelTables.Acquire(key,
+		[&]() -> const FresnelTable*
+		{
+			auto table = new FresnelTable;
+			BuildFresnelTable(bsdf, *table);
+			return table;
+		},
+		[](const FresnelTable&) {});
+}
+
+// Clamps and outliers counted by all nodes that shared the program
+static void ReportEstimatorStats(const std::string& name, const MaterialProgram& program)
+{
+	uint64_t clamped = program.estimatorStats.clamped;
+	uint64_t outliers = program.estimatorStats.outliers;
+	if (clamped || outliers)
+		AiMsgInfo("[LayerMatNode] %s: %llu closure weights clamped, %llu walk outliers cut by the median",
+			name.c_str(), (unsigned long long)clamped, (unsigned long long)outliers);
+}
+
+std::shared_ptr<MaterialProgram> AcquireMaterialProgram(const AtNode* node, std::vector<const AtNode*>* sources)
+{
+	PoolKey key;
+	ParamHasher h;
+	h.content = &key.content;
+	h.Add(HashNodeContent(node, sources, &key.content));
+
+	key.hash = h.hash;
+	std::string name = AiNodeGetName(node);
+	return Programs.Acquire(key,
+		[&]() { return CompileMaterialProgram(node); },
+		[name](const MaterialProgram& program) { ReportEstimatorStats(name, program); });
+}
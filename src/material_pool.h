@@ -0,0 +1,16 @@
+#pragma once
+#include <memory>
+#include <vector>
+
+#include "material_program.h"
+
+// Process-wide store of the data derived from node parameters. Nodes of equal content share one
+// instance, found by a hash of the content, compared in full on a hit, and counted by the nodes
+// holding it. The last node to let go, in node_finish or on a rebuild, frees it and drops it from the store
+
+// Fresnel table of a metal or dielectric interface, null if it has none
+std::shared_ptr<const FresnelTable> AcquireFresnelTable(const BSDF& bsdf);
+
+// Program of a layered node, compiled only if no node of equal graph content holds one.
+// Sources as for CompileMaterialProgram
+std::shared_ptr<MaterialProgram> AcquireMaterialProgram(const AtNode* node, std::vector<const AtNode*>* sources = nullptr);
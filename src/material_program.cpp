@@ -0,0 +1,367 @@
+#include <cmath>
+#include <cstring>
+
+#include "material_program.h"
+#include "material_pool.h"
+#include "node_cache.h"
+#include "lobe_fit.h"
+
+const int MaxProgramDepth = 16;
+
+ProgramInterface::ProgramInterface(const BSDF& bsdf) : bsdf(bsdf), flags(0)
+{
+	if (::IsDelta(&bsdf))
+		flags |= InterfaceDelta;
+	if (::HasTransmit(&bsdf))
+		flags |= InterfaceTransmit;
+	if (std::holds_alternative<LayeredBSDF>(bsdf))
+		flags |= InterfaceLayered;
+}
+
+const std::vector<ProgramInterface>& MaterialProgram::Interfaces(int level) const
+{
+	level = Min(level, int(previews.size()));
+	return (level > 0) ? previews[level - 1].interfaces : interfaces;
+}
+
+const std::vector<ProgramMedium>& MaterialProgram::Media(int level) const
+{
+	level = Min(level, int(previews.size()));
+	return (level > 0) ? previews[level - 1].media : media;
+}
+
+void MaterialProgram::Bind(BSDFState& s, int medium) const
+{
+	const ProgramMedium& m = Media(s.preview)[medium];
+	const ProgramInterface& top = Interfaces(s.preview)[m.top];
+	const ProgramInterface& bottom = Interfaces(s.preview)[m.bottom];
+
+	s.top = &top.bsdf;
+	s.bottom = &bottom.bsdf;
+	s.topDelta = ::IsDelta(&top.bsdf, s);
+	s.bottomDelta = ::IsDelta(&bottom.bsdf, s);
+	s.nTop = LocalUp;
+	s.nBottom = LocalUp;
+	s.topVariance = 0.f;
+	s.bottomVariance = 0.f;
+	s.medium = medium;
+}
+
+static void ScaleWalk(LayeredBSDF& bsdf, int level)
+{
+	bsdf.maxDepth = AiMax(int(std::ldexp(float(bsdf.maxDepth), -level) + .5f), 2);
+	// the median of means keeps its groups so previews match the final look
+	bsdf.nSamples = (bsdf.estimator == LayeredEstimator::MedianOfMeans) ? AiMin(bsdf.nSamples, MedianGroups) : 1;
+	bsdf.fastMath = true;
+}
+
+void MaterialProgram::BuildPreviews()
+{
+	previews.assign(MaxPreviewLevel, { interfaces, media });
+
+	for (int level = 1; level <= MaxPreviewLevel; level++)
+	{
+		ProgramPreview& preview = previews[level - 1];
+		for (auto& m : preview.media)
+			ScaleWalk(m.bsdf, level);
+
+		// nested media walk from their copies in the interfaces
+		for (auto& interf : preview.interfaces)
+		{
+			if (auto layered = std::get_if<LayeredBSDF>(&interf.bsdf))
+				ScaleWalk(*layered, level);
+		}
+	}
+}
+
+static bool IsNodeType(const AtNode* node, const char* typeName)
+{
+	return std::strcmp(GetNodeTypeName(node).c_str(), typeName) == 0;
+}
+
+static const AtNode* GetNodeParamNode(const AtNode* node, const char* param)
+{
+	return reinterpret_cast<const AtNode*>(AiNodeGetPtr(node, param));
+}
+
+// Interface BSDF of a non-layered node from its parameter values
+static BSDF InterfaceFromNode(const AtNode* node)
+{
+	if (!node || GetNodeTypeName(node).empty())
+		return FakeBSDF();
+	else if (IsNodeType(node, LambertNodeName))
+	{
+		LambertBSDF lambert;
+		lambert.albedo = AiNodeGetRGB(node, "albedo");
+		return lambert;
+	}
+	else if (IsNodeType(node, DielectricNodeName))
+	{
+		DielectricBSDF dielectric;
+		dielectric.ior = AiNodeGetFlt(node, "ior");
+		dielectric.alpha = AiSqr(AiNodeGetFlt(node, "roughness"));
+		dielectric.multiScatter = AiNodeGetBool(node, "multiple_scattering");
+		return dielectric;
+	}
+	else if (IsNodeType(node, MetalNodeName))
+	{
+		MetalBSDF metal;
+		metal.albedo = AiNodeGetRGB(node, "albedo");
+		bool rgbIor = AiNodeGetBool(node, "use_rgb_ior");
+		metal.ior = rgbIor ? AiNodeGetRGB(node, "ior_rgb") : AtRGB(AiNodeGetFlt(node, "ior"));
+		metal.k = rgbIor ? AiNodeGetRGB(node, "k_rgb") : AtRGB(AiNodeGetFlt(node, "k"));
+		metal.alpha = AiSqr(AiNodeGetFlt(node, "roughness"));
+		metal.SchlickFresnel = AiNodeGetBool(node, "schlick_f");
+		metal.multiScatter = AiNodeGetBool(node, "multiple_scattering");
+		return metal;
+	}
+	return FakeBSDF();
+}
+
+bool BuildFresnelTable(const BSDF& bsdf, FresnelTable& table)
+{
+	if (auto dielectric = std::get_if<DielectricBSDF>(&bsdf))
+	{
+		table.BuildDielectric(dielectric->ior);
+		return true;
+	}
+	else if (auto metal = std::get_if<MetalBSDF>(&bsdf))
+	{
+		if (metal->SchlickFresnel)
+			return false;
+		table.BuildConductor(metal->ior, metal->k);
+		return true;
+	}
+	return false;
+}
+
+void BuildNodeFresnelTable(const AtNode* node, FresnelNodeData& data)
+{
+	static const char* fresnelParams[] = { "ior", "k", "ior_rgb", "k_rgb", "use_rgb_ior", "schlick_f" };
+
+	for (auto param : fresnelParams)
+	{
+		if (AiNodeEntryLookUpParameter(AiNodeGetNodeEntry(node), param) && AiNodeIsLinked(node, param))
+		{
+			data.table.reset();
+			return;
+		}
+	}
+	data.table = AcquireFresnelTable(InterfaceFromNode(node));
+}
+
+// All parameters but the links to the nodes below
+static void AddOwnParams(ParamHasher& h, const AtNode* node)
+{
+	if (IsNodeType(node, LayeredNodeName))
+	{
+		h.Add(AiNodeGetFlt(node, "thickness"));
+		h.Add(AiNodeGetFlt(node, "g"));
+		h.Add(AiNodeGetRGB(node, "albedo"));
+		h.Add(AiNodeGetBool(node, "fast_math"));
+		h.Add(AiNodeGetStr(node, "baked_file").c_str());
+		h.Add(AiNodeGetBool(node, "fit_lobes"));
+		h.Add(AiNodeGetStr(node, "phase_file").c_str());
+		h.Add(uint64_t(AiNodeGetInt(node, "estimator")));
+		h.Add(uint64_t(AiNodeGetInt(node, "walk_samples")));
+		h.Add(AiNodeGetFlt(node, "clamp_scale"));
+		return;
+	}
+
+	BSDF bsdf = InterfaceFromNode(node);
+	h.Add(uint64_t(bsdf.index()));
+
+	if (auto lambert = std::get_if<LambertBSDF>(&bsdf))
+		h.Add(lambert->albedo);
+	else if (auto dielectric = std::get_if<DielectricBSDF>(&bsdf))
+	{
+		h.Add(dielectric->ior);
+		h.Add(dielectric->alpha);
+		h.Add(dielectric->multiScatter);
+	}
+	else if (auto metal = std::get_if<MetalBSDF>(&bsdf))
+	{
+		h.Add(metal->albedo);
+		h.Add(metal->ior);
+		h.Add(metal->k);
+		h.Add(metal->alpha);
+		h.Add(metal->SchlickFresnel);
+		h.Add(metal->multiScatter);
+	}
+}
+
+uint64_t HashNodeParams(const AtNode* node)
+{
+	ParamHasher h;
+	AddOwnParams(h, node);
+
+	if (IsNodeType(node, LayeredNodeName))
+	{
+		h.Add(GetNodeParamNode(node, "top_node"));
+		h.Add(GetNodeParamNode(node, "bottom_node"));
+	}
+	return h.hash;
+}
+
+// Reaches the same nodes as ProgramCompiler, nodes it would replace by an empty interface hash alike
+static uint64_t HashGraphContent(const AtNode* node, int depth, std::vector<const AtNode*>* sources,
+	std::vector<uint64_t>* content)
+{
+	ParamHasher h;
+	h.content = content;
+	if (depth > 0)
+	{
+		if (!node || GetNodeTypeName(node).empty() || depth > MaxProgramDepth)
+			return h.hash;
+
+		// parameters may have changed since the source's own node_update
+		UpdateNodeRevision(node, HashNodeParams(node));
+		if (sources)
+			sources->push_back(node);
+	}
+
+	AddOwnParams(h, node);
+	if (IsNodeType(node, LayeredNodeName))
+	{
+		h.Add(HashGraphContent(GetNodeParamNode(node, "top_node"), depth + 1, sources, content));
+		h.Add(HashGraphContent(GetNodeParamNode(node, "bottom_node"), depth + 1, sources, content));
+	}
+	return h.hash;
+}
+
+uint64_t HashNodeContent(const AtNode* node, std::vector<const AtNode*>* sources, std::vector<uint64_t>* content)
+{
+	return HashGraphContent(node, 0, sources, content);
+}
+
+struct ProgramCompiler
+{
+	int CompileInterface(const AtNode* node, int depth);
+	int CompileMedium(const AtNode* node, int depth);
+	void AddSource(const AtNode* node);
+	void AttachFresnelTable(BSDF& bsdf);
+
+	MaterialProgram& program;
+	std::vector<const AtNode*>* sources;
+};
+
+void ProgramCompiler::AddSource(const AtNode* node)
+{
+	// parameters may have changed since the source's own node_update
+	UpdateNodeRevision(node, HashNodeParams(node));
+	if (sources)
+		sources->push_back(node);
+}
+
+void ProgramCompiler::AttachFresnelTable(BSDF& bsdf)
+{
+	auto table = AcquireFresnelTable(bsdf);
+	if (!table)
+		return;
+
+	if (auto dielectric = std::get_if<DielectricBSDF>(&bsdf))
+		dielectric->fresnel = table.get();
+	else if (auto metal = std::get_if<MetalBSDF>(&bsdf))
+		metal->fresnel = table.get();
+	program.fresnelTables.push_back(std::move(table));
+}
+
+int ProgramCompiler::CompileInterface(const AtNode* node, int depth)
+{
+	BSDF bsdf = FakeBSDF();
+
+	if (!node || GetNodeTypeName(node).empty())
+		;
+	else if (depth > MaxProgramDepth)
+		AiMsgWarning("[LayerMatNode] layer graph deeper than %d, treating %s as empty", MaxProgramDepth, AiNodeGetName(node));
+	else
+	{
+		AddSource(node);
+		if (IsNodeType(node, LayeredNodeName))
+			bsdf = program.media[CompileMedium(node, depth)].bsdf;
+		else
+		{
+			bsdf = InterfaceFromNode(node);
+			AttachFresnelTable(bsdf);
+		}
+	}
+
+	program.interfaces.push_back(ProgramInterface(bsdf));
+	return int(program.interfaces.size()) - 1;
+}
+
+int ProgramCompiler::CompileMedium(const AtNode* node, int depth)
+{
+	int index = int(program.media.size());
+	program.media.push_back({});
+
+	LayeredBSDF layered;
+	layered.thickness = AiNodeGetFlt(node, "thickness");
+	layered.g = AiNodeGetFlt(node, "g");
+	layered.albedo = AiNodeGetRGB(node, "albedo");
+	layered.fastMath = AiNodeGetBool(node, "fast_math");
+	layered.estimator = LayeredEstimator(AiNodeGetInt(node, "estimator"));
+	layered.nSamples = AiMax(AiNodeGetInt(node, "walk_samples"), 1);
+	// the median needs a walk per group, fewer would silently give the plain mean
+	if (layered.estimator == LayeredEstimator::MedianOfMeans && layered.nSamples < MedianGroups)
+	{
+		AiMsgWarning("[LayerMatNode] %s: median_of_means needs walk_samples >= %d, raised from %d", AiNodeGetName(node),
+			MedianGroups, layered.nSamples);
+		layered.nSamples = MedianGroups;
+	}
+	layered.clampScale = AiNodeGetFlt(node, "clamp_scale");
+	layered.stats = &program.estimatorStats;
+	layered.program = &program;
+	layered.medium = index;
+
+	AtString bakedFile = AiNodeGetStr(node, "baked_file");
+	if (!bakedFile.empty())
+	{
+		auto table = OpenBakedTable(bakedFile.c_str());
+		layered.baked = table.get();
+		if (table)
+			program.bakedTables.push_back(std::move(table));
+	}
+
+	AtString phaseFile = AiNodeGetStr(node, "phase_file");
+	if (!phaseFile.empty())
+	{
+		auto table = std::make_unique<PhaseTable>();
+		if (ReadPhaseTable(phaseFile.c_str(), *table))
+		{
+			layered.phaseTable = table.get();
+			program.phaseTables.push_back(std::move(table));
+		}
+		else
+			AiMsgWarning("[LayerMatNode] cannot read phase table %s, using g", phaseFile.c_str());
+	}
+
+	int top = CompileInterface(GetNodeParamNode(node, "top_node"), depth + 1);
+	int bottom = CompileInterface(GetNodeParamNode(node, "bottom_node"), depth + 1);
+
+	program.media[index] = { layered, top, bottom };
+
+	// the root's albedo may be textured, its closure detects again
+	BSDFState state;
+	program.Bind(state, index);
+	program.media[index].bsdf.DetectClosedForm(state);
+	return index;
+}
+
+MaterialProgram* CompileMaterialProgram(const AtNode* node, std::vector<const AtNode*>* sources)
+{
+	auto program = new MaterialProgram;
+	ProgramCompiler compiler{ *program, sources };
+	compiler.CompileMedium(node, 0);
+
+	if (AiNodeGetBool(node, "fit_lobes"))
+	{
+		BSDFState state;
+		program->Bind(state, 0);
+		program->fitted = std::make_unique<FittedBSDF>();
+		FitLayeredBSDF(program->Root().bsdf, state, *program->fitted);
+	}
+
+	program->BuildPreviews();
+	return program;
+}
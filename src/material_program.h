@@ -0,0 +1,89 @@
+#pragma once
+#include <memory>
+#include <vector>
+
+#include "bsdfs.h"
+#include "baked_table.h"
+
+enum ProgramInterfaceFlag
+{
+	InterfaceDelta = 1 << 0,
+	InterfaceTransmit = 1 << 1,
+	InterfaceLayered = 1 << 2,
+};
+
+struct ProgramInterface
+{
+	ProgramInterface(const BSDF& bsdf);
+
+	bool IsDelta() const { return flags & InterfaceDelta; }
+	bool HasTransmit() const { return flags & InterfaceTransmit; }
+	bool IsLayered() const { return flags & InterfaceLayered; }
+
+	BSDF bsdf;
+	int flags;
+};
+
+struct ProgramMedium
+{
+	LayeredBSDF bsdf;
+	// indices into MaterialProgram::interfaces
+	int top;
+	int bottom;
+};
+
+// previews of quality down to 2^-MaxPreviewLevel, lower passes use the last
+const int MaxPreviewLevel = 5;
+
+// Interfaces and media of a program with the walks shortened for the passes of a progressive render
+struct ProgramPreview
+{
+	std::vector<ProgramInterface> interfaces;
+	std::vector<ProgramMedium> media;
+};
+
+// Flattened layered node graph, compiled in node_update and shared read-only by all shading threads.
+// Nested layered nodes become interfaces referring to another medium of the same program.
+// Medium 0 is the root node itself
+struct MaterialProgram
+{
+	// binds the interfaces of the preview level of s
+	void Bind(BSDFState& s, int medium) const;
+	// Copies the interfaces and media into the previews, level k with walks of quality 2^-k
+	void BuildPreviews();
+
+	const std::vector<ProgramInterface>& Interfaces(int level) const;
+	const std::vector<ProgramMedium>& Media(int level) const;
+	const ProgramMedium& Root(int level = 0) const { return Media(level)[0]; }
+
+	std::vector<ProgramInterface> interfaces;
+	std::vector<ProgramMedium> media;
+	// referred to by the metal and dielectric interfaces, pooled with the nodes and programs of equal ones
+	std::vector<std::shared_ptr<const FresnelTable>> fresnelTables;
+	// mappings of the media replaced by baked tables
+	std::vector<std::shared_ptr<const BakedTable>> bakedTables;
+	// tabulated phase functions of the media, replacing their g
+	std::vector<std::unique_ptr<PhaseTable>> phaseTables;
+	// clamps and rejected outliers of all media's estimators
+	EstimatorStats estimatorStats;
+	// lobes fitted to the root medium, replacing it in the node's closure when set
+	std::unique_ptr<FittedBSDF> fitted;
+	// level k at previews[k - 1], none for programs that are never shaded progressively
+	std::vector<ProgramPreview> previews;
+};
+
+// Nodes the program was compiled from, apart from node itself, are appended to sources
+MaterialProgram* CompileMaterialProgram(const AtNode* node, std::vector<const AtNode*>* sources = nullptr);
+
+// False for interfaces without a tabulated Fresnel term
+bool BuildFresnelTable(const BSDF& bsdf, FresnelTable& table);
+// Table of a metal or dielectric node from its parameter values, invalid if they are linked
+void BuildNodeFresnelTable(const AtNode* node, FresnelNodeData& data);
+
+// Hash of the parameters of any plugin node that the program compiler reads
+uint64_t HashNodeParams(const AtNode* node);
+// Hash of everything the program of a layered node is compiled from, the nodes below standing for
+// their parameters instead of their identity. Sources as for CompileMaterialProgram, the hashed
+// words are appended to content
+uint64_t HashNodeContent(const AtNode* node, std::vector<const AtNode*>* sources = nullptr,
+	std::vector<uint64_t>* content = nullptr);
@@ -1,4 +1,6 @@
 #include "bsdfs.h"
+#include "material_program.h"
+#include "node_cache.h"
 
 AI_SHADER_NODE_EXPORT_METHODS(MetalNodeMtd);
 
@@ -8,7 +10,11 @@ enum MetalNodeParams
 	p_ior,
 	p_k,
 	p_roughness,
-	p_schlick_f
+	p_schlick_f,
+	p_ior_rgb,
+	p_k_rgb,
+	p_use_rgb_ior,
+	p_multiple_scattering,
 };
 
 node_parameters
@@ -19,34 +25,51 @@ node_parameters
 	AiParameterFlt("k", .1f);
 	AiParameterFlt("roughness", .2f);
 	AiParameterBool("schlick_f", true);
+	AiParameterRGB("ior_rgb", .18f, .42f, 1.37f);
+	AiParameterRGB("k_rgb", 3.42f, 2.35f, 1.77f);
+	AiParameterBool("use_rgb_ior", false);
+	AiParameterBool("multiple_scattering", false);
 }
 
 node_initialize
 {
-	auto bsdf = new BSDF;
-	*bsdf = MetalBSDF();
-	AiNodeSetLocalData(node, bsdf);
+	AiNodeSetLocalData(node, new FresnelNodeData);
 }
 
 node_update
 {
+	BuildNodeFresnelTable(node, GetNodeLocalDataRef<FresnelNodeData>(node));
+	UpdateNodeRevision(node, HashNodeParams(node));
+	RebuildStaleDependents(node);
 }
 
 node_finish
 {
-	//delete GetNodeLocalDataPtr<BSDF>(node);
+	RemoveNodeFromCache(node);
+	delete GetNodeLocalDataPtr<FresnelNodeData>(node);
 }
 
 shader_evaluate
 {
 	MetalBSDF metalBSDF;
 	metalBSDF.albedo = AiShaderEvalParamRGB(p_albedo);
-	metalBSDF.ior = AiShaderEvalParamFlt(p_ior);
-	metalBSDF.k = AiShaderEvalParamFlt(p_k);
 	metalBSDF.alpha = AiSqr(AiShaderEvalParamFlt(p_roughness));
 	metalBSDF.SchlickFresnel = AiShaderEvalParamBool(p_schlick_f);
+	metalBSDF.multiScatter = AiShaderEvalParamBool(p_multiple_scattering);
 
-	GetNodeLocalDataRef<BSDF>(node) = metalBSDF;
+	auto& fresnel = GetNodeLocalDataRef<FresnelNodeData>(node);
+	if (fresnel.table)
+		metalBSDF.fresnel = fresnel.table.get();
+	else if (AiShaderEvalParamBool(p_use_rgb_ior))
+	{
+		metalBSDF.ior = AiShaderEvalParamRGB(p_ior_rgb);
+		metalBSDF.k = AiShaderEvalParamRGB(p_k_rgb);
+	}
+	else
+	{
+		metalBSDF.ior = AtRGB(AiShaderEvalParamFlt(p_ior));
+		metalBSDF.k = AtRGB(AiShaderEvalParamFlt(p_k));
+	}
 
 	if (sg->Rt & AI_RAY_SHADOW)
 		return;
@@ -1,3 +1,5 @@
+#include <limits>
+
 #include "microfacet.h"
 
 float GTR2(float cosTheta, float alpha)
@@ -18,7 +20,7 @@ float GTR2Visible(Vec3f wm, Vec3f wo, float alpha)
     return GTR2(wm.z, alpha) * SchlickG(wo.z, alpha) * AbsDot(wm, wo) / std::abs(wo.z);
 }
 
-Vec3f GTR2Sample(Vec3f wo, Vec2f u, float alpha)
+Vec3f GTR2Sample(Vec3f, Vec2f u, float alpha)
 {
     Vec2f p = ToConcentricDisk(u);
     Vec3f wh = Vec3f(p.x, p.y, Sqrt(1.f - Dot(p, p)));
@@ -41,6 +43,50 @@ Vec3f GTR2SampleVisible(Vec3f wo, Vec2f u, float alpha)
     return Normalize(Vec3f(wh.x * alpha, wh.y * alpha, Max(0.0f, wh.z)));
 }
 
+float SmithLambda(float cosTheta, float alpha)
+{
+    float cos2 = cosTheta * cosTheta;
+    if (cos2 < 1e-12f)
+        return std::numeric_limits<float>::infinity();
+
+    float tan2 = Max(0.0f, 1.0f - cos2) / cos2;
+    return (std::sqrt(1.0f + alpha * alpha * tan2) - 1.0f) * 0.5f;
+}
+
+float SmithG1(float cosTheta, float alpha)
+{
+    return 1.0f / (1.0f + SmithLambda(cosTheta, alpha));
+}
+
+float SmithGCorrelated(float cosThetaO, float cosThetaI, float alpha)
+{
+    return 1.0f / (1.0f + SmithLambda(cosThetaO, alpha) + SmithLambda(cosThetaI, alpha));
+}
+
+float GTR2VisibleSmith(Vec3f wm, Vec3f wo, float alpha)
+{
+    if (wo.z == 0.0f)
+        return 0.0f;
+    return GTR2(wm.z, alpha) * SmithG1(wo.z, alpha) * AbsDot(wm, wo) / std::abs(wo.z);
+}
+
+Vec3f GTR2SampleVisibleCap(Vec3f wo, Vec2f u, float alpha)
+{
+    // stretch to the hemisphere configuration, seen from above
+    Vec3f wi = Normalize(Vec3f(wo.x * alpha, wo.y * alpha, wo.z));
+    if (wi.z < 0.0f)
+        wi = -wi;
+
+    // uniform point on the spherical cap cut off by the plane z = -wi.z
+    float phi = AI_PI * 2.0f * u.x;
+    float z = (1.0f - u.y) * (1.0f + wi.z) - wi.z;
+    float sinTheta = Sqrt(Max(0.0f, 1.0f - z * z));
+    Vec3f c(sinTheta * std::cos(phi), sinTheta * std::sin(phi), z);
+
+    Vec3f h = c + wi;
+    return Normalize(Vec3f(h.x * alpha, h.y * alpha, Max(1e-6f, h.z)));
+}
+
 float SchlickG(float cosTheta, float alpha)
 {
     float k = alpha * 0.5f;
@@ -52,6 +98,46 @@ float SmithG(float cosThetaO, float cosThetaI, float alpha)
     return SchlickG(std::abs(cosThetaO), alpha) * SchlickG(std::abs(cosThetaI), alpha);
 }
 
+float FresnelDielectric(float cosTi, float eta)
+{
+    cosTi = AiClamp(cosTi, -1.f, 1.f);
+    if (cosTi < 0.0f)
+    {
+        eta = 1.f / eta;
+        cosTi = -cosTi;
+    }
+
+    float sinTi = Sqrt(1.f - cosTi * cosTi);
+    float sinTt = sinTi / eta;
+    if (sinTt >= 1.f)
+        return 1.f;
+
+    float cosTt = Sqrt(1.f - sinTt * sinTt);
+
+    float rPa = (cosTi - eta * cosTt) / (cosTi + eta * cosTt);
+    float rPe = (eta * cosTi - cosTt) / (eta * cosTi + cosTt);
+    return (rPa * rPa + rPe * rPe) * .5f;
+}
+
+float FresnelConductor(float cosI, float eta, float k)
+{
+    Vec2c etak(eta, k);
+    Vec2c cosThetaI(AiClamp(cosI, 0.f, 1.f), 0.f);
+
+    Vec2c sin2ThetaI(1.f - cosThetaI.LengthSqr(), 0.f);
+    Vec2c sin2ThetaT = sin2ThetaI / (etak * etak);
+    Vec2c cosThetaT = (Vec2c(1.f, 0.f) - sin2ThetaT).Sqrt();
+
+    Vec2c rPa = (etak * cosThetaI - cosThetaT) / (etak * cosThetaI + cosThetaT);
+    Vec2c rPe = (cosThetaI - etak * cosThetaT) / (cosThetaI + etak * cosThetaT);
+    return (rPa.LengthSqr() + rPe.LengthSqr()) * .5f;
+}
+
+AtRGB FresnelConductor(float cosI, AtRGB eta, AtRGB k)
+{
+    return AtRGB(FresnelConductor(cosI, eta.r, k.r), FresnelConductor(cosI, eta.g, k.g), FresnelConductor(cosI, eta.b, k.b));
+}
+
 AtRGB SchlickF(float cosTheta, AtRGB F0)
 {
     return F0 + (AtRGB(1.f) - F0) * Pow5(1.f - cosTheta);
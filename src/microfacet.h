@@ -7,8 +7,23 @@ float GTR2Visible(Vec3f wm, Vec3f wo, float alpha);
 Vec3f GTR2Sample(Vec3f wo, Vec2f u, float alpha);
 Vec3f GTR2SampleVisible(Vec3f wo, Vec2f u, float alpha);
 
+// Smith masking for GTR2, consistent with the visible normal sampling below
+float SmithLambda(float cosTheta, float alpha);
+float SmithG1(float cosTheta, float alpha);
+// height-correlated masking-shadowing
+float SmithGCorrelated(float cosThetaO, float cosThetaI, float alpha);
+// D(wm) G1(wo) |wo.wm| / |wo.z|, the density of normals seen from wo on either side of the surface
+float GTR2VisibleSmith(Vec3f wm, Vec3f wo, float alpha);
+// samples GTR2VisibleSmith by spherical caps (Dupuy & Benyoub 2023), the returned normal has z > 0
+Vec3f GTR2SampleVisibleCap(Vec3f wo, Vec2f u, float alpha);
+
 float SchlickG(float cosTheta, float alpha);
 float SmithG(float cosThetaO, float cosThetaI, float alpha);
 
+// cosThetaI < 0 for incidence from the inside of the dielectric
+float FresnelDielectric(float cosThetaI, float eta);
+float FresnelConductor(float cosThetaI, float eta, float k);
+AtRGB FresnelConductor(float cosThetaI, AtRGB eta, AtRGB k);
+
 AtRGB SchlickF(float cosTheta, AtRGB F0);
 AtRGB SchlickF(float cosTheta, AtRGB F0, float roughness);
\ No newline at end of file
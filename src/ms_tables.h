@@ -0,0 +1,4248 @@
+// Generated by tools/ms_tables.cpp, do not edit
+// 65536 samples per entry, see energy_compensation.h for the layout
+#pragma once
+
+static const float ConductorAlbedoTable[1024] =
+{
+	0.994155f, 0.999998f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.892641f, 0.999422f, 0.999852f, 0.999946f, 0.999969f, 0.999975f, 0.999978f, 0.999980f,
+	0.999981f, 0.999997f, 0.999998f, 0.999998f, 0.999998f, 0.999999f, 0.999999f, 0.999999f,
+	0.999999f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.954186f, 0.990106f, 0.997706f, 0.998994f, 0.999426f, 0.999670f, 0.999768f, 0.999826f,
+	0.999862f, 0.999891f, 0.999908f, 0.999939f, 0.999945f, 0.999964f, 0.999968f, 0.999970f,
+	0.999973f, 0.999975f, 0.999976f, 0.999978f, 0.999979f, 0.999980f, 0.999980f, 0.999981f,
+	0.999982f, 0.999982f, 0.999983f, 0.999983f, 0.999993f, 0.999999f, 1.000000f, 0.999985f,
+	0.978302f, 0.954729f, 0.987362f, 0.994531f, 0.997029f, 0.998108f, 0.998698f, 0.999047f,
+	0.999276f, 0.999401f, 0.999495f, 0.999605f, 0.999647f, 0.999710f, 0.999757f, 0.999770f,
+	0.999785f, 0.999795f, 0.999832f, 0.999840f, 0.999846f, 0.999848f, 0.999841f, 0.999863f,
+	0.999878f, 0.999881f, 0.999884f, 0.999886f, 0.999903f, 0.999905f, 0.999918f, 0.999923f,
+	0.987530f, 0.911228f, 0.962399f, 0.982082f, 0.989904f, 0.993624f, 0.995625f, 0.996780f,
+	0.997536f, 0.998047f, 0.998416f, 0.998679f, 0.998867f, 0.999008f, 0.999131f, 0.999243f,
+	0.999315f, 0.999381f, 0.999427f, 0.999484f, 0.999514f, 0.999550f, 0.999585f, 0.999593f,
+	0.999634f, 0.999649f, 0.999647f, 0.999655f, 0.999675f, 0.999717f, 0.999736f, 0.999722f,
+	0.991893f, 0.891699f, 0.929168f, 0.959461f, 0.975445f, 0.983953f, 0.988804f, 0.991768f,
+	0.993692f, 0.994988f, 0.995940f, 0.996618f, 0.997095f, 0.997520f, 0.997818f, 0.998051f,
+	0.998263f, 0.998436f, 0.998579f, 0.998684f, 0.998766f, 0.998834f, 0.998919f, 0.998979f,
+	0.999050f, 0.999103f, 0.999148f, 0.999185f, 0.999241f, 0.999246f, 0.999285f, 0.999304f,
+	0.994262f, 0.893906f, 0.902897f, 0.931764f, 0.953654f, 0.967782f, 0.976738f, 0.982567f,
+	0.986507f, 0.989239f, 0.991213f, 0.992648f, 0.993755f, 0.994604f, 0.995281f, 0.995818f,
+	0.996268f, 0.996612f, 0.996901f, 0.997147f, 0.997374f, 0.997563f, 0.997720f, 0.997851f,
+	0.997952f, 0.998061f, 0.998175f, 0.998286f, 0.998352f, 0.998414f, 0.998469f, 0.998520f,
+	0.995659f, 0.905017f, 0.890273f, 0.907725f, 0.929085f, 0.946487f, 0.959279f, 0.968424f,
+	0.974997f, 0.979787f, 0.983328f, 0.986000f, 0.988046f, 0.989652f, 0.990957f, 0.991990f,
+	0.992813f, 0.993483f, 0.994086f, 0.994578f, 0.994999f, 0.995336f, 0.995657f, 0.995908f,
+	0.996131f, 0.996351f, 0.996542f, 0.996714f, 0.996857f, 0.996957f, 0.997074f, 0.997191f,
+	0.996525f, 0.917417f, 0.888689f, 0.892282f, 0.907418f, 0.923993f, 0.938457f, 0.950092f,
+	0.959180f, 0.966213f, 0.971661f, 0.975930f, 0.979289f, 0.981966f, 0.984127f, 0.985905f,
+	0.987366f, 0.988577f, 0.989583f, 0.990439f, 0.991169f, 0.991795f, 0.992338f, 0.992832f,
+	0.993251f, 0.993609f, 0.993924f, 0.994197f, 0.994442f, 0.994680f, 0.994898f, 0.995080f,
+	0.997076f, 0.928228f, 0.893123f, 0.885256f, 0.891879f, 0.904168f, 0.917461f, 0.929712f,
+	0.940270f, 0.949076f, 0.956312f, 0.962229f, 0.967059f, 0.971037f, 0.974311f, 0.977027f,
+	0.979310f, 0.981226f, 0.982846f, 0.984238f, 0.985427f, 0.986455f, 0.987336f, 0.988133f,
+	0.988829f, 0.989431f, 0.989944f, 0.990427f, 0.990860f, 0.991240f, 0.991584f, 0.991891f,
+	0.997424f, 0.936764f, 0.899723f, 0.884063f, 0.882644f, 0.889048f, 0.898939f, 0.909781f,
+	0.920259f, 0.929774f, 0.938138f, 0.945343f, 0.951500f, 0.956749f, 0.961207f, 0.965003f,
+	0.968248f, 0.971006f, 0.973402f, 0.975473f, 0.977263f, 0.978819f, 0.980179f, 0.981379f,
+	0.982446f, 0.983384f, 0.984214f, 0.984968f, 0.985628f, 0.986231f, 0.986776f, 0.987269f,
+	0.997632f, 0.943108f, 0.906306f, 0.885970f, 0.878170f, 0.878712f, 0.884160f, 0.892120f,
+	0.901035f, 0.909997f, 0.918494f, 0.926290f, 0.933289f, 0.939504f, 0.944971f, 0.949770f,
+	0.953982f, 0.957665f, 0.960887f, 0.963722f, 0.966229f, 0.968423f, 0.970376f, 0.972096f,
+	0.973632f, 0.975007f, 0.976242f, 0.977347f, 0.978340f, 0.979242f, 0.980056f, 0.980792f,
+	0.997741f, 0.947575f, 0.911815f, 0.888931f, 0.876579f, 0.872104f, 0.873049f, 0.877437f,
+	0.883802f, 0.891135f, 0.898764f, 0.906276f, 0.913411f, 0.920062f, 0.926152f, 0.931680f,
+	0.936678f, 0.941162f, 0.945186f, 0.948795f, 0.952024f, 0.954916f, 0.957511f, 0.959845f,
+	0.961949f, 0.963834f, 0.965547f, 0.967088f, 0.968488f, 0.969769f, 0.970928f, 0.971990f,
+	0.997774f, 0.950463f, 0.915862f, 0.891672f, 0.876242f, 0.867844f, 0.864781f, 0.865543f,
+	0.868907f, 0.873929f, 0.879910f, 0.886343f, 0.892897f, 0.899331f, 0.905502f, 0.911332f,
+	0.916768f, 0.921805f, 0.926445f, 0.930688f, 0.934571f, 0.938125f, 0.941356f, 0.944308f,
+	0.946998f, 0.949458f, 0.951693f, 0.953743f, 0.955616f, 0.957339f, 0.958913f, 0.960362f,
+	0.997748f, 0.952044f, 0.918351f, 0.893496f, 0.876011f, 0.864671f, 0.858285f, 0.855743f,
+	0.856084f, 0.858504f, 0.862361f, 0.867150f, 0.872498f, 0.878115f, 0.883806f, 0.889423f,
+	0.894865f, 0.900078f, 0.905016f, 0.909664f, 0.914015f, 0.918067f, 0.921841f, 0.925338f,
+	0.928577f, 0.931581f, 0.934357f, 0.936921f, 0.939297f, 0.941492f, 0.943526f, 0.945414f,
+	0.997674f, 0.952534f, 0.919355f, 0.894062f, 0.875151f, 0.861619f, 0.852571f, 0.847192f,
+	0.844734f, 0.844553f, 0.846096f, 0.848911f, 0.852631f, 0.856962f, 0.861672f, 0.866592f,
+	0.871584f, 0.876546f, 0.881409f, 0.886127f, 0.890653f, 0.894980f, 0.899084f, 0.902969f,
+	0.906635f, 0.910084f, 0.913321f, 0.916355f, 0.919204f, 0.921871f, 0.924365f, 0.926701f,
+	0.997560f, 0.952103f, 0.918990f, 0.893253f, 0.873245f, 0.858023f, 0.846852f, 0.839091f,
+	0.834161f, 0.831546f, 0.830793f, 0.831514f, 0.833378f, 0.836111f, 0.839481f, 0.843303f,
+	0.847429f, 0.851738f, 0.856135f, 0.860547f, 0.864918f, 0.869204f, 0.873379f, 0.877412f,
+	0.881297f, 0.885016f, 0.888573f, 0.891957f, 0.895180f, 0.898236f, 0.901135f, 0.903880f,
+	0.997412f, 0.950886f, 0.917387f, 0.891069f, 0.870087f, 0.853475f, 0.840561f, 0.830804f,
+	0.823727f, 0.818916f, 0.815999f, 0.814651f, 0.814586f, 0.815555f, 0.817354f, 0.819802f,
+	0.822743f, 0.826055f, 0.829638f, 0.833399f, 0.837266f, 0.841185f, 0.845113f, 0.849005f,
+	0.852841f, 0.856595f, 0.860254f, 0.863800f, 0.867230f, 0.870533f, 0.873714f, 0.876764f,
+	0.997239f, 0.948990f, 0.914678f, 0.887573f, 0.865608f, 0.847752f, 0.833338f, 0.821866f,
+	0.812921f, 0.806153f, 0.801249f, 0.797935f, 0.795970f, 0.795141f, 0.795258f, 0.796160f,
+	0.797706f, 0.799769f, 0.802251f, 0.805056f, 0.808114f, 0.811351f, 0.814721f, 0.818170f,
+	0.821667f, 0.825174f, 0.828671f, 0.832135f, 0.835548f, 0.838895f, 0.842166f, 0.845356f,
+	0.997028f, 0.946504f, 0.910981f, 0.882853f, 0.859819f, 0.840759f, 0.824976f, 0.811976f,
+	0.801376f, 0.792854f, 0.786142f, 0.781003f, 0.777224f, 0.774627f, 0.773043f, 0.772326f,
+	0.772354f, 0.773009f, 0.774193f, 0.775818f, 0.777810f, 0.780101f, 0.782631f, 0.785355f,
+	0.788223f, 0.791204f, 0.794260f, 0.797368f, 0.800501f, 0.803643f, 0.806771f, 0.809878f,
+	0.996799f, 0.943492f, 0.906401f, 0.877012f, 0.852782f, 0.832487f, 0.815385f, 0.800967f,
+	0.788853f, 0.778739f, 0.770377f, 0.763549f, 0.758068f, 0.753778f, 0.750529f, 0.748193f,
+	0.746659f, 0.745822f, 0.745591f, 0.745886f, 0.746634f, 0.747774f, 0.749243f, 0.750999f,
+	0.752989f, 0.755177f, 0.757528f, 0.760012f, 0.762600f, 0.765268f, 0.767995f, 0.770765f,
+	0.996548f, 0.940018f, 0.901034f, 0.870151f, 0.844578f, 0.822980f, 0.804558f, 0.788773f,
+	0.775234f, 0.763641f, 0.753747f, 0.745353f, 0.738286f, 0.732397f, 0.727552f, 0.723639f,
+	0.720555f, 0.718206f, 0.716510f, 0.715397f, 0.714797f, 0.714648f, 0.714903f, 0.715510f,
+	0.716425f, 0.717609f, 0.719027f, 0.720650f, 0.722446f, 0.724390f, 0.726461f, 0.728637f,
+	0.996276f, 0.936129f, 0.894965f, 0.862373f, 0.835310f, 0.812319f, 0.792540f, 0.775397f,
+	0.760483f, 0.747483f, 0.736154f, 0.726296f, 0.717741f, 0.710350f, 0.703995f, 0.698574f,
+	0.693989f, 0.690158f, 0.687004f, 0.684460f, 0.682467f, 0.680970f, 0.679915f, 0.679264f,
+	0.678969f, 0.678998f, 0.679317f, 0.679891f, 0.680698f, 0.681709f, 0.682903f, 0.684256f,
+	0.995985f, 0.931870f, 0.888268f, 0.853773f, 0.825076f, 0.800599f, 0.779413f, 0.760901f,
+	0.744630f, 0.730273f, 0.717573f, 0.706332f, 0.696378f, 0.687575f, 0.679800f, 0.672952f,
+	0.666942f, 0.661686f, 0.657120f, 0.653176f, 0.649800f, 0.646942f, 0.644554f, 0.642597f,
+	0.641029f, 0.639819f, 0.638934f, 0.638346f, 0.638028f, 0.637956f, 0.638107f, 0.638462f,
+	0.995678f, 0.927280f, 0.881012f, 0.844444f, 0.813984f, 0.787929f, 0.765278f, 0.745374f,
+	0.727751f, 0.712063f, 0.698045f, 0.685484f, 0.674209f, 0.664078f, 0.654972f, 0.646787f,
+	0.639434f, 0.632839f, 0.626931f, 0.621652f, 0.616947f, 0.612766f, 0.609071f, 0.605820f,
+	0.602975f, 0.600508f, 0.598387f, 0.596586f, 0.595079f, 0.593844f, 0.592861f, 0.592110f,
+	0.995352f, 0.922387f, 0.873261f, 0.834466f, 0.802130f, 0.774418f, 0.750253f, 0.728930f,
+	0.709953f, 0.692956f, 0.677656f, 0.663832f, 0.651303f, 0.639925f, 0.629572f, 0.620141f,
+	0.611542f, 0.603698f, 0.596542f, 0.590014f, 0.584063f, 0.578640f, 0.573705f, 0.569219f,
+	0.565148f, 0.561462f, 0.558133f, 0.555136f, 0.552445f, 0.550041f, 0.547903f, 0.546013f,
+	0.995011f, 0.917225f, 0.865068f, 0.823922f, 0.789616f, 0.760178f, 0.734455f, 0.711693f,
+	0.691362f, 0.673074f, 0.656528f, 0.641490f, 0.627772f, 0.615221f, 0.603706f, 0.593121f,
+	0.583374f, 0.574384f, 0.566085f, 0.558415f, 0.551322f, 0.544759f, 0.538684f, 0.533061f,
+	0.527856f, 0.523039f, 0.518581f, 0.514460f, 0.510650f, 0.507133f, 0.503889f, 0.500900f,
+	0.994655f, 0.911818f, 0.856485f, 0.812883f, 0.776531f, 0.745315f, 0.718003f, 0.693790f,
+	0.672112f, 0.652554f, 0.634799f, 0.618598f, 0.603755f, 0.590104f, 0.577513f, 0.565868f,
+	0.555072f, 0.545044f, 0.535714f, 0.527018f, 0.518903f, 0.511322f, 0.504232f, 0.497594f,
+	0.491377f, 0.485549f, 0.480082f, 0.474952f, 0.470136f, 0.465615f, 0.461369f, 0.457380f,
+	0.994286f, 0.906191f, 0.847560f, 0.801418f, 0.762962f, 0.729933f, 0.701016f, 0.675351f,
+	0.652340f, 0.631541f, 0.612619f, 0.595310f, 0.579406f, 0.564733f, 0.551150f, 0.538539f,
+	0.526799f, 0.515844f, 0.505600f, 0.496002f, 0.486994f, 0.478528f, 0.470557f, 0.463045f,
+	0.455957f, 0.449261f, 0.442929f, 0.436937f, 0.431261f, 0.425880f, 0.420777f, 0.415932f,
+	0.993903f, 0.900368f, 0.838336f, 0.789588f, 0.748990f, 0.714129f, 0.683603f, 0.656499f,
+	0.632179f, 0.610178f, 0.590138f, 0.571781f, 0.554886f, 0.539270f, 0.524785f, 0.511306f,
+	0.498727f, 0.486956f, 0.475918f, 0.465544f, 0.455775f, 0.446560f, 0.437853f, 0.429614f,
+	0.421807f, 0.414399f, 0.407362f, 0.400669f, 0.394297f, 0.388224f, 0.382431f, 0.376900f,
+	0.993507f, 0.894369f, 0.828853f, 0.777453f, 0.734689f, 0.697992f, 0.665869f, 0.637351f,
+	0.611761f, 0.588603f, 0.567503f, 0.548164f, 0.530353f, 0.513879f, 0.498583f, 0.484335f,
+	0.471022f, 0.458551f, 0.446839f, 0.435815f, 0.425418f, 0.415593f, 0.406294f, 0.397476f,
+	0.389104f, 0.381142f, 0.373562f, 0.366335f, 0.359437f, 0.352847f, 0.346542f, 0.340506f,
+	0.993099f, 0.888210f, 0.819146f, 0.765064f, 0.720130f, 0.681607f, 0.647912f, 0.618016f,
+	0.591202f, 0.566947f, 0.544851f, 0.524604f, 0.505959f, 0.488713f, 0.472702f, 0.457786f,
+	0.443848f, 0.430789f, 0.418521f, 0.406972f, 0.396076f, 0.385777f, 0.376024f, 0.366773f,
+	0.357985f, 0.349624f, 0.341659f, 0.334060f, 0.326804f, 0.319865f, 0.313224f, 0.306860f,
+};
+
+static const float ConductorAverageAlbedoTable[32] =
+{
+	1.000000f, 0.999996f, 0.999926f, 0.999573f, 0.998749f, 0.997209f, 0.994707f, 0.990992f,
+	0.985814f, 0.978940f, 0.970168f, 0.959331f, 0.946287f, 0.930945f, 0.913255f, 0.893216f,
+	0.870880f, 0.846348f, 0.819772f, 0.791352f, 0.761328f, 0.729975f, 0.697592f, 0.664495f,
+	0.631003f, 0.597429f, 0.564072f, 0.531205f, 0.499073f, 0.467885f, 0.437813f, 0.408993f,
+};
+
+static const float DielectricEnterAlbedoTable[16384] =
+{
+	0.997380f, 0.999998f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.843934f, 0.999740f, 0.999935f, 0.999971f, 0.999984f, 0.999990f, 0.999993f, 0.999995f,
+	0.999996f, 0.999997f, 0.999998f, 0.999998f, 0.999998f, 0.999999f, 0.999999f, 0.999999f,
+	0.999999f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.616366f, 0.995878f, 0.998967f, 0.999542f, 0.999744f, 0.999838f, 0.999889f, 0.999919f,
+	0.999939f, 0.999953f, 0.999963f, 0.999970f, 0.999975f, 0.999980f, 0.999983f, 0.999986f,
+	0.999988f, 0.999990f, 0.999991f, 0.999993f, 0.999994f, 0.999995f, 0.999996f, 0.999996f,
+	0.999997f, 0.999998f, 0.999998f, 0.999999f, 0.999999f, 0.999999f, 1.000000f, 1.000000f,
+	0.552993f, 0.980178f, 0.994820f, 0.997697f, 0.998710f, 0.999181f, 0.999438f, 0.999592f,
+	0.999693f, 0.999762f, 0.999811f, 0.999848f, 0.999876f, 0.999897f, 0.999914f, 0.999928f,
+	0.999940f, 0.999949f, 0.999957f, 0.999964f, 0.999969f, 0.999974f, 0.999978f, 0.999982f,
+	0.999985f, 0.999988f, 0.999991f, 0.999993f, 0.999995f, 0.999997f, 0.999999f, 1.000000f,
+	0.529944f, 0.944345f, 0.984187f, 0.992812f, 0.995955f, 0.997425f, 0.998229f, 0.998715f,
+	0.999031f, 0.999249f, 0.999404f, 0.999520f, 0.999607f, 0.999675f, 0.999730f, 0.999773f,
+	0.999809f, 0.999839f, 0.999864f, 0.999885f, 0.999903f, 0.999918f, 0.999932f, 0.999943f,
+	0.999954f, 0.999963f, 0.999971f, 0.999978f, 0.999984f, 0.999990f, 0.999995f, 1.000000f,
+	0.519188f, 0.889273f, 0.963841f, 0.982995f, 0.990282f, 0.993768f, 0.995708f, 0.996880f,
+	0.997645f, 0.998172f, 0.998550f, 0.998830f, 0.999043f, 0.999209f, 0.999341f, 0.999448f,
+	0.999535f, 0.999607f, 0.999668f, 0.999719f, 0.999763f, 0.999801f, 0.999833f, 0.999862f,
+	0.999887f, 0.999909f, 0.999929f, 0.999946f, 0.999962f, 0.999976f, 0.999989f, 1.000000f,
+	0.513334f, 0.826346f, 0.932607f, 0.966554f, 0.980469f, 0.987361f, 0.991207f, 0.993595f,
+	0.995154f, 0.996232f, 0.997006f, 0.997582f, 0.998021f, 0.998364f, 0.998636f, 0.998856f,
+	0.999037f, 0.999186f, 0.999312f, 0.999418f, 0.999509f, 0.999587f, 0.999655f, 0.999714f,
+	0.999766f, 0.999811f, 0.999852f, 0.999888f, 0.999921f, 0.999950f, 0.999976f, 1.000000f,
+	0.509796f, 0.767408f, 0.892580f, 0.942792f, 0.965519f, 0.977294f, 0.984077f, 0.988310f,
+	0.991131f, 0.993085f, 0.994495f, 0.995547f, 0.996353f, 0.996982f, 0.997482f, 0.997887f,
+	0.998220f, 0.998495f, 0.998727f, 0.998923f, 0.999091f, 0.999235f, 0.999361f, 0.999470f,
+	0.999566f, 0.999651f, 0.999726f, 0.999793f, 0.999853f, 0.999907f, 0.999956f, 1.000000f,
+	0.507499f, 0.718045f, 0.848259f, 0.912499f, 0.945076f, 0.963017f, 0.973720f, 0.980543f,
+	0.985133f, 0.988372f, 0.990718f, 0.992461f, 0.993825f, 0.994883f, 0.995728f, 0.996412f,
+	0.996974f, 0.997442f, 0.997834f, 0.998167f, 0.998452f, 0.998698f, 0.998911f, 0.999097f,
+	0.999261f, 0.999405f, 0.999533f, 0.999647f, 0.999750f, 0.999842f, 0.999925f, 1.000000f,
+	0.505931f, 0.678787f, 0.804294f, 0.877791f, 0.919649f, 0.944367f, 0.959778f, 0.969896f,
+	0.976824f, 0.981739f, 0.985360f, 0.988093f, 0.990203f, 0.991879f, 0.993209f, 0.994290f,
+	0.995179f, 0.995921f, 0.996544f, 0.997074f, 0.997527f, 0.997919f, 0.998259f, 0.998556f,
+	0.998817f, 0.999048f, 0.999253f, 0.999436f, 0.999600f, 0.999747f, 0.999880f, 1.000000f,
+	0.504797f, 0.648110f, 0.763855f, 0.841352f, 0.890476f, 0.921750f, 0.942234f, 0.956129f,
+	0.965881f, 0.972954f, 0.978204f, 0.982204f, 0.985315f, 0.987762f, 0.989743f, 0.991359f,
+	0.992693f, 0.993822f, 0.994761f, 0.995561f, 0.996246f, 0.996838f, 0.997353f, 0.997804f,
+	0.998200f, 0.998551f, 0.998863f, 0.999141f, 0.999390f, 0.999614f, 0.999817f, 1.000000f,
+	0.503970f, 0.624142f, 0.728375f, 0.805586f, 0.859305f, 0.896070f, 0.921459f, 0.939362f,
+	0.952272f, 0.961795f, 0.968999f, 0.974552f, 0.978924f, 0.982401f, 0.985198f, 0.987518f,
+	0.989430f, 0.991031f, 0.992370f, 0.993540f, 0.994532f, 0.995390f, 0.996139f, 0.996794f,
+	0.997372f, 0.997883f, 0.998337f, 0.998743f, 0.999108f, 0.999435f, 0.999732f, 1.000000f,
+	0.503329f, 0.605271f, 0.698067f, 0.772152f, 0.827820f, 0.868527f, 0.898153f, 0.919900f,
+	0.936057f, 0.948288f, 0.957711f, 0.965066f, 0.970890f, 0.975603f, 0.979418f, 0.982592f,
+	0.985223f, 0.987422f, 0.989316f, 0.990924f, 0.992309f, 0.993510f, 0.994558f, 0.995478f,
+	0.996290f, 0.997009f, 0.997650f, 0.998223f, 0.998737f, 0.999201f, 0.999620f, 1.000000f,
+	0.502835f, 0.590247f, 0.672515f, 0.741930f, 0.797387f, 0.840374f, 0.873222f, 0.898319f,
+	0.917617f, 0.932582f, 0.944316f, 0.953652f, 0.961160f, 0.967268f, 0.972292f, 0.976479f,
+	0.979978f, 0.982922f, 0.985458f, 0.987625f, 0.989496f, 0.991125f, 0.992550f, 0.993803f,
+	0.994911f, 0.995895f, 0.996772f, 0.997557f, 0.998264f, 0.998900f, 0.999477f, 1.000000f,
+	0.502451f, 0.578142f, 0.651075f, 0.715153f, 0.768913f, 0.812659f, 0.847623f, 0.875363f,
+	0.897386f, 0.914953f, 0.929036f, 0.940420f, 0.949738f, 0.957386f, 0.963753f, 0.969088f,
+	0.973608f, 0.977443f, 0.980714f, 0.983563f, 0.986024f, 0.988170f, 0.990041f, 0.991718f,
+	0.993191f, 0.994501f, 0.995673f, 0.996723f, 0.997669f, 0.998523f, 0.999297f, 1.000000f,
+	0.502128f, 0.568270f, 0.633075f, 0.691763f, 0.742877f, 0.786188f, 0.822166f, 0.851775f,
+	0.875990f, 0.895822f, 0.912102f, 0.925529f, 0.936669f, 0.945985f, 0.953804f, 0.960420f,
+	0.966056f, 0.970874f, 0.975056f, 0.978655f, 0.981821f, 0.984584f, 0.987002f, 0.989156f,
+	0.991084f, 0.992791f, 0.994321f, 0.995695f, 0.996935f, 0.998056f, 0.999074f, 1.000000f,
+	0.501877f, 0.560139f, 0.617923f, 0.671425f, 0.719449f, 0.761455f, 0.797568f, 0.828210f,
+	0.854019f, 0.875721f, 0.893920f, 0.909240f, 0.922169f, 0.933137f, 0.942464f, 0.950445f,
+	0.957308f, 0.963225f, 0.968392f, 0.972875f, 0.976819f, 0.980309f, 0.983368f, 0.986112f,
+	0.988548f, 0.990727f, 0.992684f, 0.994448f, 0.996042f, 0.997488f, 0.998802f, 1.000000f,
+	0.501655f, 0.553355f, 0.605080f, 0.653818f, 0.698542f, 0.738746f, 0.774244f, 0.805239f,
+	0.832041f, 0.855107f, 0.874906f, 0.891877f, 0.906462f, 0.919013f, 0.929857f, 0.939234f,
+	0.947368f, 0.954476f, 0.960715f, 0.966174f, 0.971020f, 0.975299f, 0.979089f, 0.982499f,
+	0.985525f, 0.988256f, 0.990732f, 0.992956f, 0.994972f, 0.996805f, 0.998475f, 1.000000f,
+	0.501483f, 0.547647f, 0.594154f, 0.638548f, 0.680018f, 0.718097f, 0.752517f, 0.783255f,
+	0.810496f, 0.834443f, 0.855451f, 0.873797f, 0.889837f, 0.903870f, 0.916138f, 0.926895f,
+	0.936333f, 0.944675f, 0.952034f, 0.958542f, 0.964340f, 0.969509f, 0.974132f, 0.978293f,
+	0.982022f, 0.985389f, 0.988432f, 0.991194f, 0.993705f, 0.995994f, 0.998085f, 1.000000f,
+	0.501331f, 0.542793f, 0.584796f, 0.625278f, 0.663652f, 0.699470f, 0.732474f, 0.762549f,
+	0.789738f, 0.814156f, 0.835958f, 0.855368f, 0.872600f, 0.887922f, 0.901509f, 0.913576f,
+	0.924306f, 0.933861f, 0.942385f, 0.950005f, 0.956819f, 0.962965f, 0.968469f, 0.973463f,
+	0.977967f, 0.982049f, 0.985759f, 0.989137f, 0.992221f, 0.995041f, 0.997626f, 1.000000f,
+	0.501201f, 0.538654f, 0.576742f, 0.613727f, 0.649187f, 0.682739f, 0.714146f, 0.743253f,
+	0.770033f, 0.794514f, 0.816754f, 0.836891f, 0.855070f, 0.871450f, 0.886195f, 0.899460f,
+	0.911385f, 0.922133f, 0.931833f, 0.940561f, 0.948473f, 0.955608f, 0.962089f, 0.967989f,
+	0.973344f, 0.978225f, 0.982668f, 0.986761f, 0.990499f, 0.993932f, 0.997090f, 1.000000f,
+	0.501082f, 0.535079f, 0.569753f, 0.603639f, 0.636388f, 0.667748f, 0.697464f, 0.725418f,
+	0.751530f, 0.775737f, 0.798108f, 0.818651f, 0.837500f, 0.854718f, 0.870415f, 0.884746f,
+	0.897773f, 0.909662f, 0.920462f, 0.930331f, 0.939301f, 0.947516f, 0.954993f, 0.961846f,
+	0.968138f, 0.973879f, 0.979181f, 0.984028f, 0.988522f, 0.992653f, 0.996470f, 1.000000f,
+	0.500993f, 0.531968f, 0.563661f, 0.594777f, 0.625072f, 0.654326f, 0.682361f, 0.709040f,
+	0.734271f, 0.758000f, 0.780210f, 0.800915f, 0.820149f, 0.837954f, 0.854436f, 0.869624f,
+	0.883633f, 0.896549f, 0.908425f, 0.919356f, 0.929403f, 0.938682f, 0.947201f, 0.955083f,
+	0.962326f, 0.969041f, 0.975219f, 0.980949f, 0.986270f, 0.991175f, 0.995757f, 1.000000f,
+	0.500908f, 0.529266f, 0.558323f, 0.586961f, 0.615021f, 0.642307f, 0.668686f, 0.694041f,
+	0.718270f, 0.741345f, 0.763184f, 0.783816f, 0.803215f, 0.821396f, 0.838421f, 0.854321f,
+	0.869146f, 0.882966f, 0.895798f, 0.907742f, 0.918856f, 0.929159f, 0.938760f, 0.947655f,
+	0.955954f, 0.963644f, 0.970829f, 0.977506f, 0.983713f, 0.989514f, 0.994943f, 1.000000f,
+	0.500834f, 0.526885f, 0.553612f, 0.580063f, 0.606075f, 0.631532f, 0.656310f, 0.680346f,
+	0.703529f, 0.725808f, 0.747139f, 0.767492f, 0.786852f, 0.805207f, 0.822590f, 0.839020f,
+	0.854499f, 0.869071f, 0.882773f, 0.895644f, 0.907712f, 0.919059f, 0.929686f, 0.939636f,
+	0.948990f, 0.957732f, 0.965957f, 0.973656f, 0.980864f, 0.987657f, 0.994022f, 1.000000f,
+	0.500768f, 0.524782f, 0.549451f, 0.573920f, 0.598092f, 0.621857f, 0.645138f, 0.667850f,
+	0.689948f, 0.711367f, 0.732074f, 0.752013f, 0.771172f, 0.789534f, 0.807096f, 0.823857f,
+	0.839814f, 0.855006f, 0.869437f, 0.883131f, 0.896111f, 0.908419f, 0.920056f, 0.931050f,
+	0.941473f, 0.951299f, 0.960614f, 0.969389f, 0.977696f, 0.985547f, 0.992983f, 1.000000f,
+	0.500711f, 0.522917f, 0.545761f, 0.568460f, 0.590946f, 0.613152f, 0.635016f, 0.656482f,
+	0.677497f, 0.698017f, 0.718002f, 0.737420f, 0.756233f, 0.774455f, 0.792038f, 0.808971f,
+	0.825287f, 0.840951f, 0.855979f, 0.870379f, 0.884149f, 0.897330f, 0.909938f, 0.921962f,
+	0.933435f, 0.944362f, 0.954791f, 0.964745f, 0.974198f, 0.983231f, 0.991820f, 1.000000f,
+	0.500659f, 0.521254f, 0.542459f, 0.563567f, 0.584530f, 0.605304f, 0.625845f, 0.646111f,
+	0.666065f, 0.685672f, 0.704900f, 0.723722f, 0.742112f, 0.760051f, 0.777520f, 0.794507f,
+	0.811001f, 0.826982f, 0.842485f, 0.857469f, 0.871948f, 0.885913f, 0.899395f, 0.912402f,
+	0.924901f, 0.936958f, 0.948527f, 0.959676f, 0.970377f, 0.980641f, 0.990510f, 1.000000f,
+	0.500613f, 0.519765f, 0.539499f, 0.559172f, 0.578753f, 0.598212f, 0.617521f, 0.636653f,
+	0.655581f, 0.674280f, 0.692729f, 0.710905f, 0.728777f, 0.746360f, 0.763607f, 0.780513f,
+	0.797068f, 0.813260f, 0.829081f, 0.844525f, 0.859574f, 0.874263f, 0.888552f, 0.902452f,
+	0.915965f, 0.929079f, 0.941824f, 0.954206f, 0.966185f, 0.977825f, 0.989090f, 1.000000f,
+	0.500571f, 0.518427f, 0.536837f, 0.555204f, 0.573535f, 0.591788f, 0.609954f, 0.628019f,
+	0.645955f, 0.663777f, 0.681430f, 0.698942f, 0.716267f, 0.733403f, 0.750328f, 0.767063f,
+	0.783566f, 0.799835f, 0.815868f, 0.831638f, 0.847180f, 0.862435f, 0.877450f, 0.892181f,
+	0.906639f, 0.920805f, 0.934720f, 0.948338f, 0.961677f, 0.974719f, 0.987506f, 1.000000f,
+	0.500534f, 0.517221f, 0.534434f, 0.551633f, 0.568800f, 0.585955f, 0.603063f, 0.620118f,
+	0.637139f, 0.654083f, 0.670980f, 0.687795f, 0.704530f, 0.721179f, 0.737737f, 0.754185f,
+	0.770551f, 0.786796f, 0.802926f, 0.818922f, 0.834804f, 0.850569f, 0.866172f, 0.881662f,
+	0.896995f, 0.912166f, 0.927200f, 0.942093f, 0.956799f, 0.971373f, 0.985770f, 1.000000f,
+	0.500500f, 0.516121f, 0.532258f, 0.548387f, 0.564516f, 0.580636f, 0.596774f, 0.612903f,
+	0.629023f, 0.645161f, 0.661290f, 0.677418f, 0.693538f, 0.709677f, 0.725795f, 0.741924f,
+	0.758065f, 0.774182f, 0.790311f, 0.806451f, 0.822568f, 0.838710f, 0.854838f, 0.870955f,
+	0.887097f, 0.903212f, 0.919341f, 0.935484f, 0.951598f, 0.967727f, 0.983856f, 1.000000f,
+	0.994188f, 0.999998f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.893400f, 0.999518f, 0.999895f, 0.999967f, 0.999983f, 0.999987f, 0.999990f, 0.999992f,
+	0.999994f, 0.999999f, 0.999999f, 0.999999f, 0.999999f, 0.999999f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.954977f, 0.991740f, 0.998391f, 0.999397f, 0.999699f, 0.999846f, 0.999901f, 0.999930f,
+	0.999947f, 0.999960f, 0.999967f, 0.999977f, 0.999980f, 0.999985f, 0.999986f, 0.999988f,
+	0.999990f, 0.999991f, 0.999992f, 0.999993f, 0.999994f, 0.999995f, 0.999996f, 0.999997f,
+	0.999997f, 0.999998f, 0.999998f, 0.999999f, 0.999999f, 1.000000f, 1.000000f, 1.000000f,
+	0.978988f, 0.962184f, 0.991112f, 0.996726f, 0.998463f, 0.999136f, 0.999466f, 0.999640f,
+	0.999744f, 0.999801f, 0.999841f, 0.999878f, 0.999896f, 0.999915f, 0.999930f, 0.999938f,
+	0.999946f, 0.999952f, 0.999960f, 0.999965f, 0.999969f, 0.999973f, 0.999977f, 0.999981f,
+	0.999984f, 0.999987f, 0.999989f, 0.999992f, 0.999994f, 0.999996f, 0.999997f, 0.999999f,
+	0.988042f, 0.926288f, 0.973534f, 0.989272f, 0.994792f, 0.997116f, 0.998233f, 0.998816f,
+	0.999159f, 0.999373f, 0.999516f, 0.999613f, 0.999680f, 0.999732f, 0.999773f, 0.999808f,
+	0.999833f, 0.999856f, 0.999874f, 0.999892f, 0.999905f, 0.999918f, 0.999929f, 0.999939f,
+	0.999949f, 0.999957f, 0.999964f, 0.999971f, 0.999977f, 0.999983f, 0.999989f, 0.999993f,
+	0.992143f, 0.911219f, 0.950265f, 0.975669f, 0.987286f, 0.992727f, 0.995479f, 0.996985f,
+	0.997869f, 0.998415f, 0.998782f, 0.999032f, 0.999205f, 0.999344f, 0.999445f, 0.999527f,
+	0.999594f, 0.999650f, 0.999698f, 0.999738f, 0.999772f, 0.999802f, 0.999830f, 0.999854f,
+	0.999876f, 0.999895f, 0.999912f, 0.999928f, 0.999943f, 0.999956f, 0.999969f, 0.999979f,
+	0.994164f, 0.914378f, 0.932230f, 0.959006f, 0.975898f, 0.985324f, 0.990577f, 0.993616f,
+	0.995461f, 0.996629f, 0.997405f, 0.997940f, 0.998327f, 0.998614f, 0.998836f, 0.999011f,
+	0.999155f, 0.999271f, 0.999370f, 0.999455f, 0.999529f, 0.999593f, 0.999649f, 0.999699f,
+	0.999743f, 0.999783f, 0.999819f, 0.999852f, 0.999882f, 0.999908f, 0.999932f, 0.999952f,
+	0.995123f, 0.923989f, 0.923893f, 0.944503f, 0.962890f, 0.975416f, 0.983369f, 0.988370f,
+	0.991573f, 0.993681f, 0.995112f, 0.996118f, 0.996847f, 0.997394f, 0.997817f, 0.998150f,
+	0.998419f, 0.998640f, 0.998828f, 0.998987f, 0.999125f, 0.999244f, 0.999349f, 0.999442f,
+	0.999525f, 0.999600f, 0.999666f, 0.999726f, 0.999781f, 0.999829f, 0.999872f, 0.999907f,
+	0.995454f, 0.933055f, 0.922676f, 0.934865f, 0.951034f, 0.964581f, 0.974474f, 0.981351f,
+	0.986084f, 0.989365f, 0.991677f, 0.993346f, 0.994578f, 0.995512f, 0.996237f, 0.996813f,
+	0.997280f, 0.997666f, 0.997988f, 0.998264f, 0.998501f, 0.998706f, 0.998887f, 0.999047f,
+	0.999189f, 0.999316f, 0.999430f, 0.999533f, 0.999625f, 0.999708f, 0.999780f, 0.999836f,
+	0.995377f, 0.938978f, 0.924218f, 0.929430f, 0.941686f, 0.954317f, 0.964915f, 0.973090f,
+	0.979183f, 0.983673f, 0.986993f, 0.989474f, 0.991358f, 0.992812f, 0.993956f, 0.994872f,
+	0.995621f, 0.996240f, 0.996761f, 0.997205f, 0.997588f, 0.997920f, 0.998211f, 0.998469f,
+	0.998698f, 0.998902f, 0.999085f, 0.999250f, 0.999398f, 0.999530f, 0.999646f, 0.999733f,
+	0.995007f, 0.941246f, 0.925243f, 0.925989f, 0.934471f, 0.945206f, 0.955459f, 0.964195f,
+	0.971243f, 0.976783f, 0.981096f, 0.984455f, 0.987088f, 0.989174f, 0.990848f, 0.992208f,
+	0.993329f, 0.994264f, 0.995055f, 0.995730f, 0.996313f, 0.996821f, 0.997266f, 0.997660f,
+	0.998009f, 0.998322f, 0.998602f, 0.998853f, 0.999079f, 0.999281f, 0.999457f, 0.999588f,
+	0.994412f, 0.940115f, 0.924007f, 0.922383f, 0.928091f, 0.936894f, 0.946291f, 0.955025f,
+	0.962597f, 0.968924f, 0.974108f, 0.978324f, 0.981746f, 0.984536f, 0.986826f, 0.988721f,
+	0.990304f, 0.991640f, 0.992777f, 0.993754f, 0.994602f, 0.995341f, 0.995992f, 0.996567f,
+	0.997079f, 0.997537f, 0.997948f, 0.998316f, 0.998648f, 0.998943f, 0.999201f, 0.999390f,
+	0.993640f, 0.936101f, 0.919869f, 0.917148f, 0.921197f, 0.928542f, 0.937072f, 0.945558f,
+	0.953368f, 0.960246f, 0.966151f, 0.971149f, 0.975349f, 0.978876f, 0.981841f, 0.984344f,
+	0.986469f, 0.988285f, 0.989847f, 0.991200f, 0.992380f, 0.993414f, 0.994328f, 0.995138f,
+	0.995861f, 0.996507f, 0.997087f, 0.997610f, 0.998079f, 0.998497f, 0.998862f, 0.999129f,
+	0.992725f, 0.929742f, 0.912856f, 0.909586f, 0.912798f, 0.919292f, 0.927232f, 0.935501f,
+	0.943454f, 0.950754f, 0.957267f, 0.962974f, 0.967923f, 0.972192f, 0.975867f, 0.979033f,
+	0.981766f, 0.984134f, 0.986195f, 0.987996f, 0.989579f, 0.990976f, 0.992215f, 0.993318f,
+	0.994304f, 0.995189f, 0.995985f, 0.996702f, 0.997347f, 0.997924f, 0.998425f, 0.998791f,
+	0.991691f, 0.921562f, 0.903325f, 0.899582f, 0.902409f, 0.908541f, 0.916240f, 0.924475f,
+	0.932626f, 0.940332f, 0.947411f, 0.953789f, 0.959466f, 0.964479f, 0.968888f, 0.972757f,
+	0.976153f, 0.979137f, 0.981764f, 0.984085f, 0.986140f, 0.987967f, 0.989596f, 0.991055f,
+	0.992363f, 0.993541f, 0.994603f, 0.995562f, 0.996426f, 0.997200f, 0.997874f, 0.998363f,
+	0.990561f, 0.912030f, 0.891788f, 0.887386f, 0.889974f, 0.896027f, 0.903764f, 0.912175f,
+	0.920649f, 0.928822f, 0.936486f, 0.943539f, 0.949946f, 0.955716f, 0.960881f, 0.965491f,
+	0.969597f, 0.973252f, 0.976509f, 0.979414f, 0.982010f, 0.984335f, 0.986421f, 0.988299f,
+	0.989992f, 0.991521f, 0.992905f, 0.994157f, 0.995289f, 0.996303f, 0.997189f, 0.997832f,
+	0.989351f, 0.901547f, 0.878782f, 0.873443f, 0.875735f, 0.881797f, 0.889724f, 0.898458f,
+	0.907374f, 0.916094f, 0.924396f, 0.932157f, 0.939319f, 0.945868f, 0.951820f, 0.957206f,
+	0.962066f, 0.966445f, 0.970388f, 0.973941f, 0.977142f, 0.980031f, 0.982642f, 0.985004f,
+	0.987146f, 0.989089f, 0.990853f, 0.992456f, 0.993908f, 0.995213f, 0.996354f, 0.997182f,
+	0.988075f, 0.890455f, 0.864804f, 0.858257f, 0.860097f, 0.866118f, 0.874254f, 0.883367f,
+	0.892789f, 0.902115f, 0.911101f, 0.919605f, 0.927552f, 0.934910f, 0.941680f, 0.947878f,
+	0.953535f, 0.958686f, 0.963370f, 0.967628f, 0.971498f, 0.975016f, 0.978216f, 0.981130f,
+	0.983785f, 0.986206f, 0.988414f, 0.990426f, 0.992256f, 0.993905f, 0.995351f, 0.996399f,
+	0.986748f, 0.879023f, 0.850287f, 0.842319f, 0.843523f, 0.849373f, 0.857642f, 0.867100f,
+	0.877018f, 0.886955f, 0.896638f, 0.905902f, 0.914652f, 0.922842f, 0.930455f, 0.937497f,
+	0.943988f, 0.949954f, 0.955429f, 0.960447f, 0.965043f, 0.969251f, 0.973106f, 0.976636f,
+	0.979871f, 0.982836f, 0.985552f, 0.988038f, 0.990306f, 0.992357f, 0.994161f, 0.995470f,
+	0.985363f, 0.867464f, 0.835578f, 0.826051f, 0.826457f, 0.831981f, 0.840252f, 0.849950f,
+	0.860292f, 0.870788f, 0.881133f, 0.891137f, 0.900682f, 0.909703f, 0.918171f, 0.926076f,
+	0.933427f, 0.940243f, 0.946549f, 0.952375f, 0.957751f, 0.962708f, 0.967278f, 0.971489f,
+	0.975370f, 0.978945f, 0.982237f, 0.985262f, 0.988033f, 0.990548f, 0.992767f, 0.994380f,
+	0.983944f, 0.855935f, 0.820945f, 0.809800f, 0.809287f, 0.814336f, 0.822458f, 0.832258f,
+	0.842900f, 0.853855f, 0.864784f, 0.875465f, 0.885761f, 0.895586f, 0.904893f, 0.913659f,
+	0.921880f, 0.929567f, 0.936734f, 0.943406f, 0.949607f, 0.955364f, 0.960706f, 0.965660f,
+	0.970250f, 0.974502f, 0.978436f, 0.982069f, 0.985411f, 0.988456f, 0.991152f, 0.993115f,
+	0.982490f, 0.844553f, 0.806585f, 0.793825f, 0.792320f, 0.796776f, 0.804606f, 0.814359f,
+	0.825157f, 0.836438f, 0.847832f, 0.859093f, 0.870061f, 0.880628f, 0.890730f, 0.900329f,
+	0.909408f, 0.917965f, 0.926007f, 0.933549f, 0.940609f, 0.947209f, 0.953373f, 0.959124f,
+	0.964485f, 0.969478f, 0.974123f, 0.978433f, 0.982416f, 0.986060f, 0.989299f, 0.991662f,
+	0.981004f, 0.833400f, 0.792635f, 0.778316f, 0.775792f, 0.779570f, 0.786987f, 0.796552f,
+	0.807358f, 0.818817f, 0.830539f, 0.842256f, 0.853786f, 0.865004f, 0.875827f, 0.886204f,
+	0.896102f, 0.905507f, 0.914416f, 0.922834f, 0.930771f, 0.938244f, 0.945269f, 0.951866f,
+	0.958053f, 0.963849f, 0.969269f, 0.974326f, 0.979023f, 0.983339f, 0.987191f, 0.990009f,
+	0.979492f, 0.822528f, 0.779182f, 0.763398f, 0.759864f, 0.762917f, 0.769830f, 0.779087f,
+	0.789763f, 0.801256f, 0.813160f, 0.825193f, 0.837157f, 0.848911f, 0.860358f, 0.871430f,
+	0.882083f, 0.892289f, 0.902034f, 0.911314f, 0.920129f, 0.928488f, 0.936401f, 0.943880f,
+	0.950940f, 0.957594f, 0.963854f, 0.969726f, 0.975208f, 0.980272f, 0.984811f, 0.988143f,
+	0.977956f, 0.811974f, 0.766280f, 0.749148f, 0.744644f, 0.746952f, 0.753300f, 0.762155f,
+	0.772584f, 0.783978f, 0.795924f, 0.808132f, 0.820392f, 0.832554f, 0.844507f, 0.856172f,
+	0.867493f, 0.878430f, 0.888959f, 0.899064f, 0.908737f, 0.917977f, 0.926787f, 0.935173f,
+	0.943142f, 0.950701f, 0.957857f, 0.964610f, 0.970949f, 0.976838f, 0.982143f, 0.986051f,
+	0.976394f, 0.801753f, 0.753954f, 0.735602f, 0.730187f, 0.731758f, 0.737508f, 0.745894f,
+	0.755982f, 0.767164f, 0.779027f, 0.791275f, 0.803696f, 0.816132f, 0.828464f, 0.840605f,
+	0.852490f, 0.864068f, 0.875306f, 0.886178f, 0.896668f, 0.906765f, 0.916465f, 0.925764f,
+	0.934664f, 0.943165f, 0.951265f, 0.958958f, 0.966226f, 0.973016f, 0.979168f, 0.983718f,
+	0.974812f, 0.791877f, 0.742210f, 0.722774f, 0.716521f, 0.717381f, 0.722520f, 0.730394f,
+	0.740071f, 0.750951f, 0.762621f, 0.774790f, 0.787245f, 0.799825f, 0.812408f, 0.824902f,
+	0.837234f, 0.849349f, 0.861204f, 0.872767f, 0.884012f, 0.894922f, 0.905484f, 0.915687f,
+	0.925524f, 0.934989f, 0.944071f, 0.952758f, 0.961019f, 0.968787f, 0.975868f, 0.981132f,
+	0.973209f, 0.782343f, 0.731041f, 0.710657f, 0.703644f, 0.703832f, 0.708366f, 0.715705f,
+	0.724924f, 0.735432f, 0.746823f, 0.758811f, 0.771186f, 0.783790f, 0.796500f, 0.809223f,
+	0.821883f, 0.834421f, 0.846790f, 0.858951f, 0.870873f, 0.882533f, 0.893910f, 0.904988f,
+	0.915752f, 0.926187f, 0.936277f, 0.945999f, 0.955312f, 0.964131f, 0.972225f, 0.978277f,
+	0.971588f, 0.773150f, 0.720432f, 0.699231f, 0.691538f, 0.691101f, 0.695049f, 0.701847f,
+	0.710580f, 0.720666f, 0.731711f, 0.743435f, 0.755635f, 0.768156f, 0.780880f, 0.793714f,
+	0.806584f, 0.819428f, 0.832199f, 0.844855f, 0.857363f, 0.869693f, 0.881822f, 0.893727f,
+	0.905388f, 0.916784f, 0.927892f, 0.938679f, 0.949094f, 0.959032f, 0.968221f, 0.975138f,
+	0.969949f, 0.764290f, 0.710362f, 0.688466f, 0.680176f, 0.679164f, 0.682554f, 0.688817f,
+	0.697051f, 0.706685f, 0.717334f, 0.728730f, 0.740675f, 0.753023f, 0.765660f, 0.778498f,
+	0.791464f, 0.804502f, 0.817562f, 0.830605f, 0.843596f, 0.856506f, 0.869307f, 0.881974f,
+	0.894485f, 0.906815f, 0.918933f, 0.930800f, 0.942355f, 0.953473f, 0.963838f, 0.971700f,
+	0.968292f, 0.755754f, 0.700805f, 0.678330f, 0.669520f, 0.667987f, 0.670853f, 0.676597f,
+	0.684331f, 0.693495f, 0.703716f, 0.714735f, 0.726364f, 0.738465f, 0.750929f, 0.763675f,
+	0.776637f, 0.789760f, 0.803000f, 0.816320f, 0.829688f, 0.843076f, 0.856458f, 0.869810f,
+	0.883107f, 0.896324f, 0.909428f, 0.922375f, 0.935093f, 0.947442f, 0.959059f, 0.967945f,
+	0.966620f, 0.747528f, 0.691737f, 0.668789f, 0.659532f, 0.657531f, 0.659908f, 0.665155f,
+	0.672397f, 0.681086f, 0.690860f, 0.701470f, 0.712737f, 0.724531f, 0.736752f, 0.749326f,
+	0.762191f, 0.775301f, 0.788618f, 0.802109f, 0.815746f, 0.829508f, 0.843371f, 0.857317f,
+	0.871323f, 0.885365f, 0.899412f, 0.913420f, 0.927311f, 0.940929f, 0.953868f, 0.963858f,
+	0.994181f, 0.999998f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.893235f, 0.999498f, 0.999887f, 0.999964f, 0.999981f, 0.999986f, 0.999988f, 0.999991f,
+	0.999992f, 0.999999f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.954813f, 0.991412f, 0.998266f, 0.999332f, 0.999660f, 0.999825f, 0.999888f, 0.999922f,
+	0.999942f, 0.999956f, 0.999965f, 0.999977f, 0.999980f, 0.999986f, 0.999987f, 0.999989f,
+	0.999990f, 0.999991f, 0.999992f, 0.999993f, 0.999994f, 0.999995f, 0.999996f, 0.999996f,
+	0.999997f, 0.999998f, 0.999998f, 0.999999f, 0.999999f, 1.000000f, 1.000000f, 1.000000f,
+	0.978872f, 0.960695f, 0.990430f, 0.996370f, 0.998260f, 0.999012f, 0.999388f, 0.999592f,
+	0.999715f, 0.999782f, 0.999828f, 0.999872f, 0.999892f, 0.999914f, 0.999931f, 0.999939f,
+	0.999946f, 0.999951f, 0.999960f, 0.999965f, 0.999968f, 0.999972f, 0.999975f, 0.999979f,
+	0.999983f, 0.999985f, 0.999987f, 0.999990f, 0.999992f, 0.999994f, 0.999996f, 0.999997f,
+	0.988009f, 0.923339f, 0.971526f, 0.988110f, 0.994099f, 0.996691f, 0.997967f, 0.998646f,
+	0.999051f, 0.999305f, 0.999475f, 0.999588f, 0.999666f, 0.999723f, 0.999769f, 0.999807f,
+	0.999833f, 0.999855f, 0.999873f, 0.999891f, 0.999904f, 0.999916f, 0.999927f, 0.999935f,
+	0.999945f, 0.999952f, 0.999958f, 0.999964f, 0.999971f, 0.999977f, 0.999982f, 0.999985f,
+	0.992236f, 0.907586f, 0.946546f, 0.973078f, 0.985609f, 0.991650f, 0.994784f, 0.996535f,
+	0.997578f, 0.998226f, 0.998664f, 0.998958f, 0.999157f, 0.999317f, 0.999429f, 0.999516f,
+	0.999588f, 0.999646f, 0.999694f, 0.999733f, 0.999765f, 0.999793f, 0.999820f, 0.999843f,
+	0.999864f, 0.999882f, 0.999898f, 0.999913f, 0.999927f, 0.999939f, 0.999951f, 0.999959f,
+	0.994425f, 0.910999f, 0.927325f, 0.954794f, 0.972814f, 0.983194f, 0.989135f, 0.992650f,
+	0.994818f, 0.996204f, 0.997127f, 0.997759f, 0.998212f, 0.998540f, 0.998789f, 0.998980f,
+	0.999133f, 0.999254f, 0.999354f, 0.999438f, 0.999511f, 0.999574f, 0.999628f, 0.999675f,
+	0.999716f, 0.999754f, 0.999788f, 0.999819f, 0.999847f, 0.999872f, 0.999893f, 0.999911f,
+	0.995597f, 0.921658f, 0.918857f, 0.939203f, 0.958440f, 0.972034f, 0.980923f, 0.986648f,
+	0.990381f, 0.992867f, 0.994561f, 0.995748f, 0.996599f, 0.997228f, 0.997707f, 0.998074f,
+	0.998362f, 0.998594f, 0.998789f, 0.998949f, 0.999086f, 0.999201f, 0.999304f, 0.999393f,
+	0.999472f, 0.999543f, 0.999606f, 0.999663f, 0.999714f, 0.999758f, 0.999798f, 0.999829f,
+	0.996188f, 0.932487f, 0.918652f, 0.929513f, 0.945839f, 0.960196f, 0.971042f, 0.978782f,
+	0.984214f, 0.988031f, 0.990738f, 0.992692f, 0.994124f, 0.995196f, 0.996014f, 0.996653f,
+	0.997159f, 0.997568f, 0.997903f, 0.998183f, 0.998421f, 0.998625f, 0.998801f, 0.998957f,
+	0.999094f, 0.999215f, 0.999323f, 0.999420f, 0.999507f, 0.999585f, 0.999652f, 0.999701f,
+	0.996413f, 0.940831f, 0.922282f, 0.925233f, 0.936769f, 0.949633f, 0.960902f, 0.969862f,
+	0.976691f, 0.981803f, 0.985616f, 0.988472f, 0.990632f, 0.992286f, 0.993570f, 0.994582f,
+	0.995394f, 0.996053f, 0.996597f, 0.997054f, 0.997440f, 0.997772f, 0.998059f, 0.998311f,
+	0.998534f, 0.998731f, 0.998906f, 0.999063f, 0.999204f, 0.999329f, 0.999436f, 0.999513f,
+	0.996385f, 0.946104f, 0.926363f, 0.924128f, 0.931008f, 0.941219f, 0.951609f, 0.960812f,
+	0.968439f, 0.974547f, 0.979359f, 0.983127f, 0.986080f, 0.988409f, 0.990261f, 0.991748f,
+	0.992956f, 0.993947f, 0.994774f, 0.995470f, 0.996063f, 0.996572f, 0.997014f, 0.997401f,
+	0.997743f, 0.998047f, 0.998317f, 0.998560f, 0.998775f, 0.998966f, 0.999130f, 0.999247f,
+	0.996170f, 0.948458f, 0.929006f, 0.923912f, 0.927224f, 0.934691f, 0.943539f, 0.952225f,
+	0.960024f, 0.966697f, 0.972255f, 0.976816f, 0.980535f, 0.983565f, 0.986040f, 0.988073f,
+	0.989756f, 0.991160f, 0.992341f, 0.993344f, 0.994205f, 0.994949f, 0.995597f, 0.996166f,
+	0.996669f, 0.997116f, 0.997515f, 0.997872f, 0.998190f, 0.998471f, 0.998712f, 0.998883f,
+	0.995808f, 0.948277f, 0.929371f, 0.922921f, 0.923916f, 0.929146f, 0.936381f, 0.944181f,
+	0.951714f, 0.958564f, 0.964577f, 0.969741f, 0.974121f, 0.977814f, 0.980921f, 0.983536f,
+	0.985747f, 0.987623f, 0.989225f, 0.990602f, 0.991794f, 0.992831f, 0.993741f, 0.994543f,
+	0.995254f, 0.995888f, 0.996454f, 0.996961f, 0.997413f, 0.997814f, 0.998156f, 0.998398f,
+	0.995328f, 0.945949f, 0.927256f, 0.920206f, 0.919863f, 0.923549f, 0.929460f, 0.936356f,
+	0.943437f, 0.950223f, 0.956460f, 0.962043f, 0.966957f, 0.971237f, 0.974943f, 0.978145f,
+	0.980909f, 0.983301f, 0.985377f, 0.987184f, 0.988765f, 0.990156f, 0.991383f, 0.992472f,
+	0.993443f, 0.994310f, 0.995088f, 0.995785f, 0.996409f, 0.996962f, 0.997435f, 0.997769f,
+	0.994750f, 0.941848f, 0.922773f, 0.915365f, 0.914297f, 0.917046f, 0.922047f, 0.928236f,
+	0.934891f, 0.941534f, 0.947876f, 0.953753f, 0.959095f, 0.963886f, 0.968147f, 0.971917f,
+	0.975243f, 0.978176f, 0.980762f, 0.983047f, 0.985071f, 0.986868f, 0.988469f, 0.989900f,
+	0.991182f, 0.992334f, 0.993371f, 0.994303f, 0.995140f, 0.995882f, 0.996519f, 0.996967f,
+	0.994088f, 0.936310f, 0.916204f, 0.908359f, 0.906857f, 0.909088f, 0.913560f, 0.919313f,
+	0.925688f, 0.932239f, 0.938669f, 0.944793f, 0.950506f, 0.955759f, 0.960539f, 0.964859f,
+	0.968747f, 0.972234f, 0.975360f, 0.978161f, 0.980671f, 0.982925f, 0.984952f, 0.986778f,
+	0.988425f, 0.989913f, 0.991259f, 0.992474f, 0.993568f, 0.994542f, 0.995379f, 0.995968f,
+	0.993357f, 0.929625f, 0.907888f, 0.899381f, 0.897502f, 0.899433f, 0.903647f, 0.909204f,
+	0.915481f, 0.922053f, 0.928630f, 0.935021f, 0.941101f, 0.946802f, 0.952088f, 0.956952f,
+	0.961403f, 0.965459f, 0.969147f, 0.972496f, 0.975533f, 0.978289f, 0.980791f, 0.983063f,
+	0.985128f, 0.987005f, 0.988711f, 0.990260f, 0.991659f, 0.992908f, 0.993985f, 0.994743f,
+	0.992565f, 0.922054f, 0.898182f, 0.888733f, 0.886397f, 0.888090f, 0.892185f, 0.897712f,
+	0.904043f, 0.910758f, 0.917569f, 0.924281f, 0.930761f, 0.936927f, 0.942731f, 0.948150f,
+	0.953177f, 0.957821f, 0.962097f, 0.966025f, 0.969627f, 0.972928f, 0.975951f, 0.978718f,
+	0.981252f, 0.983570f, 0.985690f, 0.987623f, 0.989377f, 0.990949f, 0.992309f, 0.993267f,
+	0.991728f, 0.913819f, 0.887423f, 0.876769f, 0.873828f, 0.875240f, 0.879248f, 0.884818f,
+	0.891294f, 0.898241f, 0.905364f, 0.912458f, 0.919385f, 0.926053f, 0.932402f, 0.938398f,
+	0.944026f, 0.949283f, 0.954175f, 0.958715f, 0.962919f, 0.966806f, 0.970396f, 0.973708f,
+	0.976762f, 0.979574f, 0.982160f, 0.984531f, 0.986692f, 0.988637f, 0.990324f, 0.991515f,
+	0.990835f, 0.905110f, 0.875921f, 0.863841f, 0.860133f, 0.861164f, 0.865039f, 0.870649f,
+	0.877294f, 0.884511f, 0.891988f, 0.899508f, 0.906920f, 0.914123f, 0.921047f, 0.927650f,
+	0.933906f, 0.939804f, 0.945344f, 0.950531f, 0.955375f, 0.959891f, 0.964093f, 0.967998f,
+	0.971623f, 0.974983f, 0.978089f, 0.980952f, 0.983574f, 0.985944f, 0.988007f, 0.989464f,
+	0.989909f, 0.896084f, 0.863937f, 0.850274f, 0.845656f, 0.846186f, 0.849839f, 0.855428f,
+	0.862208f, 0.869683f, 0.877514f, 0.885468f, 0.893379f, 0.901134f, 0.908653f, 0.915883f,
+	0.922792f, 0.929359f, 0.935577f, 0.941444f, 0.946966f, 0.952151f, 0.957010f, 0.961557f,
+	0.965804f, 0.969763f, 0.973445f, 0.976857f, 0.979996f, 0.982845f, 0.985335f, 0.987096f,
+	0.988949f, 0.886871f, 0.851695f, 0.836352f, 0.830713f, 0.830629f, 0.833955f, 0.839434f,
+	0.846275f, 0.853948f, 0.862091f, 0.870449f, 0.878841f, 0.887139f, 0.895251f, 0.903115f,
+	0.910687f, 0.917940f, 0.924858f, 0.931434f, 0.937667f, 0.943559f, 0.949118f, 0.954353f,
+	0.959272f, 0.963885f, 0.968199f, 0.972216f, 0.975931f, 0.979317f, 0.982288f, 0.984391f,
+	0.987960f, 0.877576f, 0.839375f, 0.822313f, 0.815580f, 0.814790f, 0.817688f, 0.822955f,
+	0.829761f, 0.837545f, 0.845925f, 0.854624f, 0.863446f, 0.872248f, 0.880925f, 0.889405f,
+	0.897633f, 0.905573f, 0.913201f, 0.920502f, 0.927469f, 0.934101f, 0.940396f, 0.946362f,
+	0.952001f, 0.957320f, 0.962321f, 0.967002f, 0.971353f, 0.975336f, 0.978846f, 0.981334f,
+	0.986945f, 0.868278f, 0.827117f, 0.808344f, 0.800484f, 0.798922f, 0.801306f, 0.806265f,
+	0.812934f, 0.820730f, 0.829249f, 0.838202f, 0.847376f, 0.856615f, 0.865804f, 0.874856f,
+	0.883709f, 0.892315f, 0.900644f, 0.908672f, 0.916385f, 0.923774f, 0.930835f, 0.937567f,
+	0.943969f, 0.950042f, 0.955784f, 0.961189f, 0.966236f, 0.970880f, 0.974989f, 0.977908f,
+	0.985908f, 0.859044f, 0.815026f, 0.794593f, 0.785604f, 0.783235f, 0.785040f, 0.789607f,
+	0.796043f, 0.803747f, 0.812303f, 0.821407f, 0.830837f, 0.840426f, 0.850048f, 0.859606f,
+	0.869028f, 0.878259f, 0.887258f, 0.895995f, 0.904447f, 0.912599f, 0.920441f, 0.927964f,
+	0.935163f, 0.942033f, 0.948567f, 0.954750f, 0.960557f, 0.965925f, 0.970698f, 0.974097f,
+	0.984846f, 0.849914f, 0.803183f, 0.781163f, 0.771073f, 0.767885f, 0.769072f, 0.773182f,
+	0.779301f, 0.786820f, 0.795309f, 0.804460f, 0.814041f, 0.823879f, 0.833838f, 0.843817f,
+	0.853733f, 0.863524f, 0.873142f, 0.882548f, 0.891714f, 0.900616f, 0.909237f, 0.917563f,
+	0.925582f, 0.933283f, 0.940651f, 0.947666f, 0.954291f, 0.960450f, 0.965953f, 0.969885f,
+	0.983766f, 0.840925f, 0.791640f, 0.768131f, 0.756990f, 0.752994f, 0.753541f, 0.757148f,
+	0.762886f, 0.770137f, 0.778467f, 0.787562f, 0.797189f, 0.807169f, 0.817364f, 0.827663f,
+	0.837982f, 0.848252f, 0.858418f, 0.868434f, 0.878267f, 0.887885f, 0.897267f, 0.906391f,
+	0.915238f, 0.923791f, 0.932028f, 0.939920f, 0.947418f, 0.954431f, 0.960733f, 0.965254f,
+	0.982668f, 0.832099f, 0.780433f, 0.755547f, 0.743417f, 0.738640f, 0.738546f, 0.741624f,
+	0.746933f, 0.753850f, 0.761940f, 0.770889f, 0.780463f, 0.790482f, 0.800804f, 0.811321f,
+	0.821942f, 0.832595f, 0.843222f, 0.853773f, 0.864207f, 0.874491f, 0.884595f, 0.894492f,
+	0.904159f, 0.913570f, 0.922696f, 0.931500f, 0.939920f, 0.947847f, 0.955015f, 0.960185f,
+	0.981552f, 0.823454f, 0.769586f, 0.743439f, 0.730394f, 0.724876f, 0.724155f, 0.726693f,
+	0.731542f, 0.738076f, 0.745862f, 0.754587f, 0.764019f, 0.773979f, 0.784328f, 0.794957f,
+	0.805776f, 0.816710f, 0.827701f, 0.838696f, 0.849652f, 0.860531f, 0.871300f, 0.881929f,
+	0.892388f, 0.902646f, 0.912667f, 0.922404f, 0.931786f, 0.940681f, 0.948780f, 0.954657f,
+	0.980421f, 0.815000f, 0.759110f, 0.731820f, 0.717939f, 0.711731f, 0.710406f, 0.712408f,
+	0.716780f, 0.722898f, 0.730330f, 0.738768f, 0.747982f, 0.757799f, 0.768082f, 0.778724f,
+	0.789636f, 0.800749f, 0.812000f, 0.823341f, 0.834726f, 0.846117f, 0.857479f, 0.868778f,
+	0.879983f, 0.891058f, 0.901962f, 0.912640f, 0.923008f, 0.932915f, 0.942006f, 0.948650f,
+	0.979273f, 0.806742f, 0.749008f, 0.720694f, 0.706059f, 0.699214f, 0.697318f, 0.698796f,
+	0.702688f, 0.708370f, 0.715414f, 0.723516f, 0.732452f, 0.742053f, 0.752187f, 0.762751f,
+	0.773662f, 0.784851f, 0.796261f, 0.807844f, 0.819559f, 0.831367f, 0.843234f, 0.855128f,
+	0.867016f, 0.878860f, 0.890616f, 0.902223f, 0.913589f, 0.924540f, 0.934675f, 0.942141f,
+	0.978111f, 0.798683f, 0.739277f, 0.710056f, 0.694748f, 0.687322f, 0.684892f, 0.685868f,
+	0.689286f, 0.694524f, 0.701158f, 0.708890f, 0.717500f, 0.726826f, 0.736741f, 0.747149f,
+	0.757970f, 0.769142f, 0.780611f, 0.792336f, 0.804277f, 0.816401f, 0.828678f, 0.841077f,
+	0.853568f, 0.866115f, 0.878674f, 0.891182f, 0.903537f, 0.915550f, 0.926770f, 0.935110f,
+	0.994178f, 0.999998f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.893177f, 0.999491f, 0.999884f, 0.999963f, 0.999980f, 0.999985f, 0.999988f, 0.999990f,
+	0.999992f, 0.999999f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.954755f, 0.991290f, 0.998217f, 0.999305f, 0.999642f, 0.999815f, 0.999881f, 0.999917f,
+	0.999938f, 0.999954f, 0.999963f, 0.999976f, 0.999979f, 0.999986f, 0.999988f, 0.999989f,
+	0.999990f, 0.999991f, 0.999992f, 0.999993f, 0.999994f, 0.999995f, 0.999996f, 0.999996f,
+	0.999997f, 0.999997f, 0.999998f, 0.999998f, 0.999999f, 1.000000f, 1.000000f, 0.999999f,
+	0.978829f, 0.960141f, 0.990163f, 0.996222f, 0.998170f, 0.998952f, 0.999348f, 0.999564f,
+	0.999696f, 0.999768f, 0.999817f, 0.999866f, 0.999887f, 0.999911f, 0.999930f, 0.999938f,
+	0.999944f, 0.999950f, 0.999960f, 0.999964f, 0.999967f, 0.999970f, 0.999973f, 0.999978f,
+	0.999981f, 0.999984f, 0.999986f, 0.999988f, 0.999990f, 0.999992f, 0.999994f, 0.999995f,
+	0.987993f, 0.922235f, 0.970737f, 0.987626f, 0.993791f, 0.996489f, 0.997830f, 0.998550f,
+	0.998984f, 0.999257f, 0.999442f, 0.999565f, 0.999649f, 0.999710f, 0.999760f, 0.999800f,
+	0.999827f, 0.999851f, 0.999869f, 0.999888f, 0.999900f, 0.999912f, 0.999923f, 0.999931f,
+	0.999941f, 0.999948f, 0.999953f, 0.999959f, 0.999965f, 0.999971f, 0.999976f, 0.999979f,
+	0.992261f, 0.906200f, 0.945071f, 0.971995f, 0.984866f, 0.991139f, 0.994429f, 0.996286f,
+	0.997402f, 0.998100f, 0.998574f, 0.998894f, 0.999109f, 0.999283f, 0.999403f, 0.999496f,
+	0.999572f, 0.999633f, 0.999683f, 0.999722f, 0.999754f, 0.999782f, 0.999809f, 0.999831f,
+	0.999852f, 0.999869f, 0.999885f, 0.999899f, 0.999913f, 0.999924f, 0.999935f, 0.999943f,
+	0.994506f, 0.909654f, 0.925341f, 0.953013f, 0.971438f, 0.982182f, 0.988403f, 0.992121f,
+	0.994436f, 0.995927f, 0.996926f, 0.997611f, 0.998103f, 0.998459f, 0.998727f, 0.998932f,
+	0.999095f, 0.999221f, 0.999325f, 0.999411f, 0.999486f, 0.999549f, 0.999602f, 0.999649f,
+	0.999689f, 0.999725f, 0.999759f, 0.999789f, 0.999815f, 0.999839f, 0.999859f, 0.999875f,
+	0.995749f, 0.920630f, 0.916737f, 0.936903f, 0.956416f, 0.970408f, 0.979671f, 0.985703f,
+	0.989675f, 0.992342f, 0.994170f, 0.995457f, 0.996381f, 0.997062f, 0.997580f, 0.997975f,
+	0.998281f, 0.998525f, 0.998729f, 0.998894f, 0.999035f, 0.999150f, 0.999254f, 0.999342f,
+	0.999419f, 0.999489f, 0.999550f, 0.999605f, 0.999654f, 0.999696f, 0.999733f, 0.999762f,
+	0.996427f, 0.932028f, 0.916802f, 0.927070f, 0.943388f, 0.958027f, 0.969245f, 0.977348f,
+	0.983095f, 0.987168f, 0.990077f, 0.992185f, 0.993735f, 0.994895f, 0.995778f, 0.996465f,
+	0.997005f, 0.997437f, 0.997788f, 0.998079f, 0.998323f, 0.998530f, 0.998707f, 0.998863f,
+	0.998998f, 0.999117f, 0.999223f, 0.999317f, 0.999400f, 0.999474f, 0.999538f, 0.999584f,
+	0.996755f, 0.941182f, 0.921098f, 0.923094f, 0.934277f, 0.947186f, 0.958706f, 0.967995f,
+	0.975155f, 0.980565f, 0.984631f, 0.987694f, 0.990017f, 0.991798f, 0.993177f, 0.994261f,
+	0.995126f, 0.995824f, 0.996395f, 0.996870f, 0.997268f, 0.997606f, 0.997896f, 0.998149f,
+	0.998371f, 0.998566f, 0.998737f, 0.998891f, 0.999027f, 0.999147f, 0.999249f, 0.999322f,
+	0.996845f, 0.947497f, 0.926217f, 0.922749f, 0.928934f, 0.938888f, 0.949312f, 0.958711f,
+	0.966604f, 0.972991f, 0.978064f, 0.982062f, 0.985207f, 0.987693f, 0.989669f, 0.991252f,
+	0.992533f, 0.993578f, 0.994445f, 0.995168f, 0.995779f, 0.996300f, 0.996748f, 0.997138f,
+	0.997480f, 0.997781f, 0.998048f, 0.998285f, 0.998495f, 0.998680f, 0.998837f, 0.998949f,
+	0.996763f, 0.951104f, 0.930244f, 0.923725f, 0.926036f, 0.932930f, 0.941537f, 0.950206f,
+	0.958122f, 0.964982f, 0.970750f, 0.975518f, 0.979425f, 0.982618f, 0.985228f, 0.987371f,
+	0.989141f, 0.990611f, 0.991842f, 0.992881f, 0.993767f, 0.994527f, 0.995185f, 0.995759f,
+	0.996262f, 0.996708f, 0.997103f, 0.997454f, 0.997766f, 0.998040f, 0.998272f, 0.998435f,
+	0.996546f, 0.952356f, 0.932295f, 0.924318f, 0.924056f, 0.928406f, 0.935101f, 0.942623f,
+	0.950062f, 0.956938f, 0.963045f, 0.968337f, 0.972854f, 0.976680f, 0.979905f, 0.982623f,
+	0.984919f, 0.986863f, 0.988518f, 0.989934f, 0.991154f, 0.992210f, 0.993132f, 0.993940f,
+	0.994654f, 0.995285f, 0.995847f, 0.996348f, 0.996792f, 0.997183f, 0.997515f, 0.997748f,
+	0.996224f, 0.951600f, 0.932110f, 0.923513f, 0.921714f, 0.924243f, 0.929315f, 0.935648f,
+	0.942383f, 0.948981f, 0.955142f, 0.960719f, 0.965670f, 0.970009f, 0.973781f, 0.977049f,
+	0.979873f, 0.982316f, 0.984434f, 0.986273f, 0.987879f, 0.989286f, 0.990523f, 0.991617f,
+	0.992588f, 0.993453f, 0.994224f, 0.994914f, 0.995528f, 0.996069f, 0.996529f, 0.996851f,
+	0.995813f, 0.949167f, 0.929724f, 0.920825f, 0.918162f, 0.919514f, 0.923396f, 0.928734f,
+	0.934770f, 0.940981f, 0.947034f, 0.952728f, 0.957962f, 0.962695f, 0.966933f, 0.970699f,
+	0.974031f, 0.976975f, 0.979573f, 0.981868f, 0.983899f, 0.985700f, 0.987302f, 0.988731f,
+	0.990008f, 0.991152f, 0.992179f, 0.993100f, 0.993924f, 0.994651f, 0.995271f, 0.995705f,
+	0.995327f, 0.945342f, 0.925339f, 0.916118f, 0.912938f, 0.913578f, 0.916679f, 0.921306f,
+	0.926788f, 0.932648f, 0.938553f, 0.944286f, 0.949713f, 0.954757f, 0.959388f, 0.963601f,
+	0.967412f, 0.970845f, 0.973929f, 0.976699f, 0.979184f, 0.981417f, 0.983425f, 0.985232f,
+	0.986862f, 0.988333f, 0.989661f, 0.990858f, 0.991933f, 0.992886f, 0.993700f, 0.994271f,
+	0.994778f, 0.940372f, 0.919216f, 0.909481f, 0.905890f, 0.906083f, 0.908710f, 0.912892f,
+	0.918015f, 0.923639f, 0.929448f, 0.935224f, 0.940817f, 0.946134f, 0.951118f, 0.955746f,
+	0.960011f, 0.963922f, 0.967494f, 0.970749f, 0.973711f, 0.976405f, 0.978855f, 0.981082f,
+	0.983108f, 0.984950f, 0.986624f, 0.988142f, 0.989511f, 0.990730f, 0.991777f, 0.992511f,
+	0.994174f, 0.934476f, 0.911636f, 0.901122f, 0.897074f, 0.896923f, 0.899256f, 0.903193f,
+	0.908134f, 0.913658f, 0.919465f, 0.925337f, 0.931122f, 0.936714f, 0.942047f, 0.947080f,
+	0.951792f, 0.956178f, 0.960243f, 0.963997f, 0.967455f, 0.970637f, 0.973560f, 0.976244f,
+	0.978706f, 0.980963f, 0.983028f, 0.984911f, 0.986619f, 0.988147f, 0.989462f, 0.990387f,
+	0.993528f, 0.927840f, 0.902880f, 0.891313f, 0.886678f, 0.886173f, 0.888285f, 0.892086f,
+	0.896967f, 0.902507f, 0.908405f, 0.914445f, 0.920471f, 0.926374f, 0.932076f, 0.937527f,
+	0.942697f, 0.947569f, 0.952138f, 0.956408f, 0.960385f, 0.964081f, 0.967510f, 0.970686f,
+	0.973624f, 0.976337f, 0.978836f, 0.981130f, 0.983221f, 0.985100f, 0.986725f, 0.987868f,
+	0.992828f, 0.920633f, 0.893209f, 0.880342f, 0.874962f, 0.874027f, 0.875902f, 0.879602f,
+	0.884483f, 0.890108f, 0.896165f, 0.902435f, 0.908754f, 0.915008f, 0.921111f, 0.927007f,
+	0.932657f, 0.938036f, 0.943133f, 0.947941f, 0.952462f, 0.956703f, 0.960670f, 0.964375f,
+	0.967828f, 0.971039f, 0.974016f, 0.976766f, 0.979285f, 0.981560f, 0.983535f, 0.984926f,
+	0.992097f, 0.912991f, 0.882857f, 0.868493f, 0.862215f, 0.860741f, 0.862317f, 0.865886f,
+	0.870768f, 0.876496f, 0.882744f, 0.889277f, 0.895923f, 0.902559f, 0.909094f, 0.915462f,
+	0.921618f, 0.927530f, 0.933178f, 0.938553f, 0.943648f, 0.948464f, 0.953005f, 0.957277f,
+	0.961285f, 0.965037f, 0.968538f, 0.971789f, 0.974784f, 0.977501f, 0.979869f, 0.981537f,
+	0.991334f, 0.905040f, 0.872034f, 0.856025f, 0.848718f, 0.846596f, 0.847784f, 0.851159f,
+	0.855997f, 0.861802f, 0.868227f, 0.875022f, 0.882002f, 0.889032f, 0.896012f, 0.902870f,
+	0.909550f, 0.916016f, 0.922240f, 0.928207f, 0.933905f, 0.939330f, 0.944480f, 0.949356f,
+	0.953962f, 0.958300f, 0.962370f, 0.966171f, 0.969691f, 0.972898f, 0.975705f, 0.977683f,
+	0.990543f, 0.896879f, 0.860916f, 0.843172f, 0.834740f, 0.831869f, 0.832576f, 0.835673f,
+	0.840396f, 0.846220f, 0.852776f, 0.859797f, 0.867085f, 0.874493f, 0.881910f, 0.889255f,
+	0.896464f, 0.903493f, 0.910308f, 0.916887f, 0.923212f, 0.929274f, 0.935066f, 0.940585f,
+	0.945829f, 0.950797f, 0.955485f, 0.959886f, 0.963982f, 0.967731f, 0.971026f, 0.973349f,
+	0.989727f, 0.888593f, 0.849650f, 0.830128f, 0.820507f, 0.816813f, 0.816956f, 0.819691f,
+	0.824215f, 0.829979f, 0.836596f, 0.843781f, 0.851323f, 0.859065f, 0.866885f, 0.874691f,
+	0.882413f, 0.889997f, 0.897402f, 0.904599f, 0.911565f, 0.918285f, 0.924746f, 0.930940f,
+	0.936861f, 0.942502f, 0.947855f, 0.952906f, 0.957632f, 0.961978f, 0.965813f, 0.968521f,
+	0.988889f, 0.880252f, 0.838354f, 0.817056f, 0.806219f, 0.801650f, 0.801162f, 0.803457f,
+	0.807699f, 0.813318f, 0.819911f, 0.827180f, 0.834904f, 0.842913f, 0.851078f, 0.859297f,
+	0.867492f, 0.875601f, 0.883577f, 0.891382f, 0.898989f, 0.906373f, 0.913520f, 0.920413f,
+	0.927042f, 0.933394f, 0.939457f, 0.945209f, 0.950618f, 0.955618f, 0.960049f, 0.963185f,
+	0.988028f, 0.871905f, 0.827124f, 0.804081f, 0.792029f, 0.786562f, 0.785397f, 0.787189f,
+	0.791074f, 0.796466f, 0.802948f, 0.810214f, 0.818032f, 0.826227f, 0.834660f, 0.843223f,
+	0.851831f, 0.860415f, 0.868921f, 0.877305f, 0.885532f, 0.893574f, 0.901407f, 0.909011f,
+	0.916370f, 0.923464f, 0.930275f, 0.936774f, 0.942920f, 0.948631f, 0.953717f, 0.957328f,
+	0.987149f, 0.863597f, 0.816031f, 0.791306f, 0.778066f, 0.771698f, 0.769830f, 0.771072f,
+	0.774539f, 0.779630f, 0.785919f, 0.793093f, 0.800915f, 0.809204f, 0.817818f, 0.826642f,
+	0.835587f, 0.844577f, 0.853553f, 0.862466f, 0.871275f, 0.879947f, 0.888451f, 0.896762f,
+	0.904857f, 0.912713f, 0.920301f, 0.927587f, 0.934518f, 0.940996f, 0.946797f, 0.950933f,
+	0.986253f, 0.855358f, 0.805130f, 0.778802f, 0.764420f, 0.757168f, 0.754589f, 0.755255f,
+	0.758257f, 0.762987f, 0.769010f, 0.776010f, 0.783749f, 0.792041f, 0.800742f, 0.809736f,
+	0.818928f, 0.828241f, 0.837612f, 0.846987f, 0.856321f, 0.865575f, 0.874716f, 0.883713f,
+	0.892536f, 0.901156f, 0.909539f, 0.917642f, 0.925399f, 0.932695f, 0.939270f, 0.943983f,
+	0.985341f, 0.847215f, 0.794459f, 0.766625f, 0.751159f, 0.743055f, 0.739774f, 0.739850f,
+	0.742359f, 0.746680f, 0.752378f, 0.759133f, 0.766708f, 0.774917f, 0.783614f, 0.792682f,
+	0.802028f, 0.811573f, 0.821251f, 0.831006f, 0.840792f, 0.850566f, 0.860291f, 0.869932f,
+	0.879456f, 0.888827f, 0.898006f, 0.906941f, 0.915555f, 0.923714f, 0.931117f, 0.936457f,
+	0.984413f, 0.839186f, 0.784047f, 0.754807f, 0.738329f, 0.729417f, 0.725454f, 0.724943f,
+	0.726941f, 0.730822f, 0.736149f, 0.742602f, 0.749943f, 0.757989f, 0.766596f, 0.775649f,
+	0.785055f, 0.794736f, 0.804626f, 0.814672f, 0.824823f, 0.835038f, 0.845277f, 0.855504f,
+	0.865683f, 0.875775f, 0.885733f, 0.895500f, 0.904988f, 0.914042f, 0.922320f, 0.928336f,
+	0.983471f, 0.831282f, 0.773910f, 0.743373f, 0.725959f, 0.716289f, 0.711676f, 0.710589f,
+	0.712074f, 0.715497f, 0.720420f, 0.726524f, 0.733575f, 0.741391f, 0.749832f, 0.758786f,
+	0.768162f, 0.777885f, 0.787893f, 0.798132f, 0.808555f, 0.819121f, 0.829792f, 0.840531f,
+	0.851301f, 0.862062f, 0.872765f, 0.883345f, 0.893706f, 0.903675f, 0.912865f, 0.919600f,
+	0.982515f, 0.823513f, 0.764059f, 0.732334f, 0.714063f, 0.703692f, 0.698467f, 0.696826f,
+	0.697803f, 0.700762f, 0.705261f, 0.710984f, 0.717700f, 0.725232f, 0.733441f, 0.742222f,
+	0.751486f, 0.761163f, 0.771194f, 0.781530f, 0.792128f, 0.802949f, 0.813958f, 0.825122f,
+	0.836405f, 0.847767f, 0.859160f, 0.870516f, 0.881732f, 0.892618f, 0.902743f, 0.910228f,
+	0.994177f, 0.999998f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.893153f, 0.999488f, 0.999882f, 0.999962f, 0.999979f, 0.999984f, 0.999987f, 0.999990f,
+	0.999991f, 0.999999f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.954730f, 0.991236f, 0.998195f, 0.999291f, 0.999633f, 0.999810f, 0.999877f, 0.999914f,
+	0.999936f, 0.999952f, 0.999962f, 0.999976f, 0.999979f, 0.999986f, 0.999988f, 0.999989f,
+	0.999990f, 0.999991f, 0.999992f, 0.999993f, 0.999994f, 0.999995f, 0.999995f, 0.999996f,
+	0.999997f, 0.999997f, 0.999998f, 0.999998f, 0.999999f, 1.000000f, 1.000000f, 0.999999f,
+	0.978812f, 0.959896f, 0.990039f, 0.996150f, 0.998124f, 0.998920f, 0.999325f, 0.999548f,
+	0.999684f, 0.999758f, 0.999810f, 0.999861f, 0.999882f, 0.999908f, 0.999928f, 0.999936f,
+	0.999942f, 0.999948f, 0.999958f, 0.999962f, 0.999966f, 0.999969f, 0.999971f, 0.999976f,
+	0.999980f, 0.999982f, 0.999984f, 0.999986f, 0.999989f, 0.999990f, 0.999992f, 0.999993f,
+	0.987989f, 0.921743f, 0.970369f, 0.987390f, 0.993634f, 0.996380f, 0.997753f, 0.998493f,
+	0.998942f, 0.999226f, 0.999418f, 0.999546f, 0.999634f, 0.999699f, 0.999751f, 0.999793f,
+	0.999821f, 0.999846f, 0.999864f, 0.999883f, 0.999895f, 0.999907f, 0.999919f, 0.999926f,
+	0.999936f, 0.999943f, 0.999948f, 0.999953f, 0.999959f, 0.999966f, 0.999971f, 0.999973f,
+	0.992277f, 0.905576f, 0.944381f, 0.971466f, 0.984486f, 0.990866f, 0.994230f, 0.996139f,
+	0.997292f, 0.998016f, 0.998511f, 0.998845f, 0.999071f, 0.999253f, 0.999378f, 0.999475f,
+	0.999555f, 0.999618f, 0.999670f, 0.999710f, 0.999742f, 0.999769f, 0.999797f, 0.999819f,
+	0.999840f, 0.999857f, 0.999872f, 0.999886f, 0.999900f, 0.999909f, 0.999920f, 0.999928f,
+	0.994549f, 0.909042f, 0.924404f, 0.952138f, 0.970732f, 0.981640f, 0.987991f, 0.991808f,
+	0.994199f, 0.995745f, 0.996785f, 0.997501f, 0.998017f, 0.998390f, 0.998671f, 0.998886f,
+	0.999056f, 0.999187f, 0.999293f, 0.999382f, 0.999458f, 0.999522f, 0.999576f, 0.999622f,
+	0.999661f, 0.999697f, 0.999730f, 0.999761f, 0.999786f, 0.999809f, 0.999828f, 0.999843f,
+	0.995827f, 0.920158f, 0.915720f, 0.935761f, 0.955370f, 0.969531f, 0.978966f, 0.985145f,
+	0.989238f, 0.991999f, 0.993901f, 0.995243f, 0.996210f, 0.996924f, 0.997468f, 0.997881f,
+	0.998201f, 0.998454f, 0.998665f, 0.998836f, 0.998980f, 0.999097f, 0.999202f, 0.999289f,
+	0.999366f, 0.999435f, 0.999496f, 0.999550f, 0.999598f, 0.999637f, 0.999673f, 0.999701f,
+	0.996548f, 0.931818f, 0.915896f, 0.925833f, 0.942102f, 0.956845f, 0.968224f, 0.976497f,
+	0.982399f, 0.986604f, 0.989621f, 0.991817f, 0.993436f, 0.994649f, 0.995573f, 0.996292f,
+	0.996857f, 0.997307f, 0.997671f, 0.997971f, 0.998221f, 0.998432f, 0.998612f, 0.998769f,
+	0.998904f, 0.999022f, 0.999127f, 0.999219f, 0.999300f, 0.999373f, 0.999434f, 0.999479f,
+	0.996928f, 0.941360f, 0.920492f, 0.921977f, 0.932936f, 0.945823f, 0.957436f, 0.966869f,
+	0.974187f, 0.979748f, 0.983948f, 0.987125f, 0.989542f, 0.991400f, 0.992841f, 0.993972f,
+	0.994875f, 0.995601f, 0.996193f, 0.996683f, 0.997092f, 0.997438f, 0.997732f, 0.997988f,
+	0.998211f, 0.998405f, 0.998575f, 0.998727f, 0.998861f, 0.998978f, 0.999078f, 0.999148f,
+	0.997078f, 0.948185f, 0.926104f, 0.921977f, 0.927764f, 0.937541f, 0.947940f, 0.957408f,
+	0.965418f, 0.971941f, 0.977150f, 0.981272f, 0.984528f, 0.987108f, 0.989161f, 0.990807f,
+	0.992139f, 0.993223f, 0.994120f, 0.994867f, 0.995495f, 0.996027f, 0.996483f, 0.996878f,
+	0.997222f, 0.997524f, 0.997789f, 0.998025f, 0.998232f, 0.998414f, 0.998568f, 0.998676f,
+	0.997063f, 0.952420f, 0.930809f, 0.923524f, 0.925277f, 0.931829f, 0.940266f, 0.948889f,
+	0.956840f, 0.963781f, 0.969651f, 0.974529f, 0.978541f, 0.981830f, 0.984524f, 0.986738f,
+	0.988567f, 0.990086f, 0.991354f, 0.992423f, 0.993332f, 0.994107f, 0.994777f, 0.995357f,
+	0.995865f, 0.996312f, 0.996707f, 0.997057f, 0.997365f, 0.997635f, 0.997864f, 0.998024f,
+	0.996921f, 0.954405f, 0.933712f, 0.924905f, 0.923946f, 0.927793f, 0.934160f, 0.941495f,
+	0.948852f, 0.955718f, 0.961859f, 0.967212f, 0.971802f, 0.975704f, 0.979002f, 0.981786f,
+	0.984139f, 0.986132f, 0.987827f, 0.989276f, 0.990521f, 0.991596f, 0.992531f, 0.993348f,
+	0.994067f, 0.994701f, 0.995263f, 0.995762f, 0.996203f, 0.996590f, 0.996918f, 0.997148f,
+	0.996680f, 0.954475f, 0.934529f, 0.925082f, 0.922475f, 0.924348f, 0.928932f, 0.934925f,
+	0.941438f, 0.947906f, 0.954002f, 0.959561f, 0.964524f, 0.968893f, 0.972704f, 0.976013f,
+	0.978878f, 0.981358f, 0.983509f, 0.985375f, 0.987002f, 0.988426f, 0.989675f, 0.990777f,
+	0.991753f, 0.992620f, 0.993391f, 0.994079f, 0.994689f, 0.995225f, 0.995680f, 0.995999f,
+	0.996357f, 0.952936f, 0.933265f, 0.923536f, 0.919982f, 0.920545f, 0.923783f, 0.928621f,
+	0.934283f, 0.940225f, 0.946091f, 0.951662f, 0.956820f, 0.961512f, 0.965730f, 0.969491f,
+	0.972828f, 0.975780f, 0.978389f, 0.980696f, 0.982736f, 0.984544f, 0.986152f, 0.987583f,
+	0.988861f, 0.990004f, 0.991029f, 0.991945f, 0.992763f, 0.993483f, 0.994097f, 0.994528f,
+	0.995964f, 0.950054f, 0.930084f, 0.920089f, 0.915965f, 0.915702f, 0.918013f, 0.921983f,
+	0.926934f, 0.932375f, 0.937956f, 0.943442f, 0.948684f, 0.953592f, 0.958122f, 0.962264f,
+	0.966024f, 0.969419f, 0.972477f, 0.975228f, 0.977698f, 0.979919f, 0.981916f, 0.983714f,
+	0.985335f, 0.986797f, 0.988115f, 0.989303f, 0.990368f, 0.991310f, 0.992115f, 0.992683f,
+	0.995511f, 0.946051f, 0.925206f, 0.914780f, 0.910217f, 0.909414f, 0.911123f, 0.914500f,
+	0.918937f, 0.923988f, 0.929327f, 0.934720f, 0.940004f, 0.945072f, 0.949859f, 0.954329f,
+	0.958469f, 0.962279f, 0.965771f, 0.968962f, 0.971872f, 0.974522f, 0.976936f, 0.979132f,
+	0.981131f, 0.982949f, 0.984602f, 0.986101f, 0.987452f, 0.988654f, 0.989685f, 0.990413f,
+	0.995008f, 0.941123f, 0.918874f, 0.907763f, 0.902737f, 0.901519f, 0.902823f, 0.905819f,
+	0.909927f, 0.914730f, 0.919918f, 0.925265f, 0.930608f, 0.935830f, 0.940854f, 0.945630f,
+	0.950128f, 0.954335f, 0.958252f, 0.961882f, 0.965237f, 0.968332f, 0.971182f, 0.973803f,
+	0.976211f, 0.978421f, 0.980446f, 0.982294f, 0.983970f, 0.985469f, 0.986761f, 0.987674f,
+	0.994465f, 0.935438f, 0.911331f, 0.899265f, 0.893657f, 0.892033f, 0.893021f, 0.895763f,
+	0.899678f, 0.904354f, 0.909490f, 0.914865f, 0.920314f, 0.925719f, 0.930993f, 0.936077f,
+	0.940934f, 0.945538f, 0.949879f, 0.953953f, 0.957764f, 0.961317f, 0.964624f, 0.967696f,
+	0.970543f, 0.973178f, 0.975609f, 0.977844f, 0.979883f, 0.981717f, 0.983303f, 0.984426f,
+	0.993870f, 0.929146f, 0.902809f, 0.889530f, 0.883188f, 0.881092f, 0.881767f, 0.884305f,
+	0.888101f, 0.892732f, 0.897895f, 0.903365f, 0.908975f, 0.914603f, 0.920158f, 0.925574f,
+	0.930804f, 0.935818f, 0.940597f, 0.945129f, 0.949411f, 0.953443f, 0.957230f, 0.960779f,
+	0.964095f, 0.967187f, 0.970061f, 0.972719f, 0.975160f, 0.977365f, 0.979282f, 0.980639f,
+	0.993246f, 0.922370f, 0.893517f, 0.878809f, 0.871575f, 0.868907f, 0.869219f, 0.871540f,
+	0.875233f, 0.879854f, 0.885085f, 0.890694f, 0.896507f, 0.902396f, 0.908263f, 0.914037f,
+	0.919666f, 0.925112f, 0.930349f, 0.935359f, 0.940135f, 0.944670f, 0.948963f, 0.953017f,
+	0.956834f, 0.960418f, 0.963771f, 0.966892f, 0.969772f, 0.972388f, 0.974671f, 0.976288f,
+	0.992591f, 0.915228f, 0.883650f, 0.867339f, 0.859073f, 0.855723f, 0.855591f, 0.857645f,
+	0.861206f, 0.865806f, 0.871107f, 0.876866f, 0.882899f, 0.889068f, 0.895268f, 0.901422f,
+	0.907470f, 0.913368f, 0.919084f, 0.924597f, 0.929891f, 0.934955f, 0.939784f, 0.944376f,
+	0.948728f, 0.952841f, 0.956711f, 0.960335f, 0.963697f, 0.966765f, 0.969454f, 0.971357f,
+	0.991909f, 0.907812f, 0.873374f, 0.855339f, 0.845929f, 0.841794f, 0.841130f, 0.842843f,
+	0.846214f, 0.850747f, 0.856089f, 0.861977f, 0.868216f, 0.874659f, 0.881193f, 0.887730f,
+	0.894205f, 0.900568f, 0.906780f, 0.912814f, 0.918648f, 0.924267f, 0.929661f, 0.934822f,
+	0.939745f, 0.944425f, 0.948855f, 0.953024f, 0.956913f, 0.960478f, 0.963614f, 0.965835f,
+	0.991202f, 0.900205f, 0.862832f, 0.842999f, 0.832364f, 0.827361f, 0.826083f, 0.827375f,
+	0.830484f, 0.834887f, 0.840210f, 0.846178f, 0.852585f, 0.859270f, 0.866112f, 0.873017f,
+	0.879910f, 0.886735f, 0.893445f, 0.900008f, 0.906396f, 0.912590f, 0.918573f, 0.924334f,
+	0.929861f, 0.935146f, 0.940176f, 0.944937f, 0.949399f, 0.953510f, 0.957141f, 0.959714f,
+	0.990475f, 0.892478f, 0.852145f, 0.830484f, 0.818576f, 0.812645f, 0.810683f, 0.811482f,
+	0.814251f, 0.818447f, 0.823681f, 0.829663f, 0.836175f, 0.843049f, 0.850154f, 0.857387f,
+	0.864667f, 0.871931f, 0.879125f, 0.886210f, 0.893154f, 0.899930f, 0.906518f, 0.912900f,
+	0.919061f, 0.924985f, 0.930657f, 0.936052f, 0.941137f, 0.945844f, 0.950021f, 0.952987f,
+	0.989725f, 0.884681f, 0.841413f, 0.817924f, 0.804728f, 0.797835f, 0.795139f, 0.795381f,
+	0.797742f, 0.801658f, 0.806724f, 0.812643f, 0.819186f, 0.826178f, 0.833480f, 0.840983f,
+	0.848600f, 0.856259f, 0.863903f, 0.871486f, 0.878969f, 0.886321f, 0.893516f, 0.900531f,
+	0.907344f, 0.913935f, 0.920282f, 0.926356f, 0.932110f, 0.937467f, 0.942243f, 0.945646f,
+	0.988957f, 0.876862f, 0.830714f, 0.805434f, 0.790957f, 0.783089f, 0.779629f, 0.779269f,
+	0.781162f, 0.784729f, 0.789554f, 0.795330f, 0.801824f, 0.808854f, 0.816276f, 0.823976f,
+	0.831861f, 0.839855f, 0.847897f, 0.855933f, 0.863922f, 0.871825f, 0.879613f, 0.887255f,
+	0.894728f, 0.902003f, 0.909052f, 0.915838f, 0.922307f, 0.928363f, 0.933793f, 0.937680f,
+	0.988173f, 0.869056f, 0.820111f, 0.793096f, 0.777369f, 0.768534f, 0.764297f, 0.763305f,
+	0.764687f, 0.767849f, 0.772366f, 0.777926f, 0.784291f, 0.791276f, 0.798734f, 0.806548f,
+	0.814623f, 0.822877f, 0.831247f, 0.839677f, 0.848118f, 0.856530f, 0.864878f, 0.873129f,
+	0.881250f, 0.889211f, 0.896976f, 0.904500f, 0.911719f, 0.918520f, 0.924658f, 0.929077f,
+	0.987373f, 0.861292f, 0.809653f, 0.780977f, 0.764048f, 0.754269f, 0.749260f, 0.747622f,
+	0.748463f, 0.751176f, 0.755331f, 0.760609f, 0.766772f, 0.773633f, 0.781044f, 0.788887f,
+	0.797065f, 0.805496f, 0.814115f, 0.822861f, 0.831687f, 0.840549f, 0.849408f, 0.858226f,
+	0.866969f, 0.875601f, 0.884080f, 0.892355f, 0.900348f, 0.907932f, 0.914824f, 0.919823f,
+	0.986559f, 0.853592f, 0.799374f, 0.769123f, 0.751054f, 0.740369f, 0.734605f, 0.732322f,
+	0.732607f, 0.734842f, 0.738590f, 0.743534f, 0.749431f, 0.756096f, 0.763381f, 0.771170f,
+	0.779364f, 0.787884f, 0.796663f, 0.805643f, 0.814774f, 0.824011f, 0.833313f, 0.842643f,
+	0.851963f, 0.861233f, 0.870406f, 0.879425f, 0.888204f, 0.896597f, 0.904282f, 0.909902f,
+	0.985730f, 0.845973f, 0.789301f, 0.757571f, 0.738429f, 0.726885f, 0.720396f, 0.717481f,
+	0.717206f, 0.718946f, 0.722260f, 0.726826f, 0.732405f, 0.738812f, 0.745902f, 0.753558f,
+	0.761686f, 0.770208f, 0.779059f, 0.788182f, 0.797529f, 0.807056f, 0.816723f, 0.826492f,
+	0.836326f, 0.846181f, 0.856011f, 0.865751f, 0.875309f, 0.884520f, 0.893024f, 0.899298f,
+	0.984889f, 0.838446f, 0.779452f, 0.746343f, 0.726202f, 0.713854f, 0.706676f, 0.703150f,
+	0.702325f, 0.703564f, 0.706425f, 0.710586f, 0.715806f, 0.721905f, 0.728738f, 0.736193f,
+	0.744179f, 0.752621f, 0.761456f, 0.770633f, 0.780104f, 0.789829f, 0.799772f, 0.809895f,
+	0.820164f, 0.830537f, 0.840966f, 0.851385f, 0.861695f, 0.871716f, 0.881051f, 0.887999f,
+	0.994177f, 0.999998f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.893144f, 0.999487f, 0.999882f, 0.999962f, 0.999979f, 0.999984f, 0.999987f, 0.999989f,
+	0.999991f, 0.999999f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.954721f, 0.991214f, 0.998184f, 0.999285f, 0.999629f, 0.999807f, 0.999875f, 0.999912f,
+	0.999935f, 0.999951f, 0.999961f, 0.999975f, 0.999978f, 0.999986f, 0.999988f, 0.999989f,
+	0.999990f, 0.999991f, 0.999992f, 0.999993f, 0.999994f, 0.999995f, 0.999995f, 0.999996f,
+	0.999996f, 0.999997f, 0.999997f, 0.999998f, 0.999999f, 1.000000f, 1.000000f, 0.999999f,
+	0.978807f, 0.959796f, 0.989983f, 0.996115f, 0.998100f, 0.998902f, 0.999312f, 0.999538f,
+	0.999676f, 0.999752f, 0.999804f, 0.999857f, 0.999879f, 0.999906f, 0.999926f, 0.999934f,
+	0.999941f, 0.999946f, 0.999957f, 0.999961f, 0.999964f, 0.999967f, 0.999969f, 0.999975f,
+	0.999978f, 0.999980f, 0.999982f, 0.999984f, 0.999987f, 0.999989f, 0.999991f, 0.999992f,
+	0.987992f, 0.921540f, 0.970203f, 0.987275f, 0.993551f, 0.996320f, 0.997707f, 0.998458f,
+	0.998914f, 0.999204f, 0.999401f, 0.999532f, 0.999623f, 0.999689f, 0.999742f, 0.999786f,
+	0.999815f, 0.999840f, 0.999859f, 0.999879f, 0.999890f, 0.999903f, 0.999914f, 0.999921f,
+	0.999932f, 0.999938f, 0.999943f, 0.999947f, 0.999953f, 0.999961f, 0.999966f, 0.999967f,
+	0.992291f, 0.905316f, 0.944069f, 0.971208f, 0.984288f, 0.990715f, 0.994114f, 0.996048f,
+	0.997220f, 0.997959f, 0.998465f, 0.998808f, 0.999040f, 0.999228f, 0.999357f, 0.999456f,
+	0.999538f, 0.999603f, 0.999656f, 0.999697f, 0.999729f, 0.999756f, 0.999784f, 0.999806f,
+	0.999828f, 0.999845f, 0.999860f, 0.999873f, 0.999887f, 0.999896f, 0.999907f, 0.999914f,
+	0.994579f, 0.908789f, 0.923977f, 0.951710f, 0.970364f, 0.981341f, 0.987752f, 0.991617f,
+	0.994045f, 0.995621f, 0.996685f, 0.997418f, 0.997948f, 0.998332f, 0.998622f, 0.998843f,
+	0.999019f, 0.999152f, 0.999262f, 0.999352f, 0.999430f, 0.999495f, 0.999549f, 0.999596f,
+	0.999634f, 0.999670f, 0.999703f, 0.999734f, 0.999758f, 0.999781f, 0.999799f, 0.999814f,
+	0.995878f, 0.919975f, 0.915253f, 0.935198f, 0.954823f, 0.969047f, 0.978555f, 0.984804f,
+	0.988956f, 0.991767f, 0.993709f, 0.995083f, 0.996076f, 0.996811f, 0.997371f, 0.997797f,
+	0.998125f, 0.998385f, 0.998603f, 0.998778f, 0.998924f, 0.999043f, 0.999149f, 0.999237f,
+	0.999314f, 0.999384f, 0.999444f, 0.999498f, 0.999544f, 0.999583f, 0.999618f, 0.999646f,
+	0.996625f, 0.931775f, 0.915483f, 0.925219f, 0.941424f, 0.956186f, 0.967626f, 0.975973f,
+	0.981949f, 0.986221f, 0.989296f, 0.991542f, 0.993201f, 0.994447f, 0.995398f, 0.996138f,
+	0.996720f, 0.997183f, 0.997556f, 0.997864f, 0.998120f, 0.998334f, 0.998516f, 0.998676f,
+	0.998812f, 0.998930f, 0.999034f, 0.999125f, 0.999205f, 0.999277f, 0.999338f, 0.999381f,
+	0.997035f, 0.941531f, 0.920237f, 0.921421f, 0.932221f, 0.945055f, 0.956683f, 0.966169f,
+	0.973556f, 0.979190f, 0.983459f, 0.986699f, 0.989170f, 0.991074f, 0.992553f, 0.993716f,
+	0.994644f, 0.995390f, 0.995998f, 0.996501f, 0.996919f, 0.997271f, 0.997570f, 0.997829f,
+	0.998054f, 0.998249f, 0.998418f, 0.998570f, 0.998703f, 0.998819f, 0.998917f, 0.998987f,
+	0.997221f, 0.948647f, 0.926116f, 0.921601f, 0.927132f, 0.936768f, 0.947113f, 0.956584f,
+	0.964633f, 0.971214f, 0.976488f, 0.980675f, 0.983992f, 0.986626f, 0.988727f, 0.990414f,
+	0.991779f, 0.992891f, 0.993810f, 0.994575f, 0.995216f, 0.995758f, 0.996222f, 0.996622f,
+	0.996969f, 0.997273f, 0.997539f, 0.997775f, 0.997981f, 0.998162f, 0.998314f, 0.998422f,
+	0.997246f, 0.953248f, 0.931204f, 0.923462f, 0.924864f, 0.931179f, 0.939476f, 0.948032f,
+	0.955968f, 0.962928f, 0.968839f, 0.973766f, 0.977832f, 0.981174f, 0.983918f, 0.986176f,
+	0.988043f, 0.989594f, 0.990890f, 0.991980f, 0.992907f, 0.993696f, 0.994376f, 0.994964f,
+	0.995477f, 0.995927f, 0.996324f, 0.996674f, 0.996982f, 0.997252f, 0.997479f, 0.997639f,
+	0.997150f, 0.955671f, 0.934602f, 0.925289f, 0.923893f, 0.927406f, 0.933538f, 0.940721f,
+	0.947989f, 0.954815f, 0.960949f, 0.966319f, 0.970937f, 0.974876f, 0.978212f, 0.981034f,
+	0.983422f, 0.985447f, 0.987169f, 0.988642f, 0.989905f, 0.990996f, 0.991943f, 0.992770f,
+	0.993495f, 0.994133f, 0.994698f, 0.995198f, 0.995639f, 0.996026f, 0.996352f, 0.996583f,
+	0.996959f, 0.956239f, 0.936015f, 0.926039f, 0.922919f, 0.924365f, 0.928616f, 0.934360f,
+	0.940698f, 0.947050f, 0.953074f, 0.958595f, 0.963544f, 0.967914f, 0.971737f, 0.975064f,
+	0.977949f, 0.980451f, 0.982622f, 0.984506f, 0.986149f, 0.987587f, 0.988847f, 0.989958f,
+	0.990940f, 0.991811f, 0.992585f, 0.993273f, 0.993884f, 0.994420f, 0.994874f, 0.995195f,
+	0.996689f, 0.955251f, 0.935433f, 0.925178f, 0.921053f, 0.921100f, 0.923905f, 0.928395f,
+	0.933785f, 0.939522f, 0.945236f, 0.950698f, 0.955781f, 0.960422f, 0.964610f, 0.968354f,
+	0.971683f, 0.974635f, 0.977246f, 0.979557f, 0.981603f, 0.983416f, 0.985028f, 0.986463f,
+	0.987743f, 0.988888f, 0.989913f, 0.990829f, 0.991646f, 0.992366f, 0.992979f, 0.993413f,
+	0.996354f, 0.952959f, 0.933000f, 0.922505f, 0.917768f, 0.916911f, 0.918693f, 0.922213f,
+	0.926791f, 0.931928f, 0.937266f, 0.942559f, 0.947650f, 0.952442f, 0.956884f, 0.960959f,
+	0.964669f, 0.968027f, 0.971058f, 0.973788f, 0.976244f, 0.978453f, 0.980441f, 0.982232f,
+	0.983847f, 0.985303f, 0.986616f, 0.987799f, 0.988860f, 0.989799f, 0.990602f, 0.991174f,
+	0.995962f, 0.949572f, 0.928913f, 0.918031f, 0.912829f, 0.911365f, 0.912456f, 0.915283f,
+	0.919243f, 0.923888f, 0.928885f, 0.933992f, 0.939040f, 0.943914f, 0.948541f, 0.952882f,
+	0.956916f, 0.960641f, 0.964063f, 0.967197f, 0.970061f, 0.972674f, 0.975056f, 0.977226f,
+	0.979204f, 0.981004f, 0.982641f, 0.984126f, 0.985466f, 0.986659f, 0.987685f, 0.988416f,
+	0.995521f, 0.945272f, 0.923390f, 0.911881f, 0.906202f, 0.904269f, 0.904875f, 0.907226f,
+	0.910755f, 0.915047f, 0.919790f, 0.924753f, 0.929767f, 0.934707f, 0.939491f, 0.944063f,
+	0.948389f, 0.952451f, 0.956245f, 0.959771f, 0.963039f, 0.966059f, 0.968846f, 0.971414f,
+	0.973777f, 0.975949f, 0.977941f, 0.979761f, 0.981414f, 0.982894f, 0.984174f, 0.985088f,
+	0.995043f, 0.940213f, 0.916651f, 0.904247f, 0.897984f, 0.895600f, 0.895820f, 0.897829f,
+	0.901067f, 0.905131f, 0.909720f, 0.914610f, 0.919632f, 0.924663f, 0.929609f, 0.934409f,
+	0.939018f, 0.943407f, 0.947562f, 0.951476f, 0.955147f, 0.958581f, 0.961784f, 0.964766f,
+	0.967536f, 0.970105f, 0.972479f, 0.974665f, 0.976663f, 0.978463f, 0.980025f, 0.981143f,
+	0.994515f, 0.934534f, 0.908906f, 0.895347f, 0.888351f, 0.885459f, 0.885304f, 0.887031f,
+	0.890060f, 0.893983f, 0.898498f, 0.903384f, 0.908469f, 0.913628f, 0.918764f, 0.923808f,
+	0.928710f, 0.933434f, 0.937956f, 0.942262f, 0.946346f, 0.950203f, 0.953837f, 0.957251f,
+	0.960450f, 0.963440f, 0.966225f, 0.968807f, 0.971181f, 0.973332f, 0.975207f, 0.976549f,
+	0.993959f, 0.928349f, 0.900348f, 0.885408f, 0.877520f, 0.874024f, 0.873451f, 0.874891f,
+	0.877736f, 0.881558f, 0.886049f, 0.890977f, 0.896169f, 0.901494f, 0.906851f, 0.912165f,
+	0.917381f, 0.922456f, 0.927361f, 0.932075f, 0.936585f, 0.940885f, 0.944968f, 0.948837f,
+	0.952489f, 0.955927f, 0.959151f, 0.962160f, 0.964943f, 0.967477f, 0.969696f, 0.971282f,
+	0.993373f, 0.921766f, 0.891156f, 0.874647f, 0.865721f, 0.861512f, 0.860447f, 0.861556f,
+	0.864195f, 0.867915f, 0.872390f, 0.877379f, 0.882699f, 0.888212f, 0.893812f, 0.899418f,
+	0.904967f, 0.910413f, 0.915719f, 0.920860f, 0.925819f, 0.930581f, 0.935138f, 0.939486f,
+	0.943619f, 0.947537f, 0.951233f, 0.954702f, 0.957929f, 0.960882f, 0.963478f, 0.965332f,
+	0.992760f, 0.914874f, 0.881490f, 0.863271f, 0.853185f, 0.848158f, 0.846514f, 0.847224f,
+	0.849608f, 0.853189f, 0.857625f, 0.862660f, 0.868102f, 0.873804f, 0.879651f, 0.885555f,
+	0.891448f, 0.897276f, 0.902999f, 0.908584f, 0.914010f, 0.919258f, 0.924313f, 0.929168f,
+	0.933813f, 0.938242f, 0.942446f, 0.946414f, 0.950123f, 0.953534f, 0.956544f, 0.958692f,
+	0.992124f, 0.907752f, 0.871485f, 0.851461f, 0.840123f, 0.834189f, 0.831885f, 0.832121f,
+	0.834182f, 0.837567f, 0.841914f, 0.846955f, 0.852487f, 0.858352f, 0.864428f, 0.870618f,
+	0.876848f, 0.883058f, 0.889201f, 0.895240f, 0.901146f, 0.906896f, 0.912473f, 0.917861f,
+	0.923047f, 0.928022f, 0.932771f, 0.937276f, 0.941511f, 0.945422f, 0.948889f, 0.951365f,
+	0.991467f, 0.900468f, 0.861262f, 0.839380f, 0.826728f, 0.819821f, 0.816784f, 0.816475f,
+	0.818142f, 0.821261f, 0.825456f, 0.830445f, 0.836013f, 0.841994f, 0.848259f, 0.854703f,
+	0.861244f, 0.867817f, 0.874368f, 0.880854f, 0.887242f, 0.893503f, 0.899614f, 0.905555f,
+	0.911310f, 0.916861f, 0.922191f, 0.927275f, 0.932079f, 0.936539f, 0.940509f, 0.943350f,
+	0.990789f, 0.893074f, 0.850919f, 0.827160f, 0.813163f, 0.805241f, 0.801419f, 0.800503f,
+	0.801709f, 0.804494f, 0.808466f, 0.813333f, 0.818870f, 0.824906f, 0.831301f, 0.837946f,
+	0.844754f, 0.851651f, 0.858580f, 0.865492f, 0.872347f, 0.879113f, 0.885760f, 0.892265f,
+	0.898605f, 0.904758f, 0.910701f, 0.916402f, 0.921820f, 0.926876f, 0.931400f, 0.934649f,
+	0.990093f, 0.885619f, 0.840539f, 0.814917f, 0.799572f, 0.790614f, 0.785972f, 0.784401f,
+	0.785090f, 0.787477f, 0.791157f, 0.795829f, 0.801264f, 0.807280f, 0.813736f, 0.820517f,
+	0.827529f, 0.834697f, 0.841955f, 0.849253f, 0.856544f, 0.863792f, 0.870962f, 0.878026f,
+	0.884957f, 0.891726f, 0.898305f, 0.904657f, 0.910728f, 0.916428f, 0.921558f, 0.925261f,
+	0.989381f, 0.878137f, 0.830188f, 0.802741f, 0.786066f, 0.776072f, 0.770594f, 0.768339f,
+	0.768468f, 0.770403f, 0.773730f, 0.778139f, 0.783397f, 0.789319f, 0.795760f, 0.802601f,
+	0.809745f, 0.817113f, 0.824639f, 0.832265f, 0.839944f, 0.847633f, 0.855296f, 0.862899f,
+	0.870410f, 0.877797f, 0.885024f, 0.892047f, 0.898805f, 0.905191f, 0.910976f, 0.915181f,
+	0.988653f, 0.870662f, 0.819919f, 0.790705f, 0.772738f, 0.761725f, 0.755412f, 0.752458f,
+	0.751998f, 0.753441f, 0.756362f, 0.760449f, 0.765463f, 0.771218f, 0.777566f, 0.784388f,
+	0.791585f, 0.799077f, 0.806796f, 0.814681f, 0.822683f, 0.830758f, 0.838866f, 0.846970f,
+	0.855034f, 0.863022f, 0.870893f, 0.878598f, 0.886063f, 0.893168f, 0.899651f, 0.904402f,
+	0.987911f, 0.863216f, 0.809773f, 0.778864f, 0.759656f, 0.747657f, 0.740524f, 0.736870f,
+	0.735807f, 0.736730f, 0.739207f, 0.742922f, 0.747633f, 0.753154f, 0.759338f, 0.766064f,
+	0.773234f, 0.780768f, 0.788598f, 0.796663f, 0.804914f, 0.813304f, 0.821794f, 0.830344f,
+	0.838916f, 0.847472f, 0.855966f, 0.864343f, 0.872522f, 0.880366f, 0.887581f, 0.892915f,
+	0.987156f, 0.855820f, 0.799780f, 0.767260f, 0.746874f, 0.733932f, 0.726005f, 0.721664f,
+	0.719996f, 0.720383f, 0.722390f, 0.725694f, 0.730055f, 0.735286f, 0.741240f, 0.747799f,
+	0.754865f, 0.762361f, 0.770218f, 0.778380f, 0.786795f, 0.795421f, 0.804216f, 0.813143f,
+	0.822162f, 0.831234f, 0.840311f, 0.849334f, 0.858215f, 0.866803f, 0.874769f, 0.880714f,
+	0.986388f, 0.848486f, 0.789965f, 0.755925f, 0.734429f, 0.720595f, 0.711911f, 0.706903f,
+	0.704639f, 0.704489f, 0.706010f, 0.708878f, 0.712853f, 0.717747f, 0.723416f, 0.729744f,
+	0.736637f, 0.744018f, 0.751822f, 0.759995f, 0.768489f, 0.777263f, 0.786279f, 0.795500f,
+	0.804891f, 0.814411f, 0.824013f, 0.833637f, 0.843189f, 0.852505f, 0.861225f, 0.867793f,
+	0.994177f, 0.999998f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.893144f, 0.999487f, 0.999881f, 0.999961f, 0.999979f, 0.999984f, 0.999987f, 0.999989f,
+	0.999991f, 0.999999f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.954722f, 0.991210f, 0.998181f, 0.999282f, 0.999627f, 0.999805f, 0.999873f, 0.999911f,
+	0.999934f, 0.999951f, 0.999960f, 0.999975f, 0.999978f, 0.999986f, 0.999987f, 0.999989f,
+	0.999990f, 0.999991f, 0.999992f, 0.999993f, 0.999994f, 0.999995f, 0.999995f, 0.999996f,
+	0.999996f, 0.999997f, 0.999997f, 0.999997f, 0.999999f, 1.000000f, 1.000000f, 0.999999f,
+	0.978809f, 0.959776f, 0.989965f, 0.996100f, 0.998088f, 0.998893f, 0.999304f, 0.999531f,
+	0.999671f, 0.999747f, 0.999800f, 0.999853f, 0.999876f, 0.999904f, 0.999924f, 0.999932f,
+	0.999939f, 0.999944f, 0.999956f, 0.999960f, 0.999963f, 0.999966f, 0.999967f, 0.999973f,
+	0.999977f, 0.999979f, 0.999981f, 0.999982f, 0.999986f, 0.999987f, 0.999989f, 0.999990f,
+	0.987999f, 0.921499f, 0.970151f, 0.987228f, 0.993513f, 0.996288f, 0.997681f, 0.998436f,
+	0.998896f, 0.999188f, 0.999388f, 0.999521f, 0.999613f, 0.999680f, 0.999735f, 0.999779f,
+	0.999809f, 0.999834f, 0.999853f, 0.999874f, 0.999885f, 0.999898f, 0.999910f, 0.999916f,
+	0.999927f, 0.999934f, 0.999938f, 0.999942f, 0.999948f, 0.999956f, 0.999961f, 0.999962f,
+	0.992305f, 0.905262f, 0.943969f, 0.971105f, 0.984195f, 0.990635f, 0.994047f, 0.995992f,
+	0.997173f, 0.997919f, 0.998431f, 0.998779f, 0.999014f, 0.999206f, 0.999337f, 0.999438f,
+	0.999522f, 0.999588f, 0.999642f, 0.999684f, 0.999716f, 0.999743f, 0.999772f, 0.999794f,
+	0.999815f, 0.999832f, 0.999847f, 0.999861f, 0.999875f, 0.999883f, 0.999894f, 0.999901f,
+	0.994603f, 0.908740f, 0.923838f, 0.951537f, 0.970192f, 0.981184f, 0.987614f, 0.991499f,
+	0.993944f, 0.995534f, 0.996610f, 0.997354f, 0.997892f, 0.998283f, 0.998579f, 0.998804f,
+	0.998983f, 0.999119f, 0.999231f, 0.999323f, 0.999402f, 0.999468f, 0.999523f, 0.999569f,
+	0.999607f, 0.999643f, 0.999677f, 0.999708f, 0.999732f, 0.999754f, 0.999772f, 0.999786f,
+	0.995916f, 0.919963f, 0.915102f, 0.934968f, 0.954565f, 0.968792f, 0.978319f, 0.984592f,
+	0.988770f, 0.991605f, 0.993567f, 0.994960f, 0.995967f, 0.996714f, 0.997285f, 0.997720f,
+	0.998055f, 0.998320f, 0.998542f, 0.998720f, 0.998869f, 0.998989f, 0.999097f, 0.999186f,
+	0.999263f, 0.999333f, 0.999393f, 0.999447f, 0.999493f, 0.999531f, 0.999566f, 0.999593f,
+	0.996679f, 0.931841f, 0.915361f, 0.924968f, 0.941102f, 0.955838f, 0.967281f, 0.975648f,
+	0.981651f, 0.985954f, 0.989057f, 0.991329f, 0.993011f, 0.994278f, 0.995245f, 0.996000f,
+	0.996593f, 0.997065f, 0.997446f, 0.997760f, 0.998020f, 0.998237f, 0.998422f, 0.998583f,
+	0.998721f, 0.998839f, 0.998943f, 0.999034f, 0.999113f, 0.999185f, 0.999246f, 0.999289f,
+	0.997109f, 0.941724f, 0.920201f, 0.921202f, 0.931879f, 0.944644f, 0.956245f, 0.965731f,
+	0.973136f, 0.978797f, 0.983098f, 0.986369f, 0.988870f, 0.990801f, 0.992303f, 0.993486f,
+	0.994432f, 0.995192f, 0.995812f, 0.996324f, 0.996749f, 0.997107f, 0.997410f, 0.997673f,
+	0.997900f, 0.998097f, 0.998266f, 0.998418f, 0.998551f, 0.998667f, 0.998765f, 0.998835f,
+	0.997319f, 0.949020f, 0.926237f, 0.921484f, 0.926836f, 0.936351f, 0.946623f, 0.956060f,
+	0.964103f, 0.970696f, 0.975993f, 0.980209f, 0.983555f, 0.986220f, 0.988349f, 0.990061f,
+	0.991449f, 0.992579f, 0.993515f, 0.994293f, 0.994944f, 0.995495f, 0.995965f, 0.996370f,
+	0.996722f, 0.997028f, 0.997296f, 0.997533f, 0.997739f, 0.997920f, 0.998073f, 0.998181f,
+	0.997372f, 0.953852f, 0.931556f, 0.923526f, 0.924691f, 0.930827f, 0.938999f, 0.947474f,
+	0.955365f, 0.962308f, 0.968220f, 0.973161f, 0.977248f, 0.980615f, 0.983385f, 0.985669f,
+	0.987560f, 0.989133f, 0.990447f, 0.991554f, 0.992495f, 0.993295f, 0.993985f, 0.994579f,
+	0.995098f, 0.995552f, 0.995952f, 0.996304f, 0.996613f, 0.996883f, 0.997112f, 0.997273f,
+	0.997306f, 0.956558f, 0.935263f, 0.925624f, 0.923932f, 0.927204f, 0.933150f, 0.940196f,
+	0.947371f, 0.954136f, 0.960237f, 0.965592f, 0.970211f, 0.974158f, 0.977510f, 0.980350f,
+	0.982758f, 0.984802f, 0.986542f, 0.988031f, 0.989309f, 0.990412f, 0.991369f, 0.992204f,
+	0.992936f, 0.993580f, 0.994149f, 0.994651f, 0.995095f, 0.995483f, 0.995812f, 0.996046f,
+	0.997148f, 0.957455f, 0.937058f, 0.926732f, 0.923263f, 0.924403f, 0.928403f, 0.933948f,
+	0.940133f, 0.946371f, 0.952314f, 0.957780f, 0.962695f, 0.967047f, 0.970863f, 0.974191f,
+	0.977082f, 0.979592f, 0.981774f, 0.983669f, 0.985323f, 0.986770f, 0.988039f, 0.989158f,
+	0.990147f, 0.991023f, 0.991801f, 0.992493f, 0.993106f, 0.993645f, 0.994102f, 0.994429f,
+	0.996915f, 0.956835f, 0.936924f, 0.926312f, 0.921790f, 0.921470f, 0.923955f, 0.928177f,
+	0.933348f, 0.938908f, 0.944484f, 0.949840f, 0.954843f, 0.959426f, 0.963572f, 0.967288f,
+	0.970600f, 0.973540f, 0.976147f, 0.978456f, 0.980502f, 0.982318f, 0.983932f, 0.985371f,
+	0.986654f, 0.987802f, 0.988829f, 0.989748f, 0.990567f, 0.991289f, 0.991906f, 0.992349f,
+	0.996618f, 0.954944f, 0.934991f, 0.924149f, 0.918978f, 0.917694f, 0.919089f, 0.922269f,
+	0.926556f, 0.931448f, 0.936581f, 0.941707f, 0.946662f, 0.951345f, 0.955701f, 0.959708f,
+	0.963365f, 0.966683f, 0.969683f, 0.972390f, 0.974828f, 0.977025f, 0.979003f, 0.980787f,
+	0.982397f, 0.983850f, 0.985161f, 0.986342f, 0.987402f, 0.988343f, 0.989149f, 0.989730f,
+	0.996268f, 0.951980f, 0.931443f, 0.920236f, 0.914575f, 0.912632f, 0.913268f, 0.915682f,
+	0.919276f, 0.923602f, 0.928323f, 0.933194f, 0.938041f, 0.942747f, 0.947233f, 0.951455f,
+	0.955392f, 0.959036f, 0.962392f, 0.965473f, 0.968292f, 0.970869f, 0.973222f, 0.975368f,
+	0.977327f, 0.979111f, 0.980737f, 0.982212f, 0.983546f, 0.984736f, 0.985763f, 0.986504f,
+	0.995870f, 0.948116f, 0.926479f, 0.914678f, 0.908525f, 0.906067f, 0.906155f, 0.908021f,
+	0.911108f, 0.915004f, 0.919395f, 0.924049f, 0.928792f, 0.933496f, 0.938076f, 0.942473f,
+	0.946647f, 0.950579f, 0.954262f, 0.957695f, 0.960882f, 0.963835f, 0.966565f, 0.969084f,
+	0.971407f, 0.973545f, 0.975509f, 0.977307f, 0.978943f, 0.980412f, 0.981686f, 0.982608f,
+	0.995437f, 0.943499f, 0.920305f, 0.907647f, 0.900900f, 0.897953f, 0.897598f, 0.899054f,
+	0.901775f, 0.905365f, 0.909524f, 0.914027f, 0.918704f, 0.923427f, 0.928101f, 0.932660f,
+	0.937056f, 0.941260f, 0.945252f, 0.949023f, 0.952570f, 0.955896f, 0.959006f, 0.961908f,
+	0.964609f, 0.967118f, 0.969442f, 0.971587f, 0.973551f, 0.975326f, 0.976874f, 0.977994f,
+	0.994956f, 0.938257f, 0.913116f, 0.899340f, 0.891854f, 0.888366f, 0.887585f, 0.888694f,
+	0.891135f, 0.894507f, 0.898515f, 0.902935f, 0.907597f, 0.912373f, 0.917165f, 0.921898f,
+	0.926522f, 0.930997f, 0.935298f, 0.939407f, 0.943315f, 0.947018f, 0.950515f, 0.953809f,
+	0.956903f, 0.959801f, 0.962507f, 0.965021f, 0.967339f, 0.969446f, 0.971291f, 0.972627f,
+	0.994447f, 0.932499f, 0.905091f, 0.889967f, 0.881583f, 0.877461f, 0.876214f, 0.876977f,
+	0.879165f, 0.882365f, 0.886272f, 0.890657f, 0.895349f, 0.900215f, 0.905152f, 0.910084f,
+	0.914952f, 0.919711f, 0.924331f, 0.928788f, 0.933067f, 0.937158f, 0.941055f, 0.944757f,
+	0.948262f, 0.951569f, 0.954678f, 0.957587f, 0.960286f, 0.962750f, 0.964919f, 0.966487f,
+	0.993909f, 0.926325f, 0.896399f, 0.879728f, 0.870297f, 0.865432f, 0.863650f, 0.864027f,
+	0.865947f, 0.868975f, 0.872794f, 0.877165f, 0.881910f, 0.886888f, 0.891994f, 0.897144f,
+	0.902274f, 0.907335f, 0.912289f, 0.917110f, 0.921776f, 0.926272f, 0.930588f, 0.934718f,
+	0.938655f, 0.942397f, 0.945937f, 0.949268f, 0.952375f, 0.955228f, 0.957747f, 0.959566f,
+	0.993345f, 0.919820f, 0.887189f, 0.868820f, 0.858214f, 0.852499f, 0.850095f, 0.850022f,
+	0.851628f, 0.854454f, 0.858166f, 0.862513f, 0.867307f, 0.872402f, 0.877681f, 0.883056f,
+	0.888458f, 0.893833f, 0.899135f, 0.904334f, 0.909404f, 0.914324f, 0.919080f, 0.923662f,
+	0.928058f, 0.932261f, 0.936262f, 0.940047f, 0.943598f, 0.946873f, 0.949776f, 0.951870f,
+	0.992758f, 0.913060f, 0.877594f, 0.857416f, 0.845534f, 0.838878f, 0.835770f, 0.835174f,
+	0.836403f, 0.838974f, 0.842534f, 0.846823f, 0.851639f, 0.856827f, 0.862265f, 0.867856f,
+	0.873526f, 0.879212f, 0.884867f, 0.890452f, 0.895936f, 0.901296f, 0.906512f, 0.911568f,
+	0.916450f, 0.921145f, 0.925640f, 0.929916f, 0.933947f, 0.937683f, 0.941009f, 0.943408f,
+	0.992151f, 0.906112f, 0.867729f, 0.845673f, 0.832444f, 0.824775f, 0.820891f, 0.819702f,
+	0.820485f, 0.822736f, 0.826087f, 0.830262f, 0.835052f, 0.840292f, 0.845853f, 0.851631f,
+	0.857545f, 0.863526f, 0.869522f, 0.875489f, 0.881390f, 0.887197f, 0.892885f, 0.898433f,
+	0.903824f, 0.909039f, 0.914061f, 0.918865f, 0.923418f, 0.927659f, 0.931452f, 0.934192f,
+	0.991522f, 0.899024f, 0.857693f, 0.833724f, 0.819107f, 0.810377f, 0.805661f, 0.803817f,
+	0.804091f, 0.805956f, 0.809031f, 0.813030f, 0.817732f, 0.822967f, 0.828597f, 0.834515f,
+	0.840631f, 0.846874f, 0.853183f, 0.859511f, 0.865815f, 0.872063f, 0.878225f, 0.884275f,
+	0.890190f, 0.895949f, 0.901527f, 0.906895f, 0.912011f, 0.916803f, 0.921110f, 0.924235f,
+	0.990877f, 0.891848f, 0.847569f, 0.821685f, 0.805666f, 0.795847f, 0.790262f, 0.787716f,
+	0.787425f, 0.788845f, 0.791579f, 0.795333f, 0.799880f, 0.805043f, 0.810679f, 0.816675f,
+	0.822938f, 0.829390f, 0.835969f, 0.842620f, 0.849298f, 0.855965f, 0.862588f, 0.869135f,
+	0.875581f, 0.881896f, 0.888052f, 0.894014f, 0.899731f, 0.905118f, 0.909990f, 0.913546f,
+	0.990215f, 0.884618f, 0.837424f, 0.809650f, 0.792237f, 0.781324f, 0.774850f, 0.771571f,
+	0.770674f, 0.771596f, 0.773932f, 0.777378f, 0.781703f, 0.786723f, 0.792294f, 0.798299f,
+	0.804640f, 0.811239f, 0.818028f, 0.824950f, 0.831956f, 0.839005f, 0.846059f, 0.853084f,
+	0.860049f, 0.866921f, 0.873666f, 0.880242f, 0.886590f, 0.892612f, 0.898096f, 0.902128f,
+	0.989539f, 0.877367f, 0.827314f, 0.797694f, 0.778916f, 0.766921f, 0.759556f, 0.755528f,
+	0.753997f, 0.754384f, 0.756273f, 0.759355f, 0.763394f, 0.768205f, 0.773640f, 0.779580f,
+	0.785927f, 0.792600f, 0.799529f, 0.806657f, 0.813932f, 0.821309f, 0.828749f, 0.836216f,
+	0.843673f, 0.851086f, 0.858414f, 0.865611f, 0.872609f, 0.879297f, 0.885433f, 0.889986f,
+	0.988848f, 0.870122f, 0.817284f, 0.785878f, 0.765780f, 0.752731f, 0.744487f, 0.739709f,
+	0.737529f, 0.737355f, 0.738761f, 0.741434f, 0.745133f, 0.749673f, 0.754904f, 0.760709f,
+	0.766987f, 0.773658f, 0.780653f, 0.787912f, 0.795384f, 0.803024f, 0.810790f, 0.818645f,
+	0.826552f, 0.834472f, 0.842362f, 0.850170f, 0.857822f, 0.865192f, 0.872010f, 0.877120f,
+	0.988144f, 0.862901f, 0.807368f, 0.774250f, 0.752886f, 0.738823f, 0.729726f, 0.724209f,
+	0.721380f, 0.720632f, 0.721531f, 0.723759f, 0.727075f, 0.731292f, 0.736261f, 0.741863f,
+	0.748002f, 0.754596f, 0.761578f, 0.768890f, 0.776481f, 0.784307f, 0.792328f, 0.800505f,
+	0.808801f, 0.817178f, 0.825590f, 0.833982f, 0.842273f, 0.850326f, 0.857841f, 0.863531f,
+	0.987428f, 0.855721f, 0.797592f, 0.762844f, 0.740279f, 0.725250f, 0.715334f, 0.709101f,
+	0.705633f, 0.704309f, 0.704689f, 0.706451f, 0.709352f, 0.713203f, 0.717859f, 0.723202f,
+	0.729136f, 0.735583f, 0.742477f, 0.749763f, 0.757392f, 0.765323f, 0.773516f, 0.781938f,
+	0.790550f, 0.799317f, 0.808193f, 0.817122f, 0.826019f, 0.834736f, 0.842947f, 0.849224f,
+	0.994177f, 0.999998f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.893149f, 0.999487f, 0.999882f, 0.999961f, 0.999979f, 0.999984f, 0.999987f, 0.999989f,
+	0.999991f, 0.999999f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.954728f, 0.991217f, 0.998182f, 0.999282f, 0.999626f, 0.999804f, 0.999873f, 0.999910f,
+	0.999933f, 0.999950f, 0.999960f, 0.999974f, 0.999978f, 0.999986f, 0.999987f, 0.999989f,
+	0.999990f, 0.999991f, 0.999992f, 0.999993f, 0.999994f, 0.999994f, 0.999995f, 0.999996f,
+	0.999996f, 0.999996f, 0.999997f, 0.999997f, 0.999999f, 1.000000f, 1.000000f, 0.999998f,
+	0.978816f, 0.959807f, 0.989971f, 0.996099f, 0.998085f, 0.998889f, 0.999300f, 0.999528f,
+	0.999667f, 0.999744f, 0.999797f, 0.999851f, 0.999873f, 0.999901f, 0.999922f, 0.999930f,
+	0.999937f, 0.999942f, 0.999954f, 0.999958f, 0.999961f, 0.999964f, 0.999965f, 0.999971f,
+	0.999975f, 0.999977f, 0.999979f, 0.999980f, 0.999984f, 0.999985f, 0.999988f, 0.999989f,
+	0.988008f, 0.921558f, 0.970169f, 0.987224f, 0.993500f, 0.996273f, 0.997666f, 0.998422f,
+	0.998883f, 0.999177f, 0.999378f, 0.999512f, 0.999605f, 0.999672f, 0.999728f, 0.999773f,
+	0.999803f, 0.999829f, 0.999848f, 0.999869f, 0.999881f, 0.999893f, 0.999905f, 0.999911f,
+	0.999923f, 0.999929f, 0.999933f, 0.999937f, 0.999943f, 0.999952f, 0.999957f, 0.999957f,
+	0.992319f, 0.905334f, 0.944001f, 0.971096f, 0.984167f, 0.990600f, 0.994011f, 0.995957f,
+	0.997141f, 0.997890f, 0.998405f, 0.998755f, 0.998992f, 0.999186f, 0.999319f, 0.999422f,
+	0.999507f, 0.999574f, 0.999629f, 0.999671f, 0.999703f, 0.999730f, 0.999759f, 0.999781f,
+	0.999803f, 0.999820f, 0.999835f, 0.999849f, 0.999863f, 0.999871f, 0.999882f, 0.999889f,
+	0.994624f, 0.908818f, 0.923878f, 0.951522f, 0.970140f, 0.981115f, 0.987541f, 0.991427f,
+	0.993876f, 0.995472f, 0.996554f, 0.997302f, 0.997845f, 0.998240f, 0.998539f, 0.998767f,
+	0.998950f, 0.999088f, 0.999200f, 0.999293f, 0.999374f, 0.999441f, 0.999496f, 0.999543f,
+	0.999581f, 0.999617f, 0.999651f, 0.999682f, 0.999706f, 0.999728f, 0.999746f, 0.999760f,
+	0.995946f, 0.920059f, 0.915148f, 0.934946f, 0.954487f, 0.968681f, 0.978193f, 0.984464f,
+	0.988646f, 0.991488f, 0.993460f, 0.994861f, 0.995876f, 0.996631f, 0.997209f, 0.997649f,
+	0.997988f, 0.998257f, 0.998483f, 0.998664f, 0.998815f, 0.998936f, 0.999046f, 0.999135f,
+	0.999212f, 0.999283f, 0.999343f, 0.999398f, 0.999444f, 0.999481f, 0.999516f, 0.999544f,
+	0.996721f, 0.931980f, 0.915425f, 0.924946f, 0.941003f, 0.955684f, 0.967096f, 0.975450f,
+	0.981453f, 0.985762f, 0.988875f, 0.991159f, 0.992854f, 0.994131f, 0.995109f, 0.995873f,
+	0.996474f, 0.996953f, 0.997339f, 0.997658f, 0.997921f, 0.998142f, 0.998329f, 0.998493f,
+	0.998631f, 0.998751f, 0.998855f, 0.998946f, 0.999025f, 0.999097f, 0.999158f, 0.999202f,
+	0.997166f, 0.941939f, 0.920312f, 0.921200f, 0.931776f, 0.944462f, 0.956007f, 0.965461f,
+	0.972853f, 0.978514f, 0.982821f, 0.986104f, 0.988619f, 0.990564f, 0.992081f, 0.993276f,
+	0.994234f, 0.995004f, 0.995632f, 0.996152f, 0.996583f, 0.996946f, 0.997253f, 0.997519f,
+	0.997749f, 0.997947f, 0.998118f, 0.998270f, 0.998405f, 0.998521f, 0.998619f, 0.998690f,
+	0.997392f, 0.949350f, 0.926437f, 0.921538f, 0.926759f, 0.936164f, 0.946353f, 0.955733f,
+	0.963741f, 0.970317f, 0.975611f, 0.979831f, 0.983189f, 0.985868f, 0.988011f, 0.989738f,
+	0.991140f, 0.992283f, 0.993231f, 0.994019f, 0.994680f, 0.995238f, 0.995714f, 0.996124f,
+	0.996480f, 0.996789f, 0.997059f, 0.997298f, 0.997506f, 0.997688f, 0.997842f, 0.997952f,
+	0.997464f, 0.954337f, 0.931901f, 0.923688f, 0.924684f, 0.930676f, 0.938730f, 0.947116f,
+	0.954943f, 0.961845f, 0.967733f, 0.972665f, 0.976753f, 0.980127f, 0.982908f, 0.985205f,
+	0.987110f, 0.988697f, 0.990024f, 0.991143f, 0.992095f, 0.992904f, 0.993602f, 0.994203f,
+	0.994727f, 0.995186f, 0.995590f, 0.995944f, 0.996256f, 0.996529f, 0.996759f, 0.996925f,
+	0.997420f, 0.957235f, 0.935809f, 0.925954f, 0.924052f, 0.927138f, 0.932927f, 0.939847f,
+	0.946922f, 0.953613f, 0.959662f, 0.964984f, 0.969584f, 0.973523f, 0.976874f, 0.979719f,
+	0.982136f, 0.984190f, 0.985941f, 0.987441f, 0.988730f, 0.989843f, 0.990809f, 0.991652f,
+	0.992391f, 0.993040f, 0.993614f, 0.994121f, 0.994568f, 0.994960f, 0.995293f, 0.995533f,
+	0.997286f, 0.958361f, 0.937862f, 0.927295f, 0.923574f, 0.924484f, 0.928281f, 0.933655f,
+	0.939699f, 0.945823f, 0.951678f, 0.957078f, 0.961945f, 0.966265f, 0.970060f, 0.973377f,
+	0.976264f, 0.978775f, 0.980960f, 0.982861f, 0.984521f, 0.985976f, 0.987252f, 0.988378f,
+	0.989373f, 0.990256f, 0.991038f, 0.991736f, 0.992354f, 0.992897f, 0.993360f, 0.993695f,
+	0.997079f, 0.958001f, 0.938035f, 0.927170f, 0.922358f, 0.921759f, 0.923992f, 0.927994f,
+	0.932976f, 0.938377f, 0.943821f, 0.949071f, 0.953989f, 0.958507f, 0.962603f, 0.966283f,
+	0.969569f, 0.972492f, 0.975087f, 0.977390f, 0.979434f, 0.981249f, 0.982865f, 0.984306f,
+	0.985592f, 0.986744f, 0.987776f, 0.988699f, 0.989523f, 0.990250f, 0.990874f, 0.991328f,
+	0.996811f, 0.956396f, 0.936453f, 0.925357f, 0.919863f, 0.918254f, 0.919344f, 0.922251f,
+	0.926296f, 0.930977f, 0.935929f, 0.940901f, 0.945727f, 0.950304f, 0.954572f, 0.958509f,
+	0.962110f, 0.965385f, 0.968351f, 0.971032f, 0.973451f, 0.975633f, 0.977602f, 0.979379f,
+	0.980985f, 0.982435f, 0.983746f, 0.984928f, 0.985991f, 0.986936f, 0.987750f, 0.988344f,
+	0.996490f, 0.953738f, 0.933289f, 0.921837f, 0.915828f, 0.913516f, 0.913795f, 0.915879f,
+	0.919174f, 0.923232f, 0.927717f, 0.932381f, 0.937049f, 0.941600f, 0.945954f, 0.950065f,
+	0.953907f, 0.957473f, 0.960765f, 0.963792f, 0.966568f, 0.969109f, 0.971434f, 0.973558f,
+	0.975499f, 0.977271f, 0.978887f, 0.980357f, 0.981687f, 0.982878f, 0.983910f, 0.984666f,
+	0.996125f, 0.950194f, 0.928731f, 0.916702f, 0.910182f, 0.907316f, 0.906996f, 0.908475f,
+	0.911203f, 0.914771f, 0.918867f, 0.923256f, 0.927763f, 0.932259f, 0.936656f, 0.940892f,
+	0.944927f, 0.948739f, 0.952319f, 0.955663f, 0.958775f, 0.961664f, 0.964340f, 0.966815f,
+	0.969101f, 0.971209f, 0.973149f, 0.974929f, 0.976552f, 0.978014f, 0.979289f, 0.980225f,
+	0.995724f, 0.945903f, 0.922972f, 0.910109f, 0.902983f, 0.899592f, 0.898781f, 0.899793f,
+	0.902095f, 0.905295f, 0.909096f, 0.913272f, 0.917653f, 0.922109f, 0.926543f, 0.930888f,
+	0.935095f, 0.939130f, 0.942973f, 0.946613f, 0.950047f, 0.953273f, 0.956297f, 0.959124f,
+	0.961762f, 0.964217f, 0.966497f, 0.968605f, 0.970542f, 0.972298f, 0.973837f, 0.974968f,
+	0.995277f, 0.940988f, 0.916196f, 0.902239f, 0.894364f, 0.890401f, 0.889119f, 0.889730f,
+	0.891692f, 0.894612f, 0.898197f, 0.902227f, 0.906530f, 0.910977f, 0.915469f, 0.919931f,
+	0.924309f, 0.928562f, 0.932663f, 0.936593f, 0.940342f, 0.943903f, 0.947275f, 0.950459f,
+	0.953456f, 0.956271f, 0.958904f, 0.961358f, 0.963628f, 0.965698f, 0.967521f, 0.968859f,
+	0.994803f, 0.935551f, 0.908572f, 0.893288f, 0.884506f, 0.879879f, 0.878090f, 0.878304f,
+	0.879956f, 0.882641f, 0.886063f, 0.889994f, 0.894261f, 0.898734f, 0.903310f, 0.907908f,
+	0.912471f, 0.916951f, 0.921316f, 0.925542f, 0.929611f, 0.933513f, 0.937240f, 0.940790f,
+	0.944159f, 0.947346f, 0.950351f, 0.953169f, 0.955792f, 0.958196f, 0.960323f, 0.961882f,
+	0.994301f, 0.929689f, 0.900260f, 0.883445f, 0.873604f, 0.868207f, 0.865841f, 0.865621f,
+	0.866950f, 0.869406f, 0.872677f, 0.876530f, 0.880786f, 0.885308f, 0.889987f, 0.894741f,
+	0.899504f, 0.904226f, 0.908868f, 0.913401f, 0.917803f, 0.922059f, 0.926156f, 0.930086f,
+	0.933844f, 0.937424f, 0.940820f, 0.944025f, 0.947024f, 0.949788f, 0.952243f, 0.954037f,
+	0.993773f, 0.923481f, 0.891403f, 0.872896f, 0.861864f, 0.855588f, 0.852562f, 0.851845f,
+	0.852808f, 0.855005f, 0.858110f, 0.861878f, 0.866122f, 0.870695f, 0.875485f, 0.880402f,
+	0.885374f, 0.890348f, 0.895278f, 0.900131f, 0.904881f, 0.909506f, 0.913990f, 0.918321f,
+	0.922489f, 0.926485f, 0.930299f, 0.933918f, 0.937324f, 0.940476f, 0.943287f, 0.945338f,
+	0.993223f, 0.917001f, 0.882127f, 0.861808f, 0.849477f, 0.842228f, 0.838459f, 0.837175f,
+	0.837712f, 0.839601f, 0.842499f, 0.846149f, 0.850355f, 0.854961f, 0.859848f, 0.864918f,
+	0.870097f, 0.875321f, 0.880543f, 0.885723f, 0.890829f, 0.895837f, 0.900725f, 0.905478f,
+	0.910080f, 0.914519f, 0.918780f, 0.922846f, 0.926691f, 0.930268f, 0.933470f, 0.935806f,
+	0.992652f, 0.910314f, 0.872545f, 0.850333f, 0.836626f, 0.828328f, 0.823742f, 0.821821f,
+	0.821865f, 0.823384f, 0.826020f, 0.829503f, 0.833626f, 0.838226f, 0.843177f, 0.848375f,
+	0.853737f, 0.859197f, 0.864700f, 0.870202f, 0.875666f, 0.881063f, 0.886367f, 0.891557f,
+	0.896615f, 0.901523f, 0.906261f, 0.910808f, 0.915131f, 0.919174f, 0.922808f, 0.925465f,
+	0.992061f, 0.903468f, 0.862755f, 0.838601f, 0.823469f, 0.814069f, 0.808609f, 0.805989f,
+	0.805478f, 0.806565f, 0.808876f, 0.812131f, 0.816114f, 0.820656f, 0.825622f, 0.830903f,
+	0.836410f, 0.842073f, 0.847832f, 0.853636f, 0.859446f, 0.865226f, 0.870947f, 0.876583f,
+	0.882111f, 0.887509f, 0.892752f, 0.897814f, 0.902654f, 0.907205f, 0.911320f, 0.914339f,
+	0.991453f, 0.896511f, 0.852837f, 0.826728f, 0.810149f, 0.799616f, 0.793241f, 0.789875f,
+	0.788755f, 0.789351f, 0.791277f, 0.794241f, 0.798020f, 0.802440f, 0.807361f, 0.812668f,
+	0.818269f, 0.824087f, 0.830059f, 0.836132f, 0.842259f, 0.848402f, 0.854527f, 0.860605f,
+	0.866607f, 0.872508f, 0.878277f, 0.883882f, 0.889275f, 0.894378f, 0.899020f, 0.902449f,
+	0.990829f, 0.889481f, 0.842861f, 0.814810f, 0.796784f, 0.785106f, 0.777796f, 0.773651f,
+	0.771882f, 0.771939f, 0.773423f, 0.776035f, 0.779549f, 0.783782f, 0.788591f, 0.793859f,
+	0.799490f, 0.805404f, 0.811535f, 0.817826f, 0.824227f, 0.830698f, 0.837200f, 0.843700f,
+	0.850167f, 0.856570f, 0.862875f, 0.869042f, 0.875018f, 0.880711f, 0.885927f, 0.889812f,
+	0.990191f, 0.882410f, 0.832884f, 0.802925f, 0.783473f, 0.770659f, 0.762407f, 0.757468f,
+	0.755022f, 0.754502f, 0.755500f, 0.757710f, 0.760898f, 0.764881f, 0.769512f, 0.774673f,
+	0.780265f, 0.786208f, 0.792433f, 0.798881f, 0.805500f, 0.812248f, 0.819084f, 0.825973f,
+	0.832879f, 0.839768f, 0.846602f, 0.853339f, 0.859914f, 0.866226f, 0.872055f, 0.876440f,
+	0.989538f, 0.875325f, 0.822953f, 0.791135f, 0.770296f, 0.756368f, 0.747187f, 0.741451f,
+	0.738315f, 0.737195f, 0.737673f, 0.739437f, 0.742250f, 0.745926f, 0.750317f, 0.755305f,
+	0.760790f, 0.766690f, 0.772938f, 0.779473f, 0.786244f, 0.793207f, 0.800320f, 0.807546f,
+	0.814849f, 0.822192f, 0.829536f, 0.836830f, 0.844008f, 0.850955f, 0.857425f, 0.862344f,
+	0.988872f, 0.868247f, 0.813103f, 0.779492f, 0.757316f, 0.742312f, 0.732223f, 0.725702f,
+	0.721875f, 0.720144f, 0.720080f, 0.721367f, 0.723765f, 0.727087f, 0.731184f, 0.735937f,
+	0.741249f, 0.747038f, 0.753235f, 0.759784f, 0.766634f, 0.773739f, 0.781061f, 0.788562f,
+	0.796205f, 0.803954f, 0.811767f, 0.819592f, 0.827356f, 0.834936f, 0.842059f, 0.847536f,
+	0.988194f, 0.861191f, 0.803364f, 0.768035f, 0.744581f, 0.728547f, 0.717585f, 0.710300f,
+	0.705794f, 0.703452f, 0.702837f, 0.703628f, 0.705582f, 0.708512f, 0.712269f, 0.716735f,
+	0.721813f, 0.727425f, 0.733503f, 0.739992f, 0.746844f, 0.754016f, 0.761470f, 0.769171f,
+	0.777085f, 0.785175f, 0.793401f, 0.801710f, 0.810027f, 0.818218f, 0.825990f, 0.832028f,
+	0.994177f, 0.999998f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.893158f, 0.999488f, 0.999882f, 0.999961f, 0.999979f, 0.999984f, 0.999987f, 0.999989f,
+	0.999991f, 0.999999f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.954737f, 0.991231f, 0.998186f, 0.999283f, 0.999627f, 0.999804f, 0.999873f, 0.999910f,
+	0.999933f, 0.999950f, 0.999960f, 0.999974f, 0.999978f, 0.999986f, 0.999987f, 0.999989f,
+	0.999990f, 0.999991f, 0.999992f, 0.999993f, 0.999994f, 0.999994f, 0.999995f, 0.999995f,
+	0.999996f, 0.999996f, 0.999997f, 0.999997f, 0.999999f, 1.000000f, 1.000000f, 0.999998f,
+	0.978826f, 0.959871f, 0.989993f, 0.996106f, 0.998086f, 0.998888f, 0.999298f, 0.999525f,
+	0.999665f, 0.999741f, 0.999795f, 0.999849f, 0.999871f, 0.999899f, 0.999920f, 0.999928f,
+	0.999935f, 0.999940f, 0.999952f, 0.999957f, 0.999960f, 0.999962f, 0.999963f, 0.999969f,
+	0.999974f, 0.999976f, 0.999977f, 0.999979f, 0.999982f, 0.999984f, 0.999986f, 0.999988f,
+	0.988020f, 0.921683f, 0.970232f, 0.987248f, 0.993506f, 0.996270f, 0.997660f, 0.998414f,
+	0.998875f, 0.999169f, 0.999370f, 0.999505f, 0.999597f, 0.999666f, 0.999721f, 0.999767f,
+	0.999797f, 0.999824f, 0.999843f, 0.999864f, 0.999876f, 0.999888f, 0.999900f, 0.999907f,
+	0.999918f, 0.999924f, 0.999928f, 0.999932f, 0.999938f, 0.999947f, 0.999952f, 0.999952f,
+	0.992334f, 0.905491f, 0.944119f, 0.971150f, 0.984181f, 0.990594f, 0.993995f, 0.995937f,
+	0.997119f, 0.997868f, 0.998385f, 0.998736f, 0.998974f, 0.999169f, 0.999303f, 0.999406f,
+	0.999492f, 0.999560f, 0.999615f, 0.999658f, 0.999690f, 0.999718f, 0.999747f, 0.999769f,
+	0.999792f, 0.999809f, 0.999824f, 0.999837f, 0.999852f, 0.999859f, 0.999870f, 0.999877f,
+	0.994644f, 0.908982f, 0.924036f, 0.951610f, 0.970168f, 0.981105f, 0.987509f, 0.991385f,
+	0.993831f, 0.995426f, 0.996509f, 0.997259f, 0.997804f, 0.998202f, 0.998503f, 0.998733f,
+	0.998918f, 0.999057f, 0.999171f, 0.999265f, 0.999346f, 0.999414f, 0.999470f, 0.999517f,
+	0.999555f, 0.999591f, 0.999626f, 0.999658f, 0.999682f, 0.999703f, 0.999721f, 0.999735f,
+	0.995972f, 0.920228f, 0.915324f, 0.935060f, 0.954528f, 0.968664f, 0.978140f, 0.984391f,
+	0.988563f, 0.991403f, 0.993375f, 0.994779f, 0.995798f, 0.996557f, 0.997139f, 0.997583f,
+	0.997925f, 0.998197f, 0.998425f, 0.998608f, 0.998762f, 0.998884f, 0.998995f, 0.999085f,
+	0.999163f, 0.999234f, 0.999295f, 0.999350f, 0.999396f, 0.999433f, 0.999468f, 0.999496f,
+	0.996756f, 0.932169f, 0.915611f, 0.925074f, 0.941051f, 0.955660f, 0.967017f, 0.975337f,
+	0.981320f, 0.985620f, 0.988732f, 0.991019f, 0.992718f, 0.994001f, 0.994985f, 0.995755f,
+	0.996362f, 0.996846f, 0.997236f, 0.997558f, 0.997825f, 0.998048f, 0.998237f, 0.998403f,
+	0.998543f, 0.998664f, 0.998769f, 0.998860f, 0.998940f, 0.999012f, 0.999074f, 0.999118f,
+	0.997211f, 0.942174f, 0.920520f, 0.921343f, 0.931831f, 0.944430f, 0.955903f, 0.965305f,
+	0.972662f, 0.978304f, 0.982603f, 0.985884f, 0.988402f, 0.990354f, 0.991878f, 0.993082f,
+	0.994047f, 0.994824f, 0.995459f, 0.995985f, 0.996421f, 0.996789f, 0.997099f, 0.997369f,
+	0.997601f, 0.997801f, 0.997973f, 0.998127f, 0.998263f, 0.998380f, 0.998479f, 0.998551f,
+	0.997449f, 0.949659f, 0.926697f, 0.921711f, 0.926830f, 0.936133f, 0.946230f, 0.955537f,
+	0.963492f, 0.970033f, 0.975306f, 0.979516f, 0.982872f, 0.985554f, 0.987704f, 0.989439f,
+	0.990850f, 0.992002f, 0.992958f, 0.993755f, 0.994422f, 0.994987f, 0.995468f, 0.995883f,
+	0.996243f, 0.996556f, 0.996828f, 0.997070f, 0.997279f, 0.997463f, 0.997619f, 0.997733f,
+	0.997535f, 0.954752f, 0.932249f, 0.923922f, 0.924793f, 0.930662f, 0.938603f, 0.946894f,
+	0.954645f, 0.961489f, 0.967338f, 0.972246f, 0.976320f, 0.979689f, 0.982470f, 0.984772f,
+	0.986685f, 0.988280f, 0.989616f, 0.990744f, 0.991705f, 0.992522f, 0.993227f, 0.993835f,
+	0.994365f, 0.994829f, 0.995237f, 0.995595f, 0.995911f, 0.996186f, 0.996420f, 0.996590f,
+	0.997508f, 0.957785f, 0.936290f, 0.926292f, 0.924235f, 0.927171f, 0.932822f, 0.939619f,
+	0.946590f, 0.953199f, 0.959185f, 0.964460f, 0.969028f, 0.972948f, 0.976288f, 0.979129f,
+	0.981547f, 0.983605f, 0.985363f, 0.986870f, 0.988167f, 0.989288f, 0.990262f, 0.991113f,
+	0.991859f, 0.992514f, 0.993094f, 0.993605f, 0.994058f, 0.994455f, 0.994793f, 0.995040f,
+	0.997392f, 0.959075f, 0.938520f, 0.927786f, 0.923877f, 0.924603f, 0.928230f, 0.933450f,
+	0.939360f, 0.945370f, 0.951133f, 0.956458f, 0.961269f, 0.965547f, 0.969313f, 0.972610f,
+	0.975485f, 0.977991f, 0.980175f, 0.982077f, 0.983742f, 0.985202f, 0.986485f, 0.987617f,
+	0.988618f, 0.989508f, 0.990297f, 0.991000f, 0.991624f, 0.992175f, 0.992645f, 0.992990f,
+	0.997205f, 0.958906f, 0.938912f, 0.927863f, 0.922830f, 0.922010f, 0.924036f, 0.927847f,
+	0.932659f, 0.937911f, 0.943228f, 0.948370f, 0.953201f, 0.957648f, 0.961690f, 0.965327f,
+	0.968582f, 0.971483f, 0.974062f, 0.976356f, 0.978395f, 0.980208f, 0.981825f, 0.983268f,
+	0.984558f, 0.985715f, 0.986752f, 0.987680f, 0.988511f, 0.989246f, 0.989879f, 0.990346f,
+	0.996958f, 0.957513f, 0.937585f, 0.926296f, 0.920552f, 0.918684f, 0.919525f, 0.922200f,
+	0.926033f, 0.930525f, 0.935311f, 0.940138f, 0.944840f, 0.949311f, 0.953492f, 0.957357f,
+	0.960900f, 0.964128f, 0.967059f, 0.969712f, 0.972110f, 0.974278f, 0.976237f, 0.978007f,
+	0.979610f, 0.981059f, 0.982371f, 0.983556f, 0.984624f, 0.985576f, 0.986400f, 0.987011f,
+	0.996660f, 0.955085f, 0.934703f, 0.923060f, 0.916776f, 0.914167f, 0.914154f, 0.915961f,
+	0.919000f, 0.922824f, 0.927098f, 0.931574f, 0.936076f, 0.940481f, 0.944710f, 0.948713f,
+	0.952464f, 0.955953f, 0.959180f, 0.962155f, 0.964888f, 0.967395f, 0.969693f, 0.971796f,
+	0.973722f, 0.975482f, 0.977091f, 0.978557f, 0.979888f, 0.981082f, 0.982124f, 0.982898f,
+	0.996319f, 0.951783f, 0.930448f, 0.918237f, 0.911421f, 0.908223f, 0.907568f, 0.908724f,
+	0.911147f, 0.914432f, 0.918268f, 0.922421f, 0.926716f, 0.931021f, 0.935249f, 0.939336f,
+	0.943241f, 0.946939f, 0.950420f, 0.953680f, 0.956720f, 0.959548f, 0.962174f, 0.964607f,
+	0.966859f, 0.968940f, 0.970859f, 0.972624f, 0.974239f, 0.975698f, 0.976978f, 0.977931f,
+	0.995943f, 0.947742f, 0.925004f, 0.911970f, 0.904533f, 0.900778f, 0.899590f, 0.900231f,
+	0.902178f, 0.905044f, 0.908534f, 0.912423f, 0.916541f, 0.920757f, 0.924975f, 0.929124f,
+	0.933155f, 0.937034f, 0.940738f, 0.944257f, 0.947583f, 0.950716f, 0.953660f, 0.956417f,
+	0.958996f, 0.961402f, 0.963642f, 0.965719f, 0.967633f, 0.969374f, 0.970910f, 0.972054f,
+	0.995522f, 0.943080f, 0.918545f, 0.904431f, 0.896232f, 0.891876f, 0.890176f, 0.890370f,
+	0.891926f, 0.894459f, 0.897680f, 0.901370f, 0.905356f, 0.909511f, 0.913734f, 0.917950f,
+	0.922104f, 0.926154f, 0.930072f, 0.933837f, 0.937438f, 0.940867f, 0.944123f, 0.947204f,
+	0.950111f, 0.952848f, 0.955417f, 0.957816f, 0.960042f, 0.962081f, 0.963888f, 0.965234f,
+	0.995076f, 0.937893f, 0.911232f, 0.895803f, 0.886685f, 0.881638f, 0.879393f, 0.879144f,
+	0.880341f, 0.882587f, 0.885590f, 0.889125f, 0.893021f, 0.897147f, 0.901400f, 0.905699f,
+	0.909986f, 0.914213f, 0.918345f, 0.922359f, 0.926235f, 0.929962f, 0.933532f, 0.936940f,
+	0.940183f, 0.943259f, 0.946166f, 0.948902f, 0.951456f, 0.953808f, 0.955901f, 0.957456f,
+	0.994601f, 0.932274f, 0.903217f, 0.886267f, 0.876077f, 0.870232f, 0.867374f, 0.866647f,
+	0.867473f, 0.869438f, 0.872236f, 0.875638f, 0.879468f, 0.883587f, 0.887888f, 0.892288f,
+	0.896721f, 0.901136f, 0.905493f, 0.909764f, 0.913925f, 0.917958f, 0.921852f, 0.925598f,
+	0.929188f, 0.932618f, 0.935881f, 0.938970f, 0.941870f, 0.944554f, 0.946952f, 0.948729f,
+	0.994101f, 0.926302f, 0.894638f, 0.876000f, 0.864602f, 0.857850f, 0.854296f, 0.853031f,
+	0.853444f, 0.855100f, 0.857681f, 0.860944f, 0.864705f, 0.868820f, 0.873176f, 0.877683f,
+	0.882270f, 0.886883f, 0.891475f, 0.896013f, 0.900469f, 0.904822f, 0.909055f, 0.913155f,
+	0.917111f, 0.920915f, 0.924555f, 0.928020f, 0.931291f, 0.934332f, 0.937060f, 0.939076f,
+	0.993579f, 0.920044f, 0.885617f, 0.865161f, 0.852445f, 0.844690f, 0.840357f, 0.838483f,
+	0.838425f, 0.839726f, 0.842049f, 0.845142f, 0.848812f, 0.852906f, 0.857303f, 0.861909f,
+	0.866647f, 0.871455f, 0.876285f, 0.881096f, 0.885856f, 0.890540f, 0.895127f, 0.899599f,
+	0.903942f, 0.908142f, 0.912186f, 0.916056f, 0.919729f, 0.923160f, 0.926249f, 0.928531f,
+	0.993037f, 0.913566f, 0.876263f, 0.853900f, 0.839781f, 0.830945f, 0.825757f, 0.823206f,
+	0.822613f, 0.823497f, 0.825511f, 0.828387f, 0.831924f, 0.835959f, 0.840368f, 0.845048f,
+	0.849915f, 0.854905f, 0.859962f, 0.865041f, 0.870106f, 0.875126f, 0.880077f, 0.884936f,
+	0.889685f, 0.894307f, 0.898782f, 0.903090f, 0.907199f, 0.911058f, 0.914549f, 0.917131f,
+	0.992475f, 0.906914f, 0.866671f, 0.842343f, 0.826767f, 0.816792f, 0.810692f, 0.807402f,
+	0.806211f, 0.806620f, 0.808264f, 0.810866f, 0.814215f, 0.818143f, 0.822516f, 0.827228f,
+	0.832190f, 0.837330f, 0.842589f, 0.847918f, 0.853276f, 0.858627f, 0.863943f, 0.869197f,
+	0.874366f, 0.879428f, 0.884361f, 0.889138f, 0.893722f, 0.898051f, 0.901989f, 0.904914f,
+	0.991896f, 0.900136f, 0.856923f, 0.830607f, 0.813544f, 0.802395f, 0.795340f, 0.791263f,
+	0.789422f, 0.789299f, 0.790514f, 0.792783f, 0.795884f, 0.799644f, 0.803926f, 0.808616f,
+	0.813622f, 0.818868f, 0.824291f, 0.829837f, 0.835461f, 0.841124f, 0.846793f, 0.852438f,
+	0.858031f, 0.863546f, 0.868957f, 0.874231f, 0.879324f, 0.884166f, 0.888597f, 0.891912f,
+	0.991301f, 0.893267f, 0.847086f, 0.818785f, 0.800230f, 0.787892f, 0.779858f, 0.774962f,
+	0.772431f, 0.771729f, 0.772464f, 0.774340f, 0.777134f, 0.780666f, 0.784794f, 0.789401f,
+	0.794393f, 0.799689f, 0.805224f, 0.810940f, 0.816790f, 0.822731f, 0.828727f, 0.834745f,
+	0.840753f, 0.846721f, 0.852619f, 0.858409f, 0.864040f, 0.869431f, 0.874402f, 0.878154f,
+	0.990692f, 0.886343f, 0.837220f, 0.806959f, 0.786927f, 0.773403f, 0.764384f, 0.758651f,
+	0.755404f, 0.754087f, 0.754299f, 0.755735f, 0.758167f, 0.761411f, 0.765323f, 0.769783f,
+	0.774696f, 0.779979f, 0.785565f, 0.791394f, 0.797417f, 0.803589f, 0.809872f, 0.816229f,
+	0.822628f, 0.829035f, 0.835415f, 0.841726f, 0.847912f, 0.853881f, 0.859430f, 0.863665f,
+	0.990069f, 0.879389f, 0.827372f, 0.795192f, 0.773715f, 0.759027f, 0.749031f, 0.742460f,
+	0.738483f, 0.736530f, 0.736186f, 0.737144f, 0.739166f, 0.742070f, 0.745708f, 0.749961f,
+	0.754730f, 0.759934f, 0.765504f, 0.771381f, 0.777514f, 0.783859f, 0.790374f, 0.797024f,
+	0.803774f, 0.810589f, 0.817430f, 0.824254f, 0.830997f, 0.837558f, 0.843713f, 0.848464f,
+	0.989433f, 0.872427f, 0.817579f, 0.783538f, 0.760662f, 0.744843f, 0.733892f, 0.726493f,
+	0.721788f, 0.719189f, 0.718271f, 0.718721f, 0.720299f, 0.722818f, 0.726132f, 0.730120f,
+	0.734685f, 0.739745f, 0.745232f, 0.751088f, 0.757263f, 0.763712f, 0.770396f, 0.777279f,
+	0.784326f, 0.791502f, 0.798767f, 0.806075f, 0.813361f, 0.820512f, 0.827284f, 0.832573f,
+	0.988786f, 0.865474f, 0.807872f, 0.772039f, 0.747820f, 0.730914f, 0.719041f, 0.710836f,
+	0.705414f, 0.702171f, 0.700672f, 0.700597f, 0.701705f, 0.703808f, 0.706756f, 0.710431f,
+	0.714737f, 0.719592f, 0.724932f, 0.730698f, 0.736843f, 0.743326f, 0.750107f, 0.757153f,
+	0.764430f, 0.771905f, 0.779540f, 0.787288f, 0.795081f, 0.802801f, 0.810184f, 0.816015f,
+	0.994178f, 0.999998f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.893169f, 0.999489f, 0.999882f, 0.999962f, 0.999979f, 0.999984f, 0.999987f, 0.999989f,
+	0.999991f, 0.999999f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.954749f, 0.991250f, 0.998192f, 0.999286f, 0.999628f, 0.999804f, 0.999872f, 0.999910f,
+	0.999932f, 0.999950f, 0.999959f, 0.999974f, 0.999977f, 0.999985f, 0.999987f, 0.999989f,
+	0.999990f, 0.999991f, 0.999992f, 0.999993f, 0.999993f, 0.999994f, 0.999995f, 0.999995f,
+	0.999996f, 0.999996f, 0.999996f, 0.999997f, 0.999999f, 1.000000f, 1.000000f, 0.999998f,
+	0.978839f, 0.959958f, 0.990025f, 0.996119f, 0.998091f, 0.998889f, 0.999298f, 0.999524f,
+	0.999663f, 0.999739f, 0.999793f, 0.999847f, 0.999869f, 0.999898f, 0.999918f, 0.999926f,
+	0.999933f, 0.999939f, 0.999951f, 0.999955f, 0.999958f, 0.999961f, 0.999961f, 0.999968f,
+	0.999972f, 0.999974f, 0.999976f, 0.999977f, 0.999981f, 0.999982f, 0.999985f, 0.999986f,
+	0.988033f, 0.921855f, 0.970328f, 0.987290f, 0.993523f, 0.996275f, 0.997658f, 0.998409f,
+	0.998869f, 0.999162f, 0.999363f, 0.999498f, 0.999591f, 0.999659f, 0.999715f, 0.999762f,
+	0.999792f, 0.999818f, 0.999837f, 0.999859f, 0.999871f, 0.999884f, 0.999896f, 0.999902f,
+	0.999914f, 0.999920f, 0.999923f, 0.999927f, 0.999933f, 0.999943f, 0.999948f, 0.999948f,
+	0.992349f, 0.905706f, 0.944297f, 0.971246f, 0.984224f, 0.990608f, 0.993993f, 0.995927f,
+	0.997105f, 0.997852f, 0.998368f, 0.998719f, 0.998957f, 0.999153f, 0.999288f, 0.999391f,
+	0.999478f, 0.999547f, 0.999602f, 0.999645f, 0.999678f, 0.999705f, 0.999735f, 0.999757f,
+	0.999780f, 0.999797f, 0.999812f, 0.999825f, 0.999841f, 0.999848f, 0.999859f, 0.999866f,
+	0.994663f, 0.909205f, 0.924275f, 0.951769f, 0.970249f, 0.981134f, 0.987507f, 0.991365f,
+	0.993801f, 0.995391f, 0.996473f, 0.997222f, 0.997768f, 0.998167f, 0.998470f, 0.998701f,
+	0.998887f, 0.999027f, 0.999142f, 0.999237f, 0.999319f, 0.999387f, 0.999444f, 0.999491f,
+	0.999529f, 0.999566f, 0.999601f, 0.999634f, 0.999657f, 0.999679f, 0.999697f, 0.999712f,
+	0.995996f, 0.920448f, 0.915590f, 0.935267f, 0.954648f, 0.968711f, 0.978136f, 0.984355f,
+	0.988509f, 0.991339f, 0.993307f, 0.994709f, 0.995729f, 0.996489f, 0.997074f, 0.997520f,
+	0.997865f, 0.998138f, 0.998369f, 0.998554f, 0.998709f, 0.998833f, 0.998945f, 0.999035f,
+	0.999114f, 0.999186f, 0.999248f, 0.999303f, 0.999350f, 0.999386f, 0.999422f, 0.999451f,
+	0.996785f, 0.932395f, 0.915883f, 0.925306f, 0.941200f, 0.955722f, 0.967010f, 0.975280f,
+	0.981233f, 0.985514f, 0.988616f, 0.990899f, 0.992598f, 0.993882f, 0.994870f, 0.995643f,
+	0.996254f, 0.996742f, 0.997136f, 0.997461f, 0.997731f, 0.997956f, 0.998148f, 0.998316f,
+	0.998457f, 0.998579f, 0.998685f, 0.998776f, 0.998857f, 0.998930f, 0.998993f, 0.999038f,
+	0.997248f, 0.942424f, 0.920798f, 0.921584f, 0.931994f, 0.944500f, 0.955889f, 0.965224f,
+	0.972534f, 0.978144f, 0.982425f, 0.985697f, 0.988211f, 0.990163f, 0.991690f, 0.992898f,
+	0.993868f, 0.994652f, 0.995291f, 0.995822f, 0.996263f, 0.996634f, 0.996948f, 0.997221f,
+	0.997456f, 0.997659f, 0.997832f, 0.997988f, 0.998125f, 0.998243f, 0.998344f, 0.998418f,
+	0.997496f, 0.949956f, 0.926998f, 0.921965f, 0.927002f, 0.936206f, 0.946208f, 0.955431f,
+	0.963321f, 0.969813f, 0.975054f, 0.979245f, 0.982590f, 0.985268f, 0.987418f, 0.989157f,
+	0.990573f, 0.991731f, 0.992694f, 0.993497f, 0.994171f, 0.994741f, 0.995228f, 0.995647f,
+	0.996012f, 0.996328f, 0.996604f, 0.996848f, 0.997060f, 0.997246f, 0.997405f, 0.997522f,
+	0.997593f, 0.955120f, 0.932603f, 0.924207f, 0.924983f, 0.930743f, 0.938575f, 0.946765f,
+	0.954431f, 0.961208f, 0.967008f, 0.971880f, 0.975932f, 0.979287f, 0.982063f, 0.984364f,
+	0.986280f, 0.987880f, 0.989223f, 0.990358f, 0.991325f, 0.992150f, 0.992862f, 0.993475f,
+	0.994011f, 0.994480f, 0.994893f, 0.995256f, 0.995575f, 0.995855f, 0.996094f, 0.996268f,
+	0.997578f, 0.958251f, 0.936731f, 0.926638f, 0.924464f, 0.927274f, 0.932798f, 0.939476f,
+	0.946342f, 0.952861f, 0.958776f, 0.963997f, 0.968524f, 0.972417f, 0.975740f, 0.978570f,
+	0.980984f, 0.983042f, 0.984803f, 0.986316f, 0.987620f, 0.988747f, 0.989729f, 0.990586f,
+	0.991340f, 0.992001f, 0.992587f, 0.993105f, 0.993563f, 0.993966f, 0.994311f, 0.994565f,
+	0.997476f, 0.959663f, 0.939085f, 0.928232f, 0.924178f, 0.924753f, 0.928231f, 0.933309f,
+	0.939089f, 0.944986f, 0.950652f, 0.955899f, 0.960648f, 0.964877f, 0.968608f, 0.971881f,
+	0.974739f, 0.977235f, 0.979415f, 0.981317f, 0.982983f, 0.984448f, 0.985736f, 0.986874f,
+	0.987883f, 0.988779f, 0.989575f, 0.990286f, 0.990917f, 0.991476f, 0.991955f, 0.992312f,
+	0.997305f, 0.959637f, 0.939635f, 0.928448f, 0.923242f, 0.922241f, 0.924088f, 0.927730f,
+	0.932385f, 0.937495f, 0.942687f, 0.947722f, 0.952463f, 0.956837f, 0.960820f, 0.964412f,
+	0.967632f, 0.970507f, 0.973070f, 0.975352f, 0.977384f, 0.979194f, 0.980811f, 0.982257f,
+	0.983551f, 0.984713f, 0.985756f, 0.986691f, 0.987530f, 0.988274f, 0.988918f, 0.989400f,
+	0.997075f, 0.958405f, 0.938496f, 0.927058f, 0.921114f, 0.919031f, 0.919661f, 0.922133f,
+	0.925777f, 0.930095f, 0.934723f, 0.939411f, 0.943992f, 0.948359f, 0.952453f, 0.956246f,
+	0.959730f, 0.962911f, 0.965804f, 0.968429f, 0.970806f, 0.972959f, 0.974907f, 0.976672f,
+	0.978271f, 0.979722f, 0.981036f, 0.982225f, 0.983300f, 0.984261f, 0.985098f, 0.985726f,
+	0.996795f, 0.956155f, 0.935828f, 0.924032f, 0.917522f, 0.914666f, 0.914406f, 0.915973f,
+	0.918785f, 0.922398f, 0.926478f, 0.930780f, 0.935124f, 0.939391f, 0.943499f, 0.947397f,
+	0.951059f, 0.954473f, 0.957638f, 0.960561f, 0.963252f, 0.965726f, 0.967998f, 0.970081f,
+	0.971993f, 0.973744f, 0.975347f, 0.976812f, 0.978145f, 0.979346f, 0.980399f, 0.981193f,
+	0.996472f, 0.953042f, 0.931806f, 0.919441f, 0.912380f, 0.908904f, 0.907964f, 0.908839f,
+	0.910995f, 0.914029f, 0.917632f, 0.921570f, 0.925668f, 0.929796f, 0.933865f, 0.937811f,
+	0.941591f, 0.945180f, 0.948568f, 0.951746f, 0.954718f, 0.957488f, 0.960066f, 0.962460f,
+	0.964680f, 0.966737f, 0.968639f, 0.970392f, 0.972000f, 0.973459f, 0.974747f, 0.975721f,
+	0.996117f, 0.949197f, 0.926605f, 0.913424f, 0.905724f, 0.901661f, 0.900150f, 0.900471f,
+	0.902108f, 0.904679f, 0.907892f, 0.911522f, 0.915401f, 0.919397f, 0.923414f, 0.927381f,
+	0.931249f, 0.934980f, 0.938554f, 0.941957f, 0.945182f, 0.948227f, 0.951095f, 0.953788f,
+	0.956312f, 0.958673f, 0.960876f, 0.962925f, 0.964820f, 0.966551f, 0.968087f, 0.969249f,
+	0.995716f, 0.944734f, 0.920394f, 0.906140f, 0.897664f, 0.892972f, 0.890914f, 0.890746f,
+	0.891949f, 0.894141f, 0.897039f, 0.900424f, 0.904124f, 0.908014f, 0.911992f, 0.915981f,
+	0.919928f, 0.923789f, 0.927535f, 0.931146f, 0.934608f, 0.937914f, 0.941060f, 0.944045f,
+	0.946869f, 0.949534f, 0.952042f, 0.954392f, 0.956580f, 0.958593f, 0.960388f, 0.961745f,
+	0.995291f, 0.939747f, 0.913327f, 0.897765f, 0.888356f, 0.882947f, 0.880309f, 0.879658f,
+	0.880457f, 0.882318f, 0.884949f, 0.888132f, 0.891694f, 0.895507f, 0.899466f, 0.903492f,
+	0.907525f, 0.911518f, 0.915435f, 0.919251f, 0.922947f, 0.926511f, 0.929932f, 0.933208f,
+	0.936333f, 0.939306f, 0.942123f, 0.944782f, 0.947274f, 0.949578f, 0.951643f, 0.953200f,
+	0.994838f, 0.934325f, 0.905550f, 0.888471f, 0.877976f, 0.871743f, 0.868458f, 0.867290f,
+	0.867675f, 0.869208f, 0.871588f, 0.874589f, 0.878036f, 0.881792f, 0.885750f, 0.889828f,
+	0.893959f, 0.898092f, 0.902188f, 0.906215f, 0.910150f, 0.913977f, 0.917681f, 0.921255f,
+	0.924689f, 0.927978f, 0.931117f, 0.934097f, 0.936906f, 0.939517f, 0.941865f, 0.943630f,
+	0.994361f, 0.928542f, 0.897195f, 0.878428f, 0.866709f, 0.859542f, 0.855528f, 0.853784f,
+	0.853714f, 0.854893f, 0.857009f, 0.859823f, 0.863152f, 0.866855f, 0.870818f, 0.874953f,
+	0.879189f, 0.883470f, 0.887752f, 0.891998f, 0.896183f, 0.900283f, 0.904281f, 0.908165f,
+	0.911923f, 0.915546f, 0.919024f, 0.922344f, 0.925490f, 0.928429f, 0.931082f, 0.933069f,
+	0.993861f, 0.922466f, 0.888381f, 0.867790f, 0.854732f, 0.846534f, 0.841707f, 0.839317f,
+	0.838736f, 0.839516f, 0.841329f, 0.843927f, 0.847117f, 0.850749f, 0.854705f, 0.858889f,
+	0.863226f, 0.867653f, 0.872123f, 0.876593f, 0.881033f, 0.885417f, 0.889723f, 0.893933f,
+	0.898033f, 0.902010f, 0.905850f, 0.909537f, 0.913048f, 0.916343f, 0.919330f, 0.921564f,
+	0.993343f, 0.916158f, 0.879212f, 0.856702f, 0.842218f, 0.832907f, 0.827192f, 0.824087f,
+	0.822931f, 0.823254f, 0.824714f, 0.827049f, 0.830060f, 0.833587f, 0.837507f, 0.841716f,
+	0.846133f, 0.850693f, 0.855340f, 0.860030f, 0.864726f, 0.869397f, 0.874019f, 0.878570f,
+	0.883031f, 0.887384f, 0.891613f, 0.895696f, 0.899605f, 0.903293f, 0.906650f, 0.909166f,
+	0.992803f, 0.909664f, 0.869784f, 0.845288f, 0.829317f, 0.818835f, 0.812172f, 0.808290f,
+	0.806498f, 0.806306f, 0.807355f, 0.809374f, 0.812153f, 0.815528f, 0.819366f, 0.823561f,
+	0.828025f, 0.832688f, 0.837490f, 0.842381f, 0.847322f, 0.852276f, 0.857215f, 0.862113f,
+	0.866947f, 0.871696f, 0.876338f, 0.880848f, 0.885192f, 0.889313f, 0.893086f, 0.895924f,
+	0.992248f, 0.903033f, 0.860175f, 0.833663f, 0.816171f, 0.804478f, 0.796823f, 0.792117f,
+	0.789637f, 0.788874f, 0.789455f, 0.791100f, 0.793591f, 0.796757f, 0.800461f, 0.804591f,
+	0.809055f, 0.813779f, 0.818698f, 0.823761f, 0.828921f, 0.834140f, 0.839385f, 0.844627f,
+	0.849839f, 0.854995f, 0.860070f, 0.865034f, 0.869847f, 0.874443f, 0.878678f, 0.881887f,
+	0.991677f, 0.896299f, 0.850455f, 0.821921f, 0.802896f, 0.789975f, 0.781302f, 0.775739f,
+	0.772532f, 0.771153f, 0.771217f, 0.772433f, 0.774580f, 0.777479f, 0.780989f, 0.784996f,
+	0.789405f, 0.794136f, 0.799125f, 0.804314f, 0.809655f, 0.815108f, 0.820635f, 0.826205f,
+	0.831786f, 0.837351f, 0.842868f, 0.848305f, 0.853615f, 0.858723f, 0.863466f, 0.867095f,
+	0.991091f, 0.889496f, 0.840681f, 0.810143f, 0.789596f, 0.775446f, 0.765747f, 0.759310f,
+	0.755350f, 0.753321f, 0.752827f, 0.753569f, 0.755318f, 0.757895f, 0.761154f, 0.764978f,
+	0.769271f, 0.773952f, 0.778952f, 0.784213f, 0.789687f, 0.795329f, 0.801100f, 0.806966f,
+	0.812894f, 0.818854f, 0.824810f, 0.830726f, 0.836550f, 0.842199f, 0.847489f, 0.851583f,
+	0.990492f, 0.882651f, 0.830902f, 0.798394f, 0.776353f, 0.760993f, 0.750275f, 0.742960f,
+	0.738235f, 0.735536f, 0.734454f, 0.734685f, 0.735995f, 0.738200f, 0.741154f, 0.744738f,
+	0.748855f, 0.753422f, 0.758372f, 0.763646f, 0.769192f, 0.774968f, 0.780933f, 0.787051f,
+	0.793290f, 0.799615f, 0.805991f, 0.812378f, 0.818719f, 0.824923f, 0.830787f, 0.835383f,
+	0.989880f, 0.875785f, 0.821157f, 0.786731f, 0.763237f, 0.746697f, 0.734981f, 0.726800f,
+	0.721311f, 0.717933f, 0.716247f, 0.715942f, 0.716779f, 0.718572f, 0.721175f, 0.724467f,
+	0.728351f, 0.732745f, 0.737582f, 0.742803f, 0.748359f, 0.754205f, 0.760303f, 0.766617f,
+	0.773115f, 0.779762f, 0.786522f, 0.793354f, 0.800198f, 0.806955f, 0.813406f, 0.818524f,
+	0.989256f, 0.868917f, 0.811477f, 0.775196f, 0.750301f, 0.732624f, 0.719942f, 0.710916f,
+	0.704676f, 0.700624f, 0.698329f, 0.697473f, 0.697815f, 0.699167f, 0.701381f, 0.704337f,
+	0.707938f, 0.712104f, 0.716767f, 0.721872f, 0.727371f, 0.733221f, 0.739385f, 0.745829f,
+	0.752523f, 0.759434f, 0.766527f, 0.773761f, 0.781074f, 0.788364f, 0.795393f, 0.801038f,
+	0.994178f, 0.999998f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.893183f, 0.999490f, 0.999883f, 0.999962f, 0.999979f, 0.999984f, 0.999987f, 0.999989f,
+	0.999991f, 0.999999f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.954764f, 0.991273f, 0.998199f, 0.999289f, 0.999629f, 0.999805f, 0.999873f, 0.999910f,
+	0.999932f, 0.999949f, 0.999959f, 0.999974f, 0.999977f, 0.999985f, 0.999987f, 0.999988f,
+	0.999990f, 0.999991f, 0.999992f, 0.999993f, 0.999993f, 0.999994f, 0.999994f, 0.999995f,
+	0.999995f, 0.999996f, 0.999996f, 0.999996f, 0.999999f, 1.000000f, 1.000000f, 0.999997f,
+	0.978852f, 0.960062f, 0.990065f, 0.996136f, 0.998099f, 0.998892f, 0.999299f, 0.999524f,
+	0.999662f, 0.999738f, 0.999791f, 0.999845f, 0.999867f, 0.999896f, 0.999917f, 0.999925f,
+	0.999932f, 0.999937f, 0.999950f, 0.999954f, 0.999957f, 0.999959f, 0.999960f, 0.999966f,
+	0.999971f, 0.999972f, 0.999974f, 0.999975f, 0.999980f, 0.999981f, 0.999984f, 0.999985f,
+	0.988047f, 0.922060f, 0.970445f, 0.987346f, 0.993548f, 0.996285f, 0.997661f, 0.998408f,
+	0.998865f, 0.999157f, 0.999357f, 0.999492f, 0.999585f, 0.999653f, 0.999709f, 0.999756f,
+	0.999786f, 0.999813f, 0.999832f, 0.999854f, 0.999866f, 0.999879f, 0.999891f, 0.999897f,
+	0.999910f, 0.999916f, 0.999918f, 0.999922f, 0.999929f, 0.999939f, 0.999944f, 0.999943f,
+	0.992365f, 0.905963f, 0.944516f, 0.971372f, 0.984287f, 0.990635f, 0.994000f, 0.995923f,
+	0.997095f, 0.997839f, 0.998354f, 0.998704f, 0.998942f, 0.999138f, 0.999273f, 0.999377f,
+	0.999465f, 0.999534f, 0.999590f, 0.999632f, 0.999665f, 0.999693f, 0.999723f, 0.999745f,
+	0.999768f, 0.999786f, 0.999801f, 0.999814f, 0.999830f, 0.999837f, 0.999848f, 0.999855f,
+	0.994681f, 0.909469f, 0.924571f, 0.951976f, 0.970367f, 0.981189f, 0.987523f, 0.991359f,
+	0.993782f, 0.995365f, 0.996442f, 0.997190f, 0.997735f, 0.998134f, 0.998438f, 0.998670f,
+	0.998857f, 0.998998f, 0.999114f, 0.999209f, 0.999292f, 0.999361f, 0.999418f, 0.999466f,
+	0.999504f, 0.999541f, 0.999577f, 0.999610f, 0.999634f, 0.999656f, 0.999674f, 0.999689f,
+	0.996017f, 0.920705f, 0.915918f, 0.935538f, 0.954822f, 0.968801f, 0.978166f, 0.984345f,
+	0.988474f, 0.991289f, 0.993249f, 0.994648f, 0.995666f, 0.996427f, 0.997013f, 0.997461f,
+	0.997807f, 0.998082f, 0.998315f, 0.998502f, 0.998658f, 0.998783f, 0.998896f, 0.998987f,
+	0.999066f, 0.999139f, 0.999202f, 0.999258f, 0.999305f, 0.999341f, 0.999377f, 0.999407f,
+	0.996811f, 0.932647f, 0.916214f, 0.925609f, 0.941416f, 0.955843f, 0.967052f, 0.975263f,
+	0.981176f, 0.985432f, 0.988519f, 0.990794f, 0.992489f, 0.993773f, 0.994761f, 0.995537f,
+	0.996151f, 0.996642f, 0.997039f, 0.997366f, 0.997638f, 0.997866f, 0.998060f, 0.998230f,
+	0.998373f, 0.998496f, 0.998603f, 0.998695f, 0.998776f, 0.998851f, 0.998915f, 0.998961f,
+	0.997280f, 0.942684f, 0.921124f, 0.921895f, 0.932231f, 0.944640f, 0.955937f, 0.965196f,
+	0.972449f, 0.978020f, 0.982275f, 0.985531f, 0.988037f, 0.989986f, 0.991514f, 0.992724f,
+	0.993697f, 0.994485f, 0.995128f, 0.995663f, 0.996108f, 0.996483f, 0.996800f, 0.997077f,
+	0.997314f, 0.997519f, 0.997694f, 0.997852f, 0.997991f, 0.998111f, 0.998214f, 0.998290f,
+	0.997535f, 0.950244f, 0.927329f, 0.922275f, 0.927244f, 0.936353f, 0.946254f, 0.955387f,
+	0.963202f, 0.969639f, 0.974840f, 0.979004f, 0.982333f, 0.985002f, 0.987149f, 0.988888f,
+	0.990308f, 0.991469f, 0.992438f, 0.993246f, 0.993926f, 0.994501f, 0.994993f, 0.995417f,
+	0.995786f, 0.996105f, 0.996385f, 0.996632f, 0.996847f, 0.997036f, 0.997198f, 0.997319f,
+	0.997641f, 0.955457f, 0.932962f, 0.924528f, 0.925229f, 0.930890f, 0.938614f, 0.946700f,
+	0.954277f, 0.960980f, 0.966722f, 0.971553f, 0.975576f, 0.978913f, 0.981679f, 0.983975f,
+	0.985891f, 0.987493f, 0.988840f, 0.989981f, 0.990956f, 0.991786f, 0.992504f, 0.993124f,
+	0.993665f, 0.994140f, 0.994558f, 0.994926f, 0.995250f, 0.995535f, 0.995778f, 0.995959f,
+	0.997636f, 0.958659f, 0.937145f, 0.926992f, 0.924726f, 0.927426f, 0.932831f, 0.939392f,
+	0.946151f, 0.952578f, 0.958416f, 0.963577f, 0.968059f, 0.971918f, 0.975219f, 0.978036f,
+	0.980443f, 0.982499f, 0.984261f, 0.985777f, 0.987086f, 0.988220f, 0.989208f, 0.990073f,
+	0.990833f, 0.991502f, 0.992095f, 0.992619f, 0.993083f, 0.993493f, 0.993845f, 0.994109f,
+	0.997545f, 0.960161f, 0.939584f, 0.928648f, 0.924480f, 0.924926f, 0.928268f, 0.933213f,
+	0.938867f, 0.944651f, 0.950219f, 0.955384f, 0.960066f, 0.964245f, 0.967936f, 0.971181f,
+	0.974020f, 0.976504f, 0.978678f, 0.980577f, 0.982245f, 0.983714f, 0.985006f, 0.986151f,
+	0.987166f, 0.988070f, 0.988874f, 0.989592f, 0.990232f, 0.990799f, 0.991288f, 0.991657f,
+	0.997386f, 0.960244f, 0.940249f, 0.928960f, 0.923613f, 0.922459f, 0.924148f, 0.927635f,
+	0.932141f, 0.937115f, 0.942185f, 0.947114f, 0.951764f, 0.956063f, 0.959985f, 0.963530f,
+	0.966713f, 0.969562f, 0.972105f, 0.974375f, 0.976399f, 0.978206f, 0.979824f, 0.981272f,
+	0.982570f, 0.983738f, 0.984788f, 0.985732f, 0.986580f, 0.987334f, 0.987990f, 0.988489f,
+	0.997170f, 0.959139f, 0.939252f, 0.927697f, 0.921587f, 0.919323f, 0.919767f, 0.922057f,
+	0.925527f, 0.929681f, 0.934160f, 0.938714f, 0.943176f, 0.947442f, 0.951449f, 0.955169f,
+	0.958594f, 0.961727f, 0.964583f, 0.967180f, 0.969536f, 0.971674f, 0.973612f, 0.975372f,
+	0.976970f, 0.978421f, 0.979739f, 0.980935f, 0.982018f, 0.982989f, 0.983840f, 0.984488f,
+	0.996904f, 0.957028f, 0.936749f, 0.924826f, 0.918128f, 0.915061f, 0.914584f, 0.915938f,
+	0.918544f, 0.921964f, 0.925864f, 0.930000f, 0.934195f, 0.938329f, 0.942320f, 0.946117f,
+	0.949692f, 0.953032f, 0.956136f, 0.959008f, 0.961659f, 0.964101f, 0.966349f, 0.968414f,
+	0.970313f, 0.972056f, 0.973656f, 0.975121f, 0.976459f, 0.977668f, 0.978734f, 0.979551f,
+	0.996597f, 0.954066f, 0.932907f, 0.920413f, 0.913143f, 0.909426f, 0.908237f, 0.908866f,
+	0.910782f, 0.913587f, 0.916975f, 0.920713f, 0.924627f, 0.928588f, 0.932506f, 0.936318f,
+	0.939979f, 0.943464f, 0.946761f, 0.949863f, 0.952769f, 0.955484f, 0.958017f, 0.960374f,
+	0.962565f, 0.964600f, 0.966486f, 0.968229f, 0.969834f, 0.971296f, 0.972594f, 0.973591f,
+	0.996258f, 0.950379f, 0.927899f, 0.914588f, 0.906662f, 0.902331f, 0.900538f, 0.900575f,
+	0.901936f, 0.904241f, 0.907201f, 0.910594f, 0.914251f, 0.918042f, 0.921871f, 0.925667f,
+	0.929380f, 0.932972f, 0.936423f, 0.939716f, 0.942846f, 0.945807f, 0.948603f, 0.951235f,
+	0.953709f, 0.956028f, 0.958198f, 0.960223f, 0.962101f, 0.963824f, 0.965364f, 0.966547f,
+	0.995874f, 0.946077f, 0.921886f, 0.907505f, 0.898786f, 0.893800f, 0.891427f, 0.890940f,
+	0.891827f, 0.893714f, 0.896319f, 0.899426f, 0.902865f, 0.906509f, 0.910258f, 0.914037f,
+	0.917790f, 0.921473f, 0.925058f, 0.928523f, 0.931855f, 0.935045f, 0.938087f, 0.940982f,
+	0.943727f, 0.946326f, 0.948778f, 0.951083f, 0.953237f, 0.955227f, 0.957014f, 0.958386f,
+	0.995466f, 0.941252f, 0.915017f, 0.899331f, 0.889665f, 0.883936f, 0.880951f, 0.879945f,
+	0.880390f, 0.881903f, 0.884201f, 0.887062f, 0.890320f, 0.893845f, 0.897534f, 0.901307f,
+	0.905104f, 0.908878f, 0.912593f, 0.916224f, 0.919751f, 0.923161f, 0.926444f, 0.929596f,
+	0.932610f, 0.935485f, 0.938219f, 0.940807f, 0.943241f, 0.945503f, 0.947544f, 0.949106f,
+	0.995031f, 0.935991f, 0.907433f, 0.890231f, 0.879463f, 0.872886f, 0.869223f, 0.867664f,
+	0.867656f, 0.868801f, 0.870804f, 0.873442f, 0.876540f, 0.879965f, 0.883608f, 0.887389f,
+	0.891240f, 0.895111f, 0.898962f, 0.902762f, 0.906487f, 0.910119f, 0.913645f, 0.917056f,
+	0.920344f, 0.923501f, 0.926523f, 0.929402f, 0.932126f, 0.934669f, 0.936973f, 0.938730f,
+	0.994572f, 0.930364f, 0.899262f, 0.880368f, 0.868360f, 0.860824f, 0.856401f, 0.854230f,
+	0.853730f, 0.854481f, 0.856178f, 0.858585f, 0.861522f, 0.864849f, 0.868452f, 0.872245f,
+	0.876156f, 0.880131f, 0.884123f, 0.888098f, 0.892028f, 0.895891f, 0.899670f, 0.903351f,
+	0.906922f, 0.910375f, 0.913700f, 0.916885f, 0.919914f, 0.922757f, 0.925341f, 0.927304f,
+	0.994091f, 0.924437f, 0.890617f, 0.869893f, 0.856528f, 0.847935f, 0.842667f, 0.839816f,
+	0.838766f, 0.839079f, 0.840432f, 0.842581f, 0.845335f, 0.848547f, 0.852099f, 0.855896f,
+	0.859863f, 0.863938f, 0.868073f, 0.872227f, 0.876368f, 0.880471f, 0.884513f, 0.888478f,
+	0.892349f, 0.896116f, 0.899764f, 0.903278f, 0.906637f, 0.909805f, 0.912695f, 0.914887f,
+	0.993591f, 0.918271f, 0.881603f, 0.858947f, 0.844132f, 0.834398f, 0.828211f, 0.824610f,
+	0.822949f, 0.822767f, 0.823727f, 0.825573f, 0.828106f, 0.831170f, 0.834642f, 0.838419f,
+	0.842423f, 0.846585f, 0.850853f, 0.855181f, 0.859533f, 0.863879f, 0.868193f, 0.872454f,
+	0.876644f, 0.880745f, 0.884741f, 0.888612f, 0.892333f, 0.895859f, 0.899091f, 0.901545f,
+	0.993071f, 0.911910f, 0.872311f, 0.847651f, 0.831322f, 0.820386f, 0.813218f, 0.808806f,
+	0.806473f, 0.805739f, 0.806251f, 0.807741f, 0.810003f, 0.812874f, 0.816222f, 0.819943f,
+	0.823950f, 0.828173f, 0.832551f, 0.837037f, 0.841589f, 0.846173f, 0.850760f, 0.855325f,
+	0.859844f, 0.864298f, 0.868666f, 0.872924f, 0.877042f, 0.880967f, 0.884584f, 0.887342f,
+	0.992535f, 0.905402f, 0.862819f, 0.836117f, 0.818236f, 0.806056f, 0.797862f, 0.792591f,
+	0.789536f, 0.788196f, 0.788204f, 0.789283f, 0.791219f, 0.793843f, 0.797018f, 0.800634f,
+	0.804601f, 0.808842f, 0.813297f, 0.817910f, 0.822639f, 0.827445f, 0.832295f, 0.837161f,
+	0.842015f, 0.846834f, 0.851593f, 0.856265f, 0.860813f, 0.865178f, 0.869228f, 0.872338f,
+	0.991983f, 0.898780f, 0.853196f, 0.824440f, 0.804991f, 0.791546f, 0.782299f, 0.776137f,
+	0.772320f, 0.770330f, 0.769786f, 0.770403f, 0.771960f, 0.774281f, 0.777227f, 0.780683f,
+	0.784556f, 0.788768f, 0.793252f, 0.797953f, 0.802823f, 0.807821f, 0.812912f, 0.818063f,
+	0.823245f, 0.828431f, 0.833592f, 0.838697f, 0.843704f, 0.848545f, 0.853073f, 0.856587f,
+	0.991417f, 0.892079f, 0.843500f, 0.812702f, 0.791690f, 0.776978f, 0.766668f, 0.759596f,
+	0.754993f, 0.752320f, 0.751186f, 0.751296f, 0.752425f, 0.754391f, 0.757053f, 0.760294f,
+	0.764017f, 0.768143f, 0.772603f, 0.777340f, 0.782305f, 0.787454f, 0.792750f, 0.798158f,
+	0.803648f, 0.809188f, 0.814749f, 0.820295f, 0.825779f, 0.831126f, 0.836172f, 0.840135f,
+	0.990837f, 0.885325f, 0.833780f, 0.800967f, 0.778418f, 0.762454f, 0.751086f, 0.743102f,
+	0.737700f, 0.734326f, 0.732575f, 0.732145f, 0.732804f, 0.734371f, 0.736699f, 0.739670f,
+	0.743187f, 0.747169f, 0.751547f, 0.756263f, 0.761267f, 0.766516f, 0.771970f, 0.777594f,
+	0.783357f, 0.789226f, 0.795169f, 0.801148f, 0.807113f, 0.812982f, 0.818575f, 0.823024f,
+	0.990245f, 0.878542f, 0.824074f, 0.789294f, 0.765244f, 0.748057f, 0.735652f, 0.726766f,
+	0.720568f, 0.716485f, 0.714102f, 0.713109f, 0.713270f, 0.714400f, 0.716351f, 0.719004f,
+	0.722263f, 0.726045f, 0.730283f, 0.734919f, 0.739902f, 0.745191f, 0.750747f, 0.756535f,
+	0.762522f, 0.768679f, 0.774971f, 0.781360f, 0.787793f, 0.794184f, 0.800334f, 0.805293f,
+	0.989641f, 0.871745f, 0.814417f, 0.777727f, 0.752225f, 0.733856f, 0.720445f, 0.710679f,
+	0.703699f, 0.698912f, 0.695894f, 0.694327f, 0.693970f, 0.694636f, 0.696177f, 0.698474f,
+	0.701428f, 0.704959f, 0.709001f, 0.713497f, 0.718399f, 0.723666f, 0.729260f, 0.735149f,
+	0.741304f, 0.747693f, 0.754285f, 0.761043f, 0.767914f, 0.774806f, 0.781508f, 0.786981f,
+	0.994179f, 0.999998f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.893198f, 0.999492f, 0.999883f, 0.999962f, 0.999979f, 0.999984f, 0.999987f, 0.999989f,
+	0.999991f, 0.999999f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.954779f, 0.991298f, 0.998207f, 0.999293f, 0.999631f, 0.999806f, 0.999873f, 0.999910f,
+	0.999932f, 0.999949f, 0.999959f, 0.999974f, 0.999977f, 0.999985f, 0.999987f, 0.999988f,
+	0.999990f, 0.999991f, 0.999992f, 0.999992f, 0.999993f, 0.999994f, 0.999994f, 0.999995f,
+	0.999995f, 0.999996f, 0.999996f, 0.999996f, 0.999998f, 1.000000f, 1.000000f, 0.999997f,
+	0.978868f, 0.960177f, 0.990110f, 0.996156f, 0.998108f, 0.998897f, 0.999300f, 0.999524f,
+	0.999661f, 0.999736f, 0.999789f, 0.999843f, 0.999866f, 0.999894f, 0.999915f, 0.999923f,
+	0.999930f, 0.999935f, 0.999948f, 0.999952f, 0.999955f, 0.999958f, 0.999958f, 0.999965f,
+	0.999969f, 0.999971f, 0.999972f, 0.999974f, 0.999978f, 0.999979f, 0.999983f, 0.999984f,
+	0.988063f, 0.922289f, 0.970578f, 0.987410f, 0.993579f, 0.996299f, 0.997665f, 0.998408f,
+	0.998862f, 0.999153f, 0.999352f, 0.999487f, 0.999580f, 0.999648f, 0.999704f, 0.999751f,
+	0.999781f, 0.999808f, 0.999827f, 0.999849f, 0.999861f, 0.999875f, 0.999887f, 0.999892f,
+	0.999905f, 0.999911f, 0.999914f, 0.999918f, 0.999924f, 0.999935f, 0.999940f, 0.999939f,
+	0.992381f, 0.906250f, 0.944765f, 0.971517f, 0.984363f, 0.990671f, 0.994014f, 0.995924f,
+	0.997089f, 0.997829f, 0.998341f, 0.998690f, 0.998928f, 0.999124f, 0.999260f, 0.999363f,
+	0.999451f, 0.999521f, 0.999577f, 0.999620f, 0.999653f, 0.999681f, 0.999711f, 0.999733f,
+	0.999757f, 0.999775f, 0.999790f, 0.999804f, 0.999820f, 0.999826f, 0.999838f, 0.999844f,
+	0.994698f, 0.909765f, 0.924907f, 0.952217f, 0.970510f, 0.981262f, 0.987553f, 0.991362f,
+	0.993769f, 0.995343f, 0.996415f, 0.997160f, 0.997705f, 0.998104f, 0.998408f, 0.998641f,
+	0.998828f, 0.998970f, 0.999086f, 0.999182f, 0.999266f, 0.999336f, 0.999393f, 0.999441f,
+	0.999479f, 0.999517f, 0.999553f, 0.999587f, 0.999611f, 0.999633f, 0.999652f, 0.999667f,
+	0.996037f, 0.920987f, 0.916291f, 0.935854f, 0.955035f, 0.968921f, 0.978218f, 0.984351f,
+	0.988452f, 0.991250f, 0.993199f, 0.994593f, 0.995608f, 0.996368f, 0.996955f, 0.997403f,
+	0.997751f, 0.998027f, 0.998262f, 0.998450f, 0.998607f, 0.998733f, 0.998848f, 0.998939f,
+	0.999019f, 0.999093f, 0.999157f, 0.999214f, 0.999261f, 0.999298f, 0.999334f, 0.999365f,
+	0.996834f, 0.932916f, 0.916588f, 0.925962f, 0.941680f, 0.956005f, 0.967126f, 0.975272f,
+	0.981140f, 0.985366f, 0.988435f, 0.990699f, 0.992388f, 0.993670f, 0.994658f, 0.995436f,
+	0.996051f, 0.996545f, 0.996944f, 0.997274f, 0.997548f, 0.997778f, 0.997974f, 0.998146f,
+	0.998291f, 0.998415f, 0.998523f, 0.998616f, 0.998698f, 0.998774f, 0.998839f, 0.998887f,
+	0.997308f, 0.942952f, 0.921484f, 0.922254f, 0.932519f, 0.944829f, 0.956027f, 0.965203f,
+	0.972394f, 0.977920f, 0.982144f, 0.985381f, 0.987876f, 0.989820f, 0.991345f, 0.992556f,
+	0.993532f, 0.994322f, 0.994970f, 0.995508f, 0.995957f, 0.996336f, 0.996655f, 0.996935f,
+	0.997176f, 0.997383f, 0.997560f, 0.997720f, 0.997862f, 0.997983f, 0.998088f, 0.998167f,
+	0.997569f, 0.950526f, 0.927682f, 0.922626f, 0.927535f, 0.936549f, 0.946347f, 0.955385f,
+	0.963121f, 0.969496f, 0.974652f, 0.978785f, 0.982094f, 0.984752f, 0.986893f, 0.988631f,
+	0.990051f, 0.991216f, 0.992188f, 0.993002f, 0.993686f, 0.994267f, 0.994763f, 0.995192f,
+	0.995565f, 0.995889f, 0.996171f, 0.996423f, 0.996641f, 0.996833f, 0.996998f, 0.997123f,
+	0.997682f, 0.955771f, 0.933323f, 0.924873f, 0.925513f, 0.931082f, 0.938699f, 0.946681f,
+	0.954163f, 0.960788f, 0.966469f, 0.971254f, 0.975244f, 0.978560f, 0.981312f, 0.983601f,
+	0.985515f, 0.987119f, 0.988469f, 0.989614f, 0.990595f, 0.991431f, 0.992156f, 0.992782f,
+	0.993329f, 0.993809f, 0.994233f, 0.994606f, 0.994935f, 0.995224f, 0.995473f, 0.995660f,
+	0.997684f, 0.959023f, 0.937538f, 0.927349f, 0.925011f, 0.927612f, 0.932904f, 0.939350f,
+	0.946001f, 0.952333f, 0.958091f, 0.963188f, 0.967622f, 0.971445f, 0.974721f, 0.977522f,
+	0.979919f, 0.981971f, 0.983733f, 0.985253f, 0.986566f, 0.987706f, 0.988700f, 0.989572f,
+	0.990340f, 0.991015f, 0.991615f, 0.992146f, 0.992618f, 0.993035f, 0.993395f, 0.993668f,
+	0.997603f, 0.960593f, 0.940036f, 0.929041f, 0.924781f, 0.925114f, 0.928331f, 0.933149f,
+	0.938680f, 0.944351f, 0.949820f, 0.954901f, 0.959516f, 0.963640f, 0.967291f, 0.970505f,
+	0.973324f, 0.975795f, 0.977960f, 0.979857f, 0.981525f, 0.982997f, 0.984295f, 0.985446f,
+	0.986469f, 0.987380f, 0.988192f, 0.988919f, 0.989568f, 0.990145f, 0.990644f, 0.991027f,
+	0.997454f, 0.960762f, 0.940785f, 0.929417f, 0.923955f, 0.922667f, 0.924213f, 0.927555f,
+	0.931921f, 0.936763f, 0.941712f, 0.946536f, 0.951096f, 0.955319f, 0.959180f, 0.962676f,
+	0.965822f, 0.968643f, 0.971166f, 0.973423f, 0.975440f, 0.977244f, 0.978862f, 0.980313f,
+	0.981616f, 0.982791f, 0.983849f, 0.984801f, 0.985659f, 0.986424f, 0.987094f, 0.987610f,
+	0.997249f, 0.959756f, 0.939895f, 0.928245f, 0.921996f, 0.919574f, 0.919852f, 0.921975f,
+	0.925282f, 0.929282f, 0.933617f, 0.938041f, 0.942388f, 0.946553f, 0.950474f, 0.954123f,
+	0.957490f, 0.960576f, 0.963395f, 0.965963f, 0.968299f, 0.970423f, 0.972352f, 0.974107f,
+	0.975704f, 0.977158f, 0.978481f, 0.979683f, 0.980776f, 0.981759f, 0.982624f, 0.983294f,
+	0.996995f, 0.957757f, 0.937519f, 0.925490f, 0.918631f, 0.915379f, 0.914709f, 0.915870f,
+	0.918287f, 0.921526f, 0.925256f, 0.929234f, 0.933286f, 0.937292f, 0.941170f, 0.944868f,
+	0.948359f, 0.951628f, 0.954673f, 0.957496f, 0.960109f, 0.962520f, 0.964744f, 0.966793f,
+	0.968681f, 0.970417f, 0.972016f, 0.973483f, 0.974826f, 0.976045f, 0.977127f, 0.977968f,
+	0.996701f, 0.954916f, 0.933821f, 0.921214f, 0.913762f, 0.909834f, 0.908423f, 0.908828f,
+	0.910526f, 0.913120f, 0.916308f, 0.919858f, 0.923599f, 0.927400f, 0.931175f, 0.934857f,
+	0.938404f, 0.941790f, 0.945001f, 0.948028f, 0.950872f, 0.953535f, 0.956025f, 0.958348f,
+	0.960513f, 0.962528f, 0.964401f, 0.966137f, 0.967740f, 0.969206f, 0.970517f, 0.971539f,
+	0.996375f, 0.951358f, 0.928967f, 0.915540f, 0.907413f, 0.902846f, 0.900801f, 0.900583f,
+	0.901693f, 0.903754f, 0.906481f, 0.909653f, 0.913102f, 0.916701f, 0.920352f, 0.923986f,
+	0.927552f, 0.931012f, 0.934345f, 0.937535f, 0.940573f, 0.943456f, 0.946184f, 0.948759f,
+	0.951185f, 0.953466f, 0.955606f, 0.957609f, 0.959474f, 0.961193f, 0.962738f, 0.963944f,
+	0.996005f, 0.947189f, 0.923115f, 0.908616f, 0.899681f, 0.894433f, 0.891778f, 0.891003f,
+	0.891605f, 0.893213f, 0.895549f, 0.898399f, 0.901594f, 0.905010f, 0.908545f, 0.912126f,
+	0.915696f, 0.919212f, 0.922644f, 0.925972f, 0.929180f, 0.932259f, 0.935205f, 0.938014f,
+	0.940686f, 0.943223f, 0.945623f, 0.947886f, 0.950010f, 0.951981f, 0.953763f, 0.955152f,
+	0.995612f, 0.942499f, 0.916408f, 0.900603f, 0.890705f, 0.884690f, 0.881395f, 0.880067f,
+	0.880192f, 0.881390f, 0.883381f, 0.885948f, 0.888925f, 0.892183f, 0.895619f, 0.899155f,
+	0.902731f, 0.906300f, 0.909825f, 0.913282f, 0.916649f, 0.919914f, 0.923066f, 0.926100f,
+	0.929010f, 0.931794f, 0.934449f, 0.936971f, 0.939353f, 0.941577f, 0.943597f, 0.945167f,
+	0.995192f, 0.937371f, 0.908983f, 0.891660f, 0.880645f, 0.873759f, 0.869755f, 0.867843f,
+	0.867479f, 0.868272f, 0.869931f, 0.872235f, 0.875013f, 0.878130f, 0.881482f, 0.884985f,
+	0.888576f, 0.892201f, 0.895822f, 0.899408f, 0.902935f, 0.906384f, 0.909743f, 0.913001f,
+	0.916149f, 0.919183f, 0.922095f, 0.924879f, 0.927523f, 0.930005f, 0.932268f, 0.934020f,
+	0.994748f, 0.931874f, 0.900963f, 0.881946f, 0.869674f, 0.861805f, 0.857012f, 0.854456f,
+	0.853564f, 0.853927f, 0.855241f, 0.857276f, 0.859852f, 0.862832f, 0.866102f, 0.869577f,
+	0.873187f, 0.876874f, 0.880596f, 0.884316f, 0.888008f, 0.891648f, 0.895219f, 0.898709f,
+	0.902104f, 0.905397f, 0.908577f, 0.911634f, 0.914553f, 0.917306f, 0.919826f, 0.921769f,
+	0.994282f, 0.926073f, 0.892460f, 0.871605f, 0.857957f, 0.849006f, 0.843340f, 0.840071f,
+	0.838596f, 0.838485f, 0.839418f, 0.841155f, 0.843510f, 0.846335f, 0.849513f, 0.852951f,
+	0.856574f, 0.860321f, 0.864143f, 0.868001f, 0.871862f, 0.875700f, 0.879494f, 0.883228f,
+	0.886884f, 0.890452f, 0.893918f, 0.897269f, 0.900485f, 0.903532f, 0.906332f, 0.908486f,
+	0.993798f, 0.920027f, 0.883575f, 0.860775f, 0.845657f, 0.835538f, 0.828923f, 0.824874f,
+	0.822753f, 0.822111f, 0.822616f, 0.824013f, 0.826108f, 0.828746f, 0.831804f, 0.835182f,
+	0.838801f, 0.842594f, 0.846508f, 0.850498f, 0.854528f, 0.858568f, 0.862593f, 0.866581f,
+	0.870515f, 0.874378f, 0.878153f, 0.881824f, 0.885366f, 0.888740f, 0.891854f, 0.894250f,
+	0.993294f, 0.913778f, 0.874397f, 0.849576f, 0.832919f, 0.821570f, 0.813944f, 0.809052f,
+	0.806227f, 0.804999f, 0.805020f, 0.806026f, 0.807813f, 0.810220f, 0.813117f, 0.816400f,
+	0.819983f, 0.823796f, 0.827780f, 0.831887f, 0.836076f, 0.840313f, 0.844570f, 0.848821f,
+	0.853044f, 0.857219f, 0.861328f, 0.865348f, 0.869250f, 0.872989f, 0.876459f, 0.879140f,
+	0.992773f, 0.907373f, 0.865004f, 0.838118f, 0.819881f, 0.807257f, 0.798574f, 0.792790f,
+	0.789211f, 0.787344f, 0.786829f, 0.787390f, 0.788817f, 0.790941f, 0.793629f, 0.796771f,
+	0.800276f, 0.804070f, 0.808092f, 0.812287f, 0.816614f, 0.821033f, 0.825513f, 0.830024f,
+	0.834542f, 0.839043f, 0.843504f, 0.847900f, 0.852197f, 0.856342f, 0.860215f, 0.863230f,
+	0.992238f, 0.900847f, 0.855463f, 0.826495f, 0.806658f, 0.792736f, 0.782967f, 0.776260f,
+	0.771887f, 0.769339f, 0.768240f, 0.768307f, 0.769323f, 0.771113f, 0.773538f, 0.776486f,
+	0.779863f, 0.783592f, 0.787608f, 0.791854f, 0.796284f, 0.800858f, 0.805540f, 0.810299f,
+	0.815106f, 0.819936f, 0.824761f, 0.829552f, 0.834273f, 0.838862f, 0.843185f, 0.846586f,
+	0.991688f, 0.894233f, 0.845833f, 0.814788f, 0.793352f, 0.778129f, 0.767263f, 0.759614f,
+	0.754424f, 0.751163f, 0.749444f, 0.748975f, 0.749533f, 0.750938f, 0.753050f, 0.755752f,
+	0.758948f, 0.762559f, 0.766518f, 0.770767f, 0.775258f, 0.779948f, 0.784800f, 0.789780f,
+	0.794858f, 0.800006f, 0.805194f, 0.810391f, 0.815554f, 0.820617f, 0.825431f, 0.829266f,
+	0.991125f, 0.887557f, 0.836162f, 0.803064f, 0.780050f, 0.763538f, 0.751580f, 0.742986f,
+	0.736967f, 0.732975f, 0.730611f, 0.729576f, 0.729638f, 0.730617f, 0.732368f, 0.734773f,
+	0.737736f, 0.741175f, 0.745023f, 0.749222f, 0.753722f, 0.758480f, 0.763457f, 0.768620f,
+	0.773938f, 0.779380f, 0.784917f, 0.790513f, 0.796125f, 0.801679f, 0.807014f, 0.811322f,
+	0.990549f, 0.880843f, 0.826490f, 0.791381f, 0.766823f, 0.749048f, 0.736018f, 0.726489f,
+	0.719645f, 0.714917f, 0.711895f, 0.710271f, 0.709811f, 0.710330f, 0.711681f, 0.713745f,
+	0.716426f, 0.719642f, 0.723325f, 0.727418f, 0.731871f, 0.736642f, 0.741693f, 0.746990f,
+	0.752503f, 0.758202f, 0.764056f, 0.770031f, 0.776080f, 0.782126f, 0.787995f, 0.792801f,
+	0.989961f, 0.874108f, 0.816852f, 0.779783f, 0.753729f, 0.734731f, 0.720658f, 0.710217f,
+	0.702561f, 0.697104f, 0.693423f, 0.691202f, 0.690204f, 0.690239f, 0.691160f, 0.692848f,
+	0.695205f, 0.698150f, 0.701617f, 0.705550f, 0.709899f, 0.714625f, 0.719691f, 0.725064f,
+	0.730717f, 0.736622f, 0.742748f, 0.749063f, 0.755521f, 0.762042f, 0.768439f, 0.773749f,
+	0.994180f, 0.999998f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.893214f, 0.999493f, 0.999884f, 0.999962f, 0.999979f, 0.999984f, 0.999987f, 0.999989f,
+	0.999991f, 0.999999f, 0.999999f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.954796f, 0.991326f, 0.998216f, 0.999297f, 0.999633f, 0.999807f, 0.999873f, 0.999910f,
+	0.999932f, 0.999949f, 0.999959f, 0.999973f, 0.999977f, 0.999985f, 0.999987f, 0.999988f,
+	0.999990f, 0.999991f, 0.999992f, 0.999992f, 0.999993f, 0.999994f, 0.999994f, 0.999995f,
+	0.999995f, 0.999995f, 0.999996f, 0.999996f, 0.999998f, 1.000000f, 1.000000f, 0.999997f,
+	0.978884f, 0.960302f, 0.990159f, 0.996177f, 0.998118f, 0.998902f, 0.999302f, 0.999524f,
+	0.999661f, 0.999735f, 0.999788f, 0.999842f, 0.999864f, 0.999893f, 0.999914f, 0.999922f,
+	0.999928f, 0.999934f, 0.999947f, 0.999951f, 0.999954f, 0.999956f, 0.999956f, 0.999963f,
+	0.999968f, 0.999969f, 0.999971f, 0.999972f, 0.999977f, 0.999978f, 0.999981f, 0.999983f,
+	0.988078f, 0.922536f, 0.970723f, 0.987481f, 0.993614f, 0.996315f, 0.997672f, 0.998409f,
+	0.998860f, 0.999149f, 0.999348f, 0.999482f, 0.999574f, 0.999642f, 0.999698f, 0.999745f,
+	0.999776f, 0.999803f, 0.999822f, 0.999844f, 0.999857f, 0.999870f, 0.999883f, 0.999888f,
+	0.999901f, 0.999907f, 0.999909f, 0.999913f, 0.999920f, 0.999931f, 0.999937f, 0.999935f,
+	0.992397f, 0.906561f, 0.945035f, 0.971677f, 0.984448f, 0.990713f, 0.994032f, 0.995928f,
+	0.997085f, 0.997821f, 0.998330f, 0.998678f, 0.998915f, 0.999111f, 0.999246f, 0.999350f,
+	0.999438f, 0.999508f, 0.999565f, 0.999608f, 0.999641f, 0.999669f, 0.999699f, 0.999722f,
+	0.999746f, 0.999764f, 0.999780f, 0.999793f, 0.999810f, 0.999815f, 0.999828f, 0.999834f,
+	0.994715f, 0.910083f, 0.925272f, 0.952482f, 0.970670f, 0.981348f, 0.987592f, 0.991372f,
+	0.993762f, 0.995325f, 0.996392f, 0.997133f, 0.997676f, 0.998075f, 0.998379f, 0.998612f,
+	0.998800f, 0.998942f, 0.999059f, 0.999156f, 0.999241f, 0.999311f, 0.999369f, 0.999417f,
+	0.999455f, 0.999493f, 0.999530f, 0.999565f, 0.999589f, 0.999611f, 0.999630f, 0.999645f,
+	0.996055f, 0.921289f, 0.916696f, 0.936201f, 0.955273f, 0.969060f, 0.978285f, 0.984370f,
+	0.988439f, 0.991217f, 0.993155f, 0.994542f, 0.995554f, 0.996312f, 0.996898f, 0.997348f,
+	0.997696f, 0.997973f, 0.998210f, 0.998399f, 0.998558f, 0.998685f, 0.998800f, 0.998893f,
+	0.998974f, 0.999048f, 0.999113f, 0.999171f, 0.999219f, 0.999255f, 0.999293f, 0.999325f,
+	0.996856f, 0.933199f, 0.916991f, 0.926350f, 0.941976f, 0.956194f, 0.967223f, 0.975300f,
+	0.981118f, 0.985312f, 0.988360f, 0.990611f, 0.992293f, 0.993572f, 0.994559f, 0.995337f,
+	0.995954f, 0.996450f, 0.996851f, 0.997183f, 0.997460f, 0.997692f, 0.997889f, 0.998063f,
+	0.998210f, 0.998336f, 0.998445f, 0.998539f, 0.998623f, 0.998700f, 0.998766f, 0.998816f,
+	0.997333f, 0.943225f, 0.921869f, 0.922646f, 0.932842f, 0.945049f, 0.956145f, 0.965235f,
+	0.972358f, 0.977836f, 0.982028f, 0.985243f, 0.987725f, 0.989662f, 0.991184f, 0.992394f,
+	0.993372f, 0.994165f, 0.994815f, 0.995357f, 0.995809f, 0.996191f, 0.996514f, 0.996797f,
+	0.997041f, 0.997251f, 0.997430f, 0.997592f, 0.997736f, 0.997860f, 0.997966f, 0.998048f,
+	0.997599f, 0.950802f, 0.928048f, 0.923004f, 0.927858f, 0.936780f, 0.946472f, 0.955411f,
+	0.963064f, 0.969375f, 0.974483f, 0.978583f, 0.981869f, 0.984513f, 0.986647f, 0.988382f,
+	0.989803f, 0.990969f, 0.991945f, 0.992763f, 0.993453f, 0.994038f, 0.994539f, 0.994972f,
+	0.995349f, 0.995677f, 0.995964f, 0.996219f, 0.996440f, 0.996636f, 0.996805f, 0.996934f,
+	0.997717f, 0.956067f, 0.933684f, 0.925236f, 0.925824f, 0.931304f, 0.938816f, 0.946691f,
+	0.954077f, 0.960621f, 0.966238f, 0.970974f, 0.974930f, 0.978222f, 0.980959f, 0.983240f,
+	0.985150f, 0.986754f, 0.988107f, 0.989257f, 0.990242f, 0.991085f, 0.991816f, 0.992447f,
+	0.993000f, 0.993487f, 0.993916f, 0.994294f, 0.994629f, 0.994924f, 0.995178f, 0.995372f,
+	0.997726f, 0.959354f, 0.937915f, 0.927707f, 0.925309f, 0.927819f, 0.933003f, 0.939335f,
+	0.945878f, 0.952114f, 0.957791f, 0.962822f, 0.967205f, 0.970992f, 0.974241f, 0.977024f,
+	0.979411f, 0.981458f, 0.983220f, 0.984741f, 0.986058f, 0.987204f, 0.988205f, 0.989084f,
+	0.989859f, 0.990542f, 0.991150f, 0.991688f, 0.992167f, 0.992592f, 0.992960f, 0.993243f,
+	0.997653f, 0.960976f, 0.940450f, 0.929416f, 0.925079f, 0.925311f, 0.928411f, 0.933105f,
+	0.938516f, 0.944075f, 0.949446f, 0.954443f, 0.958988f, 0.963058f, 0.966667f, 0.969850f,
+	0.972647f, 0.975104f, 0.977262f, 0.979156f, 0.980824f, 0.982299f, 0.983602f, 0.984759f,
+	0.985789f, 0.986710f, 0.987530f, 0.988266f, 0.988924f, 0.989511f, 0.990022f, 0.990418f,
+	0.997512f, 0.961211f, 0.941260f, 0.929831f, 0.924272f, 0.922865f, 0.924281f, 0.927486f,
+	0.931716f, 0.936429f, 0.941261f, 0.945980f, 0.950451f, 0.954599f, 0.958399f, 0.961846f,
+	0.964955f, 0.967748f, 0.970252f, 0.972496f, 0.974506f, 0.976307f, 0.977925f, 0.979379f,
+	0.980688f, 0.981870f, 0.982936f, 0.983898f, 0.984767f, 0.985544f, 0.986228f, 0.986762f,
+	0.997316f, 0.960285f, 0.940452f, 0.928725f, 0.922356f, 0.919793f, 0.919920f, 0.921888f,
+	0.925041f, 0.928893f, 0.933090f, 0.937387f, 0.941622f, 0.945689f, 0.949526f, 0.953105f,
+	0.956414f, 0.959454f, 0.962237f, 0.964778f, 0.967094f, 0.969205f, 0.971126f, 0.972878f,
+	0.974475f, 0.975931f, 0.977260f, 0.978470f, 0.979573f, 0.980569f, 0.981451f, 0.982142f,
+	0.997072f, 0.958377f, 0.938175f, 0.926056f, 0.919055f, 0.915640f, 0.914795f, 0.915777f,
+	0.918018f, 0.921086f, 0.924654f, 0.928482f, 0.932396f, 0.936279f, 0.940047f, 0.943650f,
+	0.947059f, 0.950260f, 0.953247f, 0.956024f, 0.958599f, 0.960981f, 0.963184f, 0.965218f,
+	0.967096f, 0.968828f, 0.970426f, 0.971896f, 0.973247f, 0.974477f, 0.975575f, 0.976441f,
+	0.996788f, 0.955636f, 0.934592f, 0.921885f, 0.914272f, 0.910155f, 0.908543f, 0.908744f,
+	0.910239f, 0.912637f, 0.915636f, 0.919009f, 0.922584f, 0.926234f, 0.929870f, 0.933430f,
+	0.936867f, 0.940158f, 0.943286f, 0.946242f, 0.949026f, 0.951640f, 0.954090f, 0.956381f,
+	0.958522f, 0.960519f, 0.962381f, 0.964111f, 0.965715f, 0.967188f, 0.968513f, 0.969560f,
+	0.996474f, 0.952184f, 0.929863f, 0.916331f, 0.908025f, 0.903244f, 0.900971f, 0.900521f,
+	0.901398f, 0.903234f, 0.905742f, 0.908707f, 0.911961f, 0.915377f, 0.918860f, 0.922340f,
+	0.925766f, 0.929100f, 0.932321f, 0.935412f, 0.938364f, 0.941172f, 0.943837f, 0.946358f,
+	0.948740f, 0.950985f, 0.953099f, 0.955082f, 0.956936f, 0.958652f, 0.960205f, 0.961436f,
+	0.996116f, 0.948126f, 0.924143f, 0.909534f, 0.900403f, 0.894919f, 0.892009f, 0.890971f,
+	0.891310f, 0.892661f, 0.894747f, 0.897357f, 0.900325f, 0.903525f, 0.906859f, 0.910252f,
+	0.913648f, 0.917006f, 0.920294f, 0.923491f, 0.926582f, 0.929557f, 0.932411f, 0.935140f,
+	0.937743f, 0.940221f, 0.942573f, 0.944799f, 0.946895f, 0.948851f, 0.950630f, 0.952039f,
+	0.995735f, 0.943548f, 0.917570f, 0.901652f, 0.891543f, 0.885269f, 0.881690f, 0.880070f,
+	0.879900f, 0.880808f, 0.882516f, 0.884809f, 0.887523f, 0.890531f, 0.893731f, 0.897044f,
+	0.900412f, 0.903787f, 0.907133f, 0.910424f, 0.913640f, 0.916768f, 0.919796f, 0.922719f,
+	0.925531f, 0.928229f, 0.930811f, 0.933271f, 0.935604f, 0.937794f, 0.939797f, 0.941377f,
+	0.995327f, 0.938532f, 0.910277f, 0.892838f, 0.881596f, 0.874427f, 0.870114f, 0.867879f,
+	0.867189f, 0.867658f, 0.868999f, 0.870994f, 0.873474f, 0.876305f, 0.879383f, 0.882628f,
+	0.885973f, 0.889367f, 0.892772f, 0.896156f, 0.899496f, 0.902772f, 0.905972f, 0.909085f,
+	0.912102f, 0.915019f, 0.917827f, 0.920522f, 0.923091f, 0.925516f, 0.927742f, 0.929493f,
+	0.994896f, 0.933146f, 0.902385f, 0.883245f, 0.870731f, 0.862557f, 0.857427f, 0.854518f,
+	0.853268f, 0.853273f, 0.854235f, 0.855926f, 0.858168f, 0.860824f, 0.863784f, 0.866962f,
+	0.870288f, 0.873707f, 0.877174f, 0.880654f, 0.884121f, 0.887550f, 0.890926f, 0.894234f,
+	0.897463f, 0.900604f, 0.903647f, 0.906583f, 0.909399f, 0.912068f, 0.914528f, 0.916453f,
+	0.994444f, 0.927452f, 0.894001f, 0.873016f, 0.859107f, 0.849827f, 0.843798f, 0.840146f,
+	0.838282f, 0.837780f, 0.838327f, 0.839684f, 0.841668f, 0.844134f, 0.846964f, 0.850067f,
+	0.853369f, 0.856808f, 0.860338f, 0.863917f, 0.867514f, 0.871103f, 0.874663f, 0.878177f,
+	0.881629f, 0.885009f, 0.888303f, 0.891499f, 0.894579f, 0.897512f, 0.900227f, 0.902345f,
+	0.993973f, 0.921507f, 0.885225f, 0.862283f, 0.846884f, 0.836412f, 0.829406f, 0.824944f,
+	0.822404f, 0.821339f, 0.821423f, 0.822407f, 0.824096f, 0.826339f, 0.829012f, 0.832019f,
+	0.835279f, 0.838726f, 0.842308f, 0.845981f, 0.849709f, 0.853460f, 0.857212f, 0.860943f,
+	0.864634f, 0.868271f, 0.871838f, 0.875318f, 0.878691f, 0.881919f, 0.884920f, 0.887262f,
+	0.993482f, 0.915354f, 0.876144f, 0.851165f, 0.834204f, 0.822476f, 0.814430f, 0.809097f,
+	0.805821f, 0.804139f, 0.803708f, 0.804267f, 0.805615f, 0.807592f, 0.810070f, 0.812945f,
+	0.816133f, 0.819563f, 0.823179f, 0.826930f, 0.830779f, 0.834689f, 0.838634f, 0.842589f,
+	0.846532f, 0.850444f, 0.854307f, 0.858100f, 0.861798f, 0.865359f, 0.868689f, 0.871296f,
+	0.992976f, 0.909039f, 0.866835f, 0.839770f, 0.821202f, 0.808172f, 0.799039f, 0.792786f,
+	0.788725f, 0.786375f, 0.785376f, 0.785459f, 0.786415f, 0.788078f, 0.790314f, 0.793013f,
+	0.796089f, 0.799466f, 0.803083f, 0.806888f, 0.810837f, 0.814892f, 0.819023f, 0.823201f,
+	0.827401f, 0.831602f, 0.835780f, 0.839914f, 0.843972f, 0.847907f, 0.851612f, 0.854535f,
+	0.992454f, 0.902594f, 0.857364f, 0.828192f, 0.807994f, 0.793636f, 0.783388f, 0.776180f,
+	0.771298f, 0.768236f, 0.766625f, 0.766185f, 0.766701f, 0.767998f, 0.769941f, 0.772417f,
+	0.775333f, 0.778612f, 0.782190f, 0.786011f, 0.790030f, 0.794205f, 0.798503f, 0.802893f,
+	0.807347f, 0.811840f, 0.816347f, 0.820842f, 0.825290f, 0.829638f, 0.833766f, 0.837058f,
+	0.991918f, 0.896055f, 0.847789f, 0.816510f, 0.794682f, 0.778989f, 0.767613f, 0.759434f,
+	0.753705f, 0.749903f, 0.747645f, 0.746642f, 0.746672f, 0.747558f, 0.749160f, 0.751361f,
+	0.754068f, 0.757200f, 0.760691f, 0.764485f, 0.768533f, 0.772793f, 0.777227f, 0.781805f,
+	0.786497f, 0.791274f, 0.796111f, 0.800978f, 0.805837f, 0.810629f, 0.815222f, 0.818934f,
+	0.991368f, 0.889446f, 0.838161f, 0.804793f, 0.781351f, 0.764335f, 0.751836f, 0.742681f,
+	0.736096f, 0.731536f, 0.728607f, 0.727012f, 0.726522f, 0.726957f, 0.728174f, 0.730054f,
+	0.732502f, 0.735437f, 0.738791f, 0.742508f, 0.746537f, 0.750836f, 0.755367f, 0.760098f,
+	0.764999f, 0.770040f, 0.775194f, 0.780429f, 0.785707f, 0.790962f, 0.796051f, 0.800223f,
+	0.990806f, 0.882792f, 0.828517f, 0.793098f, 0.768074f, 0.749760f, 0.736155f, 0.726037f,
+	0.718598f, 0.713277f, 0.709666f, 0.707460f, 0.706426f, 0.706379f, 0.707175f, 0.708693f,
+	0.710838f, 0.713527f, 0.716694f, 0.720282f, 0.724240f, 0.728528f, 0.733107f, 0.737946f,
+	0.743015f, 0.748284f, 0.753728f, 0.759313f, 0.765000f, 0.770722f, 0.776323f, 0.780981f,
+	0.990233f, 0.876109f, 0.818894f, 0.781473f, 0.754911f, 0.735337f, 0.720656f, 0.709596f,
+	0.701319f, 0.695244f, 0.690952f, 0.688129f, 0.686537f, 0.685988f, 0.686336f, 0.687460f,
+	0.689263f, 0.691664f, 0.694597f, 0.698005f, 0.701840f, 0.706062f, 0.710636f, 0.715529f,
+	0.720714f, 0.726165f, 0.731856f, 0.737757f, 0.743828f, 0.750000f, 0.756109f, 0.761263f,
+	0.994181f, 0.999998f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.893231f, 0.999495f, 0.999884f, 0.999962f, 0.999979f, 0.999984f, 0.999987f, 0.999989f,
+	0.999991f, 0.999999f, 0.999999f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.954814f, 0.991355f, 0.998226f, 0.999301f, 0.999635f, 0.999807f, 0.999874f, 0.999910f,
+	0.999932f, 0.999949f, 0.999959f, 0.999973f, 0.999977f, 0.999985f, 0.999987f, 0.999988f,
+	0.999989f, 0.999991f, 0.999991f, 0.999992f, 0.999993f, 0.999994f, 0.999994f, 0.999995f,
+	0.999995f, 0.999995f, 0.999996f, 0.999996f, 0.999998f, 1.000000f, 1.000000f, 0.999997f,
+	0.978900f, 0.960434f, 0.990210f, 0.996200f, 0.998129f, 0.998907f, 0.999304f, 0.999525f,
+	0.999661f, 0.999735f, 0.999787f, 0.999840f, 0.999863f, 0.999891f, 0.999912f, 0.999920f,
+	0.999927f, 0.999932f, 0.999945f, 0.999949f, 0.999952f, 0.999955f, 0.999954f, 0.999961f,
+	0.999966f, 0.999968f, 0.999969f, 0.999971f, 0.999976f, 0.999977f, 0.999980f, 0.999981f,
+	0.988094f, 0.922796f, 0.970876f, 0.987556f, 0.993651f, 0.996333f, 0.997679f, 0.998411f,
+	0.998859f, 0.999146f, 0.999344f, 0.999477f, 0.999569f, 0.999637f, 0.999693f, 0.999740f,
+	0.999771f, 0.999798f, 0.999818f, 0.999840f, 0.999852f, 0.999866f, 0.999878f, 0.999884f,
+	0.999897f, 0.999903f, 0.999905f, 0.999909f, 0.999916f, 0.999927f, 0.999933f, 0.999931f,
+	0.992413f, 0.906888f, 0.945320f, 0.971847f, 0.984540f, 0.990760f, 0.994052f, 0.995934f,
+	0.997083f, 0.997813f, 0.998320f, 0.998666f, 0.998902f, 0.999098f, 0.999233f, 0.999337f,
+	0.999426f, 0.999496f, 0.999553f, 0.999596f, 0.999629f, 0.999657f, 0.999688f, 0.999711f,
+	0.999735f, 0.999753f, 0.999769f, 0.999783f, 0.999800f, 0.999805f, 0.999818f, 0.999825f,
+	0.994731f, 0.910417f, 0.925658f, 0.952763f, 0.970841f, 0.981442f, 0.987636f, 0.991386f,
+	0.993758f, 0.995310f, 0.996370f, 0.997108f, 0.997649f, 0.998047f, 0.998350f, 0.998584f,
+	0.998773f, 0.998916f, 0.999033f, 0.999130f, 0.999215f, 0.999286f, 0.999345f, 0.999393f,
+	0.999432f, 0.999470f, 0.999508f, 0.999544f, 0.999568f, 0.999590f, 0.999609f, 0.999625f,
+	0.996073f, 0.921605f, 0.917124f, 0.936570f, 0.955528f, 0.969213f, 0.978362f, 0.984396f,
+	0.988432f, 0.991190f, 0.993115f, 0.994494f, 0.995502f, 0.996258f, 0.996844f, 0.997294f,
+	0.997643f, 0.997921f, 0.998159f, 0.998350f, 0.998510f, 0.998637f, 0.998754f, 0.998847f,
+	0.998929f, 0.999005f, 0.999070f, 0.999129f, 0.999178f, 0.999214f, 0.999252f, 0.999285f,
+	0.996876f, 0.933492f, 0.917416f, 0.926761f, 0.942294f, 0.956402f, 0.967335f, 0.975339f,
+	0.981106f, 0.985266f, 0.988291f, 0.990529f, 0.992203f, 0.993478f, 0.994463f, 0.995242f,
+	0.995860f, 0.996357f, 0.996760f, 0.997095f, 0.997373f, 0.997607f, 0.997807f, 0.997983f,
+	0.998132f, 0.998258f, 0.998369f, 0.998465f, 0.998549f, 0.998627f, 0.998696f, 0.998747f,
+	0.997356f, 0.943500f, 0.922269f, 0.923061f, 0.933189f, 0.945292f, 0.956282f, 0.965282f,
+	0.972336f, 0.977764f, 0.981921f, 0.985113f, 0.987581f, 0.989509f, 0.991028f, 0.992237f,
+	0.993216f, 0.994011f, 0.994664f, 0.995209f, 0.995664f, 0.996050f, 0.996376f, 0.996662f,
+	0.996909f, 0.997122f, 0.997303f, 0.997468f, 0.997613f, 0.997740f, 0.997849f, 0.997933f,
+	0.997625f, 0.951073f, 0.928423f, 0.923400f, 0.928204f, 0.937032f, 0.946618f, 0.955456f,
+	0.963024f, 0.969268f, 0.974327f, 0.978391f, 0.981654f, 0.984283f, 0.986409f, 0.988140f,
+	0.989561f, 0.990729f, 0.991708f, 0.992530f, 0.993224f, 0.993814f, 0.994319f, 0.994757f,
+	0.995139f, 0.995471f, 0.995762f, 0.996021f, 0.996246f, 0.996445f, 0.996618f, 0.996752f,
+	0.997748f, 0.956347f, 0.934044f, 0.925608f, 0.926152f, 0.931546f, 0.938953f, 0.946721f,
+	0.954009f, 0.960471f, 0.966022f, 0.970709f, 0.974628f, 0.977896f, 0.980617f, 0.982889f,
+	0.984795f, 0.986399f, 0.987754f, 0.988908f, 0.989899f, 0.990747f, 0.991483f, 0.992121f,
+	0.992680f, 0.993173f, 0.993608f, 0.993992f, 0.994332f, 0.994633f, 0.994893f, 0.995094f,
+	0.997763f, 0.959659f, 0.938277f, 0.928064f, 0.925615f, 0.928040f, 0.933118f, 0.939339f,
+	0.945774f, 0.951913f, 0.957508f, 0.962473f, 0.966805f, 0.970553f, 0.973775f, 0.976541f,
+	0.978917f, 0.980958f, 0.982718f, 0.984242f, 0.985563f, 0.986715f, 0.987722f, 0.988608f,
+	0.989391f, 0.990081f, 0.990697f, 0.991243f, 0.991729f, 0.992163f, 0.992539f, 0.992833f,
+	0.997695f, 0.961320f, 0.940835f, 0.929775f, 0.925373f, 0.925511f, 0.928500f, 0.933075f,
+	0.938368f, 0.943817f, 0.949089f, 0.954002f, 0.958479f, 0.962494f, 0.966060f, 0.969213f,
+	0.971988f, 0.974431f, 0.976581f, 0.978471f, 0.980140f, 0.981618f, 0.982926f, 0.984091f,
+	0.985129f, 0.986057f, 0.986887f, 0.987632f, 0.988300f, 0.988898f, 0.989420f, 0.989830f,
+	0.997562f, 0.961607f, 0.941687f, 0.930212f, 0.924569f, 0.923055f, 0.924347f, 0.927422f,
+	0.931521f, 0.936109f, 0.940826f, 0.945443f, 0.949825f, 0.953899f, 0.957639f, 0.961038f,
+	0.964109f, 0.966876f, 0.969361f, 0.971592f, 0.973595f, 0.975394f, 0.977013f, 0.978471f,
+	0.979786f, 0.980975f, 0.982051f, 0.983023f, 0.983903f, 0.984693f, 0.985391f, 0.985943f,
+	0.997373f, 0.960746f, 0.940941f, 0.929150f, 0.922676f, 0.919987f, 0.919974f, 0.921795f,
+	0.924802f, 0.928511f, 0.932574f, 0.936749f, 0.940874f, 0.944846f, 0.948601f, 0.952112f,
+	0.955365f, 0.958360f, 0.961108f, 0.963624f, 0.965920f, 0.968019f, 0.969933f, 0.971682f,
+	0.973280f, 0.974741f, 0.976076f, 0.977295f, 0.978409f, 0.979419f, 0.980317f, 0.981031f,
+	0.997138f, 0.958912f, 0.938743f, 0.926545f, 0.919419f, 0.915855f, 0.914849f, 0.915665f,
+	0.917740f, 0.920646f, 0.924058f, 0.927742f, 0.931524f, 0.935287f, 0.938949f, 0.942460f,
+	0.945791f, 0.948925f, 0.951857f, 0.954590f, 0.957129f, 0.959485f, 0.961668f, 0.963688f,
+	0.965558f, 0.967286f, 0.968885f, 0.970360f, 0.971719f, 0.972961f, 0.974077f, 0.974968f,
+	0.996863f, 0.956253f, 0.935252f, 0.922456f, 0.914698f, 0.910410f, 0.908613f, 0.908625f,
+	0.909930f, 0.912142f, 0.914963f, 0.918166f, 0.921583f, 0.925088f, 0.928593f, 0.932034f,
+	0.935367f, 0.938565f, 0.941614f, 0.944504f, 0.947231f, 0.949799f, 0.952211f, 0.954472f,
+	0.956591f, 0.958573f, 0.960425f, 0.962152f, 0.963757f, 0.965238f, 0.966578f, 0.967653f,
+	0.996558f, 0.952890f, 0.930626f, 0.916996f, 0.908527f, 0.903552f, 0.901070f, 0.900404f,
+	0.901066f, 0.902690f, 0.904994f, 0.907762f, 0.910831f, 0.914074f, 0.917396f, 0.920729f,
+	0.924021f, 0.927236f, 0.930350f, 0.933347f, 0.936217f, 0.938954f, 0.941559f, 0.944030f,
+	0.946371f, 0.948584f, 0.950673f, 0.952640f, 0.954485f, 0.956200f, 0.957763f, 0.959019f,
+	0.996211f, 0.948925f, 0.925014f, 0.910303f, 0.900993f, 0.895291f, 0.892146f, 0.890867f,
+	0.890963f, 0.892073f, 0.893926f, 0.896310f, 0.899063f, 0.902060f, 0.905203f, 0.908417f,
+	0.911650f, 0.914857f, 0.918008f, 0.921080f, 0.924061f, 0.926937f, 0.929704f, 0.932357f,
+	0.934896f, 0.937320f, 0.939627f, 0.941819f, 0.943890f, 0.945831f, 0.947611f, 0.949040f,
+	0.995840f, 0.944443f, 0.918553f, 0.902528f, 0.892224f, 0.885711f, 0.881872f, 0.879982f,
+	0.879540f, 0.880178f, 0.881621f, 0.883659f, 0.886126f, 0.888899f, 0.891875f, 0.894978f,
+	0.898149f, 0.901340f, 0.904516f, 0.907650f, 0.910723f, 0.913721f, 0.916632f, 0.919451f,
+	0.922170f, 0.924787f, 0.927300f, 0.929703f, 0.931991f, 0.934149f, 0.936137f, 0.937730f,
+	0.995443f, 0.939523f, 0.911371f, 0.893820f, 0.882368f, 0.874939f, 0.870340f, 0.867808f,
+	0.866816f, 0.866984f, 0.868030f, 0.869737f, 0.871937f, 0.874500f, 0.877321f, 0.880321f,
+	0.883435f, 0.886611f, 0.889811f, 0.893004f, 0.896167f, 0.899279f, 0.902328f, 0.905304f,
+	0.908198f, 0.911004f, 0.913714f, 0.916325f, 0.918825f, 0.921195f, 0.923389f, 0.925139f,
+	0.995023f, 0.934232f, 0.903587f, 0.884328f, 0.871588f, 0.863132f, 0.857692f, 0.854458f,
+	0.852877f, 0.852551f, 0.853185f, 0.854555f, 0.856484f, 0.858839f, 0.861508f, 0.864407f,
+	0.867466f, 0.870631f, 0.873858f, 0.877111f, 0.880365f, 0.883595f, 0.886785f, 0.889922f,
+	0.892993f, 0.895990f, 0.898904f, 0.901726f, 0.904443f, 0.907032f, 0.909437f, 0.911347f,
+	0.994582f, 0.928629f, 0.895304f, 0.874191f, 0.860039f, 0.850456f, 0.844091f, 0.840087f,
+	0.837862f, 0.836998f, 0.837186f, 0.838191f, 0.839830f, 0.841959f, 0.844464f, 0.847253f,
+	0.850253f, 0.853403f, 0.856656f, 0.859972f, 0.863320f, 0.866673f, 0.870011f, 0.873318f,
+	0.876577f, 0.879778f, 0.882909f, 0.885958f, 0.888909f, 0.891734f, 0.894368f, 0.896453f,
+	0.994123f, 0.922772f, 0.886621f, 0.863540f, 0.847878f, 0.837080f, 0.829713f, 0.824871f,
+	0.821941f, 0.820485f, 0.820180f, 0.820779f, 0.822091f, 0.823964f, 0.826279f, 0.828937f,
+	0.831860f, 0.834983f, 0.838253f, 0.841627f, 0.845069f, 0.848548f, 0.852042f, 0.855528f,
+	0.858990f, 0.862413f, 0.865781f, 0.869081f, 0.872291f, 0.875381f, 0.878275f, 0.880565f,
+	0.993644f, 0.916701f, 0.877623f, 0.852489f, 0.835245f, 0.823166f, 0.814732f, 0.808991f,
+	0.805299f, 0.803196f, 0.802346f, 0.802490f, 0.803430f, 0.805006f, 0.807093f, 0.809587f,
+	0.812405f, 0.815476f, 0.818745f, 0.822162f, 0.825689f, 0.829292f, 0.832943f, 0.836617f,
+	0.840294f, 0.843956f, 0.847585f, 0.851163f, 0.854667f, 0.858058f, 0.861253f, 0.863789f,
+	0.993149f, 0.910463f, 0.868386f, 0.841148f, 0.822272f, 0.808864f, 0.799317f, 0.792629f,
+	0.788124f, 0.785324f, 0.783878f, 0.783518f, 0.784036f, 0.785268f, 0.787082f, 0.789370f,
+	0.792044f, 0.795030f, 0.798267f, 0.801704f, 0.805298f, 0.809011f, 0.812813f, 0.816675f,
+	0.820575f, 0.824490f, 0.828401f, 0.832285f, 0.836116f, 0.839851f, 0.843394f, 0.846227f,
+	0.992639f, 0.904090f, 0.858975f, 0.829606f, 0.809073f, 0.794310f, 0.783620f, 0.775950f,
+	0.770595f, 0.767059f, 0.764974f, 0.764063f, 0.764113f, 0.764952f, 0.766445f, 0.768480f,
+	0.770965f, 0.773824f, 0.776992f, 0.780414f, 0.784046f, 0.787847f, 0.791783f, 0.795824f,
+	0.799944f, 0.804119f, 0.808324f, 0.812537f, 0.816726f, 0.820844f, 0.824784f, 0.827970f,
+	0.992115f, 0.897615f, 0.849449f, 0.817944f, 0.795751f, 0.779624f, 0.767778f, 0.759109f,
+	0.752881f, 0.748578f, 0.745820f, 0.744321f, 0.743861f, 0.744264f, 0.745391f, 0.747125f,
+	0.749375f, 0.752059f, 0.755113f, 0.758480f, 0.762112f, 0.765968f, 0.770011f, 0.774210f,
+	0.778536f, 0.782964f, 0.787468f, 0.792022f, 0.796592f, 0.801126f, 0.805507f, 0.809097f,
+	0.991578f, 0.891065f, 0.839856f, 0.806231f, 0.782392f, 0.764910f, 0.751911f, 0.742240f,
+	0.735129f, 0.730044f, 0.726591f, 0.724477f, 0.723475f, 0.723404f, 0.724123f, 0.725514f,
+	0.727481f, 0.729945f, 0.732838f, 0.736103f, 0.739691f, 0.743560f, 0.747673f, 0.751998f,
+	0.756505f, 0.761168f, 0.765961f, 0.770855f, 0.775815f, 0.780786f, 0.785640f, 0.789678f,
+	0.991028f, 0.884462f, 0.830236f, 0.794525f, 0.769069f, 0.750256f, 0.736121f, 0.725458f,
+	0.717469f, 0.711599f, 0.707442f, 0.704696f, 0.703129f, 0.702557f, 0.702836f, 0.703845f,
+	0.705490f, 0.707689f, 0.710374f, 0.713489f, 0.716985f, 0.720820f, 0.724958f, 0.729367f,
+	0.734018f, 0.738884f, 0.743941f, 0.749159f, 0.754504f, 0.759917f, 0.765263f, 0.769777f,
+	0.990466f, 0.877825f, 0.820625f, 0.782872f, 0.755841f, 0.735735f, 0.720494f, 0.708862f,
+	0.700010f, 0.693364f, 0.688505f, 0.685123f, 0.682980f, 0.681890f, 0.681704f, 0.682303f,
+	0.683590f, 0.685484f, 0.687919f, 0.690838f, 0.694193f, 0.697945f, 0.702057f, 0.706500f,
+	0.711248f, 0.716274f, 0.721556f, 0.727067f, 0.732774f, 0.738616f, 0.744452f, 0.749455f,
+	0.994181f, 0.999998f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.893248f, 0.999497f, 0.999885f, 0.999963f, 0.999980f, 0.999984f, 0.999987f, 0.999989f,
+	0.999991f, 0.999999f, 0.999999f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.954833f, 0.991385f, 0.998235f, 0.999305f, 0.999637f, 0.999808f, 0.999874f, 0.999911f,
+	0.999932f, 0.999949f, 0.999959f, 0.999973f, 0.999977f, 0.999985f, 0.999987f, 0.999988f,
+	0.999989f, 0.999990f, 0.999991f, 0.999992f, 0.999993f, 0.999993f, 0.999994f, 0.999994f,
+	0.999995f, 0.999995f, 0.999995f, 0.999996f, 0.999998f, 1.000000f, 1.000000f, 0.999996f,
+	0.978918f, 0.960571f, 0.990264f, 0.996224f, 0.998140f, 0.998913f, 0.999307f, 0.999526f,
+	0.999660f, 0.999734f, 0.999786f, 0.999839f, 0.999861f, 0.999890f, 0.999911f, 0.999918f,
+	0.999925f, 0.999931f, 0.999944f, 0.999948f, 0.999951f, 0.999953f, 0.999953f, 0.999960f,
+	0.999965f, 0.999967f, 0.999968f, 0.999969f, 0.999974f, 0.999975f, 0.999979f, 0.999980f,
+	0.988111f, 0.923067f, 0.971034f, 0.987634f, 0.993689f, 0.996352f, 0.997688f, 0.998413f,
+	0.998858f, 0.999143f, 0.999340f, 0.999472f, 0.999565f, 0.999632f, 0.999688f, 0.999735f,
+	0.999766f, 0.999794f, 0.999813f, 0.999835f, 0.999847f, 0.999861f, 0.999874f, 0.999879f,
+	0.999893f, 0.999899f, 0.999901f, 0.999905f, 0.999912f, 0.999924f, 0.999930f, 0.999927f,
+	0.992429f, 0.907228f, 0.945616f, 0.972023f, 0.984635f, 0.990808f, 0.994075f, 0.995941f,
+	0.997081f, 0.997807f, 0.998311f, 0.998655f, 0.998890f, 0.999086f, 0.999221f, 0.999325f,
+	0.999413f, 0.999484f, 0.999541f, 0.999584f, 0.999618f, 0.999646f, 0.999677f, 0.999700f,
+	0.999724f, 0.999743f, 0.999759f, 0.999773f, 0.999791f, 0.999796f, 0.999808f, 0.999815f,
+	0.994748f, 0.910764f, 0.926058f, 0.953055f, 0.971020f, 0.981540f, 0.987684f, 0.991403f,
+	0.993756f, 0.995297f, 0.996350f, 0.997084f, 0.997623f, 0.998019f, 0.998323f, 0.998557f,
+	0.998746f, 0.998889f, 0.999007f, 0.999104f, 0.999191f, 0.999262f, 0.999321f, 0.999370f,
+	0.999409f, 0.999448f, 0.999486f, 0.999523f, 0.999547f, 0.999570f, 0.999589f, 0.999605f,
+	0.996090f, 0.921930f, 0.917567f, 0.936953f, 0.955795f, 0.969374f, 0.978445f, 0.984427f,
+	0.988429f, 0.991165f, 0.993077f, 0.994448f, 0.995451f, 0.996206f, 0.996791f, 0.997241f,
+	0.997591f, 0.997870f, 0.998109f, 0.998301f, 0.998462f, 0.998591f, 0.998709f, 0.998803f,
+	0.998885f, 0.998962f, 0.999029f, 0.999088f, 0.999138f, 0.999175f, 0.999213f, 0.999248f,
+	0.996894f, 0.933790f, 0.917855f, 0.927188f, 0.942625f, 0.956620f, 0.967455f, 0.975385f,
+	0.981100f, 0.985224f, 0.988227f, 0.990450f, 0.992116f, 0.993386f, 0.994370f, 0.995148f,
+	0.995768f, 0.996267f, 0.996672f, 0.997008f, 0.997288f, 0.997525f, 0.997726f, 0.997904f,
+	0.998055f, 0.998183f, 0.998295f, 0.998392f, 0.998478f, 0.998557f, 0.998627f, 0.998680f,
+	0.997376f, 0.943777f, 0.922681f, 0.923491f, 0.933550f, 0.945547f, 0.956431f, 0.965339f,
+	0.972322f, 0.977698f, 0.981820f, 0.984989f, 0.987441f, 0.989362f, 0.990876f, 0.992084f,
+	0.993063f, 0.993860f, 0.994516f, 0.995065f, 0.995523f, 0.995912f, 0.996241f, 0.996531f,
+	0.996781f, 0.996996f, 0.997179f, 0.997347f, 0.997495f, 0.997623f, 0.997735f, 0.997822f,
+	0.997649f, 0.951339f, 0.928803f, 0.923807f, 0.928563f, 0.937298f, 0.946776f, 0.955513f,
+	0.962995f, 0.969171f, 0.974179f, 0.978207f, 0.981446f, 0.984060f, 0.986177f, 0.987904f,
+	0.989324f, 0.990494f, 0.991476f, 0.992303f, 0.993001f, 0.993595f, 0.994106f, 0.994548f,
+	0.994935f, 0.995271f, 0.995565f, 0.995828f, 0.996057f, 0.996260f, 0.996437f, 0.996576f,
+	0.997776f, 0.956615f, 0.934401f, 0.925985f, 0.926489f, 0.931800f, 0.939102f, 0.946763f,
+	0.953953f, 0.960333f, 0.965817f, 0.970454f, 0.974337f, 0.977579f, 0.980284f, 0.982547f,
+	0.984449f, 0.986052f, 0.987409f, 0.988567f, 0.989563f, 0.990417f, 0.991159f, 0.991804f,
+	0.992369f, 0.992867f, 0.993309f, 0.993698f, 0.994044f, 0.994351f, 0.994617f, 0.994825f,
+	0.997795f, 0.959943f, 0.938627f, 0.928418f, 0.925925f, 0.928269f, 0.933244f, 0.939353f,
+	0.945681f, 0.951723f, 0.957237f, 0.962136f, 0.966416f, 0.970127f, 0.973322f, 0.976069f,
+	0.978434f, 0.980470f, 0.982229f, 0.983755f, 0.985080f, 0.986237f, 0.987252f, 0.988145f,
+	0.988936f, 0.989634f, 0.990257f, 0.990811f, 0.991305f, 0.991747f, 0.992132f, 0.992436f,
+	0.997733f, 0.961633f, 0.941194f, 0.930118f, 0.925661f, 0.925712f, 0.928595f, 0.933053f,
+	0.938229f, 0.943569f, 0.948745f, 0.953575f, 0.957983f, 0.961944f, 0.965469f, 0.968591f,
+	0.971345f, 0.973774f, 0.975916f, 0.977803f, 0.979473f, 0.980955f, 0.982268f, 0.983440f,
+	0.984486f, 0.985424f, 0.986262f, 0.987018f, 0.987696f, 0.988304f, 0.988839f, 0.989263f,
+	0.997605f, 0.961961f, 0.942076f, 0.930565f, 0.924848f, 0.923235f, 0.924411f, 0.927360f,
+	0.931333f, 0.935799f, 0.940403f, 0.944919f, 0.949215f, 0.953216f, 0.956896f, 0.960249f,
+	0.963284f, 0.966024f, 0.968491f, 0.970711f, 0.972708f, 0.974504f, 0.976125f, 0.977587f,
+	0.978909f, 0.980107f, 0.981191f, 0.982174f, 0.983066f, 0.983869f, 0.984583f, 0.985153f,
+	0.997423f, 0.961151f, 0.941376f, 0.929530f, 0.922964f, 0.920158f, 0.920015f, 0.921697f,
+	0.924563f, 0.928135f, 0.932068f, 0.936124f, 0.940143f, 0.944021f, 0.947697f, 0.951141f,
+	0.954340f, 0.957292f, 0.960007f, 0.962498f, 0.964777f, 0.966864f, 0.968773f, 0.970520f,
+	0.972120f, 0.973585f, 0.974928f, 0.976157f, 0.977282f, 0.978306f, 0.979222f, 0.979959f,
+	0.997196f, 0.959378f, 0.939240f, 0.926973f, 0.919734f, 0.916033f, 0.914878f, 0.915538f,
+	0.917455f, 0.920205f, 0.923469f, 0.927013f, 0.930667f, 0.934314f, 0.937875f, 0.941298f,
+	0.944552f, 0.947622f, 0.950502f, 0.953193f, 0.955699f, 0.958029f, 0.960194f, 0.962202f,
+	0.964065f, 0.965791f, 0.967392f, 0.968872f, 0.970241f, 0.971496f, 0.972630f, 0.973547f,
+	0.996928f, 0.956789f, 0.935823f, 0.922946f, 0.915056f, 0.910611f, 0.908643f, 0.908477f,
+	0.909604f, 0.911640f, 0.914290f, 0.917332f, 0.920598f, 0.923963f, 0.927342f, 0.930669f,
+	0.933902f, 0.937013f, 0.939986f, 0.942812f, 0.945486f, 0.948009f, 0.950386f, 0.952620f,
+	0.954719f, 0.956687f, 0.958532f, 0.960257f, 0.961865f, 0.963355f, 0.964711f, 0.965814f,
+	0.996632f, 0.953501f, 0.931282f, 0.917562f, 0.908943f, 0.903789f, 0.901113f, 0.900247f,
+	0.900707f, 0.902131f, 0.904240f, 0.906822f, 0.909715f, 0.912792f, 0.915962f, 0.919154f,
+	0.922319f, 0.925420f, 0.928432f, 0.931339f, 0.934132f, 0.936802f, 0.939350f, 0.941774f,
+	0.944077f, 0.946260f, 0.948327f, 0.950279f, 0.952117f, 0.953834f, 0.955407f, 0.956690f,
+	0.996293f, 0.949616f, 0.925761f, 0.910952f, 0.901476f, 0.895575f, 0.892213f, 0.890707f,
+	0.890576f, 0.891461f, 0.893093f, 0.895265f, 0.897813f, 0.900617f, 0.903579f, 0.906624f,
+	0.909700f, 0.912764f, 0.915784f, 0.918739f, 0.921614f, 0.924397f, 0.927081f, 0.929664f,
+	0.932142f, 0.934514f, 0.936781f, 0.938941f, 0.940990f, 0.942920f, 0.944700f, 0.946152f,
+	0.995931f, 0.945215f, 0.919394f, 0.903265f, 0.892780f, 0.886046f, 0.881966f, 0.879825f,
+	0.879129f, 0.879515f, 0.880710f, 0.882506f, 0.884741f, 0.887291f, 0.890056f, 0.892959f,
+	0.895943f, 0.898959f, 0.901974f, 0.904960f, 0.907897f, 0.910771f, 0.913571f, 0.916291f,
+	0.918923f, 0.921464f, 0.923912f, 0.926262f, 0.928508f, 0.930637f, 0.932612f, 0.934219f,
+	0.995544f, 0.940377f, 0.912307f, 0.894645f, 0.882997f, 0.875327f, 0.870464f, 0.867654f,
+	0.866381f, 0.866269f, 0.867038f, 0.868474f, 0.870412f, 0.872721f, 0.875300f, 0.878069f,
+	0.880964f, 0.883933f, 0.886939f, 0.889951f, 0.892945f, 0.895902f, 0.898809f, 0.901655f,
+	0.904432f, 0.907132f, 0.909751f, 0.912282f, 0.914716f, 0.917036f, 0.919199f, 0.920951f,
+	0.995133f, 0.935167f, 0.904614f, 0.885239f, 0.872286f, 0.863569f, 0.857841f, 0.854304f,
+	0.852414f, 0.851779f, 0.852108f, 0.853177f, 0.854813f, 0.856884f, 0.859279f, 0.861914f,
+	0.864721f, 0.867647f, 0.870646f, 0.873685f, 0.876736f, 0.879778f, 0.882792f, 0.885766f,
+	0.888687f, 0.891548f, 0.894339f, 0.897052f, 0.899677f, 0.902190f, 0.904543f, 0.906439f,
+	0.994702f, 0.929644f, 0.896419f, 0.875180f, 0.860799f, 0.850934f, 0.844256f, 0.839924f,
+	0.837364f, 0.836163f, 0.836016f, 0.836691f, 0.838006f, 0.839820f, 0.842019f, 0.844512f,
+	0.847228f, 0.850105f, 0.853097f, 0.856164f, 0.859275f, 0.862405f, 0.865533f, 0.868643f,
+	0.871718f, 0.874750f, 0.877726f, 0.880635f, 0.883462f, 0.886185f, 0.888742f, 0.890796f,
+	0.994253f, 0.923863f, 0.887815f, 0.864597f, 0.848689f, 0.837587f, 0.829883f, 0.824688f,
+	0.821396f, 0.819575f, 0.818907f, 0.819146f, 0.820105f, 0.821632f, 0.823610f, 0.825941f,
+	0.828547f, 0.831365f, 0.834340f, 0.837432f, 0.840603f, 0.843825f, 0.847073f, 0.850328f,
+	0.853572f, 0.856791f, 0.859971f, 0.863098f, 0.866154f, 0.869112f, 0.871903f, 0.874142f,
+	0.993784f, 0.917865f, 0.878889f, 0.853603f, 0.836092f, 0.823686f, 0.814892f, 0.808773f,
+	0.804692f, 0.802198f, 0.800957f, 0.800714f, 0.801271f, 0.802473f, 0.804192f, 0.806329f,
+	0.808798f, 0.811532f, 0.814474f, 0.817576f, 0.820800f, 0.824111f, 0.827483f, 0.830892f,
+	0.834317f, 0.837741f, 0.841148f, 0.844521f, 0.847838f, 0.851068f, 0.854133f, 0.856600f,
+	0.993299f, 0.911694f, 0.869714f, 0.842306f, 0.823141f, 0.809382f, 0.799449f, 0.792357f,
+	0.787438f, 0.784221f, 0.782358f, 0.781584f, 0.781693f, 0.782523f, 0.783942f, 0.785843f,
+	0.788139f, 0.790758f, 0.793638f, 0.796728f, 0.799987f, 0.803377f, 0.806867f, 0.810431f,
+	0.814046f, 0.817691f, 0.821346f, 0.824992f, 0.828606f, 0.832149f, 0.835536f, 0.838283f,
+	0.992800f, 0.905383f, 0.860355f, 0.830794f, 0.809948f, 0.794807f, 0.783706f, 0.775607f,
+	0.769813f, 0.765834f, 0.763307f, 0.761957f, 0.761573f, 0.761984f, 0.763056f, 0.764678f,
+	0.766759f, 0.769222f, 0.772005f, 0.775052f, 0.778319f, 0.781767f, 0.785361f, 0.789073f,
+	0.792877f, 0.796749f, 0.800669f, 0.804613f, 0.808554f, 0.812452f, 0.816211f, 0.819293f,
+	0.992286f, 0.898964f, 0.850870f, 0.819149f, 0.796614f, 0.780083f, 0.767799f, 0.758675f,
+	0.751984f, 0.747214f, 0.743991f, 0.742030f, 0.741112f, 0.741064f, 0.741746f, 0.743044f,
+	0.744865f, 0.747129f, 0.749773f, 0.752739f, 0.755979f, 0.759454f, 0.763128f, 0.766969f,
+	0.770951f, 0.775047f, 0.779236f, 0.783492f, 0.787786f, 0.792074f, 0.796249f, 0.799721f,
+	0.991759f, 0.892465f, 0.841307f, 0.807437f, 0.783227f, 0.765312f, 0.751848f, 0.741696f,
+	0.734098f, 0.728524f, 0.724584f, 0.721986f, 0.720505f, 0.719963f, 0.720216f, 0.721150f,
+	0.722668f, 0.724690f, 0.727150f, 0.729991f, 0.733165f, 0.736629f, 0.740348f, 0.744290f,
+	0.748426f, 0.752732f, 0.757183f, 0.761753f, 0.766412f, 0.771111f, 0.775739f, 0.779646f,
+	0.991220f, 0.885908f, 0.831708f, 0.795718f, 0.769859f, 0.750584f, 0.735957f, 0.724788f,
+	0.716288f, 0.709906f, 0.705242f, 0.701993f, 0.699929f, 0.698867f, 0.698662f, 0.699196f,
+	0.700373f, 0.702113f, 0.704346f, 0.707019f, 0.710081f, 0.713491f, 0.717214f, 0.721218f,
+	0.725476f, 0.729963f, 0.734654f, 0.739525f, 0.744545f, 0.749665f, 0.754765f, 0.759139f,
+	0.990669f, 0.879310f, 0.822106f, 0.784040f, 0.756572f, 0.735972f, 0.720211f, 0.708047f,
+	0.698662f, 0.691484f, 0.686099f, 0.682196f, 0.679540f, 0.677944f, 0.677260f, 0.677369f,
+	0.678174f, 0.679594f, 0.681563f, 0.684024f, 0.686929f, 0.690240f, 0.693920f, 0.697942f,
+	0.702277f, 0.706904f, 0.711801f, 0.716945f, 0.722307f, 0.727837f, 0.733411f, 0.738266f,
+	0.994182f, 0.999998f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.893267f, 0.999498f, 0.999885f, 0.999963f, 0.999980f, 0.999985f, 0.999987f, 0.999990f,
+	0.999991f, 0.999999f, 0.999999f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.954852f, 0.991416f, 0.998245f, 0.999310f, 0.999640f, 0.999810f, 0.999875f, 0.999911f,
+	0.999932f, 0.999949f, 0.999958f, 0.999973f, 0.999976f, 0.999985f, 0.999986f, 0.999988f,
+	0.999989f, 0.999990f, 0.999991f, 0.999992f, 0.999993f, 0.999993f, 0.999994f, 0.999994f,
+	0.999995f, 0.999995f, 0.999995f, 0.999995f, 0.999998f, 1.000000f, 1.000000f, 0.999996f,
+	0.978936f, 0.960711f, 0.990318f, 0.996248f, 0.998152f, 0.998918f, 0.999310f, 0.999527f,
+	0.999660f, 0.999733f, 0.999785f, 0.999838f, 0.999860f, 0.999888f, 0.999909f, 0.999917f,
+	0.999924f, 0.999929f, 0.999943f, 0.999947f, 0.999950f, 0.999952f, 0.999951f, 0.999959f,
+	0.999964f, 0.999965f, 0.999967f, 0.999968f, 0.999973f, 0.999974f, 0.999978f, 0.999979f,
+	0.988128f, 0.923345f, 0.971196f, 0.987713f, 0.993729f, 0.996371f, 0.997696f, 0.998416f,
+	0.998858f, 0.999141f, 0.999336f, 0.999468f, 0.999560f, 0.999627f, 0.999683f, 0.999731f,
+	0.999762f, 0.999789f, 0.999808f, 0.999831f, 0.999843f, 0.999857f, 0.999870f, 0.999875f,
+	0.999889f, 0.999895f, 0.999897f, 0.999900f, 0.999908f, 0.999920f, 0.999926f, 0.999924f,
+	0.992445f, 0.907577f, 0.945920f, 0.972203f, 0.984732f, 0.990859f, 0.994098f, 0.995949f,
+	0.997080f, 0.997801f, 0.998301f, 0.998644f, 0.998878f, 0.999074f, 0.999208f, 0.999312f,
+	0.999401f, 0.999472f, 0.999530f, 0.999573f, 0.999606f, 0.999634f, 0.999666f, 0.999689f,
+	0.999714f, 0.999733f, 0.999749f, 0.999763f, 0.999782f, 0.999786f, 0.999799f, 0.999806f,
+	0.994764f, 0.911120f, 0.926468f, 0.953354f, 0.971203f, 0.981642f, 0.987734f, 0.991421f,
+	0.993755f, 0.995284f, 0.996330f, 0.997060f, 0.997597f, 0.997993f, 0.998296f, 0.998530f,
+	0.998720f, 0.998863f, 0.998981f, 0.999079f, 0.999167f, 0.999238f, 0.999298f, 0.999347f,
+	0.999386f, 0.999426f, 0.999465f, 0.999502f, 0.999527f, 0.999550f, 0.999569f, 0.999586f,
+	0.996107f, 0.922263f, 0.918021f, 0.937345f, 0.956068f, 0.969540f, 0.978532f, 0.984460f,
+	0.988428f, 0.991142f, 0.993041f, 0.994404f, 0.995403f, 0.996155f, 0.996740f, 0.997190f,
+	0.997540f, 0.997819f, 0.998060f, 0.998253f, 0.998416f, 0.998546f, 0.998665f, 0.998760f,
+	0.998843f, 0.998921f, 0.998988f, 0.999049f, 0.999099f, 0.999136f, 0.999176f, 0.999211f,
+	0.996912f, 0.934093f, 0.918303f, 0.927625f, 0.942965f, 0.956845f, 0.967581f, 0.975435f,
+	0.981097f, 0.985186f, 0.988165f, 0.990374f, 0.992032f, 0.993297f, 0.994279f, 0.995057f,
+	0.995678f, 0.996178f, 0.996585f, 0.996923f, 0.997206f, 0.997444f, 0.997647f, 0.997828f,
+	0.997980f, 0.998110f, 0.998224f, 0.998322f, 0.998408f, 0.998489f, 0.998561f, 0.998615f,
+	0.997396f, 0.944054f, 0.923099f, 0.923929f, 0.933919f, 0.945810f, 0.956585f, 0.965402f,
+	0.972313f, 0.977638f, 0.981723f, 0.984868f, 0.987306f, 0.989218f, 0.990728f, 0.991935f,
+	0.992914f, 0.993713f, 0.994372f, 0.994923f, 0.995385f, 0.995777f, 0.996109f, 0.996402f,
+	0.996655f, 0.996873f, 0.997059f, 0.997229f, 0.997380f, 0.997510f, 0.997625f, 0.997714f,
+	0.997671f, 0.951600f, 0.929185f, 0.924221f, 0.928929f, 0.937571f, 0.946941f, 0.955576f,
+	0.962971f, 0.969079f, 0.974037f, 0.978029f, 0.981244f, 0.983843f, 0.985951f, 0.987674f,
+	0.989093f, 0.990264f, 0.991250f, 0.992080f, 0.992783f, 0.993382f, 0.993897f, 0.994344f,
+	0.994735f, 0.995076f, 0.995374f, 0.995641f, 0.995874f, 0.996081f, 0.996262f, 0.996405f,
+	0.997800f, 0.956873f, 0.934755f, 0.926364f, 0.926830f, 0.932060f, 0.939258f, 0.946812f,
+	0.953904f, 0.960201f, 0.965620f, 0.970206f, 0.974053f, 0.977270f, 0.979959f, 0.982212f,
+	0.984110f, 0.985713f, 0.987072f, 0.988234f, 0.989235f, 0.990094f, 0.990844f, 0.991494f,
+	0.992065f, 0.992570f, 0.993018f, 0.993413f, 0.993765f, 0.994077f, 0.994350f, 0.994565f,
+	0.997824f, 0.960209f, 0.938964f, 0.928766f, 0.926234f, 0.928500f, 0.933374f, 0.939373f,
+	0.945595f, 0.951542f, 0.956975f, 0.961808f, 0.966038f, 0.969710f, 0.972878f, 0.975607f,
+	0.977962f, 0.979993f, 0.981751f, 0.983279f, 0.984609f, 0.985772f, 0.986793f, 0.987694f,
+	0.988492f, 0.989198f, 0.989830f, 0.990392f, 0.990894f, 0.991345f, 0.991739f, 0.992053f,
+	0.997766f, 0.961919f, 0.941533f, 0.930449f, 0.925941f, 0.925911f, 0.928690f, 0.933034f,
+	0.938096f, 0.943329f, 0.948409f, 0.953158f, 0.957499f, 0.961406f, 0.964891f, 0.967983f,
+	0.970716f, 0.973132f, 0.975267f, 0.977152f, 0.978822f, 0.980308f, 0.981628f, 0.982806f,
+	0.983861f, 0.984808f, 0.985656f, 0.986421f, 0.987110f, 0.987730f, 0.988276f, 0.988715f,
+	0.997644f, 0.962279f, 0.942432f, 0.930893f, 0.925111f, 0.923405f, 0.924470f, 0.927298f,
+	0.931147f, 0.935494f, 0.939988f, 0.944405f, 0.948617f, 0.952547f, 0.956170f, 0.959477f,
+	0.962478f, 0.965193f, 0.967642f, 0.969851f, 0.971842f, 0.973638f, 0.975261f, 0.976728f,
+	0.978057f, 0.979263f, 0.980358f, 0.981352f, 0.982256f, 0.983072f, 0.983801f, 0.984391f,
+	0.997467f, 0.961512f, 0.941767f, 0.929875f, 0.923224f, 0.920310f, 0.920043f, 0.921593f,
+	0.924323f, 0.927762f, 0.931569f, 0.935510f, 0.939425f, 0.943213f, 0.946812f, 0.950193f,
+	0.953339f, 0.956250f, 0.958933f, 0.961401f, 0.963664f, 0.965741f, 0.967644f, 0.969390f,
+	0.970993f, 0.972464f, 0.973814f, 0.975054f, 0.976192f, 0.977231f, 0.978164f, 0.978924f,
+	0.997246f, 0.959790f, 0.939679f, 0.927350f, 0.920008f, 0.916181f, 0.914885f, 0.915397f,
+	0.917162f, 0.919764f, 0.922885f, 0.926294f, 0.929824f, 0.933361f, 0.936823f, 0.940161f,
+	0.943343f, 0.946352f, 0.949182f, 0.951832f, 0.954307f, 0.956614f, 0.958762f, 0.960759f,
+	0.962617f, 0.964342f, 0.965945f, 0.967433f, 0.968811f, 0.970081f, 0.971233f, 0.972177f,
+	0.996986f, 0.957259f, 0.936323f, 0.923372f, 0.915361f, 0.910769f, 0.908641f, 0.908308f,
+	0.909265f, 0.911133f, 0.913620f, 0.916507f, 0.919628f, 0.922859f, 0.926116f, 0.929335f,
+	0.932471f, 0.935498f, 0.938400f, 0.941165f, 0.943788f, 0.946270f, 0.948615f, 0.950824f,
+	0.952904f, 0.954861f, 0.956699f, 0.958423f, 0.960036f, 0.961536f, 0.962909f, 0.964040f,
+	0.996696f, 0.954035f, 0.931851f, 0.918047f, 0.909290f, 0.903970f, 0.901112f, 0.900057f,
+	0.900326f, 0.901561f, 0.903486f, 0.905890f, 0.908614f, 0.911533f, 0.914556f, 0.917615f,
+	0.920658f, 0.923649f, 0.926565f, 0.929387f, 0.932106f, 0.934713f, 0.937208f, 0.939588f,
+	0.941855f, 0.944011f, 0.946058f, 0.947998f, 0.949830f, 0.951549f, 0.953135f, 0.954445f,
+	0.996365f, 0.950218f, 0.926407f, 0.911506f, 0.901875f, 0.895787f, 0.892222f, 0.890505f,
+	0.890159f, 0.890832f, 0.892255f, 0.894225f, 0.896580f, 0.899200f, 0.901988f, 0.904872f,
+	0.907799f, 0.910726f, 0.913622f, 0.916465f, 0.919240f, 0.921934f, 0.924541f, 0.927057f,
+	0.929477f, 0.931803f, 0.934031f, 0.936162f, 0.938191f, 0.940112f, 0.941895f, 0.943369f,
+	0.996011f, 0.945887f, 0.920120f, 0.903891f, 0.893236f, 0.886297f, 0.881991f, 0.879615f,
+	0.878680f, 0.878828f, 0.879789f, 0.881357f, 0.883372f, 0.885711f, 0.888275f, 0.890989f,
+	0.893794f, 0.896645f, 0.899506f, 0.902350f, 0.905159f, 0.907916f, 0.910610f, 0.913237f,
+	0.915786f, 0.918256f, 0.920642f, 0.922942f, 0.925150f, 0.927253f, 0.929217f, 0.930838f,
+	0.995632f, 0.941121f, 0.913113f, 0.895345f, 0.883512f, 0.875617f, 0.870506f, 0.867437f,
+	0.865901f, 0.865525f, 0.866033f, 0.867214f, 0.868904f, 0.870974f, 0.873323f, 0.875873f,
+	0.878559f, 0.881333f, 0.884155f, 0.886995f, 0.889829f, 0.892638f, 0.895410f, 0.898133f,
+	0.900798f, 0.903399f, 0.905931f, 0.908387f, 0.910759f, 0.913033f, 0.915167f, 0.916922f,
+	0.995230f, 0.935982f, 0.905499f, 0.886010f, 0.872857f, 0.863895f, 0.857897f, 0.854078f,
+	0.851900f, 0.850975f, 0.851016f, 0.851802f, 0.853162f, 0.854964f, 0.857100f, 0.859486f,
+	0.862055f, 0.864753f, 0.867537f, 0.870372f, 0.873232f, 0.876094f, 0.878941f, 0.881760f,
+	0.884539f, 0.887270f, 0.889945f, 0.892555f, 0.895091f, 0.897534f, 0.899837f, 0.901721f,
+	0.994807f, 0.930529f, 0.897379f, 0.876017f, 0.861421f, 0.851290f, 0.844321f, 0.839682f,
+	0.836808f, 0.835292f, 0.834830f, 0.835195f, 0.836205f, 0.837722f, 0.839632f, 0.841847f,
+	0.844293f, 0.846912f, 0.849656f, 0.852488f, 0.855375f, 0.858293f, 0.861222f, 0.864144f,
+	0.867045f, 0.869915f, 0.872743f, 0.875519f, 0.878230f, 0.880854f, 0.883338f, 0.885363f,
+	0.994367f, 0.924814f, 0.888845f, 0.865492f, 0.849351f, 0.837964f, 0.829946f, 0.824420f,
+	0.820790f, 0.818628f, 0.817619f, 0.817521f, 0.818148f, 0.819350f, 0.821010f, 0.823033f,
+	0.825339f, 0.827868f, 0.830565f, 0.833389f, 0.836304f, 0.839281f, 0.842297f, 0.845332f,
+	0.848369f, 0.851394f, 0.854394f, 0.857357f, 0.860266f, 0.863097f, 0.865789f, 0.867981f,
+	0.993907f, 0.918879f, 0.879981f, 0.854547f, 0.836784f, 0.824071f, 0.814941f, 0.808467f,
+	0.804023f, 0.801163f, 0.799556f, 0.798949f, 0.799148f, 0.799998f, 0.801372f, 0.803171f,
+	0.805313f, 0.807728f, 0.810361f, 0.813165f, 0.816101f, 0.819137f, 0.822245f, 0.825401f,
+	0.828587f, 0.831785f, 0.834980f, 0.838157f, 0.841296f, 0.844370f, 0.847310f, 0.849711f,
+	0.993431f, 0.912767f, 0.870860f, 0.843286f, 0.823848f, 0.809760f, 0.799468f, 0.791997f,
+	0.786692f, 0.783085f, 0.780832f, 0.779670f, 0.779395f, 0.779846f, 0.780894f, 0.782432f,
+	0.784373f, 0.786645f, 0.789188f, 0.791951f, 0.794893f, 0.797977f, 0.801172f, 0.804453f,
+	0.807797f, 0.811184f, 0.814597f, 0.818016f, 0.821422f, 0.824781f, 0.828018f, 0.830679f,
+	0.992941f, 0.906511f, 0.861545f, 0.831799f, 0.810657f, 0.795164f, 0.783678f, 0.775178f,
+	0.768974f, 0.764582f, 0.761641f, 0.759880f, 0.759089f, 0.759099f, 0.759775f, 0.761009f,
+	0.762710f, 0.764801f, 0.767220f, 0.769914f, 0.772837f, 0.775950f, 0.779221f, 0.782621f,
+	0.786124f, 0.789710f, 0.793357f, 0.797045f, 0.800750f, 0.804437f, 0.808020f, 0.811000f,
+	0.992436f, 0.900142f, 0.852096f, 0.820166f, 0.797311f, 0.780402f, 0.767709f, 0.758160f,
+	0.751036f, 0.745830f, 0.742172f, 0.739778f, 0.738432f, 0.737961f, 0.738226f, 0.739114f,
+	0.740532f, 0.742402f, 0.744658f, 0.747246f, 0.750118f, 0.753234f, 0.756558f, 0.760061f,
+	0.763716f, 0.767498f, 0.771387f, 0.775360f, 0.779391f, 0.783441f, 0.787420f, 0.790774f,
+	0.991919f, 0.893688f, 0.842560f, 0.808455f, 0.783896f, 0.765577f, 0.751679f, 0.741079f,
+	0.733026f, 0.726994f, 0.722598f, 0.719548f, 0.717619f, 0.716635f, 0.716452f, 0.716956f,
+	0.718052f, 0.719660f, 0.721713f, 0.724155f, 0.726939f, 0.730022f, 0.733369f, 0.736949f,
+	0.740735f, 0.744702f, 0.748828f, 0.753090f, 0.757462f, 0.761901f, 0.766312f, 0.770089f,
+	0.991388f, 0.887170f, 0.832977f, 0.796723f, 0.770486f, 0.750779f, 0.735693f, 0.724051f,
+	0.715075f, 0.708216f, 0.703077f, 0.699357f, 0.696828f, 0.695307f, 0.694650f, 0.694739f,
+	0.695477f, 0.696785f, 0.698595f, 0.700852f, 0.703505f, 0.706516f, 0.709848f, 0.713471f,
+	0.717358f, 0.721485f, 0.725830f, 0.730372f, 0.735083f, 0.739923f, 0.744788f, 0.749023f,
+	0.990847f, 0.880608f, 0.823383f, 0.785020f, 0.757143f, 0.736082f, 0.719836f, 0.707177f,
+	0.697294f, 0.689620f, 0.683743f, 0.679354f, 0.676217f, 0.674148f, 0.672998f, 0.672648f,
+	0.673001f, 0.673977f, 0.675508f, 0.677539f, 0.680023f, 0.682919f, 0.686193f, 0.689817f,
+	0.693765f, 0.698016f, 0.702549f, 0.707345f, 0.712379f, 0.717612f, 0.722936f, 0.727646f,
+};
+
+static const float DielectricExitAlbedoTable[16384] =
+{
+	0.997380f, 0.999998f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.843934f, 0.999740f, 0.999935f, 0.999971f, 0.999984f, 0.999990f, 0.999993f, 0.999995f,
+	0.999996f, 0.999997f, 0.999998f, 0.999998f, 0.999998f, 0.999999f, 0.999999f, 0.999999f,
+	0.999999f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.616366f, 0.995878f, 0.998952f, 0.999542f, 0.999744f, 0.999838f, 0.999889f, 0.999919f,
+	0.999939f, 0.999953f, 0.999963f, 0.999970f, 0.999975f, 0.999980f, 0.999983f, 0.999986f,
+	0.999988f, 0.999990f, 0.999991f, 0.999993f, 0.999994f, 0.999995f, 0.999996f, 0.999996f,
+	0.999997f, 0.999998f, 0.999998f, 0.999999f, 0.999999f, 0.999999f, 1.000000f, 1.000000f,
+	0.552993f, 0.980178f, 0.994820f, 0.997696f, 0.998695f, 0.999181f, 0.999438f, 0.999592f,
+	0.999693f, 0.999762f, 0.999811f, 0.999848f, 0.999876f, 0.999897f, 0.999914f, 0.999928f,
+	0.999940f, 0.999949f, 0.999957f, 0.999964f, 0.999969f, 0.999974f, 0.999978f, 0.999982f,
+	0.999985f, 0.999988f, 0.999991f, 0.999993f, 0.999995f, 0.999997f, 0.999999f, 1.000000f,
+	0.529944f, 0.944345f, 0.984187f, 0.992812f, 0.995941f, 0.997410f, 0.998229f, 0.998715f,
+	0.999031f, 0.999249f, 0.999404f, 0.999520f, 0.999607f, 0.999675f, 0.999730f, 0.999773f,
+	0.999809f, 0.999839f, 0.999864f, 0.999885f, 0.999903f, 0.999918f, 0.999932f, 0.999943f,
+	0.999954f, 0.999963f, 0.999971f, 0.999978f, 0.999984f, 0.999990f, 0.999995f, 1.000000f,
+	0.519188f, 0.889273f, 0.963841f, 0.982995f, 0.990282f, 0.993782f, 0.995694f, 0.996865f,
+	0.997645f, 0.998172f, 0.998550f, 0.998830f, 0.999043f, 0.999209f, 0.999341f, 0.999448f,
+	0.999535f, 0.999607f, 0.999668f, 0.999719f, 0.999763f, 0.999801f, 0.999833f, 0.999862f,
+	0.999887f, 0.999909f, 0.999929f, 0.999946f, 0.999962f, 0.999976f, 0.999989f, 1.000000f,
+	0.513334f, 0.826346f, 0.932607f, 0.966554f, 0.980469f, 0.987361f, 0.991207f, 0.993595f,
+	0.995154f, 0.996232f, 0.997006f, 0.997582f, 0.998021f, 0.998364f, 0.998636f, 0.998856f,
+	0.999037f, 0.999186f, 0.999312f, 0.999418f, 0.999509f, 0.999587f, 0.999655f, 0.999714f,
+	0.999766f, 0.999811f, 0.999852f, 0.999888f, 0.999921f, 0.999950f, 0.999976f, 1.000000f,
+	0.509796f, 0.767408f, 0.892580f, 0.942792f, 0.965519f, 0.977308f, 0.984092f, 0.988310f,
+	0.991117f, 0.993085f, 0.994481f, 0.995548f, 0.996353f, 0.996982f, 0.997482f, 0.997887f,
+	0.998220f, 0.998495f, 0.998727f, 0.998923f, 0.999091f, 0.999235f, 0.999361f, 0.999470f,
+	0.999566f, 0.999651f, 0.999726f, 0.999793f, 0.999853f, 0.999907f, 0.999956f, 1.000000f,
+	0.507499f, 0.718045f, 0.848259f, 0.912499f, 0.945076f, 0.963030f, 0.973720f, 0.980543f,
+	0.985133f, 0.988372f, 0.990717f, 0.992461f, 0.993825f, 0.994883f, 0.995728f, 0.996397f,
+	0.996959f, 0.997442f, 0.997834f, 0.998167f, 0.998452f, 0.998698f, 0.998911f, 0.999097f,
+	0.999261f, 0.999405f, 0.999533f, 0.999647f, 0.999750f, 0.999842f, 0.999925f, 1.000000f,
+	0.505931f, 0.678787f, 0.804294f, 0.877804f, 0.919650f, 0.944381f, 0.959778f, 0.969897f,
+	0.976824f, 0.981739f, 0.985360f, 0.988108f, 0.990218f, 0.991879f, 0.993209f, 0.994289f,
+	0.995164f, 0.995921f, 0.996544f, 0.997074f, 0.997527f, 0.997919f, 0.998259f, 0.998556f,
+	0.998817f, 0.999048f, 0.999253f, 0.999436f, 0.999600f, 0.999747f, 0.999880f, 1.000000f,
+	0.504797f, 0.648110f, 0.763855f, 0.841364f, 0.890476f, 0.921764f, 0.942249f, 0.956129f,
+	0.965881f, 0.972954f, 0.978205f, 0.982205f, 0.985315f, 0.987762f, 0.989743f, 0.991373f,
+	0.992708f, 0.993822f, 0.994761f, 0.995560f, 0.996246f, 0.996823f, 0.997353f, 0.997804f,
+	0.998200f, 0.998551f, 0.998863f, 0.999141f, 0.999390f, 0.999614f, 0.999817f, 1.000000f,
+	0.503970f, 0.624142f, 0.728375f, 0.805586f, 0.859317f, 0.896070f, 0.921459f, 0.939363f,
+	0.952272f, 0.961809f, 0.969013f, 0.974567f, 0.978910f, 0.982401f, 0.985213f, 0.987518f,
+	0.989430f, 0.991031f, 0.992385f, 0.993540f, 0.994532f, 0.995391f, 0.996139f, 0.996794f,
+	0.997372f, 0.997883f, 0.998337f, 0.998743f, 0.999108f, 0.999435f, 0.999732f, 1.000000f,
+	0.503329f, 0.605271f, 0.698067f, 0.772152f, 0.827832f, 0.868540f, 0.898153f, 0.919901f,
+	0.936071f, 0.948302f, 0.957711f, 0.965066f, 0.970890f, 0.975603f, 0.979418f, 0.982592f,
+	0.985223f, 0.987437f, 0.989316f, 0.990924f, 0.992309f, 0.993510f, 0.994558f, 0.995477f,
+	0.996275f, 0.997009f, 0.997650f, 0.998223f, 0.998737f, 0.999201f, 0.999620f, 1.000000f,
+	0.502835f, 0.590256f, 0.672515f, 0.741930f, 0.797387f, 0.840374f, 0.873222f, 0.898332f,
+	0.917618f, 0.932582f, 0.944316f, 0.953666f, 0.961160f, 0.967268f, 0.972307f, 0.976479f,
+	0.979978f, 0.982936f, 0.985458f, 0.987625f, 0.989497f, 0.991125f, 0.992550f, 0.993788f,
+	0.994911f, 0.995894f, 0.996772f, 0.997557f, 0.998264f, 0.998900f, 0.999477f, 1.000000f,
+	0.502451f, 0.578142f, 0.651075f, 0.715164f, 0.768923f, 0.812659f, 0.847623f, 0.875376f,
+	0.897386f, 0.914953f, 0.929037f, 0.940420f, 0.949738f, 0.957386f, 0.963753f, 0.969088f,
+	0.973608f, 0.977443f, 0.980729f, 0.983563f, 0.986024f, 0.988171f, 0.990056f, 0.991718f,
+	0.993191f, 0.994501f, 0.995672f, 0.996723f, 0.997669f, 0.998523f, 0.999297f, 1.000000f,
+	0.502128f, 0.568270f, 0.633085f, 0.691763f, 0.742889f, 0.786176f, 0.822178f, 0.851775f,
+	0.876004f, 0.895822f, 0.912116f, 0.925543f, 0.936683f, 0.945985f, 0.953804f, 0.960421f,
+	0.966058f, 0.970874f, 0.975056f, 0.978670f, 0.981821f, 0.984569f, 0.987002f, 0.989171f,
+	0.991084f, 0.992776f, 0.994321f, 0.995694f, 0.996935f, 0.998056f, 0.999074f, 1.000000f,
+	0.501877f, 0.560139f, 0.617914f, 0.671435f, 0.719449f, 0.761466f, 0.797556f, 0.828198f,
+	0.854019f, 0.875721f, 0.893934f, 0.909254f, 0.922169f, 0.933124f, 0.942465f, 0.950445f,
+	0.957308f, 0.963239f, 0.968392f, 0.972875f, 0.976833f, 0.980309f, 0.983382f, 0.986098f,
+	0.988548f, 0.990712f, 0.992684f, 0.994448f, 0.996027f, 0.997488f, 0.998802f, 1.000000f,
+	0.501655f, 0.553355f, 0.605089f, 0.653819f, 0.698552f, 0.738746f, 0.774244f, 0.805239f,
+	0.832041f, 0.855108f, 0.874906f, 0.891891f, 0.906462f, 0.919026f, 0.929857f, 0.939234f,
+	0.947368f, 0.954476f, 0.960716f, 0.966189f, 0.971020f, 0.975299f, 0.979104f, 0.982500f,
+	0.985540f, 0.988256f, 0.990732f, 0.992955f, 0.994972f, 0.996805f, 0.998459f, 1.000000f,
+	0.501483f, 0.547647f, 0.594163f, 0.638549f, 0.680029f, 0.718087f, 0.752517f, 0.783267f,
+	0.810484f, 0.834443f, 0.855452f, 0.873797f, 0.889837f, 0.903870f, 0.916138f, 0.926895f,
+	0.936333f, 0.944675f, 0.952035f, 0.958556f, 0.964354f, 0.969509f, 0.974147f, 0.978279f,
+	0.982024f, 0.985389f, 0.988432f, 0.991193f, 0.993690f, 0.995994f, 0.998085f, 1.000000f,
+	0.501331f, 0.542793f, 0.584805f, 0.625278f, 0.663653f, 0.699470f, 0.732475f, 0.762561f,
+	0.789749f, 0.814156f, 0.835958f, 0.855368f, 0.872614f, 0.887922f, 0.901509f, 0.913577f,
+	0.924306f, 0.933861f, 0.942385f, 0.950006f, 0.956819f, 0.962965f, 0.968484f, 0.973463f,
+	0.977966f, 0.982049f, 0.985759f, 0.989137f, 0.992206f, 0.995041f, 0.997624f, 1.000000f,
+	0.501201f, 0.538654f, 0.576742f, 0.613736f, 0.649187f, 0.682739f, 0.714146f, 0.743264f,
+	0.770033f, 0.794514f, 0.816754f, 0.836891f, 0.855070f, 0.871450f, 0.886195f, 0.899461f,
+	0.911399f, 0.922147f, 0.931820f, 0.940576f, 0.948473f, 0.955622f, 0.962103f, 0.967989f,
+	0.973344f, 0.978225f, 0.982668f, 0.986761f, 0.990499f, 0.993917f, 0.997075f, 1.000000f,
+	0.501082f, 0.535079f, 0.569753f, 0.603639f, 0.636397f, 0.667748f, 0.697474f, 0.725429f,
+	0.751530f, 0.775749f, 0.798108f, 0.818664f, 0.837500f, 0.854718f, 0.870415f, 0.884746f,
+	0.897773f, 0.909662f, 0.920462f, 0.930331f, 0.939315f, 0.947516f, 0.954993f, 0.961861f,
+	0.968138f, 0.973879f, 0.979180f, 0.984043f, 0.988522f, 0.992653f, 0.996469f, 1.000000f,
+	0.500993f, 0.531976f, 0.563661f, 0.594777f, 0.625072f, 0.654326f, 0.682361f, 0.709030f,
+	0.734271f, 0.758001f, 0.780199f, 0.800915f, 0.820149f, 0.837967f, 0.854425f, 0.869637f,
+	0.883647f, 0.896549f, 0.908425f, 0.919356f, 0.929418f, 0.938682f, 0.947216f, 0.955083f,
+	0.962340f, 0.969026f, 0.975219f, 0.980964f, 0.986270f, 0.991175f, 0.995741f, 1.000000f,
+	0.500908f, 0.529257f, 0.558323f, 0.586961f, 0.615021f, 0.642307f, 0.668686f, 0.694041f,
+	0.718281f, 0.741345f, 0.763196f, 0.783817f, 0.803214f, 0.821409f, 0.838434f, 0.854321f,
+	0.869146f, 0.882966f, 0.895811f, 0.907742f, 0.918857f, 0.929173f, 0.938760f, 0.947655f,
+	0.955954f, 0.963659f, 0.970829f, 0.977506f, 0.983727f, 0.989514f, 0.994928f, 1.000000f,
+	0.500834f, 0.526885f, 0.553621f, 0.580063f, 0.606075f, 0.631532f, 0.656320f, 0.680346f,
+	0.703529f, 0.725797f, 0.747139f, 0.767492f, 0.786852f, 0.805219f, 0.822602f, 0.839020f,
+	0.854499f, 0.869071f, 0.882773f, 0.895644f, 0.907725f, 0.919058f, 0.929687f, 0.939650f,
+	0.948991f, 0.957746f, 0.965942f, 0.973641f, 0.980879f, 0.987657f, 0.994022f, 1.000000f,
+	0.500768f, 0.524782f, 0.549451f, 0.573920f, 0.598092f, 0.621857f, 0.645138f, 0.667850f,
+	0.689958f, 0.711377f, 0.732074f, 0.752013f, 0.771172f, 0.789534f, 0.807096f, 0.823857f,
+	0.839827f, 0.855019f, 0.869437f, 0.883131f, 0.896111f, 0.908419f, 0.920056f, 0.931063f,
+	0.941473f, 0.951299f, 0.960614f, 0.969389f, 0.977709f, 0.985561f, 0.992983f, 1.000000f,
+	0.500711f, 0.522917f, 0.545761f, 0.568460f, 0.590946f, 0.613152f, 0.635007f, 0.656482f,
+	0.677497f, 0.698016f, 0.717991f, 0.737420f, 0.756233f, 0.774455f, 0.792026f, 0.808983f,
+	0.825287f, 0.840951f, 0.855979f, 0.870379f, 0.884149f, 0.897330f, 0.909938f, 0.921962f,
+	0.933435f, 0.944362f, 0.954791f, 0.964745f, 0.974198f, 0.983230f, 0.991806f, 1.000000f,
+	0.500659f, 0.521254f, 0.542459f, 0.563567f, 0.584530f, 0.605304f, 0.625845f, 0.646111f,
+	0.666065f, 0.685672f, 0.704899f, 0.723722f, 0.742112f, 0.760051f, 0.777520f, 0.794507f,
+	0.811001f, 0.826995f, 0.842485f, 0.857469f, 0.871948f, 0.885927f, 0.899409f, 0.912388f,
+	0.924901f, 0.936958f, 0.948542f, 0.959677f, 0.970377f, 0.980641f, 0.990525f, 1.000000f,
+	0.500613f, 0.519765f, 0.539491f, 0.559164f, 0.578753f, 0.598212f, 0.617521f, 0.636653f,
+	0.655581f, 0.674281f, 0.692719f, 0.710905f, 0.728777f, 0.746360f, 0.763607f, 0.780502f,
+	0.797068f, 0.813260f, 0.829081f, 0.844525f, 0.859587f, 0.874263f, 0.888552f, 0.902452f,
+	0.915965f, 0.929079f, 0.941824f, 0.954206f, 0.966185f, 0.977826f, 0.989090f, 1.000000f,
+	0.500571f, 0.518427f, 0.536837f, 0.555212f, 0.573535f, 0.591788f, 0.609955f, 0.628018f,
+	0.645955f, 0.663767f, 0.681430f, 0.698942f, 0.716267f, 0.733403f, 0.750339f, 0.767063f,
+	0.783554f, 0.799837f, 0.815868f, 0.831651f, 0.847180f, 0.862448f, 0.877436f, 0.892168f,
+	0.906639f, 0.920805f, 0.934719f, 0.948340f, 0.961663f, 0.974734f, 0.987506f, 1.000000f,
+	0.500534f, 0.517213f, 0.534426f, 0.551633f, 0.568809f, 0.585955f, 0.603063f, 0.620127f,
+	0.637130f, 0.654092f, 0.670970f, 0.687795f, 0.704530f, 0.721169f, 0.737726f, 0.754185f,
+	0.770540f, 0.786796f, 0.802926f, 0.818934f, 0.834804f, 0.850568f, 0.866186f, 0.881662f,
+	0.896995f, 0.912166f, 0.927200f, 0.942093f, 0.956799f, 0.971373f, 0.985770f, 1.000000f,
+	0.500500f, 0.516129f, 0.532258f, 0.548387f, 0.564516f, 0.580645f, 0.596774f, 0.612903f,
+	0.629023f, 0.645161f, 0.661290f, 0.677419f, 0.693538f, 0.709677f, 0.725795f, 0.741924f,
+	0.758065f, 0.774194f, 0.790323f, 0.806452f, 0.822581f, 0.838710f, 0.854826f, 0.870968f,
+	0.887096f, 0.903212f, 0.919354f, 0.935484f, 0.951598f, 0.967727f, 0.983856f, 1.000000f,
+	0.994188f, 0.999982f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.893400f, 0.999406f, 0.999839f, 0.999929f, 0.999969f, 0.999975f, 0.999978f, 0.999971f,
+	0.999969f, 0.999969f, 0.999982f, 0.999983f, 0.999998f, 0.999999f, 0.999997f, 0.999989f,
+	0.999996f, 0.999998f, 0.999999f, 0.999999f, 0.999999f, 0.999999f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.954977f, 0.989744f, 0.997531f, 0.998873f, 0.999347f, 0.999601f, 0.999700f, 0.999772f,
+	0.999790f, 0.999831f, 0.999863f, 0.999898f, 0.999912f, 0.999921f, 0.999896f, 0.999805f,
+	0.999922f, 0.999949f, 0.999961f, 0.999968f, 0.999972f, 0.999975f, 0.999977f, 0.999979f,
+	0.999980f, 0.999981f, 0.999982f, 0.999983f, 0.999983f, 0.999990f, 0.999998f, 1.000000f,
+	0.978988f, 0.952729f, 0.986366f, 0.993871f, 0.996509f, 0.997710f, 0.998348f, 0.998737f,
+	0.999008f, 0.999138f, 0.999302f, 0.999359f, 0.999410f, 0.999424f, 0.999318f, 0.999007f,
+	0.999556f, 0.999693f, 0.999783f, 0.999820f, 0.999843f, 0.999858f, 0.999869f, 0.999901f,
+	0.999915f, 0.999929f, 0.999937f, 0.999958f, 0.999972f, 0.999978f, 0.999981f, 0.999981f,
+	0.988042f, 0.905073f, 0.959294f, 0.980052f, 0.988396f, 0.992437f, 0.994631f, 0.995951f,
+	0.996745f, 0.997285f, 0.997658f, 0.997891f, 0.998051f, 0.998005f, 0.997391f, 0.997122f,
+	0.998600f, 0.999065f, 0.999283f, 0.999438f, 0.999531f, 0.999586f, 0.999649f, 0.999691f,
+	0.999751f, 0.999780f, 0.999794f, 0.999848f, 0.999859f, 0.999880f, 0.999882f, 0.999914f,
+	0.992143f, 0.877640f, 0.921660f, 0.954473f, 0.971743f, 0.980959f, 0.986216f, 0.989458f,
+	0.991584f, 0.992970f, 0.993965f, 0.994573f, 0.994814f, 0.994689f, 0.993518f, 0.993848f,
+	0.996548f, 0.997661f, 0.998230f, 0.998567f, 0.998780f, 0.998932f, 0.999072f, 0.999182f,
+	0.999300f, 0.999382f, 0.999454f, 0.999560f, 0.999644f, 0.999698f, 0.999759f, 0.999786f,
+	0.994164f, 0.867381f, 0.887631f, 0.921368f, 0.945785f, 0.961422f, 0.971296f, 0.977722f,
+	0.981985f, 0.984831f, 0.986835f, 0.988086f, 0.988684f, 0.988435f, 0.987395f, 0.988947f,
+	0.992925f, 0.995048f, 0.996190f, 0.996893f, 0.997406f, 0.997785f, 0.998080f, 0.998324f,
+	0.998502f, 0.998716f, 0.998927f, 0.999109f, 0.999292f, 0.999390f, 0.999468f, 0.999545f,
+	0.995123f, 0.861437f, 0.863111f, 0.888595f, 0.914341f, 0.934456f, 0.948848f, 0.959059f,
+	0.966279f, 0.971365f, 0.974837f, 0.977123f, 0.978265f, 0.978487f, 0.978694f, 0.981926f,
+	0.987220f, 0.990732f, 0.992833f, 0.994186f, 0.995138f, 0.995827f, 0.996393f, 0.996841f,
+	0.997208f, 0.997616f, 0.998001f, 0.998354f, 0.998608f, 0.998854f, 0.998996f, 0.999153f,
+	0.995454f, 0.852646f, 0.844997f, 0.860310f, 0.882384f, 0.903239f, 0.920479f, 0.933791f,
+	0.943896f, 0.951382f, 0.956858f, 0.960535f, 0.962868f, 0.964428f, 0.966924f, 0.972195f,
+	0.979008f, 0.984205f, 0.987601f, 0.989900f, 0.991544f, 0.992778f, 0.993744f, 0.994536f,
+	0.995255f, 0.995916f, 0.996613f, 0.997194f, 0.997662f, 0.998036f, 0.998293f, 0.998550f,
+	0.995377f, 0.838448f, 0.828302f, 0.835985f, 0.852381f, 0.870993f, 0.888425f, 0.903403f,
+	0.915593f, 0.925170f, 0.932555f, 0.938110f, 0.942309f, 0.946313f, 0.951779f, 0.959366f,
+	0.967874f, 0.974919f, 0.979979f, 0.983578f, 0.986214f, 0.988219f, 0.989806f, 0.991161f,
+	0.992337f, 0.993469f, 0.994550f, 0.995497f, 0.996251f, 0.996840f, 0.997300f, 0.997672f,
+	0.995007f, 0.818751f, 0.809708f, 0.812946f, 0.824308f, 0.839349f, 0.855100f, 0.869872f,
+	0.882942f, 0.893923f, 0.903006f, 0.910532f, 0.917282f, 0.924469f, 0.933184f, 0.943228f,
+	0.953619f, 0.962614f, 0.969609f, 0.974840f, 0.978791f, 0.981864f, 0.984357f, 0.986482f,
+	0.988306f, 0.990021f, 0.991721f, 0.993159f, 0.994251f, 0.995161f, 0.995855f, 0.996449f,
+	0.994412f, 0.794085f, 0.787364f, 0.788879f, 0.796737f, 0.808412f, 0.821676f, 0.835235f,
+	0.847922f, 0.859530f, 0.869895f, 0.879526f, 0.889111f, 0.899614f, 0.911472f, 0.923915f,
+	0.936237f, 0.947263f, 0.956299f, 0.963404f, 0.968966f, 0.973422f, 0.977080f, 0.980187f,
+	0.982954f, 0.985533f, 0.987985f, 0.990044f, 0.991663f, 0.992949f, 0.993944f, 0.994801f,
+	0.993640f, 0.765367f, 0.761119f, 0.762427f, 0.768348f, 0.777465f, 0.788461f, 0.800380f,
+	0.812303f, 0.824027f, 0.835450f, 0.847036f, 0.859407f, 0.872912f, 0.887385f, 0.901991f,
+	0.916140f, 0.929062f, 0.940129f, 0.949211f, 0.956608f, 0.962708f, 0.967829f, 0.972186f,
+	0.976106f, 0.979720f, 0.983197f, 0.986038f, 0.988226f, 0.990028f, 0.991452f, 0.992643f,
+	0.992725f, 0.733375f, 0.731476f, 0.733320f, 0.738463f, 0.746068f, 0.755504f, 0.766025f,
+	0.777301f, 0.789120f, 0.801512f, 0.814958f, 0.829618f, 0.845525f, 0.862012f, 0.878307f,
+	0.894013f, 0.908581f, 0.921498f, 0.932547f, 0.941878f, 0.949763f, 0.956513f, 0.962423f,
+	0.967726f, 0.972626f, 0.977185f, 0.981041f, 0.983978f, 0.986357f, 0.988298f, 0.989882f,
+	0.991691f, 0.699099f, 0.699050f, 0.701872f, 0.707044f, 0.714124f, 0.722830f, 0.732740f,
+	0.743829f, 0.756017f, 0.769517f, 0.784483f, 0.800935f, 0.818453f, 0.836313f, 0.853810f,
+	0.870700f, 0.886570f, 0.901026f, 0.913846f, 0.925027f, 0.934736f, 0.943291f, 0.950836f,
+	0.957736f, 0.964089f, 0.969909f, 0.974831f, 0.978671f, 0.981805f, 0.984330f, 0.986423f,
+	0.990561f, 0.663323f, 0.664968f, 0.668905f, 0.674666f, 0.682033f, 0.690797f, 0.700933f,
+	0.712429f, 0.725466f, 0.740127f, 0.756422f, 0.774108f, 0.792666f, 0.811235f, 0.829427f,
+	0.847050f, 0.863830f, 0.879488f, 0.893769f, 0.906594f, 0.918068f, 0.928365f, 0.937657f,
+	0.946224f, 0.954127f, 0.961424f, 0.967559f, 0.972355f, 0.976251f, 0.979473f, 0.982166f,
+	0.989351f, 0.626958f, 0.630078f, 0.635316f, 0.642175f, 0.650420f, 0.659998f, 0.671031f,
+	0.683603f, 0.697825f, 0.713638f, 0.730993f, 0.749522f, 0.768510f, 0.787394f, 0.805859f,
+	0.823835f, 0.841140f, 0.857610f, 0.873002f, 0.887208f, 0.900206f, 0.912141f, 0.923133f,
+	0.933333f, 0.942811f, 0.951602f, 0.959018f, 0.964895f, 0.969648f, 0.973676f, 0.977014f,
+	0.988075f, 0.590644f, 0.595287f, 0.602028f, 0.610343f, 0.620080f, 0.631112f, 0.643593f,
+	0.657614f, 0.673138f, 0.690111f, 0.708288f, 0.727194f, 0.746295f, 0.765172f, 0.783574f,
+	0.801605f, 0.819131f, 0.836048f, 0.852186f, 0.867394f, 0.881670f, 0.895023f, 0.907546f,
+	0.919292f, 0.930361f, 0.940569f, 0.949321f, 0.956169f, 0.961961f, 0.966799f, 0.970868f,
+	0.986748f, 0.555090f, 0.561408f, 0.569966f, 0.580047f, 0.591630f, 0.604535f, 0.618801f,
+	0.634397f, 0.651294f, 0.669292f, 0.688044f, 0.707086f, 0.726076f, 0.744690f, 0.762867f,
+	0.780695f, 0.798207f, 0.815289f, 0.831845f, 0.847779f, 0.862966f, 0.877472f, 0.891294f,
+	0.904371f, 0.916861f, 0.928417f, 0.938433f, 0.946380f, 0.953042f, 0.958778f, 0.963635f,
+	0.985363f, 0.520982f, 0.529199f, 0.539779f, 0.552015f, 0.565657f, 0.580618f, 0.596726f,
+	0.613957f, 0.632096f, 0.650904f, 0.669985f, 0.689035f, 0.707739f, 0.725985f, 0.743814f,
+	0.761330f, 0.778621f, 0.795669f, 0.812355f, 0.828682f, 0.844501f, 0.859882f, 0.874673f,
+	0.888942f, 0.902577f, 0.915340f, 0.926486f, 0.935390f, 0.942998f, 0.949572f, 0.955228f,
+	0.983944f, 0.488670f, 0.499067f, 0.511998f, 0.526538f, 0.542485f, 0.559491f, 0.577480f,
+	0.596162f, 0.615314f, 0.634638f, 0.653852f, 0.672736f, 0.691124f, 0.708944f, 0.726348f,
+	0.743499f, 0.760474f, 0.777293f, 0.794000f, 0.810432f, 0.826633f, 0.842526f, 0.858037f,
+	0.873163f, 0.887766f, 0.901538f, 0.913577f, 0.923315f, 0.931755f, 0.939150f, 0.945572f,
+	0.982490f, 0.458530f, 0.471446f, 0.486881f, 0.503984f, 0.522221f, 0.541280f, 0.560843f,
+	0.580707f, 0.600595f, 0.620262f, 0.639456f, 0.658075f, 0.676065f, 0.693468f, 0.710394f,
+	0.727150f, 0.743767f, 0.760315f, 0.776790f, 0.793232f, 0.809551f, 0.825713f, 0.841664f,
+	0.857347f, 0.872571f, 0.887061f, 0.899865f, 0.910256f, 0.919331f, 0.927405f, 0.934601f,
+	0.981004f, 0.430741f, 0.446452f, 0.464710f, 0.484388f, 0.504870f, 0.525715f, 0.546639f,
+	0.567400f, 0.587746f, 0.607496f, 0.626533f, 0.644834f, 0.662408f, 0.679348f, 0.695871f,
+	0.712183f, 0.728397f, 0.744603f, 0.760848f, 0.777065f, 0.793336f, 0.809573f, 0.825670f,
+	0.841651f, 0.857293f, 0.872236f, 0.885572f, 0.896273f, 0.905857f, 0.914486f, 0.922264f,
+	0.979492f, 0.405460f, 0.424289f, 0.445409f, 0.467679f, 0.490225f, 0.512657f, 0.534625f,
+	0.555934f, 0.576453f, 0.596114f, 0.614882f, 0.632768f, 0.649902f, 0.666442f, 0.682549f,
+	0.698464f, 0.714305f, 0.730146f, 0.746023f, 0.762026f, 0.778046f, 0.794176f, 0.810276f,
+	0.826287f, 0.842109f, 0.857235f, 0.870726f, 0.881498f, 0.891299f, 0.900279f, 0.908530f,
+	0.977956f, 0.382732f, 0.404803f, 0.428986f, 0.453720f, 0.478128f, 0.501785f, 0.524485f,
+	0.546085f, 0.566557f, 0.585946f, 0.604333f, 0.621809f, 0.638499f, 0.654596f, 0.670333f,
+	0.685852f, 0.701315f, 0.716790f, 0.732332f, 0.747962f, 0.763713f, 0.779588f, 0.795485f,
+	0.811384f, 0.827046f, 0.842166f, 0.855561f, 0.866178f, 0.875812f, 0.884941f, 0.893381f,
+	0.976394f, 0.362486f, 0.388010f, 0.415201f, 0.442230f, 0.468254f, 0.492852f, 0.515957f,
+	0.537575f, 0.557825f, 0.576857f, 0.594773f, 0.611734f, 0.628004f, 0.643711f, 0.659060f,
+	0.674221f, 0.689297f, 0.704405f, 0.719570f, 0.734852f, 0.750283f, 0.765772f, 0.781368f,
+	0.796931f, 0.812328f, 0.827143f, 0.840189f, 0.850243f, 0.859567f, 0.868412f, 0.876825f,
+	0.974812f, 0.344639f, 0.373713f, 0.403880f, 0.433021f, 0.460339f, 0.485569f, 0.508822f,
+	0.530287f, 0.550128f, 0.568648f, 0.586051f, 0.602543f, 0.618375f, 0.633672f, 0.648630f,
+	0.663428f, 0.678165f, 0.692900f, 0.707740f, 0.722625f, 0.737639f, 0.752757f, 0.767914f,
+	0.783055f, 0.798019f, 0.812282f, 0.824807f, 0.833967f, 0.842594f, 0.850903f, 0.858885f,
+	0.973209f, 0.329017f, 0.361749f, 0.394791f, 0.425783f, 0.454094f, 0.479670f, 0.502820f,
+	0.523918f, 0.543267f, 0.561238f, 0.578150f, 0.594114f, 0.609499f, 0.624373f, 0.638975f,
+	0.653414f, 0.667782f, 0.682180f, 0.696637f, 0.711136f, 0.725712f, 0.740418f, 0.755116f,
+	0.769746f, 0.784097f, 0.797785f, 0.809428f, 0.817441f, 0.824987f, 0.832364f, 0.839611f,
+	0.971588f, 0.315509f, 0.351940f, 0.387655f, 0.420240f, 0.449249f, 0.474890f, 0.497755f,
+	0.518361f, 0.537141f, 0.554562f, 0.570867f, 0.586346f, 0.601255f, 0.615730f, 0.629974f,
+	0.644058f, 0.658084f, 0.672145f, 0.686208f, 0.700385f, 0.714567f, 0.728757f, 0.742952f,
+	0.757017f, 0.770681f, 0.783554f, 0.794170f, 0.800812f, 0.806865f, 0.813008f, 0.819068f,
+	0.969949f, 0.303923f, 0.344030f, 0.382216f, 0.416124f, 0.445551f, 0.471090f, 0.493524f,
+	0.513530f, 0.531680f, 0.548457f, 0.564196f, 0.579179f, 0.593624f, 0.607695f, 0.621560f,
+	0.635289f, 0.648996f, 0.662693f, 0.676405f, 0.690176f, 0.703965f, 0.717692f, 0.731366f,
+	0.744803f, 0.757798f, 0.769722f, 0.779195f, 0.784072f, 0.788468f, 0.792877f, 0.797347f,
+	0.968292f, 0.294074f, 0.337845f, 0.378329f, 0.413229f, 0.442832f, 0.468039f, 0.489891f,
+	0.509257f, 0.526748f, 0.542895f, 0.558052f, 0.572516f, 0.586515f, 0.600190f, 0.613676f,
+	0.627064f, 0.640424f, 0.653781f, 0.667136f, 0.680503f, 0.693816f, 0.707176f, 0.720296f,
+	0.733113f, 0.745324f, 0.756316f, 0.764460f, 0.767338f, 0.769660f, 0.772094f, 0.774552f,
+	0.966620f, 0.285826f, 0.333152f, 0.375656f, 0.411322f, 0.440866f, 0.465620f, 0.486820f,
+	0.505483f, 0.522293f, 0.537804f, 0.552422f, 0.566391f, 0.579921f, 0.593180f, 0.606284f,
+	0.619349f, 0.632342f, 0.645365f, 0.658372f, 0.671372f, 0.684340f, 0.697127f, 0.709735f,
+	0.721916f, 0.733332f, 0.743291f, 0.750008f, 0.750747f, 0.750773f, 0.750780f, 0.750806f,
+	0.994181f, 0.999982f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.893235f, 0.999407f, 0.999853f, 0.999941f, 0.999969f, 0.999975f, 0.999978f, 0.999980f,
+	0.999981f, 0.999982f, 0.999982f, 0.999983f, 0.999998f, 0.999999f, 0.999987f, 0.999999f,
+	0.999999f, 0.999989f, 1.000000f, 0.999985f, 0.999997f, 0.999998f, 0.999999f, 0.999999f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.954813f, 0.989839f, 0.997565f, 0.998886f, 0.999344f, 0.999602f, 0.999708f, 0.999775f,
+	0.999833f, 0.999867f, 0.999896f, 0.999913f, 0.999932f, 0.999947f, 0.999935f, 0.999936f,
+	0.999938f, 0.999965f, 0.999956f, 0.999728f, 0.999932f, 0.999959f, 0.999969f, 0.999974f,
+	0.999977f, 0.999979f, 0.999981f, 0.999982f, 0.999983f, 0.999984f, 0.999984f, 0.999999f,
+	0.978872f, 0.953529f, 0.986795f, 0.994142f, 0.996760f, 0.997919f, 0.998567f, 0.998918f,
+	0.999161f, 0.999292f, 0.999404f, 0.999528f, 0.999556f, 0.999595f, 0.999691f, 0.999697f,
+	0.999693f, 0.999666f, 0.999665f, 0.999007f, 0.999635f, 0.999771f, 0.999819f, 0.999868f,
+	0.999891f, 0.999900f, 0.999900f, 0.999906f, 0.999922f, 0.999943f, 0.999945f, 0.999949f,
+	0.988009f, 0.907578f, 0.960567f, 0.980919f, 0.989042f, 0.992987f, 0.995123f, 0.996342f,
+	0.997163f, 0.997720f, 0.998070f, 0.998397f, 0.998557f, 0.998708f, 0.998836f, 0.998953f,
+	0.998965f, 0.998902f, 0.998779f, 0.997614f, 0.998831f, 0.999262f, 0.999453f, 0.999545f,
+	0.999633f, 0.999677f, 0.999703f, 0.999715f, 0.999744f, 0.999761f, 0.999798f, 0.999820f,
+	0.992236f, 0.883346f, 0.924743f, 0.956569f, 0.973326f, 0.982300f, 0.987449f, 0.990617f,
+	0.992652f, 0.994061f, 0.995093f, 0.995763f, 0.996293f, 0.996762f, 0.996994f, 0.997165f,
+	0.997262f, 0.997203f, 0.996732f, 0.995353f, 0.997188f, 0.998192f, 0.998647f, 0.998899f,
+	0.999077f, 0.999193f, 0.999259f, 0.999301f, 0.999373f, 0.999404f, 0.999487f, 0.999551f,
+	0.994425f, 0.878169f, 0.893929f, 0.925739f, 0.949189f, 0.964274f, 0.973818f, 0.980087f,
+	0.984295f, 0.987273f, 0.989362f, 0.990848f, 0.991986f, 0.992866f, 0.993433f, 0.993806f,
+	0.993983f, 0.993866f, 0.992972f, 0.991915f, 0.994410f, 0.996272f, 0.997179f, 0.997690f,
+	0.997998f, 0.998196f, 0.998378f, 0.998543f, 0.998667f, 0.998779f, 0.998916f, 0.999059f,
+	0.995597f, 0.879113f, 0.874353f, 0.896715f, 0.920843f, 0.939891f, 0.953793f, 0.963679f,
+	0.970805f, 0.975966f, 0.979743f, 0.982583f, 0.984683f, 0.986233f, 0.987407f, 0.988089f,
+	0.988391f, 0.988105f, 0.987241f, 0.987058f, 0.990212f, 0.993042f, 0.994652f, 0.995595f,
+	0.996219f, 0.996669f, 0.996995f, 0.997266f, 0.997515f, 0.997707f, 0.997907f, 0.998248f,
+	0.996188f, 0.878936f, 0.863144f, 0.873956f, 0.893381f, 0.912741f, 0.928952f, 0.941910f,
+	0.951887f, 0.959503f, 0.965365f, 0.969848f, 0.973318f, 0.975858f, 0.977724f, 0.978989f,
+	0.979586f, 0.979567f, 0.979252f, 0.980363f, 0.984294f, 0.988192f, 0.990711f, 0.992354f,
+	0.993431f, 0.994195f, 0.994756f, 0.995258f, 0.995652f, 0.996044f, 0.996479f, 0.997003f,
+	0.996413f, 0.874811f, 0.855261f, 0.857024f, 0.869744f, 0.886120f, 0.902180f, 0.916403f,
+	0.928293f, 0.938076f, 0.945934f, 0.952187f, 0.957133f, 0.960973f, 0.963843f, 0.965852f,
+	0.967051f, 0.967759f, 0.968724f, 0.971384f, 0.976259f, 0.981311f, 0.984982f, 0.987515f,
+	0.989271f, 0.990524f, 0.991484f, 0.992247f, 0.992958f, 0.993576f, 0.994306f, 0.995195f,
+	0.996385f, 0.866277f, 0.846937f, 0.843211f, 0.849887f, 0.861905f, 0.875727f, 0.889407f,
+	0.901868f, 0.912775f, 0.922085f, 0.929848f, 0.936231f, 0.941307f, 0.945251f, 0.948297f,
+	0.950586f, 0.952632f, 0.955393f, 0.959804f, 0.965873f, 0.972083f, 0.977044f, 0.980682f,
+	0.983348f, 0.985300f, 0.986793f, 0.988056f, 0.989141f, 0.990157f, 0.991334f, 0.992675f,
+	0.996170f, 0.853767f, 0.836230f, 0.829954f, 0.832187f, 0.839943f, 0.850666f, 0.862494f,
+	0.874178f, 0.885140f, 0.894934f, 0.903627f, 0.911058f, 0.917230f, 0.922324f, 0.926622f,
+	0.930324f, 0.934277f, 0.939141f, 0.945362f, 0.952744f, 0.960202f, 0.966599f, 0.971546f,
+	0.975314f, 0.978176f, 0.980458f, 0.982334f, 0.984039f, 0.985598f, 0.987353f, 0.989285f,
+	0.995808f, 0.837683f, 0.822484f, 0.815329f, 0.814838f, 0.819235f, 0.826892f, 0.836260f,
+	0.846359f, 0.856409f, 0.865980f, 0.874785f, 0.882689f, 0.889711f, 0.895873f, 0.901498f,
+	0.906988f, 0.913011f, 0.920020f, 0.928049f, 0.936832f, 0.945580f, 0.953399f, 0.959799f,
+	0.964924f, 0.968870f, 0.972137f, 0.974865f, 0.977272f, 0.979585f, 0.982104f, 0.984853f,
+	0.995328f, 0.818536f, 0.805540f, 0.798517f, 0.796475f, 0.798585f, 0.803629f, 0.810656f,
+	0.818801f, 0.827470f, 0.836132f, 0.844536f, 0.852517f, 0.859983f, 0.867123f, 0.874116f,
+	0.881395f, 0.889413f, 0.898384f, 0.908081f, 0.918187f, 0.928256f, 0.937447f, 0.945363f,
+	0.951897f, 0.957163f, 0.961553f, 0.965341f, 0.968704f, 0.971988f, 0.975493f, 0.979203f,
+	0.994750f, 0.796828f, 0.785673f, 0.779090f, 0.776464f, 0.777048f, 0.780221f, 0.785248f,
+	0.791539f, 0.798664f, 0.806254f, 0.813984f, 0.821747f, 0.829500f, 0.837364f, 0.845578f,
+	0.854495f, 0.864253f, 0.874847f, 0.885922f, 0.897275f, 0.908438f, 0.918956f, 0.928263f,
+	0.936294f, 0.942974f, 0.948670f, 0.953677f, 0.958229f, 0.962641f, 0.967328f, 0.972157f,
+	0.994088f, 0.773099f, 0.763234f, 0.757287f, 0.754488f, 0.754244f, 0.756107f, 0.759694f,
+	0.764544f, 0.770371f, 0.776888f, 0.783921f, 0.791400f, 0.799362f, 0.807854f, 0.817082f,
+	0.827270f, 0.838312f, 0.850119f, 0.862242f, 0.874554f, 0.886681f, 0.898249f, 0.908881f,
+	0.918249f, 0.926289f, 0.933392f, 0.939766f, 0.945644f, 0.951352f, 0.957348f, 0.963543f,
+	0.993357f, 0.747724f, 0.738809f, 0.733407f, 0.730665f, 0.730017f, 0.731216f, 0.733858f,
+	0.737696f, 0.742626f, 0.748375f, 0.754943f, 0.762260f, 0.770362f, 0.779373f, 0.789417f,
+	0.800453f, 0.812430f, 0.824929f, 0.837743f, 0.850670f, 0.863496f, 0.875915f, 0.887586f,
+	0.898157f, 0.907464f, 0.915884f, 0.923645f, 0.930951f, 0.938055f, 0.945629f, 0.953199f,
+	0.992565f, 0.721089f, 0.712860f, 0.707957f, 0.705385f, 0.704756f, 0.705603f, 0.707776f,
+	0.711155f, 0.715636f, 0.720987f, 0.727364f, 0.734739f, 0.743077f, 0.752566f, 0.763132f,
+	0.774738f, 0.787111f, 0.800023f, 0.813138f, 0.826359f, 0.839552f, 0.852495f, 0.864886f,
+	0.876422f, 0.886767f, 0.896428f, 0.905492f, 0.914181f, 0.922789f, 0.931845f, 0.940987f,
+	0.991728f, 0.693713f, 0.685909f, 0.681433f, 0.679197f, 0.678651f, 0.679627f, 0.681784f,
+	0.685203f, 0.689570f, 0.694984f, 0.701475f, 0.709061f, 0.717802f, 0.727633f, 0.738602f,
+	0.750384f, 0.762915f, 0.775796f, 0.788933f, 0.802210f, 0.815511f, 0.828693f, 0.841496f,
+	0.853575f, 0.864716f, 0.875358f, 0.885562f, 0.895526f, 0.905567f, 0.916089f, 0.926792f,
+	0.990835f, 0.665896f, 0.658476f, 0.654395f, 0.652575f, 0.652441f, 0.653761f, 0.656304f,
+	0.659958f, 0.664717f, 0.670535f, 0.677498f, 0.685495f, 0.694592f, 0.704746f, 0.715836f,
+	0.727671f, 0.740065f, 0.752782f, 0.765660f, 0.778680f, 0.791804f, 0.804946f, 0.817849f,
+	0.830254f, 0.841754f, 0.853047f, 0.864164f, 0.875130f, 0.886422f, 0.898390f, 0.910538f,
+	0.989909f, 0.638102f, 0.630966f, 0.627343f, 0.626063f, 0.626521f, 0.628482f, 0.631683f,
+	0.635962f, 0.641400f, 0.647873f, 0.655313f, 0.663892f, 0.673377f, 0.683773f, 0.694930f,
+	0.706618f, 0.718730f, 0.731062f, 0.743497f, 0.756156f, 0.768919f, 0.781750f, 0.794466f,
+	0.806836f, 0.818419f, 0.829956f, 0.841599f, 0.853426f, 0.865660f, 0.878760f, 0.892188f,
+	0.988949f, 0.610570f, 0.603770f, 0.600767f, 0.600176f, 0.601444f, 0.604217f, 0.608238f,
+	0.613410f, 0.619657f, 0.626891f, 0.635104f, 0.644179f, 0.654052f, 0.664628f, 0.675721f,
+	0.687210f, 0.698971f, 0.710797f, 0.722742f, 0.734897f, 0.747157f, 0.759500f, 0.771809f,
+	0.783778f, 0.795034f, 0.806489f, 0.818299f, 0.830478f, 0.843325f, 0.857243f, 0.871753f,
+	0.987960f, 0.583674f, 0.577408f, 0.575076f, 0.575323f, 0.577525f, 0.581267f, 0.586350f,
+	0.592512f, 0.599731f, 0.607787f, 0.616723f, 0.626324f, 0.636524f, 0.647182f, 0.658176f,
+	0.669386f, 0.680689f, 0.692037f, 0.703478f, 0.714970f, 0.726630f, 0.738362f, 0.750042f,
+	0.761427f, 0.772078f, 0.783051f, 0.794569f, 0.806753f, 0.819748f, 0.834171f, 0.849289f,
+	0.986945f, 0.557684f, 0.551988f, 0.550556f, 0.551843f, 0.555134f, 0.560035f, 0.566181f,
+	0.573430f, 0.581590f, 0.590500f, 0.600056f, 0.610114f, 0.620551f, 0.631256f, 0.642105f,
+	0.652993f, 0.663887f, 0.674766f, 0.685596f, 0.696486f, 0.707475f, 0.718479f, 0.729404f,
+	0.739999f, 0.749688f, 0.759808f, 0.770683f, 0.782417f, 0.795207f, 0.809536f, 0.824902f,
+	0.985908f, 0.532800f, 0.527830f, 0.527464f, 0.529954f, 0.534496f, 0.540565f, 0.547881f,
+	0.556188f, 0.565265f, 0.574916f, 0.585009f, 0.595412f, 0.606025f, 0.616697f, 0.627347f,
+	0.637924f, 0.648441f, 0.658818f, 0.669090f, 0.679363f, 0.689636f, 0.699859f, 0.709964f,
+	0.719545f, 0.728095f, 0.737052f, 0.746942f, 0.757804f, 0.769913f, 0.783699f, 0.798742f,
+	0.984846f, 0.509132f, 0.505195f, 0.506019f, 0.509806f, 0.515695f, 0.523001f, 0.531481f,
+	0.540738f, 0.550634f, 0.560925f, 0.571459f, 0.582110f, 0.592778f, 0.603390f, 0.613853f,
+	0.624152f, 0.634210f, 0.644141f, 0.653868f, 0.663571f, 0.673155f, 0.682610f, 0.691756f,
+	0.700218f, 0.707334f, 0.714962f, 0.723490f, 0.733096f, 0.744042f, 0.756771f, 0.771002f,
+	0.983766f, 0.486915f, 0.484068f, 0.486283f, 0.491523f, 0.498758f, 0.507342f, 0.516885f,
+	0.527063f, 0.537618f, 0.548415f, 0.559254f, 0.570075f, 0.580713f, 0.591197f, 0.601432f,
+	0.611403f, 0.621142f, 0.630646f, 0.639917f, 0.649012f, 0.657937f, 0.666549f, 0.674736f,
+	0.681979f, 0.687584f, 0.693540f, 0.700447f, 0.708483f, 0.717859f, 0.729089f, 0.741907f,
+	0.982668f, 0.466101f, 0.464598f, 0.468332f, 0.475098f, 0.483705f, 0.493519f, 0.504030f,
+	0.514991f, 0.526105f, 0.537192f, 0.548252f, 0.559119f, 0.569719f, 0.579983f, 0.589998f,
+	0.599704f, 0.609096f, 0.618184f, 0.627017f, 0.635579f, 0.643827f, 0.651669f, 0.658834f,
+	0.664864f, 0.668760f, 0.672932f, 0.678002f, 0.684096f, 0.691549f, 0.700796f, 0.711711f,
+	0.981552f, 0.446821f, 0.446798f, 0.452172f, 0.460490f, 0.470484f, 0.481414f, 0.492815f,
+	0.504365f, 0.515921f, 0.527241f, 0.538385f, 0.549166f, 0.559599f, 0.569704f, 0.579489f,
+	0.588886f, 0.597959f, 0.606709f, 0.615115f, 0.623178f, 0.630796f, 0.637890f, 0.644073f,
+	0.648742f, 0.650842f, 0.653031f, 0.656092f, 0.660065f, 0.665241f, 0.672145f, 0.680684f,
+	0.980421f, 0.429045f, 0.430656f, 0.437754f, 0.447634f, 0.458944f, 0.470909f, 0.483082f,
+	0.495108f, 0.506885f, 0.518345f, 0.529395f, 0.540097f, 0.550357f, 0.560262f, 0.569749f,
+	0.578924f, 0.587686f, 0.596066f, 0.604082f, 0.611687f, 0.618708f, 0.625044f, 0.630237f,
+	0.633617f, 0.633814f, 0.633920f, 0.634786f, 0.636412f, 0.639073f, 0.643340f, 0.649105f,
+	0.979273f, 0.412738f, 0.416099f, 0.425008f, 0.436467f, 0.449017f, 0.461868f, 0.474620f,
+	0.487012f, 0.498963f, 0.510392f, 0.521327f, 0.531835f, 0.541889f, 0.551540f, 0.560785f,
+	0.569653f, 0.578141f, 0.586237f, 0.593890f, 0.601031f, 0.607455f, 0.613071f, 0.617302f,
+	0.619304f, 0.617605f, 0.615593f, 0.614053f, 0.613219f, 0.613215f, 0.614564f, 0.617251f,
+	0.978111f, 0.397865f, 0.403122f, 0.413839f, 0.426800f, 0.440516f, 0.454176f, 0.467337f,
+	0.479938f, 0.491904f, 0.503255f, 0.514025f, 0.524292f, 0.534118f, 0.543499f, 0.552475f,
+	0.561075f, 0.569289f, 0.577090f, 0.584347f, 0.591081f, 0.597014f, 0.601892f, 0.605171f,
+	0.605833f, 0.602148f, 0.597883f, 0.593959f, 0.590511f, 0.587738f, 0.586000f, 0.585390f,
+	0.994178f, 0.999982f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.893177f, 0.999408f, 0.999853f, 0.999941f, 0.999969f, 0.999975f, 0.999978f, 0.999980f,
+	0.999981f, 0.999982f, 0.999982f, 0.999983f, 0.999998f, 0.999999f, 0.999999f, 0.999999f,
+	0.999999f, 0.999989f, 1.000000f, 1.000000f, 0.999997f, 1.000000f, 0.999994f, 0.999998f,
+	0.999999f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.954755f, 0.989926f, 0.997634f, 0.998944f, 0.999383f, 0.999627f, 0.999726f, 0.999794f,
+	0.999832f, 0.999859f, 0.999881f, 0.999901f, 0.999915f, 0.999927f, 0.999958f, 0.999947f,
+	0.999973f, 0.999939f, 0.999956f, 0.999946f, 0.999968f, 0.999955f, 0.999886f, 0.999957f,
+	0.999970f, 0.999976f, 0.999979f, 0.999981f, 0.999982f, 0.999983f, 0.999984f, 0.999985f,
+	0.978829f, 0.953875f, 0.986954f, 0.994287f, 0.996829f, 0.997958f, 0.998570f, 0.998916f,
+	0.999172f, 0.999300f, 0.999427f, 0.999535f, 0.999555f, 0.999631f, 0.999700f, 0.999728f,
+	0.999705f, 0.999760f, 0.999761f, 0.999773f, 0.999758f, 0.999698f, 0.999393f, 0.999757f,
+	0.999832f, 0.999862f, 0.999878f, 0.999888f, 0.999905f, 0.999916f, 0.999920f, 0.999923f,
+	0.987993f, 0.908651f, 0.961112f, 0.981269f, 0.989318f, 0.993149f, 0.995249f, 0.996447f,
+	0.997265f, 0.997814f, 0.998224f, 0.998473f, 0.998667f, 0.998801f, 0.998964f, 0.999103f,
+	0.999133f, 0.999194f, 0.999221f, 0.999236f, 0.999208f, 0.998974f, 0.998380f, 0.999261f,
+	0.999510f, 0.999600f, 0.999651f, 0.999675f, 0.999697f, 0.999712f, 0.999757f, 0.999732f,
+	0.992261f, 0.885835f, 0.926080f, 0.957459f, 0.973984f, 0.982813f, 0.987861f, 0.990993f,
+	0.993005f, 0.994370f, 0.995374f, 0.996135f, 0.996607f, 0.997047f, 0.997352f, 0.997655f,
+	0.997756f, 0.997943f, 0.998039f, 0.998062f, 0.997911f, 0.997257f, 0.996593f, 0.998149f,
+	0.998687f, 0.998938f, 0.999079f, 0.999175f, 0.999266f, 0.999297f, 0.999331f, 0.999335f,
+	0.994506f, 0.882872f, 0.896697f, 0.927601f, 0.950600f, 0.965399f, 0.974810f, 0.980946f,
+	0.985107f, 0.987996f, 0.990097f, 0.991609f, 0.992775f, 0.993698f, 0.994321f, 0.994840f,
+	0.995235f, 0.995487f, 0.995642f, 0.995620f, 0.995320f, 0.994297f, 0.993926f, 0.996186f,
+	0.997244f, 0.997753f, 0.998065f, 0.998284f, 0.998436f, 0.998540f, 0.998628f, 0.998607f,
+	0.995749f, 0.886925f, 0.879279f, 0.900180f, 0.923470f, 0.942076f, 0.955682f, 0.965358f,
+	0.972322f, 0.977417f, 0.981132f, 0.983958f, 0.986100f, 0.987765f, 0.989087f, 0.990029f,
+	0.990818f, 0.991247f, 0.991568f, 0.991554f, 0.991011f, 0.989826f, 0.990154f, 0.993043f,
+	0.994837f, 0.995790f, 0.996383f, 0.996772f, 0.997048f, 0.997241f, 0.997356f, 0.997404f,
+	0.996427f, 0.890529f, 0.871016f, 0.879749f, 0.897950f, 0.916384f, 0.932211f, 0.944799f,
+	0.954554f, 0.962047f, 0.967844f, 0.972357f, 0.975806f, 0.978615f, 0.980771f, 0.982411f,
+	0.983704f, 0.984611f, 0.985029f, 0.985059f, 0.984539f, 0.983742f, 0.984913f, 0.988453f,
+	0.991149f, 0.992735f, 0.993687f, 0.994371f, 0.994839f, 0.995196f, 0.995452f, 0.995554f,
+	0.996755f, 0.890939f, 0.866937f, 0.865966f, 0.876920f, 0.892116f, 0.907442f, 0.921150f,
+	0.932731f, 0.942313f, 0.950052f, 0.956354f, 0.961433f, 0.965466f, 0.968735f, 0.971258f,
+	0.973252f, 0.974594f, 0.975459f, 0.975725f, 0.975540f, 0.975719f, 0.977901f, 0.982063f,
+	0.985696f, 0.988155f, 0.989688f, 0.990806f, 0.991602f, 0.992218f, 0.992653f, 0.992858f,
+	0.996845f, 0.887518f, 0.863227f, 0.856175f, 0.860546f, 0.870952f, 0.883727f, 0.896646f,
+	0.908633f, 0.919283f, 0.928460f, 0.936196f, 0.942698f, 0.948094f, 0.952516f, 0.956050f,
+	0.958908f, 0.960889f, 0.962340f, 0.963193f, 0.963894f, 0.965342f, 0.968661f, 0.973610f,
+	0.978230f, 0.981639f, 0.984007f, 0.985728f, 0.986944f, 0.987953f, 0.988670f, 0.989095f,
+	0.996763f, 0.880565f, 0.857814f, 0.847629f, 0.847098f, 0.852918f, 0.862199f, 0.872990f,
+	0.884010f, 0.894575f, 0.904196f, 0.912782f, 0.920274f, 0.926775f, 0.932211f, 0.936714f,
+	0.940369f, 0.943239f, 0.945510f, 0.947341f, 0.949367f, 0.952383f, 0.956892f, 0.962719f,
+	0.968364f, 0.972880f, 0.976237f, 0.978731f, 0.980640f, 0.982113f, 0.983268f, 0.984028f,
+	0.996546f, 0.870557f, 0.849967f, 0.838539f, 0.834796f, 0.836864f, 0.842651f, 0.850768f,
+	0.859902f, 0.869349f, 0.878516f, 0.887166f, 0.895023f, 0.902056f, 0.908239f, 0.913553f,
+	0.918057f, 0.921847f, 0.925157f, 0.928290f, 0.931941f, 0.936548f, 0.942381f, 0.949157f,
+	0.955846f, 0.961544f, 0.966014f, 0.969501f, 0.972223f, 0.974408f, 0.976144f, 0.977408f,
+	0.996224f, 0.857762f, 0.839202f, 0.827675f, 0.822087f, 0.821394f, 0.824313f, 0.829734f,
+	0.836708f, 0.844435f, 0.852503f, 0.860487f, 0.868094f, 0.875123f, 0.881562f, 0.887385f,
+	0.892611f, 0.897324f, 0.901835f, 0.906430f, 0.911712f, 0.917941f, 0.924979f, 0.932732f,
+	0.940463f, 0.947353f, 0.953075f, 0.957721f, 0.961462f, 0.964510f, 0.967011f, 0.968983f,
+	0.995813f, 0.842669f, 0.825851f, 0.814580f, 0.808133f, 0.805625f, 0.806252f, 0.809337f,
+	0.814082f, 0.819978f, 0.826562f, 0.833391f, 0.840248f, 0.846901f, 0.853279f, 0.859275f,
+	0.864997f, 0.870537f, 0.876195f, 0.882300f, 0.889058f, 0.896676f, 0.904911f, 0.913560f,
+	0.922222f, 0.930289f, 0.937275f, 0.943166f, 0.948047f, 0.952164f, 0.955610f, 0.958508f,
+	0.995327f, 0.825601f, 0.810043f, 0.799244f, 0.792336f, 0.788663f, 0.787690f, 0.788899f,
+	0.791811f, 0.795910f, 0.800889f, 0.806395f, 0.812292f, 0.818221f, 0.824224f, 0.830244f,
+	0.836322f, 0.842562f, 0.849176f, 0.856514f, 0.864532f, 0.873227f, 0.882392f, 0.891820f,
+	0.901294f, 0.910347f, 0.918539f, 0.925695f, 0.931847f, 0.937192f, 0.941742f, 0.945762f,
+	0.994778f, 0.806883f, 0.792127f, 0.781734f, 0.774666f, 0.770244f, 0.768168f, 0.768046f,
+	0.769388f, 0.772008f, 0.775507f, 0.779782f, 0.784594f, 0.789802f, 0.795362f, 0.801229f,
+	0.807465f, 0.814233f, 0.821660f, 0.829781f, 0.838717f, 0.848188f, 0.858003f, 0.867904f,
+	0.878019f, 0.887849f, 0.897058f, 0.905417f, 0.912827f, 0.919440f, 0.925283f, 0.930560f,
+	0.994174f, 0.786740f, 0.772491f, 0.762309f, 0.755148f, 0.750340f, 0.747553f, 0.746392f,
+	0.746650f, 0.748090f, 0.750504f, 0.753721f, 0.757543f, 0.762083f, 0.767188f, 0.772893f,
+	0.779234f, 0.786346f, 0.794240f, 0.802905f, 0.812301f, 0.822155f, 0.832217f, 0.842394f,
+	0.852818f, 0.863212f, 0.873197f, 0.882524f, 0.891147f, 0.898939f, 0.906078f, 0.912763f,
+	0.993528f, 0.765526f, 0.751441f, 0.741359f, 0.734129f, 0.729088f, 0.725844f, 0.724074f,
+	0.723551f, 0.724197f, 0.725819f, 0.728235f, 0.731518f, 0.735497f, 0.740236f, 0.745817f,
+	0.752169f, 0.759394f, 0.767450f, 0.776336f, 0.785869f, 0.795714f, 0.805698f, 0.815831f,
+	0.826243f, 0.836830f, 0.847314f, 0.857391f, 0.866933f, 0.875909f, 0.884265f, 0.892298f,
+	0.992828f, 0.743436f, 0.729308f, 0.719279f, 0.711971f, 0.706784f, 0.703263f, 0.701186f,
+	0.700256f, 0.700382f, 0.701540f, 0.703552f, 0.706430f, 0.710120f, 0.714750f, 0.720157f,
+	0.726510f, 0.733698f, 0.741782f, 0.750547f, 0.759873f, 0.769453f, 0.779079f, 0.788753f,
+	0.798853f, 0.809358f, 0.819945f, 0.830406f, 0.840595f, 0.850422f, 0.859891f, 0.869167f,
+	0.992097f, 0.720816f, 0.706436f, 0.696314f, 0.688949f, 0.683709f, 0.680151f, 0.678001f,
+	0.676910f, 0.676933f, 0.677935f, 0.679860f, 0.682607f, 0.686244f, 0.690770f, 0.696209f,
+	0.702491f, 0.709554f, 0.717413f, 0.725861f, 0.734726f, 0.743784f, 0.752803f, 0.761745f,
+	0.771260f, 0.781275f, 0.791619f, 0.802094f, 0.812574f, 0.822942f, 0.833171f, 0.843447f,
+	0.991334f, 0.697789f, 0.683144f, 0.672929f, 0.665564f, 0.660403f, 0.656920f, 0.654829f,
+	0.653922f, 0.654060f, 0.655166f, 0.657141f, 0.660074f, 0.663836f, 0.668413f, 0.673865f,
+	0.680030f, 0.686942f, 0.694472f, 0.702399f, 0.710682f, 0.718993f, 0.727114f, 0.735129f,
+	0.743751f, 0.753027f, 0.762787f, 0.772898f, 0.783284f, 0.793752f, 0.804371f, 0.815298f,
+	0.990543f, 0.674768f, 0.659702f, 0.649446f, 0.642176f, 0.637190f, 0.633904f, 0.632102f,
+	0.631515f, 0.631955f, 0.633398f, 0.635740f, 0.638940f, 0.642898f, 0.647642f, 0.653105f,
+	0.659235f, 0.665912f, 0.672971f, 0.680368f, 0.687864f, 0.695362f, 0.702479f, 0.709355f,
+	0.716865f, 0.725085f, 0.733919f, 0.743284f, 0.753143f, 0.763340f, 0.773886f, 0.784957f,
+	0.989727f, 0.651827f, 0.636414f, 0.626130f, 0.619082f, 0.614360f, 0.611496f, 0.610099f,
+	0.609961f, 0.610925f, 0.612826f, 0.615603f, 0.619171f, 0.623493f, 0.628452f, 0.633945f,
+	0.639951f, 0.646318f, 0.652934f, 0.659682f, 0.666466f, 0.673022f, 0.679022f, 0.684522f,
+	0.690796f, 0.697707f, 0.705354f, 0.713685f, 0.722563f, 0.732060f, 0.742042f, 0.752725f,
+	0.988889f, 0.629236f, 0.613562f, 0.603355f, 0.596571f, 0.592276f, 0.589924f, 0.589089f,
+	0.589562f, 0.591129f, 0.593615f, 0.596905f, 0.600946f, 0.605537f, 0.610667f, 0.616188f,
+	0.622067f, 0.628139f, 0.634319f, 0.640417f, 0.646394f, 0.651984f, 0.656795f, 0.660910f,
+	0.665676f, 0.671194f, 0.677391f, 0.684352f, 0.691956f, 0.700236f, 0.709208f, 0.718957f,
+	0.988028f, 0.607110f, 0.591358f, 0.581283f, 0.574920f, 0.571185f, 0.569440f, 0.569316f,
+	0.570469f, 0.572674f, 0.575734f, 0.579611f, 0.584030f, 0.588957f, 0.594254f, 0.599835f,
+	0.605540f, 0.611310f, 0.616996f, 0.622529f, 0.627673f, 0.632253f, 0.635893f, 0.638440f,
+	0.641662f, 0.645589f, 0.650236f, 0.655557f, 0.661595f, 0.668349f, 0.675756f, 0.684041f,
+	0.987149f, 0.585704f, 0.569893f, 0.560196f, 0.554355f, 0.551242f, 0.550222f, 0.550847f,
+	0.552708f, 0.555616f, 0.559324f, 0.563651f, 0.568506f, 0.573698f, 0.579152f, 0.584684f,
+	0.590272f, 0.595725f, 0.600975f, 0.605870f, 0.610251f, 0.613885f, 0.616217f, 0.617255f,
+	0.618869f, 0.621071f, 0.623951f, 0.627484f, 0.631673f, 0.636546f, 0.642107f, 0.648386f,
+	0.986253f, 0.565063f, 0.549323f, 0.540094f, 0.534966f, 0.532630f, 0.532415f, 0.533805f,
+	0.536413f, 0.539993f, 0.544260f, 0.549048f, 0.554263f, 0.559673f, 0.565196f, 0.570713f,
+	0.576107f, 0.581299f, 0.586052f, 0.590431f, 0.594070f, 0.596762f, 0.597825f, 0.597257f,
+	0.597171f, 0.597583f, 0.598602f, 0.600217f, 0.602387f, 0.605117f, 0.608472f, 0.612396f,
+	0.985341f, 0.545351f, 0.529857f, 0.521250f, 0.516873f, 0.515424f, 0.516043f, 0.518238f,
+	0.521564f, 0.525751f, 0.530549f, 0.535742f, 0.541211f, 0.546802f, 0.552342f, 0.557818f,
+	0.563021f, 0.567905f, 0.572273f, 0.576099f, 0.579030f, 0.580791f, 0.580575f, 0.578395f,
+	0.576543f, 0.575202f, 0.574274f, 0.573826f, 0.573833f, 0.574306f, 0.575183f, 0.576461f,
+	0.984413f, 0.526570f, 0.511462f, 0.503642f, 0.500150f, 0.499610f, 0.501134f, 0.504106f,
+	0.508121f, 0.512867f, 0.518127f, 0.523656f, 0.529301f, 0.534972f, 0.540518f, 0.545867f,
+	0.550909f, 0.555467f, 0.559503f, 0.562768f, 0.565035f, 0.565872f, 0.564433f, 0.560595f,
+	0.557057f, 0.553805f, 0.550901f, 0.548368f, 0.546119f, 0.544189f, 0.542486f, 0.540940f,
+	0.983471f, 0.508849f, 0.494250f, 0.487302f, 0.484791f, 0.485213f, 0.487625f, 0.491369f,
+	0.496001f, 0.501251f, 0.506829f, 0.512606f, 0.518385f, 0.524099f, 0.529633f, 0.534850f,
+	0.539666f, 0.543970f, 0.547645f, 0.550417f, 0.552018f, 0.552004f, 0.549370f, 0.543820f,
+	0.538464f, 0.533354f, 0.528443f, 0.523776f, 0.519262f, 0.514896f, 0.510583f, 0.506152f,
+	0.982515f, 0.492155f, 0.478230f, 0.472234f, 0.470808f, 0.472233f, 0.475511f, 0.479959f,
+	0.485145f, 0.490817f, 0.496679f, 0.502586f, 0.508418f, 0.514141f, 0.519576f, 0.524642f,
+	0.529245f, 0.533326f, 0.536604f, 0.538919f, 0.539921f, 0.539098f, 0.535165f, 0.527964f,
+	0.520814f, 0.513809f, 0.506904f, 0.500084f, 0.493288f, 0.486512f, 0.479619f, 0.472369f,
+	0.994177f, 0.999982f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.893153f, 0.999411f, 0.999853f, 0.999941f, 0.999969f, 0.999975f, 0.999978f, 0.999980f,
+	0.999981f, 0.999982f, 0.999982f, 0.999983f, 0.999998f, 0.999999f, 0.999999f, 0.999999f,
+	0.999999f, 0.999999f, 1.000000f, 0.999991f, 1.000000f, 1.000000f, 0.999995f, 1.000000f,
+	0.999997f, 0.999999f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.954730f, 0.989979f, 0.997650f, 0.998952f, 0.999390f, 0.999654f, 0.999753f, 0.999826f,
+	0.999862f, 0.999891f, 0.999916f, 0.999938f, 0.999939f, 0.999944f, 0.999947f, 0.999935f,
+	0.999971f, 0.999956f, 0.999976f, 0.999959f, 0.999974f, 0.999956f, 0.999948f, 0.999960f,
+	0.999933f, 0.999967f, 0.999975f, 0.999979f, 0.999982f, 0.999983f, 0.999984f, 0.999985f,
+	0.978812f, 0.954070f, 0.987058f, 0.994315f, 0.996867f, 0.997985f, 0.998623f, 0.998971f,
+	0.999207f, 0.999339f, 0.999445f, 0.999561f, 0.999601f, 0.999662f, 0.999712f, 0.999717f,
+	0.999752f, 0.999751f, 0.999816f, 0.999799f, 0.999800f, 0.999796f, 0.999793f, 0.999727f,
+	0.999641f, 0.999816f, 0.999858f, 0.999874f, 0.999889f, 0.999914f, 0.999920f, 0.999923f,
+	0.987989f, 0.909286f, 0.961431f, 0.981456f, 0.989482f, 0.993314f, 0.995371f, 0.996549f,
+	0.997335f, 0.997857f, 0.998236f, 0.998533f, 0.998734f, 0.998891f, 0.999077f, 0.999167f,
+	0.999155f, 0.999267f, 0.999302f, 0.999352f, 0.999361f, 0.999364f, 0.999335f, 0.999002f,
+	0.998901f, 0.999424f, 0.999555f, 0.999614f, 0.999662f, 0.999687f, 0.999734f, 0.999723f,
+	0.992277f, 0.887295f, 0.926863f, 0.957971f, 0.974378f, 0.983122f, 0.988140f, 0.991237f,
+	0.993220f, 0.994552f, 0.995579f, 0.996296f, 0.996781f, 0.997221f, 0.997517f, 0.997764f,
+	0.997997f, 0.998109f, 0.998283f, 0.998362f, 0.998372f, 0.998309f, 0.998188f, 0.997437f,
+	0.997448f, 0.998553f, 0.998902f, 0.999065f, 0.999180f, 0.999231f, 0.999299f, 0.999308f,
+	0.994549f, 0.885613f, 0.898283f, 0.928731f, 0.951448f, 0.966037f, 0.975350f, 0.981439f,
+	0.985515f, 0.988384f, 0.990454f, 0.991972f, 0.993127f, 0.994013f, 0.994675f, 0.995164f,
+	0.995649f, 0.995943f, 0.996187f, 0.996323f, 0.996409f, 0.996361f, 0.995996f, 0.994843f,
+	0.995130f, 0.996922f, 0.997680f, 0.998064f, 0.998280f, 0.998408f, 0.998484f, 0.998536f,
+	0.995827f, 0.891480f, 0.882075f, 0.902117f, 0.924954f, 0.943280f, 0.956690f, 0.966250f,
+	0.973127f, 0.978141f, 0.981857f, 0.984660f, 0.986772f, 0.988457f, 0.989728f, 0.990775f,
+	0.991575f, 0.992172f, 0.992701f, 0.992930f, 0.993097f, 0.992966f, 0.992321f, 0.991038f,
+	0.991824f, 0.994358f, 0.995635f, 0.996330f, 0.996733f, 0.996970f, 0.997108f, 0.997239f,
+	0.996548f, 0.897288f, 0.875550f, 0.883019f, 0.900450f, 0.918528f, 0.933947f, 0.946293f,
+	0.955909f, 0.963336f, 0.969079f, 0.973542f, 0.977047f, 0.979789f, 0.981992f, 0.983764f,
+	0.985120f, 0.986210f, 0.986977f, 0.987527f, 0.987747f, 0.987492f, 0.986757f, 0.985844f,
+	0.987265f, 0.990462f, 0.992453f, 0.993575f, 0.994282f, 0.994732f, 0.995037f, 0.995210f,
+	0.996928f, 0.900264f, 0.873671f, 0.871018f, 0.880927f, 0.895446f, 0.910260f, 0.923600f,
+	0.935002f, 0.944412f, 0.952078f, 0.958279f, 0.963352f, 0.967422f, 0.970755f, 0.973434f,
+	0.975602f, 0.977262f, 0.978539f, 0.979383f, 0.979786f, 0.979650f, 0.979065f, 0.978898f,
+	0.981030f, 0.984886f, 0.987733f, 0.989530f, 0.990655f, 0.991418f, 0.991909f, 0.992199f,
+	0.997078f, 0.899897f, 0.872618f, 0.863474f, 0.866519f, 0.875987f, 0.888069f, 0.900464f,
+	0.912139f, 0.922509f, 0.931530f, 0.939234f, 0.945681f, 0.951117f, 0.955663f, 0.959414f,
+	0.962446f, 0.964840f, 0.966678f, 0.968007f, 0.968754f, 0.968971f, 0.968977f, 0.969847f,
+	0.972834f, 0.977325f, 0.981104f, 0.983731f, 0.985482f, 0.986650f, 0.987458f, 0.987925f,
+	0.997063f, 0.896262f, 0.870298f, 0.857748f, 0.855505f, 0.860076f, 0.868450f, 0.878586f,
+	0.889185f, 0.899356f, 0.908770f, 0.917229f, 0.924685f, 0.931147f, 0.936721f, 0.941421f,
+	0.945432f, 0.948604f, 0.951137f, 0.953062f, 0.954328f, 0.955149f, 0.956253f, 0.958303f,
+	0.962270f, 0.967480f, 0.972251f, 0.975816f, 0.978358f, 0.980122f, 0.981339f, 0.982075f,
+	0.996921f, 0.889805f, 0.865769f, 0.851827f, 0.846111f, 0.846579f, 0.851344f, 0.858562f,
+	0.867126f, 0.876136f, 0.884998f, 0.893453f, 0.901251f, 0.908194f, 0.914491f, 0.919914f,
+	0.924610f, 0.928587f, 0.931788f, 0.934379f, 0.936485f, 0.938285f, 0.940608f, 0.944038f,
+	0.949009f, 0.954983f, 0.960760f, 0.965407f, 0.968873f, 0.971434f, 0.973194f, 0.974318f,
+	0.996680f, 0.880872f, 0.858839f, 0.844493f, 0.836706f, 0.834218f, 0.835829f, 0.840152f,
+	0.846375f, 0.853566f, 0.861159f, 0.868808f, 0.876224f, 0.883189f, 0.889617f, 0.895448f,
+	0.900640f, 0.905120f, 0.909034f, 0.912371f, 0.915384f, 0.918393f, 0.922063f, 0.926780f,
+	0.932762f, 0.939671f, 0.946375f, 0.952142f, 0.956693f, 0.960176f, 0.962709f, 0.964321f,
+	0.996357f, 0.869807f, 0.849404f, 0.835213f, 0.826312f, 0.821842f, 0.820970f, 0.822740f,
+	0.826551f, 0.831703f, 0.837663f, 0.844026f, 0.850576f, 0.856938f, 0.863135f, 0.868920f,
+	0.874178f, 0.879042f, 0.883423f, 0.887576f, 0.891535f, 0.895686f, 0.900662f, 0.906631f,
+	0.913593f, 0.921259f, 0.928947f, 0.935794f, 0.941507f, 0.946061f, 0.949508f, 0.951767f,
+	0.995964f, 0.856935f, 0.837720f, 0.823847f, 0.814369f, 0.808590f, 0.805830f, 0.805595f,
+	0.807266f, 0.810473f, 0.814679f, 0.819492f, 0.824747f, 0.830250f, 0.835684f, 0.841062f,
+	0.846208f, 0.851170f, 0.855916f, 0.860664f, 0.865508f, 0.870706f, 0.876791f, 0.883727f,
+	0.891517f, 0.899922f, 0.908395f, 0.916284f, 0.923155f, 0.928891f, 0.933312f, 0.936377f,
+	0.995511f, 0.842413f, 0.824007f, 0.810446f, 0.800621f, 0.793933f, 0.789911f, 0.788057f,
+	0.788001f, 0.789421f, 0.791927f, 0.795240f, 0.799186f, 0.803510f, 0.808104f, 0.812752f,
+	0.817532f, 0.822424f, 0.827386f, 0.832482f, 0.837997f, 0.843958f, 0.850797f, 0.858454f,
+	0.866866f, 0.875768f, 0.884912f, 0.893664f, 0.901601f, 0.908436f, 0.913976f, 0.917931f,
+	0.995008f, 0.826631f, 0.808552f, 0.795111f, 0.785066f, 0.777804f, 0.772849f, 0.769816f,
+	0.768354f, 0.768284f, 0.769324f, 0.771240f, 0.773889f, 0.777088f, 0.780661f, 0.784702f,
+	0.788968f, 0.793549f, 0.798512f, 0.803894f, 0.809744f, 0.816050f, 0.823289f, 0.831296f,
+	0.839986f, 0.849258f, 0.858763f, 0.868157f, 0.876964f, 0.884796f, 0.891423f, 0.896297f,
+	0.994465f, 0.809631f, 0.791614f, 0.778153f, 0.767902f, 0.760182f, 0.754520f, 0.750583f,
+	0.748103f, 0.746911f, 0.746739f, 0.747495f, 0.748965f, 0.751146f, 0.753877f, 0.757169f,
+	0.760898f, 0.765189f, 0.770010f, 0.775369f, 0.781203f, 0.787642f, 0.794846f, 0.802857f,
+	0.811509f, 0.820778f, 0.830431f, 0.840132f, 0.849502f, 0.858121f, 0.865649f, 0.871441f,
+	0.993870f, 0.791739f, 0.773439f, 0.759773f, 0.749268f, 0.741160f, 0.734973f, 0.730392f,
+	0.727174f, 0.725135f, 0.724098f, 0.723955f, 0.724573f, 0.725942f, 0.727955f, 0.730624f,
+	0.733897f, 0.737770f, 0.742312f, 0.747481f, 0.753084f, 0.759107f, 0.766010f, 0.773637f,
+	0.781987f, 0.790940f, 0.800367f, 0.810044f, 0.819619f, 0.828740f, 0.836936f, 0.843447f,
+	0.993246f, 0.773082f, 0.754316f, 0.740314f, 0.729521f, 0.721064f, 0.714510f, 0.709498f,
+	0.705778f, 0.703132f, 0.701446f, 0.700714f, 0.700724f, 0.701503f, 0.702992f, 0.705162f,
+	0.708005f, 0.711532f, 0.715734f, 0.720493f, 0.725649f, 0.731055f, 0.737252f, 0.744256f,
+	0.751903f, 0.760248f, 0.769152f, 0.778430f, 0.787846f, 0.797059f, 0.805557f, 0.812513f,
+	0.992591f, 0.753821f, 0.734456f, 0.720046f, 0.708880f, 0.700211f, 0.693350f, 0.688071f,
+	0.683978f, 0.681051f, 0.679058f, 0.677923f, 0.677593f, 0.678015f, 0.679140f, 0.680981f,
+	0.683527f, 0.686703f, 0.690440f, 0.694651f, 0.699176f, 0.703633f, 0.708959f, 0.714970f,
+	0.721755f, 0.729153f, 0.737232f, 0.745809f, 0.754657f, 0.763532f, 0.771931f, 0.778952f,
+	0.991909f, 0.734199f, 0.714058f, 0.699217f, 0.687787f, 0.678840f, 0.671786f, 0.666367f,
+	0.662180f, 0.659125f, 0.656995f, 0.655729f, 0.655246f, 0.655525f, 0.656488f, 0.658164f,
+	0.660396f, 0.663230f, 0.666550f, 0.670151f, 0.673777f, 0.677218f, 0.681418f, 0.686326f,
+	0.691951f, 0.698189f, 0.705152f, 0.712671f, 0.720597f, 0.728719f, 0.736564f, 0.743174f,
+	0.991202f, 0.714383f, 0.693394f, 0.678080f, 0.666412f, 0.657301f, 0.650222f, 0.644725f,
+	0.640595f, 0.637552f, 0.635489f, 0.634315f, 0.633888f, 0.634185f, 0.635110f, 0.636663f,
+	0.638689f, 0.641193f, 0.643981f, 0.646893f, 0.649612f, 0.651919f, 0.654837f, 0.658454f,
+	0.662766f, 0.667682f, 0.673268f, 0.679463f, 0.686165f, 0.693136f, 0.699906f, 0.705661f,
+	0.990475f, 0.694453f, 0.672666f, 0.656983f, 0.645018f, 0.635902f, 0.628797f, 0.623444f,
+	0.619470f, 0.616641f, 0.614777f, 0.613782f, 0.613551f, 0.613985f, 0.614976f, 0.616455f,
+	0.618355f, 0.620523f, 0.622841f, 0.625033f, 0.626728f, 0.627788f, 0.629381f, 0.631580f,
+	0.634401f, 0.637861f, 0.641914f, 0.646575f, 0.651740f, 0.657216f, 0.662561f, 0.666942f,
+	0.989725f, 0.674670f, 0.652131f, 0.636014f, 0.623929f, 0.614816f, 0.607921f, 0.602752f,
+	0.599099f, 0.596534f, 0.595017f, 0.594306f, 0.594374f, 0.594976f, 0.596090f, 0.597561f,
+	0.599322f, 0.601182f, 0.603008f, 0.604459f, 0.605172f, 0.604836f, 0.605094f, 0.605851f,
+	0.607103f, 0.608951f, 0.611333f, 0.614298f, 0.617685f, 0.621365f, 0.624917f, 0.627560f,
+	0.988957f, 0.655107f, 0.631899f, 0.615477f, 0.603387f, 0.594386f, 0.587729f, 0.582885f,
+	0.579565f, 0.577473f, 0.576324f, 0.576010f, 0.576336f, 0.577212f, 0.578431f, 0.579945f,
+	0.581531f, 0.583112f, 0.584396f, 0.585147f, 0.584813f, 0.583142f, 0.581963f, 0.581193f,
+	0.580882f, 0.581028f, 0.581728f, 0.582796f, 0.584293f, 0.586005f, 0.587492f, 0.588049f,
+	0.988173f, 0.635905f, 0.612078f, 0.595480f, 0.583441f, 0.574703f, 0.568425f, 0.564024f,
+	0.561140f, 0.559485f, 0.558798f, 0.558874f, 0.559541f, 0.560634f, 0.562004f, 0.563491f,
+	0.564948f, 0.566199f, 0.567035f, 0.567023f, 0.565726f, 0.562721f, 0.560041f, 0.557701f,
+	0.555831f, 0.554273f, 0.553099f, 0.552305f, 0.551772f, 0.551353f, 0.550657f, 0.548903f,
+	0.987373f, 0.617227f, 0.592828f, 0.576225f, 0.564394f, 0.555988f, 0.550121f, 0.546227f,
+	0.543881f, 0.542681f, 0.542458f, 0.542934f, 0.543903f, 0.545210f, 0.546707f, 0.548228f,
+	0.549538f, 0.550445f, 0.550805f, 0.550109f, 0.547751f, 0.543389f, 0.539210f, 0.535422f,
+	0.531828f, 0.528608f, 0.525616f, 0.522874f, 0.520291f, 0.517688f, 0.514708f, 0.510563f,
+	0.986559f, 0.599103f, 0.574288f, 0.557732f, 0.546239f, 0.538316f, 0.532970f, 0.529651f,
+	0.527820f, 0.527118f, 0.527311f, 0.528171f, 0.529407f, 0.530915f, 0.532522f, 0.533994f,
+	0.535118f, 0.535801f, 0.535642f, 0.534293f, 0.530879f, 0.525170f, 0.519546f, 0.514148f,
+	0.508991f, 0.504039f, 0.499243f, 0.494585f, 0.489942f, 0.485196f, 0.479901f, 0.473401f,
+	0.985730f, 0.581655f, 0.556554f, 0.540184f, 0.529114f, 0.521714f, 0.516966f, 0.514219f,
+	0.512946f, 0.512771f, 0.513371f, 0.514547f, 0.516045f, 0.517705f, 0.519353f, 0.520755f,
+	0.521773f, 0.522106f, 0.521507f, 0.519453f, 0.515120f, 0.507990f, 0.500909f, 0.494001f,
+	0.487232f, 0.480554f, 0.473957f, 0.467418f, 0.460814f, 0.453917f, 0.446462f, 0.437719f,
+	0.984889f, 0.564908f, 0.539646f, 0.523577f, 0.513050f, 0.506280f, 0.502157f, 0.500014f,
+	0.499303f, 0.499575f, 0.500561f, 0.502041f, 0.503759f, 0.505519f, 0.507149f, 0.508472f,
+	0.509302f, 0.509415f, 0.508315f, 0.505590f, 0.500308f, 0.491781f, 0.483250f, 0.474817f,
+	0.466425f, 0.458096f, 0.449795f, 0.441427f, 0.432918f, 0.424064f, 0.414531f, 0.403743f,
+	0.994177f, 0.999982f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.893144f, 0.999421f, 0.999853f, 0.999941f, 0.999969f, 0.999975f, 0.999978f, 0.999980f,
+	0.999981f, 0.999982f, 0.999982f, 0.999983f, 0.999998f, 0.999999f, 0.999999f, 0.999999f,
+	0.999999f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 0.999995f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.954721f, 0.990025f, 0.997664f, 0.998957f, 0.999414f, 0.999667f, 0.999763f, 0.999826f,
+	0.999862f, 0.999891f, 0.999916f, 0.999938f, 0.999945f, 0.999954f, 0.999968f, 0.999970f,
+	0.999963f, 0.999948f, 0.999965f, 0.999957f, 0.999979f, 0.999970f, 0.999971f, 0.999975f,
+	0.999975f, 0.999896f, 0.999967f, 0.999977f, 0.999981f, 0.999983f, 0.999984f, 0.999985f,
+	0.978807f, 0.954224f, 0.987119f, 0.994361f, 0.996921f, 0.998029f, 0.998639f, 0.998995f,
+	0.999228f, 0.999365f, 0.999460f, 0.999568f, 0.999605f, 0.999654f, 0.999735f, 0.999792f,
+	0.999767f, 0.999749f, 0.999818f, 0.999789f, 0.999807f, 0.999837f, 0.999812f, 0.999825f,
+	0.999810f, 0.999483f, 0.999803f, 0.999852f, 0.999883f, 0.999912f, 0.999919f, 0.999923f,
+	0.987992f, 0.909724f, 0.961655f, 0.981621f, 0.989578f, 0.993354f, 0.995435f, 0.996624f,
+	0.997418f, 0.997948f, 0.998336f, 0.998613f, 0.998789f, 0.998939f, 0.999063f, 0.999167f,
+	0.999264f, 0.999332f, 0.999325f, 0.999409f, 0.999432f, 0.999400f, 0.999427f, 0.999386f,
+	0.999291f, 0.998614f, 0.999417f, 0.999568f, 0.999631f, 0.999673f, 0.999728f, 0.999723f,
+	0.992291f, 0.888238f, 0.927352f, 0.958312f, 0.974630f, 0.983300f, 0.988279f, 0.991372f,
+	0.993353f, 0.994671f, 0.995655f, 0.996364f, 0.996827f, 0.997294f, 0.997644f, 0.997844f,
+	0.998083f, 0.998223f, 0.998343f, 0.998430f, 0.998474f, 0.998506f, 0.998554f, 0.998441f,
+	0.998083f, 0.997155f, 0.998536f, 0.998925f, 0.999113f, 0.999208f, 0.999269f, 0.999307f,
+	0.994579f, 0.887427f, 0.899282f, 0.929380f, 0.951926f, 0.966452f, 0.975642f, 0.981660f,
+	0.985746f, 0.988599f, 0.990603f, 0.992092f, 0.993274f, 0.994167f, 0.994827f, 0.995368f,
+	0.995819f, 0.996141f, 0.996383f, 0.996589f, 0.996750f, 0.996843f, 0.996827f, 0.996550f,
+	0.995845f, 0.994973f, 0.996944f, 0.997782f, 0.998117f, 0.998313f, 0.998434f, 0.998532f,
+	0.995878f, 0.894413f, 0.883909f, 0.903401f, 0.925936f, 0.944021f, 0.957281f, 0.966789f,
+	0.973576f, 0.978536f, 0.982225f, 0.985006f, 0.987098f, 0.988806f, 0.990132f, 0.991130f,
+	0.991946f, 0.992593f, 0.993128f, 0.993526f, 0.993773f, 0.993868f, 0.993846f, 0.993423f,
+	0.992323f, 0.991859f, 0.994398f, 0.995790f, 0.996449f, 0.996769f, 0.997021f, 0.997226f,
+	0.996625f, 0.901676f, 0.878535f, 0.885125f, 0.902101f, 0.919794f, 0.935073f, 0.947289f,
+	0.956768f, 0.964108f, 0.969793f, 0.974206f, 0.977701f, 0.980429f, 0.982641f, 0.984414f,
+	0.985851f, 0.986933f, 0.987845f, 0.988499f, 0.988936f, 0.989148f, 0.989073f, 0.988534f,
+	0.987420f, 0.987561f, 0.990562f, 0.992651f, 0.993760f, 0.994415f, 0.994842f, 0.995171f,
+	0.997035f, 0.906410f, 0.878023f, 0.874297f, 0.883508f, 0.897552f, 0.912096f, 0.925169f,
+	0.936344f, 0.945642f, 0.953244f, 0.959419f, 0.964387f, 0.968522f, 0.971836f, 0.974567f,
+	0.976738f, 0.978550f, 0.979909f, 0.980994f, 0.981687f, 0.982058f, 0.982025f, 0.981479f,
+	0.980766f, 0.981680f, 0.985141f, 0.988080f, 0.989821f, 0.990858f, 0.991554f, 0.992104f,
+	0.997221f, 0.907939f, 0.878684f, 0.868250f, 0.870318f, 0.879136f, 0.890761f, 0.902859f,
+	0.914277f, 0.924485f, 0.933349f, 0.940962f, 0.947357f, 0.952819f, 0.957337f, 0.961147f,
+	0.964239f, 0.966789f, 0.968840f, 0.970420f, 0.971474f, 0.972148f, 0.972281f, 0.972052f,
+	0.972073f, 0.973828f, 0.977859f, 0.981685f, 0.984155f, 0.985769f, 0.986854f, 0.987716f,
+	0.997246f, 0.906540f, 0.878398f, 0.864254f, 0.860874f, 0.864608f, 0.872381f, 0.882063f,
+	0.892302f, 0.902230f, 0.911489f, 0.919838f, 0.927195f, 0.933649f, 0.939207f, 0.943978f,
+	0.948028f, 0.951490f, 0.954099f, 0.956290f, 0.957850f, 0.958914f, 0.959487f, 0.959909f,
+	0.960961f, 0.963689f, 0.968373f, 0.972991f, 0.976409f, 0.978748f, 0.980366f, 0.981654f,
+	0.997150f, 0.902429f, 0.876136f, 0.860366f, 0.853316f, 0.852818f, 0.856737f, 0.863411f,
+	0.871505f, 0.880151f, 0.888790f, 0.897072f, 0.904713f, 0.911675f, 0.917942f, 0.923433f,
+	0.928241f, 0.932346f, 0.935756f, 0.938424f, 0.940546f, 0.942206f, 0.943493f, 0.944880f,
+	0.947105f, 0.950892f, 0.956253f, 0.961733f, 0.966155f, 0.969382f, 0.971674f, 0.973537f,
+	0.996959f, 0.896050f, 0.871629f, 0.855316f, 0.846072f, 0.842396f, 0.843063f, 0.846676f,
+	0.852310f, 0.859042f, 0.866355f, 0.873782f, 0.880999f, 0.887936f, 0.894298f, 0.900090f,
+	0.905364f, 0.909880f, 0.913815f, 0.917042f, 0.919740f, 0.922073f, 0.924245f, 0.926805f,
+	0.930295f, 0.935129f, 0.941207f, 0.947555f, 0.953014f, 0.957230f, 0.960389f, 0.962969f,
+	0.996689f, 0.887709f, 0.864837f, 0.848615f, 0.838036f, 0.832227f, 0.830273f, 0.831181f,
+	0.834310f, 0.838904f, 0.844437f, 0.850551f, 0.856819f, 0.863013f, 0.869067f, 0.874731f,
+	0.879984f, 0.884742f, 0.888919f, 0.892535f, 0.895780f, 0.898809f, 0.902013f, 0.905712f,
+	0.910414f, 0.916192f, 0.923043f, 0.930185f, 0.936681f, 0.941984f, 0.946113f, 0.949564f,
+	0.996354f, 0.877667f, 0.855930f, 0.839951f, 0.828680f, 0.821424f, 0.817427f, 0.816197f,
+	0.817036f, 0.819533f, 0.823168f, 0.827636f, 0.832560f, 0.837741f, 0.842956f, 0.848080f,
+	0.852965f, 0.857582f, 0.861777f, 0.865596f, 0.869224f, 0.872935f, 0.877050f, 0.881811f,
+	0.887504f, 0.894155f, 0.901679f, 0.909544f, 0.916956f, 0.923356f, 0.928544f, 0.932980f,
+	0.995962f, 0.866124f, 0.845110f, 0.829348f, 0.817629f, 0.809357f, 0.803973f, 0.800939f,
+	0.799946f, 0.800492f, 0.802349f, 0.805071f, 0.808518f, 0.812389f, 0.816539f, 0.820809f,
+	0.825053f, 0.829250f, 0.833232f, 0.837006f, 0.840852f, 0.845101f, 0.849864f, 0.855416f,
+	0.861863f, 0.869146f, 0.877226f, 0.885679f, 0.893858f, 0.901211f, 0.907464f, 0.912948f,
+	0.995521f, 0.853296f, 0.832580f, 0.816868f, 0.804871f, 0.795829f, 0.789379f, 0.785014f,
+	0.782467f, 0.781415f, 0.781599f, 0.782804f, 0.784701f, 0.787224f, 0.790189f, 0.793420f,
+	0.796891f, 0.800394f, 0.803928f, 0.807480f, 0.811380f, 0.815838f, 0.821064f, 0.827036f,
+	0.833921f, 0.841569f, 0.849941f, 0.858727f, 0.867476f, 0.875618f, 0.882802f, 0.889307f,
+	0.995043f, 0.839346f, 0.818597f, 0.802725f, 0.790404f, 0.780818f, 0.773515f, 0.768117f,
+	0.764371f, 0.762031f, 0.760791f, 0.760541f, 0.761111f, 0.762350f, 0.764118f, 0.766322f,
+	0.768859f, 0.771650f, 0.774657f, 0.777774f, 0.781405f, 0.785814f, 0.791097f, 0.797244f,
+	0.804169f, 0.811844f, 0.820222f, 0.829104f, 0.838122f, 0.846747f, 0.854633f, 0.862030f,
+	0.994515f, 0.824459f, 0.803278f, 0.787137f, 0.774425f, 0.764368f, 0.756410f, 0.750209f,
+	0.745519f, 0.742084f, 0.739701f, 0.738347f, 0.737760f, 0.737854f, 0.738513f, 0.739774f,
+	0.741400f, 0.743467f, 0.745764f, 0.748300f, 0.751512f, 0.755545f, 0.760576f, 0.766478f,
+	0.773138f, 0.780531f, 0.788621f, 0.797266f, 0.806166f, 0.814934f, 0.823209f, 0.831242f,
+	0.993959f, 0.808776f, 0.786981f, 0.770356f, 0.757244f, 0.746638f, 0.738105f, 0.731295f,
+	0.725879f, 0.721578f, 0.718403f, 0.716079f, 0.714533f, 0.713758f, 0.713540f, 0.713928f,
+	0.714764f, 0.716067f, 0.717741f, 0.719530f, 0.722104f, 0.725634f, 0.730041f, 0.735320f,
+	0.741365f, 0.748168f, 0.755604f, 0.763674f, 0.772121f, 0.780633f, 0.788893f, 0.797222f,
+	0.993373f, 0.792430f, 0.769801f, 0.752571f, 0.738944f, 0.727879f, 0.718900f, 0.711521f,
+	0.705568f, 0.700676f, 0.696838f, 0.693886f, 0.691675f, 0.690160f, 0.689238f, 0.688924f,
+	0.689181f, 0.689788f, 0.690675f, 0.691723f, 0.693470f, 0.696131f, 0.699753f, 0.704172f,
+	0.709336f, 0.715212f, 0.721753f, 0.728945f, 0.736576f, 0.744423f, 0.752255f, 0.760388f,
+	0.992760f, 0.775550f, 0.751936f, 0.734033f, 0.719853f, 0.708377f, 0.698953f, 0.691183f,
+	0.684800f, 0.679536f, 0.675228f, 0.671827f, 0.669132f, 0.667124f, 0.665720f, 0.664899f,
+	0.664564f, 0.664596f, 0.664810f, 0.664973f, 0.665736f, 0.667475f, 0.670032f, 0.673398f,
+	0.677459f, 0.682194f, 0.687556f, 0.693557f, 0.700080f, 0.706855f, 0.713782f, 0.721277f,
+	0.992124f, 0.758316f, 0.733599f, 0.714999f, 0.700267f, 0.688326f, 0.678549f, 0.670516f,
+	0.663826f, 0.658329f, 0.653757f, 0.650109f, 0.647163f, 0.644876f, 0.643133f, 0.641943f,
+	0.641144f, 0.640616f, 0.640144f, 0.639377f, 0.639163f, 0.639764f, 0.641176f, 0.643306f,
+	0.646110f, 0.649499f, 0.653501f, 0.658035f, 0.663125f, 0.668523f, 0.674142f, 0.680507f,
+	0.991467f, 0.740799f, 0.714927f, 0.695589f, 0.680303f, 0.668034f, 0.657979f, 0.649728f,
+	0.642913f, 0.637336f, 0.632663f, 0.628919f, 0.625820f, 0.623412f, 0.621511f, 0.620074f,
+	0.618894f, 0.617896f, 0.616737f, 0.614963f, 0.613675f, 0.613134f, 0.613274f, 0.614063f,
+	0.615424f, 0.617379f, 0.619809f, 0.622796f, 0.626205f, 0.629952f, 0.633913f, 0.638734f,
+	0.990789f, 0.723197f, 0.696191f, 0.676078f, 0.660304f, 0.647715f, 0.637504f, 0.629176f,
+	0.622283f, 0.616691f, 0.612075f, 0.608368f, 0.605336f, 0.602931f, 0.600925f, 0.599299f,
+	0.597809f, 0.596358f, 0.594553f, 0.591817f, 0.589359f, 0.587614f, 0.586439f, 0.585835f,
+	0.585740f, 0.586079f, 0.586869f, 0.588127f, 0.589752f, 0.591630f, 0.593696f, 0.596613f,
+	0.990093f, 0.705589f, 0.677361f, 0.656613f, 0.640463f, 0.627640f, 0.617337f, 0.608949f,
+	0.602209f, 0.596695f, 0.592244f, 0.588686f, 0.585787f, 0.583385f, 0.581436f, 0.579672f,
+	0.577978f, 0.576049f, 0.573562f, 0.569870f, 0.566266f, 0.563234f, 0.560671f, 0.558654f,
+	0.557041f, 0.555799f, 0.554900f, 0.554356f, 0.554060f, 0.553946f, 0.553950f, 0.554762f,
+	0.989381f, 0.688055f, 0.658818f, 0.637393f, 0.620906f, 0.607957f, 0.597632f, 0.589391f,
+	0.582787f, 0.577512f, 0.573294f, 0.569912f, 0.567200f, 0.564951f, 0.562992f, 0.561147f,
+	0.559219f, 0.556918f, 0.553805f, 0.549066f, 0.544211f, 0.539957f, 0.536073f, 0.532575f,
+	0.529434f, 0.526578f, 0.523958f, 0.521631f, 0.519439f, 0.517256f, 0.515127f, 0.513734f,
+	0.988653f, 0.670767f, 0.640468f, 0.618522f, 0.601836f, 0.588848f, 0.578636f, 0.570575f,
+	0.564269f, 0.559228f, 0.555300f, 0.552191f, 0.549664f, 0.547575f, 0.545692f, 0.543805f,
+	0.541645f, 0.538933f, 0.535150f, 0.529423f, 0.523408f, 0.517816f, 0.512603f, 0.507694f,
+	0.502960f, 0.498538f, 0.494270f, 0.490106f, 0.485985f, 0.481837f, 0.477561f, 0.473996f,
+	0.987911f, 0.653756f, 0.622496f, 0.600166f, 0.583366f, 0.570459f, 0.560431f, 0.552663f,
+	0.546625f, 0.541952f, 0.538335f, 0.535513f, 0.533227f, 0.531283f, 0.529418f, 0.527487f,
+	0.525138f, 0.522052f, 0.517577f, 0.510856f, 0.503645f, 0.496814f, 0.490229f, 0.483862f,
+	0.477700f, 0.471690f, 0.465740f, 0.459840f, 0.453948f, 0.447846f, 0.441580f, 0.435922f,
+	0.987156f, 0.637183f, 0.605091f, 0.582399f, 0.565576f, 0.552864f, 0.543131f, 0.535683f,
+	0.530044f, 0.525720f, 0.522450f, 0.519913f, 0.517850f, 0.516071f, 0.514291f, 0.512256f,
+	0.509694f, 0.506212f, 0.501153f, 0.493268f, 0.484931f, 0.476782f, 0.468939f, 0.461156f,
+	0.453573f, 0.445992f, 0.438486f, 0.430963f, 0.423305f, 0.415412f, 0.407339f, 0.399790f,
+	0.986388f, 0.621087f, 0.588194f, 0.565342f, 0.548605f, 0.536140f, 0.526797f, 0.519758f,
+	0.514518f, 0.510580f, 0.507605f, 0.505400f, 0.503544f, 0.501876f, 0.500123f, 0.498062f,
+	0.495228f, 0.491388f, 0.485670f, 0.476828f, 0.467218f, 0.457848f, 0.448622f, 0.439494f,
+	0.430511f, 0.421518f, 0.412475f, 0.403396f, 0.394171f, 0.384669f, 0.374969f, 0.365789f,
+	0.994177f, 0.999982f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.893144f, 0.999421f, 0.999853f, 0.999941f, 0.999969f, 0.999975f, 0.999978f, 0.999980f,
+	0.999981f, 0.999982f, 0.999982f, 0.999983f, 0.999998f, 0.999999f, 0.999999f, 0.999999f,
+	0.999999f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 0.999991f, 1.000000f,
+	1.000000f, 0.999998f, 0.999996f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.954722f, 0.990037f, 0.997666f, 0.998982f, 0.999425f, 0.999667f, 0.999763f, 0.999826f,
+	0.999862f, 0.999891f, 0.999916f, 0.999938f, 0.999945f, 0.999954f, 0.999968f, 0.999970f,
+	0.999973f, 0.999975f, 0.999969f, 0.999960f, 0.999971f, 0.999980f, 0.999959f, 0.999966f,
+	0.999972f, 0.999974f, 0.999915f, 0.999971f, 0.999979f, 0.999982f, 0.999984f, 0.999985f,
+	0.978809f, 0.954339f, 0.987167f, 0.994429f, 0.996961f, 0.998043f, 0.998648f, 0.999012f,
+	0.999248f, 0.999388f, 0.999484f, 0.999599f, 0.999634f, 0.999668f, 0.999728f, 0.999749f,
+	0.999773f, 0.999801f, 0.999812f, 0.999815f, 0.999838f, 0.999848f, 0.999795f, 0.999831f,
+	0.999821f, 0.999808f, 0.999552f, 0.999824f, 0.999875f, 0.999909f, 0.999918f, 0.999923f,
+	0.987999f, 0.910009f, 0.961775f, 0.981702f, 0.989617f, 0.993425f, 0.995467f, 0.996658f,
+	0.997440f, 0.997975f, 0.998351f, 0.998611f, 0.998829f, 0.998992f, 0.999104f, 0.999221f,
+	0.999262f, 0.999288f, 0.999377f, 0.999422f, 0.999440f, 0.999429f, 0.999454f, 0.999473f,
+	0.999473f, 0.999362f, 0.998775f, 0.999466f, 0.999605f, 0.999664f, 0.999725f, 0.999722f,
+	0.992305f, 0.888894f, 0.927737f, 0.958537f, 0.974777f, 0.983462f, 0.988397f, 0.991431f,
+	0.993388f, 0.994727f, 0.995730f, 0.996411f, 0.996896f, 0.997328f, 0.997653f, 0.997904f,
+	0.998114f, 0.998272f, 0.998399f, 0.998471f, 0.998596f, 0.998623f, 0.998633f, 0.998617f,
+	0.998596f, 0.998221f, 0.997394f, 0.998690f, 0.999044f, 0.999172f, 0.999261f, 0.999306f,
+	0.994603f, 0.888709f, 0.900006f, 0.929873f, 0.952279f, 0.966731f, 0.975924f, 0.981864f,
+	0.985922f, 0.988733f, 0.990770f, 0.992271f, 0.993407f, 0.994263f, 0.994936f, 0.995498f,
+	0.995960f, 0.996251f, 0.996519f, 0.996724f, 0.996915f, 0.997005f, 0.997088f, 0.997074f,
+	0.996883f, 0.996185f, 0.995377f, 0.997276f, 0.997970f, 0.998239f, 0.998416f, 0.998529f,
+	0.995916f, 0.896515f, 0.885141f, 0.904297f, 0.926568f, 0.944573f, 0.957747f, 0.967183f,
+	0.973937f, 0.978839f, 0.982498f, 0.985266f, 0.987365f, 0.989011f, 0.990318f, 0.991338f,
+	0.992179f, 0.992806f, 0.993337f, 0.993764f, 0.994129f, 0.994266f, 0.994421f, 0.994347f,
+	0.994000f, 0.992975f, 0.992463f, 0.994935f, 0.996112f, 0.996650f, 0.996983f, 0.997218f,
+	0.996679f, 0.904771f, 0.880526f, 0.886577f, 0.903213f, 0.920712f, 0.935835f, 0.947933f,
+	0.957357f, 0.964608f, 0.970244f, 0.974617f, 0.978104f, 0.980814f, 0.982983f, 0.984802f,
+	0.986253f, 0.987355f, 0.988268f, 0.988992f, 0.989558f, 0.989922f, 0.990078f, 0.990030f,
+	0.989525f, 0.988389f, 0.988399f, 0.991357f, 0.993208f, 0.994166f, 0.994761f, 0.995151f,
+	0.997109f, 0.910691f, 0.881075f, 0.876550f, 0.885308f, 0.898984f, 0.913267f, 0.926189f,
+	0.937281f, 0.946511f, 0.954025f, 0.960115f, 0.965119f, 0.969170f, 0.972447f, 0.975189f,
+	0.977406f, 0.979215f, 0.980700f, 0.981830f, 0.982701f, 0.983363f, 0.983637f, 0.983573f,
+	0.982995f, 0.982136f, 0.982855f, 0.986290f, 0.988940f, 0.990452f, 0.991404f, 0.992055f,
+	0.997319f, 0.913620f, 0.882957f, 0.871493f, 0.872927f, 0.881312f, 0.892576f, 0.904479f,
+	0.915668f, 0.925758f, 0.934564f, 0.942042f, 0.948468f, 0.953817f, 0.958359f, 0.962143f,
+	0.965279f, 0.967857f, 0.969976f, 0.971701f, 0.973021f, 0.973958f, 0.974493f, 0.974545f,
+	0.974171f, 0.973922f, 0.975429f, 0.979401f, 0.982875f, 0.985104f, 0.986576f, 0.987608f,
+	0.997372f, 0.913691f, 0.884031f, 0.868767f, 0.864559f, 0.867712f, 0.875025f, 0.884385f,
+	0.894359f, 0.904125f, 0.913209f, 0.921415f, 0.928772f, 0.935183f, 0.940688f, 0.945500f,
+	0.949578f, 0.952990f, 0.955763f, 0.958153f, 0.959955f, 0.961320f, 0.962241f, 0.962606f,
+	0.962771f, 0.963356f, 0.965785f, 0.970296f, 0.974631f, 0.977736f, 0.979887f, 0.981436f,
+	0.997306f, 0.911317f, 0.883356f, 0.866299f, 0.858319f, 0.857040f, 0.860422f, 0.866689f,
+	0.874424f, 0.882828f, 0.891260f, 0.899413f, 0.906972f, 0.913877f, 0.920083f, 0.925574f,
+	0.930376f, 0.934547f, 0.937963f, 0.940924f, 0.943310f, 0.945181f, 0.946515f, 0.947507f,
+	0.948448f, 0.950131f, 0.953528f, 0.958609f, 0.963798f, 0.967887f, 0.970887f, 0.973128f,
+	0.997148f, 0.906709f, 0.880567f, 0.862913f, 0.852496f, 0.848034f, 0.847981f, 0.851115f,
+	0.856221f, 0.862657f, 0.869697f, 0.876912f, 0.884051f, 0.890888f, 0.897160f, 0.903008f,
+	0.908184f, 0.912790f, 0.916687f, 0.920106f, 0.922980f, 0.925370f, 0.927366f, 0.929092f,
+	0.931078f, 0.933916f, 0.938223f, 0.944014f, 0.950023f, 0.955137f, 0.959153f, 0.962251f,
+	0.996915f, 0.900323f, 0.875674f, 0.857948f, 0.846184f, 0.839366f, 0.836598f, 0.836902f,
+	0.839498f, 0.843734f, 0.848928f, 0.854712f, 0.860799f, 0.866930f, 0.872822f, 0.878433f,
+	0.883619f, 0.888264f, 0.892412f, 0.896092f, 0.899357f, 0.902270f, 0.904868f, 0.907495f,
+	0.910541f, 0.914550f, 0.919756f, 0.926224f, 0.933031f, 0.939149f, 0.944255f, 0.948376f,
+	0.996618f, 0.892310f, 0.868728f, 0.851195f, 0.838613f, 0.830237f, 0.825352f, 0.823376f,
+	0.823657f, 0.825625f, 0.828834f, 0.832964f, 0.837645f, 0.842582f, 0.847675f, 0.852594f,
+	0.857385f, 0.861781f, 0.865753f, 0.869484f, 0.872899f, 0.876230f, 0.879453f, 0.882928f,
+	0.886942f, 0.891926f, 0.897931f, 0.905015f, 0.912540f, 0.919641f, 0.925872f, 0.931118f,
+	0.996268f, 0.882876f, 0.859916f, 0.842543f, 0.829458f, 0.820000f, 0.813588f, 0.809767f,
+	0.808032f, 0.808016f, 0.809351f, 0.811677f, 0.814716f, 0.818338f, 0.822209f, 0.826204f,
+	0.830139f, 0.833925f, 0.837419f, 0.840903f, 0.844362f, 0.847850f, 0.851564f, 0.855722f,
+	0.860564f, 0.866281f, 0.872945f, 0.880489f, 0.888555f, 0.896460f, 0.903772f, 0.910171f,
+	0.995870f, 0.872256f, 0.849559f, 0.832144f, 0.818660f, 0.808392f, 0.800832f, 0.795534f,
+	0.792197f, 0.790428f, 0.790008f, 0.790639f, 0.792078f, 0.794123f, 0.796687f, 0.799524f,
+	0.802482f, 0.805337f, 0.808147f, 0.811162f, 0.814371f, 0.817877f, 0.821857f, 0.826408f,
+	0.831758f, 0.837936f, 0.844940f, 0.852789f, 0.861200f, 0.869676f, 0.877860f, 0.885350f,
+	0.995437f, 0.860574f, 0.837761f, 0.820122f, 0.806227f, 0.795319f, 0.786809f, 0.780355f,
+	0.775721f, 0.772511f, 0.770552f, 0.769626f, 0.769575f, 0.770221f, 0.771406f, 0.772913f,
+	0.774715f, 0.776610f, 0.778492f, 0.780844f, 0.783575f, 0.786921f, 0.790830f, 0.795517f,
+	0.801031f, 0.807306f, 0.814387f, 0.822247f, 0.830713f, 0.839469f, 0.848255f, 0.856626f,
+	0.994956f, 0.847896f, 0.824611f, 0.806637f, 0.792309f, 0.780760f, 0.771516f, 0.764137f,
+	0.758355f, 0.753955f, 0.750733f, 0.748540f, 0.747111f, 0.746439f, 0.746304f, 0.746644f,
+	0.747344f, 0.748086f, 0.749002f, 0.750504f, 0.752646f, 0.755544f, 0.759116f, 0.763601f,
+	0.768868f, 0.774921f, 0.781735f, 0.789313f, 0.797526f, 0.806176f, 0.815200f, 0.824148f,
+	0.994447f, 0.834481f, 0.810413f, 0.791905f, 0.777010f, 0.764861f, 0.754903f, 0.746797f,
+	0.740153f, 0.734788f, 0.730537f, 0.727187f, 0.724670f, 0.722826f, 0.721572f, 0.720798f,
+	0.720382f, 0.720086f, 0.719967f, 0.720551f, 0.721987f, 0.724179f, 0.727204f, 0.731120f,
+	0.735824f, 0.741317f, 0.747562f, 0.754492f, 0.762116f, 0.770336f, 0.779149f, 0.788243f,
+	0.993909f, 0.820374f, 0.795348f, 0.776050f, 0.760586f, 0.747856f, 0.737306f, 0.728511f,
+	0.721120f, 0.715033f, 0.709911f, 0.705671f, 0.702233f, 0.699449f, 0.697242f, 0.695530f,
+	0.694135f, 0.692833f, 0.691594f, 0.691253f, 0.691802f, 0.693176f, 0.695435f, 0.698532f,
+	0.702440f, 0.707023f, 0.712369f, 0.718415f, 0.725063f, 0.732445f, 0.740648f, 0.749400f,
+	0.993345f, 0.805724f, 0.779490f, 0.759391f, 0.743218f, 0.729860f, 0.718788f, 0.709357f,
+	0.701426f, 0.694684f, 0.688965f, 0.684050f, 0.679878f, 0.676361f, 0.673450f, 0.670886f,
+	0.668645f, 0.666421f, 0.664205f, 0.662821f, 0.662412f, 0.662858f, 0.664106f, 0.666214f,
+	0.669049f, 0.672555f, 0.676726f, 0.681540f, 0.686991f, 0.693181f, 0.700329f, 0.708242f,
+	0.992758f, 0.790547f, 0.763028f, 0.742039f, 0.725153f, 0.711216f, 0.699565f, 0.689658f,
+	0.681275f, 0.674085f, 0.667832f, 0.662447f, 0.657806f, 0.653716f, 0.650163f, 0.646947f,
+	0.643996f, 0.640948f, 0.637751f, 0.635424f, 0.633953f, 0.633296f, 0.633483f, 0.634414f,
+	0.636031f, 0.638243f, 0.641030f, 0.644451f, 0.648427f, 0.653153f, 0.658840f, 0.665475f,
+	0.992151f, 0.775021f, 0.746163f, 0.724193f, 0.706553f, 0.692034f, 0.679922f, 0.669643f,
+	0.660834f, 0.653284f, 0.646746f, 0.641052f, 0.636051f, 0.631603f, 0.627625f, 0.623907f,
+	0.620342f, 0.616528f, 0.612328f, 0.608987f, 0.606458f, 0.604756f, 0.603738f, 0.603381f,
+	0.603654f, 0.604433f, 0.605758f, 0.607551f, 0.609892f, 0.612880f, 0.616881f, 0.621840f,
+	0.991522f, 0.759285f, 0.728989f, 0.706050f, 0.687717f, 0.672648f, 0.660103f, 0.649476f,
+	0.640430f, 0.632682f, 0.625914f, 0.620038f, 0.614836f, 0.610120f, 0.605852f, 0.601773f,
+	0.597661f, 0.593205f, 0.588036f, 0.583685f, 0.580064f, 0.577214f, 0.574974f, 0.573232f,
+	0.572116f, 0.571419f, 0.571113f, 0.571247f, 0.571837f, 0.572952f, 0.575041f, 0.578065f,
+	0.990877f, 0.743393f, 0.711654f, 0.687741f, 0.668712f, 0.653193f, 0.640291f, 0.629424f,
+	0.620254f, 0.612361f, 0.605541f, 0.599568f, 0.594263f, 0.589470f, 0.584994f, 0.580623f,
+	0.576039f, 0.570931f, 0.564850f, 0.559477f, 0.554762f, 0.550690f, 0.547172f, 0.544125f,
+	0.541565f, 0.539310f, 0.537425f, 0.535850f, 0.534574f, 0.533807f, 0.533878f, 0.534820f,
+	0.990215f, 0.727445f, 0.694301f, 0.669401f, 0.649777f, 0.633849f, 0.620697f, 0.609730f,
+	0.600442f, 0.592580f, 0.585777f, 0.579818f, 0.574518f, 0.569668f, 0.565061f, 0.560470f,
+	0.555532f, 0.549746f, 0.542707f, 0.536339f, 0.530578f, 0.525293f, 0.520503f, 0.516135f,
+	0.512096f, 0.508361f, 0.504829f, 0.501552f, 0.498461f, 0.495780f, 0.493854f, 0.492690f,
+	0.989539f, 0.711525f, 0.676969f, 0.651241f, 0.631116f, 0.614844f, 0.601538f, 0.590482f,
+	0.581265f, 0.573439f, 0.566750f, 0.560897f, 0.555676f, 0.550822f, 0.546154f, 0.541356f,
+	0.536076f, 0.529615f, 0.521769f, 0.514333f, 0.507416f, 0.501022f, 0.494966f, 0.489240f,
+	0.483827f, 0.478546f, 0.473485f, 0.468537f, 0.463727f, 0.459204f, 0.455355f, 0.452158f,
+	0.988848f, 0.695828f, 0.659886f, 0.633368f, 0.612762f, 0.596281f, 0.582904f, 0.571927f,
+	0.562756f, 0.555093f, 0.548546f, 0.542843f, 0.537736f, 0.532942f, 0.528230f, 0.523278f,
+	0.517661f, 0.510637f, 0.501783f, 0.493391f, 0.485364f, 0.477786f, 0.470509f, 0.463510f,
+	0.456670f, 0.450004f, 0.443455f, 0.436914f, 0.430500f, 0.424272f, 0.418628f, 0.413591f,
+	0.988144f, 0.680260f, 0.643017f, 0.615871f, 0.594918f, 0.578290f, 0.564923f, 0.554055f,
+	0.545125f, 0.537612f, 0.531287f, 0.525795f, 0.520833f, 0.516126f, 0.511383f, 0.506244f,
+	0.500283f, 0.492695f, 0.482897f, 0.473433f, 0.464424f, 0.455644f, 0.447167f, 0.438879f,
+	0.430754f, 0.422759f, 0.414765f, 0.406817f, 0.398898f, 0.391144f, 0.383918f, 0.377250f,
+	0.987428f, 0.664937f, 0.626572f, 0.598812f, 0.577631f, 0.560993f, 0.547727f, 0.537068f,
+	0.528353f, 0.521142f, 0.515044f, 0.509738f, 0.504910f, 0.500294f, 0.495526f, 0.490241f,
+	0.483958f, 0.475745f, 0.465018f, 0.454557f, 0.444422f, 0.434532f, 0.424914f, 0.415457f,
+	0.406073f, 0.396754f, 0.387500f, 0.378230f, 0.368990f, 0.359885f, 0.351333f, 0.343296f,
+	0.994177f, 0.999982f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.893149f, 0.999421f, 0.999853f, 0.999941f, 0.999969f, 0.999975f, 0.999978f, 0.999980f,
+	0.999981f, 0.999982f, 0.999982f, 0.999983f, 0.999998f, 0.999999f, 0.999999f, 0.999999f,
+	0.999999f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 0.999991f,
+	1.000000f, 1.000000f, 1.000000f, 0.999998f, 0.999999f, 1.000000f, 1.000000f, 1.000000f,
+	0.954728f, 0.990039f, 0.997669f, 0.998994f, 0.999425f, 0.999667f, 0.999763f, 0.999826f,
+	0.999862f, 0.999891f, 0.999916f, 0.999938f, 0.999945f, 0.999954f, 0.999968f, 0.999970f,
+	0.999973f, 0.999975f, 0.999976f, 0.999978f, 0.999960f, 0.999970f, 0.999980f, 0.999961f,
+	0.999982f, 0.999969f, 0.999973f, 0.999954f, 0.999976f, 0.999981f, 0.999983f, 0.999985f,
+	0.978816f, 0.954413f, 0.987224f, 0.994463f, 0.996964f, 0.998062f, 0.998681f, 0.999034f,
+	0.999264f, 0.999387f, 0.999481f, 0.999603f, 0.999642f, 0.999705f, 0.999759f, 0.999768f,
+	0.999754f, 0.999770f, 0.999845f, 0.999825f, 0.999834f, 0.999854f, 0.999838f, 0.999822f,
+	0.999839f, 0.999840f, 0.999794f, 0.999733f, 0.999862f, 0.999905f, 0.999917f, 0.999923f,
+	0.988008f, 0.910262f, 0.961931f, 0.981775f, 0.989704f, 0.993478f, 0.995506f, 0.996672f,
+	0.997434f, 0.997952f, 0.998346f, 0.998632f, 0.998823f, 0.998964f, 0.999122f, 0.999224f,
+	0.999289f, 0.999340f, 0.999339f, 0.999393f, 0.999471f, 0.999477f, 0.999490f, 0.999487f,
+	0.999507f, 0.999491f, 0.999312f, 0.999184f, 0.999562f, 0.999652f, 0.999722f, 0.999722f,
+	0.992319f, 0.889433f, 0.927968f, 0.958731f, 0.974911f, 0.983535f, 0.988468f, 0.991521f,
+	0.993501f, 0.994832f, 0.995803f, 0.996512f, 0.996993f, 0.997391f, 0.997692f, 0.997898f,
+	0.998101f, 0.998281f, 0.998431f, 0.998563f, 0.998619f, 0.998648f, 0.998713f, 0.998709f,
+	0.998681f, 0.998640f, 0.998151f, 0.998079f, 0.998925f, 0.999142f, 0.999253f, 0.999306f,
+	0.994624f, 0.889615f, 0.900534f, 0.930224f, 0.952556f, 0.966961f, 0.976069f, 0.982016f,
+	0.986056f, 0.988865f, 0.990864f, 0.992327f, 0.993455f, 0.994324f, 0.994984f, 0.995562f,
+	0.995983f, 0.996339f, 0.996607f, 0.996791f, 0.996983f, 0.997141f, 0.997269f, 0.997325f,
+	0.997229f, 0.996991f, 0.996119f, 0.996272f, 0.997727f, 0.998174f, 0.998398f, 0.998528f,
+	0.995946f, 0.898051f, 0.886092f, 0.904916f, 0.927064f, 0.944935f, 0.958028f, 0.967426f,
+	0.974191f, 0.979074f, 0.982707f, 0.985436f, 0.987544f, 0.989149f, 0.990467f, 0.991521f,
+	0.992294f, 0.992904f, 0.993514f, 0.993913f, 0.994286f, 0.994501f, 0.994696f, 0.994788f,
+	0.994682f, 0.994263f, 0.993072f, 0.993534f, 0.995692f, 0.996524f, 0.996946f, 0.997213f,
+	0.996721f, 0.907052f, 0.882028f, 0.887649f, 0.904027f, 0.921367f, 0.936361f, 0.948345f,
+	0.957721f, 0.964968f, 0.970595f, 0.974968f, 0.978367f, 0.981065f, 0.983273f, 0.985040f,
+	0.986459f, 0.987617f, 0.988509f, 0.989280f, 0.989873f, 0.990313f, 0.990680f, 0.990818f,
+	0.990667f, 0.990033f, 0.988798f, 0.989703f, 0.992507f, 0.993940f, 0.994689f, 0.995137f,
+	0.997166f, 0.913852f, 0.883282f, 0.878213f, 0.886593f, 0.900037f, 0.914129f, 0.926917f,
+	0.937924f, 0.947069f, 0.954540f, 0.960609f, 0.965544f, 0.969588f, 0.972883f, 0.975596f,
+	0.977785f, 0.979607f, 0.981129f, 0.982340f, 0.983289f, 0.984039f, 0.984537f, 0.984768f,
+	0.984620f, 0.983940f, 0.982992f, 0.984462f, 0.987932f, 0.990077f, 0.991273f, 0.992020f,
+	0.997392f, 0.917798f, 0.886050f, 0.873893f, 0.874859f, 0.882869f, 0.893909f, 0.905568f,
+	0.916700f, 0.926675f, 0.935374f, 0.942831f, 0.949118f, 0.954498f, 0.959005f, 0.962756f,
+	0.965898f, 0.968496f, 0.970659f, 0.972512f, 0.973949f, 0.975053f, 0.975814f, 0.976223f,
+	0.976146f, 0.975641f, 0.975350f, 0.977475f, 0.981524f, 0.984520f, 0.986349f, 0.987532f,
+	0.997464f, 0.918982f, 0.888167f, 0.872076f, 0.867228f, 0.869895f, 0.876942f, 0.886042f,
+	0.895819f, 0.905430f, 0.914413f, 0.922574f, 0.929800f, 0.936165f, 0.941693f, 0.946432f,
+	0.950517f, 0.953938f, 0.956856f, 0.959318f, 0.961311f, 0.962895f, 0.964023f, 0.964718f,
+	0.964930f, 0.964886f, 0.965500f, 0.968312f, 0.972967f, 0.976886f, 0.979512f, 0.981284f,
+	0.997420f, 0.917835f, 0.888613f, 0.870617f, 0.861927f, 0.860107f, 0.863041f, 0.868998f,
+	0.876504f, 0.884708f, 0.892979f, 0.901000f, 0.908420f, 0.915315f, 0.921474f, 0.926943f,
+	0.931722f, 0.935852f, 0.939387f, 0.942554f, 0.945083f, 0.947185f, 0.948763f, 0.949858f,
+	0.950636f, 0.951317f, 0.952964f, 0.956543f, 0.961825f, 0.966709f, 0.970295f, 0.972846f,
+	0.997286f, 0.914618f, 0.887107f, 0.868431f, 0.857180f, 0.852041f, 0.851497f, 0.854193f,
+	0.859024f, 0.865184f, 0.872026f, 0.879106f, 0.886130f, 0.892839f, 0.899060f, 0.904858f,
+	0.909987f, 0.914586f, 0.918632f, 0.922189f, 0.925241f, 0.927838f, 0.929942f, 0.931576f,
+	0.933053f, 0.934740f, 0.937432f, 0.941846f, 0.947758f, 0.953588f, 0.958257f, 0.961760f,
+	0.997079f, 0.909605f, 0.883569f, 0.864752f, 0.852080f, 0.844529f, 0.841119f, 0.840981f,
+	0.843155f, 0.847015f, 0.851956f, 0.857623f, 0.863494f, 0.869493f, 0.875325f, 0.880828f,
+	0.885909f, 0.890513f, 0.894802f, 0.898638f, 0.902040f, 0.905038f, 0.907612f, 0.909878f,
+	0.912161f, 0.914903f, 0.918656f, 0.923868f, 0.930414f, 0.937154f, 0.942961f, 0.947571f,
+	0.996811f, 0.903097f, 0.878119f, 0.859395f, 0.845844f, 0.836620f, 0.831061f, 0.828469f,
+	0.828269f, 0.829847f, 0.832793f, 0.836668f, 0.841109f, 0.845894f, 0.850802f, 0.855627f,
+	0.860254f, 0.864471f, 0.868550f, 0.872345f, 0.875879f, 0.879136f, 0.882098f, 0.885024f,
+	0.888134f, 0.891829f, 0.896522f, 0.902433f, 0.909581f, 0.917144f, 0.924059f, 0.929865f,
+	0.996490f, 0.895275f, 0.870874f, 0.852254f, 0.838096f, 0.827706f, 0.820548f, 0.816050f,
+	0.813797f, 0.813344f, 0.814203f, 0.816240f, 0.819012f, 0.822339f, 0.826035f, 0.829743f,
+	0.833485f, 0.836944f, 0.840546f, 0.844023f, 0.847403f, 0.850709f, 0.853972f, 0.857381f,
+	0.861142f, 0.865647f, 0.871092f, 0.877559f, 0.885194f, 0.893404f, 0.901318f, 0.908314f,
+	0.996125f, 0.886285f, 0.862064f, 0.843380f, 0.828762f, 0.817524f, 0.809105f, 0.803088f,
+	0.799103f, 0.796788f, 0.795885f, 0.796122f, 0.797226f, 0.798997f, 0.801201f, 0.803673f,
+	0.806181f, 0.808678f, 0.811433f, 0.814337f, 0.817331f, 0.820451f, 0.823764f, 0.827465f,
+	0.831708f, 0.836666f, 0.842572f, 0.849410f, 0.857302f, 0.865975f, 0.874649f, 0.882720f,
+	0.995724f, 0.876280f, 0.851856f, 0.832907f, 0.817820f, 0.805845f, 0.796432f, 0.789197f,
+	0.783809f, 0.779992f, 0.777481f, 0.776055f, 0.775544f, 0.775702f, 0.776464f, 0.777529f,
+	0.778760f, 0.780077f, 0.781781f, 0.783775f, 0.786237f, 0.789027f, 0.792140f, 0.795858f,
+	0.800220f, 0.805373f, 0.811354f, 0.818283f, 0.826214f, 0.835016f, 0.844159f, 0.853056f,
+	0.995277f, 0.865377f, 0.840390f, 0.820999f, 0.805434f, 0.792791f, 0.782516f, 0.774235f,
+	0.767696f, 0.762587f, 0.758722f, 0.755839f, 0.753856f, 0.752609f, 0.751880f, 0.751608f,
+	0.751379f, 0.751407f, 0.751966f, 0.753088f, 0.754721f, 0.756873f, 0.759629f, 0.763034f,
+	0.767228f, 0.772230f, 0.777964f, 0.784633f, 0.792275f, 0.800909f, 0.810133f, 0.819487f,
+	0.994803f, 0.853678f, 0.827855f, 0.807841f, 0.791648f, 0.778295f, 0.767321f, 0.758196f,
+	0.750646f, 0.744425f, 0.739414f, 0.735313f, 0.732081f, 0.729507f, 0.727464f, 0.725827f,
+	0.724300f, 0.723009f, 0.722385f, 0.722419f, 0.723200f, 0.724606f, 0.726756f, 0.729616f,
+	0.733254f, 0.737740f, 0.742946f, 0.749020f, 0.756061f, 0.764117f, 0.773019f, 0.782375f,
+	0.994301f, 0.841313f, 0.814425f, 0.793556f, 0.776629f, 0.762674f, 0.750918f, 0.741061f,
+	0.732661f, 0.725614f, 0.719516f, 0.714431f, 0.710116f, 0.706415f, 0.703215f, 0.700377f,
+	0.697635f, 0.695041f, 0.693263f, 0.692230f, 0.692013f, 0.692522f, 0.693852f, 0.695904f,
+	0.698786f, 0.702420f, 0.706801f, 0.711987f, 0.718066f, 0.725244f, 0.733402f, 0.742259f,
+	0.993773f, 0.828353f, 0.800207f, 0.778376f, 0.760704f, 0.745996f, 0.733520f, 0.723000f,
+	0.713883f, 0.706019f, 0.699202f, 0.693257f, 0.688067f, 0.683397f, 0.679231f, 0.675342f,
+	0.671497f, 0.667758f, 0.664816f, 0.662715f, 0.661423f, 0.660976f, 0.661288f, 0.662405f,
+	0.664253f, 0.666827f, 0.670114f, 0.674073f, 0.678962f, 0.684944f, 0.691929f, 0.699816f,
+	0.993223f, 0.814863f, 0.785283f, 0.762388f, 0.743905f, 0.728473f, 0.715413f, 0.704157f,
+	0.694469f, 0.685974f, 0.678512f, 0.671876f, 0.666013f, 0.660589f, 0.655626f, 0.650898f,
+	0.645984f, 0.641128f, 0.637098f, 0.633962f, 0.631579f, 0.630102f, 0.629297f, 0.629320f,
+	0.629988f, 0.631332f, 0.633286f, 0.635899f, 0.639343f, 0.643806f, 0.649324f, 0.655810f,
+	0.992652f, 0.801046f, 0.769861f, 0.745890f, 0.726473f, 0.710329f, 0.696600f, 0.684818f,
+	0.674579f, 0.665595f, 0.657685f, 0.650516f, 0.644041f, 0.638145f, 0.632466f, 0.626962f,
+	0.621185f, 0.615308f, 0.610264f, 0.606065f, 0.602642f, 0.599988f, 0.598084f, 0.596909f,
+	0.596312f, 0.596249f, 0.596774f, 0.597832f, 0.599681f, 0.602485f, 0.606285f, 0.611035f,
+	0.992061f, 0.786853f, 0.754065f, 0.728929f, 0.708622f, 0.691765f, 0.677482f, 0.665207f,
+	0.654537f, 0.645161f, 0.636809f, 0.629322f, 0.622432f, 0.616044f, 0.609905f, 0.603783f,
+	0.597212f, 0.590389f, 0.584358f, 0.579134f, 0.574632f, 0.570906f, 0.567814f, 0.565317f,
+	0.563349f, 0.561898f, 0.560877f, 0.560374f, 0.560518f, 0.561530f, 0.563452f, 0.566261f,
+	0.991453f, 0.772463f, 0.737960f, 0.711657f, 0.690517f, 0.672914f, 0.658143f, 0.645476f,
+	0.634458f, 0.624790f, 0.616151f, 0.608405f, 0.601297f, 0.594537f, 0.588018f, 0.581422f,
+	0.574188f, 0.566377f, 0.559415f, 0.553190f, 0.547707f, 0.542787f, 0.538499f, 0.534730f,
+	0.531412f, 0.528506f, 0.525936f, 0.523804f, 0.522220f, 0.521420f, 0.521412f, 0.522189f,
+	0.990829f, 0.757871f, 0.721720f, 0.694306f, 0.672273f, 0.654131f, 0.638853f, 0.625817f,
+	0.614547f, 0.604677f, 0.595939f, 0.587976f, 0.580666f, 0.573782f, 0.566977f, 0.559936f,
+	0.551995f, 0.543348f, 0.535471f, 0.528274f, 0.521725f, 0.515746f, 0.510248f, 0.505235f,
+	0.500487f, 0.496219f, 0.492072f, 0.488357f, 0.485116f, 0.482533f, 0.480646f, 0.479423f,
+	0.990191f, 0.743248f, 0.705417f, 0.676905f, 0.654107f, 0.635405f, 0.619750f, 0.606510f,
+	0.595088f, 0.585123f, 0.576250f, 0.568247f, 0.560860f, 0.553796f, 0.546771f, 0.539342f,
+	0.530773f, 0.521312f, 0.512531f, 0.504382f, 0.496833f, 0.489716f, 0.483087f, 0.476819f,
+	0.470784f, 0.465081f, 0.459575f, 0.454308f, 0.449453f, 0.445200f, 0.441538f, 0.438446f,
+	0.989538f, 0.728652f, 0.689141f, 0.659593f, 0.636083f, 0.616929f, 0.601020f, 0.587579f,
+	0.576033f, 0.566079f, 0.557235f, 0.549248f, 0.541866f, 0.534677f, 0.527473f, 0.519765f,
+	0.510648f, 0.500305f, 0.490672f, 0.481569f, 0.472937f, 0.464861f, 0.457056f, 0.449592f,
+	0.442321f, 0.435263f, 0.428436f, 0.421699f, 0.415404f, 0.409646f, 0.404390f, 0.399623f,
+	0.988872f, 0.714101f, 0.673066f, 0.642481f, 0.618391f, 0.598859f, 0.582737f, 0.569246f,
+	0.557751f, 0.547769f, 0.539032f, 0.531128f, 0.523724f, 0.516565f, 0.509176f, 0.501137f,
+	0.491491f, 0.480336f, 0.469816f, 0.459803f, 0.450203f, 0.441008f, 0.432096f, 0.423521f,
+	0.415077f, 0.406855f, 0.398708f, 0.390755f, 0.383142f, 0.376021f, 0.369397f, 0.363200f,
+	0.988194f, 0.699745f, 0.657129f, 0.625684f, 0.601111f, 0.581307f, 0.565096f, 0.551587f,
+	0.540173f, 0.530325f, 0.521682f, 0.513882f, 0.506554f, 0.499381f, 0.491905f, 0.483538f,
+	0.473361f, 0.461335f, 0.449915f, 0.438990f, 0.428454f, 0.418268f, 0.408349f, 0.398640f,
+	0.389141f, 0.379791f, 0.370522f, 0.361420f, 0.352682f, 0.344453f, 0.336668f, 0.329319f,
+	0.994177f, 0.999982f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.893158f, 0.999421f, 0.999853f, 0.999941f, 0.999969f, 0.999975f, 0.999978f, 0.999980f,
+	0.999981f, 0.999982f, 0.999982f, 0.999983f, 0.999998f, 0.999999f, 0.999999f, 0.999999f,
+	0.999999f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 0.999999f, 1.000000f, 1.000000f, 1.000000f,
+	0.954737f, 0.990041f, 0.997684f, 0.998994f, 0.999425f, 0.999667f, 0.999763f, 0.999826f,
+	0.999862f, 0.999891f, 0.999916f, 0.999938f, 0.999945f, 0.999954f, 0.999968f, 0.999970f,
+	0.999973f, 0.999975f, 0.999976f, 0.999978f, 0.999979f, 0.999969f, 0.999972f, 0.999981f,
+	0.999981f, 0.999970f, 0.999961f, 0.999951f, 0.999971f, 0.999980f, 0.999983f, 0.999985f,
+	0.978826f, 0.954469f, 0.987247f, 0.994464f, 0.996970f, 0.998085f, 0.998691f, 0.999034f,
+	0.999264f, 0.999387f, 0.999482f, 0.999591f, 0.999629f, 0.999692f, 0.999774f, 0.999798f,
+	0.999789f, 0.999775f, 0.999798f, 0.999850f, 0.999832f, 0.999838f, 0.999829f, 0.999853f,
+	0.999847f, 0.999844f, 0.999841f, 0.999639f, 0.999836f, 0.999901f, 0.999916f, 0.999923f,
+	0.988020f, 0.910366f, 0.962005f, 0.981821f, 0.989750f, 0.993510f, 0.995536f, 0.996742f,
+	0.997499f, 0.998010f, 0.998379f, 0.998644f, 0.998855f, 0.999017f, 0.999128f, 0.999240f,
+	0.999271f, 0.999318f, 0.999374f, 0.999419f, 0.999435f, 0.999496f, 0.999524f, 0.999505f,
+	0.999515f, 0.999555f, 0.999512f, 0.998910f, 0.999478f, 0.999636f, 0.999719f, 0.999722f,
+	0.992334f, 0.889786f, 0.928192f, 0.958811f, 0.974999f, 0.983621f, 0.988549f, 0.991560f,
+	0.993520f, 0.994848f, 0.995811f, 0.996509f, 0.996981f, 0.997435f, 0.997745f, 0.997961f,
+	0.998133f, 0.998324f, 0.998463f, 0.998562f, 0.998622f, 0.998694f, 0.998723f, 0.998771f,
+	0.998807f, 0.998763f, 0.998650f, 0.997644f, 0.998717f, 0.999102f, 0.999244f, 0.999306f,
+	0.994644f, 0.890336f, 0.900948f, 0.930512f, 0.952736f, 0.967090f, 0.976202f, 0.982153f,
+	0.986173f, 0.988951f, 0.990966f, 0.992409f, 0.993536f, 0.994397f, 0.995100f, 0.995649f,
+	0.996058f, 0.996340f, 0.996602f, 0.996884f, 0.997064f, 0.997204f, 0.997329f, 0.997384f,
+	0.997404f, 0.997338f, 0.997024f, 0.995745f, 0.997315f, 0.998089f, 0.998378f, 0.998526f,
+	0.995972f, 0.899221f, 0.886829f, 0.905419f, 0.927427f, 0.945196f, 0.958296f, 0.967588f,
+	0.974313f, 0.979217f, 0.982817f, 0.985540f, 0.987607f, 0.989256f, 0.990568f, 0.991543f,
+	0.992355f, 0.993030f, 0.993594f, 0.994064f, 0.994415f, 0.994681f, 0.994861f, 0.995039f,
+	0.995058f, 0.994937f, 0.994326f, 0.992990f, 0.995015f, 0.996360f, 0.996905f, 0.997209f,
+	0.996756f, 0.908770f, 0.883161f, 0.888491f, 0.904668f, 0.921838f, 0.936779f, 0.948688f,
+	0.958041f, 0.965214f, 0.970759f, 0.975105f, 0.978553f, 0.981293f, 0.983439f, 0.985165f,
+	0.986614f, 0.987748f, 0.988683f, 0.989493f, 0.990125f, 0.990666f, 0.990986f, 0.991256f,
+	0.991370f, 0.991060f, 0.990173f, 0.989117f, 0.991556f, 0.993658f, 0.994612f, 0.995125f,
+	0.997211f, 0.916241f, 0.885000f, 0.879457f, 0.887541f, 0.900780f, 0.914763f, 0.927495f,
+	0.938379f, 0.947419f, 0.954865f, 0.960915f, 0.965850f, 0.969842f, 0.973116f, 0.975826f,
+	0.978081f, 0.979953f, 0.981413f, 0.982616f, 0.983682f, 0.984523f, 0.985097f, 0.985535f,
+	0.985611f, 0.985284f, 0.984373f, 0.983877f, 0.986752f, 0.989633f, 0.991138f, 0.991992f,
+	0.997449f, 0.920929f, 0.888392f, 0.875727f, 0.876256f, 0.884000f, 0.894872f, 0.906399f,
+	0.917408f, 0.927302f, 0.935932f, 0.943331f, 0.949639f, 0.954943f, 0.959468f, 0.963161f,
+	0.966309f, 0.968952f, 0.971147f, 0.972986f, 0.974577f, 0.975816f, 0.976673f, 0.977314f,
+	0.977551f, 0.977262f, 0.976619f, 0.976872f, 0.980183f, 0.983884f, 0.986124f, 0.987471f,
+	0.997535f, 0.923020f, 0.891284f, 0.874529f, 0.869219f, 0.871554f, 0.878300f, 0.887238f,
+	0.896884f, 0.906384f, 0.915267f, 0.923335f, 0.930543f, 0.936867f, 0.942330f, 0.947071f,
+	0.951100f, 0.954580f, 0.957531f, 0.960079f, 0.962213f, 0.963951f, 0.965275f, 0.966161f,
+	0.966627f, 0.966615f, 0.966537f, 0.967682f, 0.971517f, 0.976032f, 0.979159f, 0.981163f,
+	0.997508f, 0.922798f, 0.892630f, 0.873888f, 0.864563f, 0.862382f, 0.864967f, 0.870621f,
+	0.877990f, 0.886081f, 0.894208f, 0.902114f, 0.909546f, 0.916294f, 0.922384f, 0.927776f,
+	0.932540f, 0.936764f, 0.940422f, 0.943617f, 0.946336f, 0.948588f, 0.950390f, 0.951723f,
+	0.952566f, 0.953040f, 0.953760f, 0.955872f, 0.960316f, 0.965627f, 0.969766f, 0.972626f,
+	0.997392f, 0.920586f, 0.892055f, 0.872527f, 0.860666f, 0.855051f, 0.854065f, 0.856420f,
+	0.861070f, 0.867055f, 0.873727f, 0.880678f, 0.887562f, 0.894186f, 0.900353f, 0.906022f,
+	0.911129f, 0.915818f, 0.919968f, 0.923659f, 0.926892f, 0.929614f, 0.931892f, 0.933724f,
+	0.935081f, 0.936296f, 0.937989f, 0.941092f, 0.946193f, 0.952282f, 0.957498f, 0.961382f,
+	0.997205f, 0.916710f, 0.889566f, 0.869851f, 0.856430f, 0.848361f, 0.844469f, 0.843932f,
+	0.845835f, 0.849449f, 0.854170f, 0.859687f, 0.865414f, 0.871285f, 0.876963f, 0.882372f,
+	0.887449f, 0.892098f, 0.896475f, 0.900443f, 0.904059f, 0.907122f, 0.909823f, 0.912146f,
+	0.914170f, 0.916236f, 0.918971f, 0.923007f, 0.928787f, 0.935608f, 0.941913f, 0.946961f,
+	0.996958f, 0.911318f, 0.885199f, 0.865554f, 0.851175f, 0.841383f, 0.835241f, 0.832275f,
+	0.831699f, 0.832999f, 0.835666f, 0.839257f, 0.843594f, 0.848215f, 0.852949f, 0.857584f,
+	0.862082f, 0.866438f, 0.870640f, 0.874524f, 0.878177f, 0.881516f, 0.884481f, 0.887245f,
+	0.889940f, 0.892834f, 0.896529f, 0.901429f, 0.907842f, 0.915341f, 0.922663f, 0.928929f,
+	0.996660f, 0.904694f, 0.879137f, 0.859544f, 0.844554f, 0.833455f, 0.825703f, 0.820698f,
+	0.817991f, 0.817147f, 0.817745f, 0.819544f, 0.822088f, 0.825225f, 0.828623f, 0.832116f,
+	0.835667f, 0.839241f, 0.842935f, 0.846450f, 0.849927f, 0.853205f, 0.856385f, 0.859442f,
+	0.862654f, 0.866265f, 0.870729f, 0.876332f, 0.883302f, 0.891320f, 0.899511f, 0.906947f,
+	0.996319f, 0.897018f, 0.871543f, 0.851851f, 0.836331f, 0.824343f, 0.815271f, 0.808673f,
+	0.804201f, 0.801462f, 0.800192f, 0.800093f, 0.800897f, 0.802421f, 0.804306f, 0.806417f,
+	0.808714f, 0.811252f, 0.814050f, 0.816944f, 0.819911f, 0.822875f, 0.825977f, 0.829185f,
+	0.832730f, 0.836846f, 0.841865f, 0.847874f, 0.855173f, 0.863539f, 0.872367f, 0.880811f,
+	0.995943f, 0.888284f, 0.862613f, 0.842596f, 0.826598f, 0.813805f, 0.803685f, 0.795798f,
+	0.789803f, 0.785509f, 0.782538f, 0.780770f, 0.779858f, 0.779680f, 0.780017f, 0.780603f,
+	0.781467f, 0.782795f, 0.784457f, 0.786427f, 0.788669f, 0.791180f, 0.793971f, 0.797059f,
+	0.800728f, 0.805022f, 0.810185f, 0.816382f, 0.823730f, 0.832184f, 0.841335f, 0.850500f,
+	0.995522f, 0.878761f, 0.852443f, 0.831902f, 0.815345f, 0.801828f, 0.790801f, 0.781871f,
+	0.774629f, 0.768921f, 0.764538f, 0.761222f, 0.758734f, 0.757060f, 0.755808f, 0.754843f,
+	0.754170f, 0.754121f, 0.754587f, 0.755528f, 0.756872f, 0.758682f, 0.760938f, 0.763677f,
+	0.767114f, 0.771253f, 0.776257f, 0.782249f, 0.789363f, 0.797605f, 0.806711f, 0.816195f,
+	0.995076f, 0.868406f, 0.841245f, 0.819960f, 0.802730f, 0.788496f, 0.776614f, 0.766754f,
+	0.758502f, 0.751647f, 0.745936f, 0.741326f, 0.737447f, 0.734309f, 0.731690f, 0.729196f,
+	0.726988f, 0.725565f, 0.724723f, 0.724541f, 0.724893f, 0.725772f, 0.727320f, 0.729535f,
+	0.732429f, 0.736095f, 0.740586f, 0.746059f, 0.752625f, 0.760278f, 0.768946f, 0.778285f,
+	0.994601f, 0.857428f, 0.829063f, 0.806926f, 0.788918f, 0.773891f, 0.761269f, 0.750496f,
+	0.741345f, 0.733486f, 0.726739f, 0.720918f, 0.715907f, 0.711521f, 0.707540f, 0.703704f,
+	0.700044f, 0.697270f, 0.695119f, 0.693742f, 0.693078f, 0.692996f, 0.693651f, 0.695033f,
+	0.697151f, 0.700029f, 0.703746f, 0.708367f, 0.714029f, 0.720806f, 0.728634f, 0.737340f,
+	0.994101f, 0.845796f, 0.816093f, 0.792938f, 0.774084f, 0.758303f, 0.744820f, 0.733302f,
+	0.723359f, 0.714623f, 0.706936f, 0.700179f, 0.694125f, 0.688648f, 0.683467f, 0.678394f,
+	0.673454f, 0.669338f, 0.665981f, 0.663438f, 0.661634f, 0.660572f, 0.660205f, 0.660626f,
+	0.661738f, 0.663600f, 0.666256f, 0.669756f, 0.674303f, 0.679849f, 0.686467f, 0.694077f,
+	0.993579f, 0.833732f, 0.802422f, 0.778137f, 0.758313f, 0.741731f, 0.727528f, 0.715290f,
+	0.704537f, 0.695077f, 0.686652f, 0.679088f, 0.672192f, 0.665811f, 0.659620f, 0.653421f,
+	0.647241f, 0.641947f, 0.637438f, 0.633788f, 0.630830f, 0.628676f, 0.627297f, 0.626541f,
+	0.626498f, 0.627192f, 0.628588f, 0.630766f, 0.633921f, 0.638034f, 0.643159f, 0.649294f,
+	0.993037f, 0.821223f, 0.788247f, 0.762739f, 0.741886f, 0.724435f, 0.709509f, 0.696583f,
+	0.685242f, 0.675113f, 0.666049f, 0.657855f, 0.650239f, 0.643000f, 0.636063f, 0.628812f,
+	0.621537f, 0.615172f, 0.609529f, 0.604808f, 0.600788f, 0.597496f, 0.594933f, 0.593070f,
+	0.591770f, 0.591169f, 0.591171f, 0.591913f, 0.593504f, 0.596015f, 0.599444f, 0.603817f,
+	0.992475f, 0.808316f, 0.773599f, 0.746780f, 0.724924f, 0.706617f, 0.690989f, 0.677456f,
+	0.665529f, 0.654886f, 0.645299f, 0.636530f, 0.628339f, 0.620540f, 0.612875f, 0.604755f,
+	0.596469f, 0.589034f, 0.582463f, 0.576623f, 0.571644f, 0.567174f, 0.563474f, 0.560323f,
+	0.557801f, 0.555797f, 0.554373f, 0.553599f, 0.553587f, 0.554368f, 0.555984f, 0.558440f,
+	0.991896f, 0.795225f, 0.758544f, 0.730460f, 0.707594f, 0.688493f, 0.672166f, 0.658011f,
+	0.645629f, 0.634543f, 0.624539f, 0.615358f, 0.606807f, 0.598475f, 0.590156f, 0.581306f,
+	0.572113f, 0.563765f, 0.556201f, 0.549436f, 0.543303f, 0.537837f, 0.532943f, 0.528586f,
+	0.524756f, 0.521359f, 0.518434f, 0.516172f, 0.514542f, 0.513613f, 0.513390f, 0.513882f,
+	0.991301f, 0.781838f, 0.743321f, 0.713859f, 0.689995f, 0.670143f, 0.653242f, 0.638602f,
+	0.625774f, 0.614349f, 0.604045f, 0.594548f, 0.585623f, 0.576929f, 0.568150f, 0.558643f,
+	0.548570f, 0.539332f, 0.530878f, 0.523094f, 0.516032f, 0.509458f, 0.503411f, 0.497854f,
+	0.492758f, 0.488015f, 0.483730f, 0.479919f, 0.476740f, 0.474162f, 0.472153f, 0.470751f,
+	0.990692f, 0.768293f, 0.727948f, 0.697139f, 0.672389f, 0.651790f, 0.634286f, 0.619285f,
+	0.606144f, 0.594496f, 0.583918f, 0.574223f, 0.565039f, 0.556076f, 0.546864f, 0.536745f,
+	0.525833f, 0.515809f, 0.506485f, 0.497783f, 0.489700f, 0.482127f, 0.475011f, 0.468300f,
+	0.461978f, 0.455966f, 0.450305f, 0.445073f, 0.440429f, 0.436310f, 0.432670f, 0.429533f,
+	0.990069f, 0.754761f, 0.712467f, 0.680425f, 0.654759f, 0.633494f, 0.615626f, 0.600258f,
+	0.586874f, 0.575036f, 0.564381f, 0.554530f, 0.545166f, 0.536016f, 0.526457f, 0.515774f,
+	0.504119f, 0.493244f, 0.483058f, 0.473471f, 0.464469f, 0.455903f, 0.447730f, 0.439905f,
+	0.432399f, 0.425181f, 0.418309f, 0.411806f, 0.405828f, 0.400327f, 0.395251f, 0.390585f,
+	0.989433f, 0.741176f, 0.697058f, 0.663828f, 0.637341f, 0.615531f, 0.597251f, 0.581661f,
+	0.568136f, 0.556187f, 0.545426f, 0.535571f, 0.526133f, 0.516735f, 0.506938f, 0.495704f,
+	0.483318f, 0.471663f, 0.460662f, 0.450191f, 0.440270f, 0.430726f, 0.421603f, 0.412731f,
+	0.404212f, 0.395879f, 0.387863f, 0.380240f, 0.373083f, 0.366371f, 0.360078f, 0.354144f,
+	0.988786f, 0.727655f, 0.681764f, 0.647399f, 0.620143f, 0.597904f, 0.579353f, 0.563546f,
+	0.549990f, 0.538033f, 0.527297f, 0.517392f, 0.507932f, 0.498443f, 0.488326f, 0.476624f,
+	0.463495f, 0.451078f, 0.439280f, 0.427959f, 0.417129f, 0.406735f, 0.396633f, 0.386792f,
+	0.377323f, 0.368028f, 0.358993f, 0.350410f, 0.342266f, 0.334582f, 0.327285f, 0.320337f,
+	0.994178f, 0.999982f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.893169f, 0.999421f, 0.999853f, 0.999941f, 0.999969f, 0.999975f, 0.999978f, 0.999980f,
+	0.999981f, 0.999982f, 0.999982f, 0.999983f, 0.999998f, 0.999999f, 0.999999f, 0.999999f,
+	0.999999f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 0.999998f, 1.000000f, 1.000000f, 1.000000f,
+	0.954749f, 0.990042f, 0.997705f, 0.998993f, 0.999425f, 0.999667f, 0.999763f, 0.999826f,
+	0.999862f, 0.999891f, 0.999916f, 0.999938f, 0.999945f, 0.999954f, 0.999968f, 0.999970f,
+	0.999973f, 0.999975f, 0.999976f, 0.999978f, 0.999979f, 0.999980f, 0.999980f, 0.999956f,
+	0.999982f, 0.999982f, 0.999977f, 0.999981f, 0.999958f, 0.999979f, 0.999983f, 0.999985f,
+	0.978839f, 0.954502f, 0.987252f, 0.994458f, 0.996991f, 0.998093f, 0.998691f, 0.999034f,
+	0.999265f, 0.999388f, 0.999482f, 0.999591f, 0.999629f, 0.999679f, 0.999761f, 0.999798f,
+	0.999798f, 0.999800f, 0.999814f, 0.999820f, 0.999853f, 0.999821f, 0.999819f, 0.999835f,
+	0.999856f, 0.999832f, 0.999864f, 0.999838f, 0.999763f, 0.999894f, 0.999915f, 0.999923f,
+	0.988033f, 0.910522f, 0.962051f, 0.981896f, 0.989783f, 0.993544f, 0.995590f, 0.996744f,
+	0.997500f, 0.998013f, 0.998381f, 0.998642f, 0.998819f, 0.998979f, 0.999127f, 0.999231f,
+	0.999289f, 0.999330f, 0.999366f, 0.999447f, 0.999477f, 0.999475f, 0.999538f, 0.999535f,
+	0.999559f, 0.999580f, 0.999560f, 0.999426f, 0.999251f, 0.999614f, 0.999715f, 0.999722f,
+	0.992349f, 0.890101f, 0.928347f, 0.958923f, 0.975064f, 0.983676f, 0.988582f, 0.991600f,
+	0.993537f, 0.994843f, 0.995808f, 0.996508f, 0.996991f, 0.997420f, 0.997733f, 0.997985f,
+	0.998215f, 0.998334f, 0.998476f, 0.998593f, 0.998671f, 0.998687f, 0.998774f, 0.998837f,
+	0.998870f, 0.998880f, 0.998806f, 0.998473f, 0.998239f, 0.999046f, 0.999234f, 0.999305f,
+	0.994663f, 0.890893f, 0.901246f, 0.930676f, 0.952877f, 0.967215f, 0.976297f, 0.982175f,
+	0.986206f, 0.988976f, 0.990980f, 0.992456f, 0.993581f, 0.994426f, 0.995114f, 0.995633f,
+	0.996088f, 0.996406f, 0.996701f, 0.996905f, 0.997109f, 0.997266f, 0.997408f, 0.997477f,
+	0.997511f, 0.997498f, 0.997417f, 0.996757f, 0.996565f, 0.997968f, 0.998355f, 0.998525f,
+	0.995996f, 0.900074f, 0.887376f, 0.905803f, 0.927703f, 0.945448f, 0.958434f, 0.967765f,
+	0.974435f, 0.979308f, 0.982918f, 0.985640f, 0.987713f, 0.989339f, 0.990639f, 0.991620f,
+	0.992441f, 0.993080f, 0.993707f, 0.994142f, 0.994502f, 0.994775f, 0.995002f, 0.995211f,
+	0.995244f, 0.995237f, 0.995005f, 0.993959f, 0.994059f, 0.996136f, 0.996859f, 0.997205f,
+	0.996785f, 0.910148f, 0.884068f, 0.889116f, 0.905103f, 0.922250f, 0.937087f, 0.948925f,
+	0.958222f, 0.965390f, 0.970954f, 0.975296f, 0.978678f, 0.981340f, 0.983518f, 0.985273f,
+	0.986711f, 0.987877f, 0.988854f, 0.989646f, 0.990347f, 0.990780f, 0.991211f, 0.991570f,
+	0.991728f, 0.991673f, 0.991188f, 0.989982f, 0.990497f, 0.993290f, 0.994527f, 0.995114f,
+	0.997248f, 0.918108f, 0.886278f, 0.880416f, 0.888286f, 0.901367f, 0.915227f, 0.927904f,
+	0.938739f, 0.947774f, 0.955159f, 0.961153f, 0.966049f, 0.970106f, 0.973361f, 0.976053f,
+	0.978235f, 0.980079f, 0.981613f, 0.982897f, 0.983944f, 0.984862f, 0.985496f, 0.986041f,
+	0.986270f, 0.986194f, 0.985642f, 0.984589f, 0.985671f, 0.989098f, 0.990992f, 0.991967f,
+	0.997496f, 0.923412f, 0.890223f, 0.877094f, 0.877322f, 0.884880f, 0.895578f, 0.907026f,
+	0.917956f, 0.927775f, 0.936396f, 0.943745f, 0.950015f, 0.955265f, 0.959697f, 0.963463f,
+	0.966612f, 0.969236f, 0.971502f, 0.973391f, 0.974996f, 0.976273f, 0.977320f, 0.978080f,
+	0.978470f, 0.978528f, 0.978019f, 0.977451f, 0.979132f, 0.983174f, 0.985891f, 0.987418f,
+	0.997593f, 0.926156f, 0.893693f, 0.876449f, 0.870752f, 0.872841f, 0.879364f, 0.888155f,
+	0.897687f, 0.907100f, 0.915923f, 0.923942f, 0.931064f, 0.937336f, 0.942754f, 0.947398f,
+	0.951509f, 0.955046f, 0.958069f, 0.960646f, 0.962805f, 0.964673f, 0.966116f, 0.967220f,
+	0.967924f, 0.968131f, 0.967979f, 0.968115f, 0.970529f, 0.975160f, 0.978808f, 0.981061f,
+	0.997578f, 0.926641f, 0.895728f, 0.876359f, 0.866657f, 0.864087f, 0.866447f, 0.871972f,
+	0.879100f, 0.887054f, 0.895123f, 0.902943f, 0.910266f, 0.916967f, 0.923045f, 0.928375f,
+	0.933151f, 0.937405f, 0.941136f, 0.944402f, 0.947240f, 0.949589f, 0.951596f, 0.953077f,
+	0.954137f, 0.954703f, 0.955160f, 0.956206f, 0.959386f, 0.964627f, 0.969265f, 0.972442f,
+	0.997476f, 0.925232f, 0.895898f, 0.875737f, 0.863405f, 0.857310f, 0.856039f, 0.858171f,
+	0.862584f, 0.868388f, 0.874927f, 0.881769f, 0.888558f, 0.895131f, 0.901236f, 0.906767f,
+	0.911957f, 0.916708f, 0.920927f, 0.924739f, 0.928035f, 0.930952f, 0.933423f, 0.935343f,
+	0.936852f, 0.938041f, 0.939228f, 0.941350f, 0.945312f, 0.951169f, 0.956819f, 0.961073f,
+	0.997305f, 0.922178f, 0.894185f, 0.873829f, 0.859878f, 0.851264f, 0.847041f, 0.846155f,
+	0.847805f, 0.851200f, 0.855817f, 0.861110f, 0.866779f, 0.872507f, 0.878045f, 0.883433f,
+	0.888451f, 0.893307f, 0.897770f, 0.901818f, 0.905495f, 0.908746f, 0.911614f, 0.914000f,
+	0.916059f, 0.917904f, 0.920026f, 0.923156f, 0.927933f, 0.934405f, 0.941030f, 0.946468f,
+	0.997075f, 0.917778f, 0.890743f, 0.870340f, 0.855358f, 0.845007f, 0.838479f, 0.835106f,
+	0.834267f, 0.835325f, 0.837745f, 0.841186f, 0.845328f, 0.849777f, 0.854389f, 0.858933f,
+	0.863440f, 0.867905f, 0.872191f, 0.876214f, 0.879933f, 0.883363f, 0.886462f, 0.889228f,
+	0.891805f, 0.894364f, 0.897382f, 0.901440f, 0.906981f, 0.914034f, 0.921543f, 0.928188f,
+	0.996795f, 0.912108f, 0.885593f, 0.865170f, 0.849542f, 0.837913f, 0.829643f, 0.824237f,
+	0.821171f, 0.820032f, 0.820386f, 0.821885f, 0.824276f, 0.827168f, 0.830392f, 0.833798f,
+	0.837354f, 0.841026f, 0.844746f, 0.848372f, 0.851919f, 0.855217f, 0.858405f, 0.861374f,
+	0.864359f, 0.867580f, 0.871357f, 0.876199f, 0.882344f, 0.889892f, 0.898123f, 0.905883f,
+	0.996472f, 0.905369f, 0.878953f, 0.858436f, 0.842183f, 0.829573f, 0.819967f, 0.812921f,
+	0.808037f, 0.804930f, 0.803448f, 0.803009f, 0.803574f, 0.804776f, 0.806409f, 0.808315f,
+	0.810590f, 0.813250f, 0.816137f, 0.819010f, 0.822018f, 0.825019f, 0.828030f, 0.831032f,
+	0.834230f, 0.837891f, 0.842185f, 0.847536f, 0.854102f, 0.861958f, 0.870684f, 0.879353f,
+	0.996117f, 0.897691f, 0.871020f, 0.850109f, 0.833344f, 0.819881f, 0.809178f, 0.800798f,
+	0.794337f, 0.789655f, 0.786308f, 0.784176f, 0.782972f, 0.782471f, 0.782486f, 0.782751f,
+	0.783645f, 0.784946f, 0.786662f, 0.788643f, 0.790884f, 0.793275f, 0.795854f, 0.798658f,
+	0.801867f, 0.805632f, 0.810206f, 0.815764f, 0.822465f, 0.830397f, 0.839321f, 0.848583f,
+	0.995716f, 0.889239f, 0.861833f, 0.840370f, 0.823023f, 0.808822f, 0.797128f, 0.787582f,
+	0.779885f, 0.773745f, 0.768906f, 0.765184f, 0.762338f, 0.760233f, 0.758513f, 0.757110f,
+	0.756440f, 0.756421f, 0.756803f, 0.757680f, 0.758949f, 0.760549f, 0.762550f, 0.764940f,
+	0.767839f, 0.771374f, 0.775870f, 0.781310f, 0.787841f, 0.795545f, 0.804331f, 0.813768f,
+	0.995291f, 0.879957f, 0.851636f, 0.829432f, 0.811327f, 0.796377f, 0.783786f, 0.773253f,
+	0.764437f, 0.757049f, 0.750874f, 0.745763f, 0.741425f, 0.737790f, 0.734556f, 0.731488f,
+	0.729282f, 0.727765f, 0.726857f, 0.726510f, 0.726707f, 0.727367f, 0.728523f, 0.730259f,
+	0.732630f, 0.735746f, 0.739752f, 0.744747f, 0.750772f, 0.757894f, 0.766159f, 0.775317f,
+	0.994838f, 0.870112f, 0.840501f, 0.817366f, 0.798476f, 0.782617f, 0.769251f, 0.757779f,
+	0.747986f, 0.739510f, 0.732237f, 0.725847f, 0.720278f, 0.715234f, 0.710495f, 0.705901f,
+	0.702237f, 0.699239f, 0.696968f, 0.695435f, 0.694420f, 0.694020f, 0.694318f, 0.695172f,
+	0.696755f, 0.699126f, 0.702391f, 0.706600f, 0.711783f, 0.718051f, 0.725419f, 0.733826f,
+	0.994361f, 0.859665f, 0.828579f, 0.804337f, 0.784499f, 0.767830f, 0.753592f, 0.741307f,
+	0.730596f, 0.721200f, 0.712902f, 0.705455f, 0.698736f, 0.692467f, 0.686358f, 0.680362f,
+	0.675259f, 0.670976f, 0.667411f, 0.664635f, 0.662423f, 0.660949f, 0.660159f, 0.660041f,
+	0.660635f, 0.662056f, 0.664286f, 0.667447f, 0.671540f, 0.676645f, 0.682806f, 0.690033f,
+	0.993861f, 0.848646f, 0.815982f, 0.790520f, 0.769648f, 0.752033f, 0.736981f, 0.723846f,
+	0.712383f, 0.702176f, 0.692971f, 0.684624f, 0.676903f, 0.669566f, 0.662255f, 0.654943f,
+	0.648590f, 0.643053f, 0.638262f, 0.634253f, 0.630924f, 0.628350f, 0.626432f, 0.625228f,
+	0.624699f, 0.624916f, 0.626020f, 0.627941f, 0.630671f, 0.634378f, 0.639058f, 0.644761f,
+	0.993343f, 0.837225f, 0.802761f, 0.775954f, 0.754021f, 0.735500f, 0.719610f, 0.705733f,
+	0.693486f, 0.682511f, 0.672602f, 0.663437f, 0.654830f, 0.646609f, 0.638304f, 0.629854f,
+	0.622289f, 0.615576f, 0.609631f, 0.604504f, 0.600036f, 0.596310f, 0.593274f, 0.590900f,
+	0.589181f, 0.588185f, 0.587935f, 0.588443f, 0.589768f, 0.591910f, 0.594900f, 0.598852f,
+	0.992803f, 0.825404f, 0.789081f, 0.760866f, 0.737780f, 0.718360f, 0.701657f, 0.687063f,
+	0.674120f, 0.662488f, 0.651911f, 0.642118f, 0.632818f, 0.623812f, 0.614537f, 0.605002f,
+	0.596412f, 0.588626f, 0.581682f, 0.575441f, 0.569943f, 0.565058f, 0.560884f, 0.557309f,
+	0.554367f, 0.552061f, 0.550426f, 0.549530f, 0.549298f, 0.549789f, 0.551055f, 0.553114f,
+	0.992248f, 0.813349f, 0.774935f, 0.745343f, 0.721128f, 0.700768f, 0.683229f, 0.668001f,
+	0.654461f, 0.642284f, 0.631192f, 0.620765f, 0.610919f, 0.601250f, 0.591182f, 0.580723f,
+	0.571116f, 0.562340f, 0.554427f, 0.547183f, 0.540634f, 0.534707f, 0.529415f, 0.524652f,
+	0.520490f, 0.516838f, 0.513821f, 0.511469f, 0.509743f, 0.508600f, 0.508105f, 0.508272f,
+	0.991677f, 0.800978f, 0.760561f, 0.729483f, 0.704113f, 0.682889f, 0.664639f, 0.648774f,
+	0.634734f, 0.622061f, 0.610504f, 0.599659f, 0.589334f, 0.579118f, 0.568350f, 0.556987f,
+	0.546536f, 0.536853f, 0.528041f, 0.519840f, 0.512264f, 0.505370f, 0.498918f, 0.493030f,
+	0.487637f, 0.482676f, 0.478387f, 0.474636f, 0.471426f, 0.468711f, 0.466551f, 0.464938f,
+	0.991091f, 0.788449f, 0.746005f, 0.713425f, 0.687021f, 0.664868f, 0.645994f, 0.629571f,
+	0.615036f, 0.602010f, 0.590088f, 0.578910f, 0.568182f, 0.557515f, 0.546124f, 0.533968f,
+	0.522688f, 0.512180f, 0.502457f, 0.493369f, 0.484881f, 0.476938f, 0.469519f, 0.462534f,
+	0.456015f, 0.449878f, 0.444269f, 0.439235f, 0.434642f, 0.430514f, 0.426839f, 0.423594f,
+	0.990492f, 0.775790f, 0.731270f, 0.697283f, 0.669791f, 0.646892f, 0.627420f, 0.610476f,
+	0.595603f, 0.582273f, 0.570059f, 0.558627f, 0.547642f, 0.536562f, 0.524672f, 0.511754f,
+	0.499667f, 0.488418f, 0.477801f, 0.467911f, 0.458509f, 0.449638f, 0.441233f, 0.433216f,
+	0.425618f, 0.418396f, 0.411680f, 0.405453f, 0.399650f, 0.394244f, 0.389239f, 0.384594f,
+	0.989880f, 0.763066f, 0.716486f, 0.681113f, 0.652645f, 0.629026f, 0.609012f, 0.591728f,
+	0.576593f, 0.563021f, 0.550624f, 0.539041f, 0.527826f, 0.516438f, 0.504065f, 0.490391f,
+	0.477614f, 0.465593f, 0.454182f, 0.443419f, 0.433239f, 0.423488f, 0.414130f, 0.405202f,
+	0.396620f, 0.388392f, 0.380642f, 0.373400f, 0.366545f, 0.360076f, 0.353948f, 0.348165f,
+	0.989256f, 0.750297f, 0.701752f, 0.665040f, 0.635657f, 0.611455f, 0.590978f, 0.573410f,
+	0.558057f, 0.544379f, 0.531880f, 0.520157f, 0.508759f, 0.497109f, 0.484240f, 0.469962f,
+	0.456406f, 0.443667f, 0.431576f, 0.420019f, 0.408998f, 0.398489f, 0.388297f, 0.378452f,
+	0.368986f, 0.359917f, 0.351304f, 0.343157f, 0.335437f, 0.328106f, 0.321113f, 0.314428f,
+	0.994178f, 0.999982f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.893183f, 0.999421f, 0.999853f, 0.999941f, 0.999969f, 0.999975f, 0.999978f, 0.999980f,
+	0.999981f, 0.999982f, 0.999982f, 0.999983f, 0.999998f, 0.999999f, 0.999999f, 0.999999f,
+	0.999999f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 0.999996f, 1.000000f, 1.000000f, 0.999988f, 1.000000f, 1.000000f, 1.000000f,
+	0.954764f, 0.990050f, 0.997694f, 0.998990f, 0.999425f, 0.999667f, 0.999763f, 0.999826f,
+	0.999862f, 0.999891f, 0.999916f, 0.999938f, 0.999945f, 0.999954f, 0.999968f, 0.999970f,
+	0.999973f, 0.999975f, 0.999976f, 0.999978f, 0.999979f, 0.999980f, 0.999976f, 0.999981f,
+	0.999982f, 0.999968f, 0.999976f, 0.999965f, 0.999855f, 0.999977f, 0.999983f, 0.999985f,
+	0.978852f, 0.954525f, 0.987276f, 0.994459f, 0.997002f, 0.998082f, 0.998687f, 0.999034f,
+	0.999265f, 0.999388f, 0.999483f, 0.999592f, 0.999630f, 0.999680f, 0.999748f, 0.999785f,
+	0.999797f, 0.999807f, 0.999836f, 0.999825f, 0.999817f, 0.999848f, 0.999819f, 0.999854f,
+	0.999867f, 0.999849f, 0.999866f, 0.999832f, 0.999495f, 0.999884f, 0.999914f, 0.999923f,
+	0.988047f, 0.910635f, 0.962116f, 0.981924f, 0.989800f, 0.993573f, 0.995583f, 0.996744f,
+	0.997504f, 0.998023f, 0.998380f, 0.998639f, 0.998828f, 0.998963f, 0.999116f, 0.999219f,
+	0.999279f, 0.999354f, 0.999372f, 0.999458f, 0.999472f, 0.999507f, 0.999509f, 0.999518f,
+	0.999569f, 0.999591f, 0.999562f, 0.999529f, 0.998822f, 0.999580f, 0.999710f, 0.999722f,
+	0.992365f, 0.890313f, 0.928469f, 0.959026f, 0.975122f, 0.983716f, 0.988626f, 0.991623f,
+	0.993542f, 0.994846f, 0.995810f, 0.996506f, 0.996988f, 0.997426f, 0.997724f, 0.997977f,
+	0.998185f, 0.998396f, 0.998489f, 0.998582f, 0.998675f, 0.998704f, 0.998771f, 0.998882f,
+	0.998867f, 0.998908f, 0.998849f, 0.998754f, 0.997719f, 0.998960f, 0.999222f, 0.999305f,
+	0.994681f, 0.891335f, 0.901488f, 0.930867f, 0.953020f, 0.967292f, 0.976333f, 0.982224f,
+	0.986224f, 0.989008f, 0.991024f, 0.992491f, 0.993625f, 0.994484f, 0.995122f, 0.995628f,
+	0.996068f, 0.996431f, 0.996718f, 0.996958f, 0.997124f, 0.997337f, 0.997426f, 0.997539f,
+	0.997584f, 0.997632f, 0.997584f, 0.997298f, 0.996031f, 0.997788f, 0.998328f, 0.998524f,
+	0.996017f, 0.900787f, 0.887787f, 0.906094f, 0.927942f, 0.945577f, 0.958587f, 0.967867f,
+	0.974499f, 0.979351f, 0.982958f, 0.985674f, 0.987720f, 0.989338f, 0.990651f, 0.991684f,
+	0.992485f, 0.993169f, 0.993689f, 0.994204f, 0.994569f, 0.994867f, 0.995106f, 0.995294f,
+	0.995436f, 0.995471f, 0.995424f, 0.994811f, 0.993550f, 0.995819f, 0.996806f, 0.997201f,
+	0.996811f, 0.911183f, 0.884784f, 0.889621f, 0.905477f, 0.922513f, 0.937291f, 0.949160f,
+	0.958372f, 0.965536f, 0.971080f, 0.975387f, 0.978809f, 0.981486f, 0.983601f, 0.985354f,
+	0.986778f, 0.987982f, 0.988935f, 0.989733f, 0.990419f, 0.990973f, 0.991421f, 0.991767f,
+	0.991988f, 0.992023f, 0.991859f, 0.991009f, 0.990023f, 0.992813f, 0.994431f, 0.995104f,
+	0.997280f, 0.919565f, 0.887341f, 0.881152f, 0.888824f, 0.901874f, 0.915592f, 0.928168f,
+	0.939010f, 0.948025f, 0.955390f, 0.961383f, 0.966269f, 0.970245f, 0.973433f, 0.976135f,
+	0.978371f, 0.980262f, 0.981770f, 0.983045f, 0.984187f, 0.985108f, 0.985798f, 0.986350f,
+	0.986686f, 0.986873f, 0.986568f, 0.985653f, 0.985242f, 0.988463f, 0.990831f, 0.991944f,
+	0.997535f, 0.925365f, 0.891686f, 0.878159f, 0.878170f, 0.885564f, 0.896175f, 0.907491f,
+	0.918345f, 0.928128f, 0.936687f, 0.944001f, 0.950210f, 0.955476f, 0.959904f, 0.963645f,
+	0.966792f, 0.969484f, 0.971773f, 0.973659f, 0.975320f, 0.976676f, 0.977747f, 0.978610f,
+	0.979163f, 0.979437f, 0.979207f, 0.978466f, 0.978755f, 0.982416f, 0.985642f, 0.987371f,
+	0.997641f, 0.928631f, 0.895651f, 0.877919f, 0.871962f, 0.873808f, 0.880226f, 0.888853f,
+	0.898278f, 0.907598f, 0.916378f, 0.924354f, 0.931411f, 0.937647f, 0.943045f, 0.947772f,
+	0.951833f, 0.955407f, 0.958450f, 0.961049f, 0.963355f, 0.965195f, 0.966808f, 0.968018f,
+	0.968898f, 0.969326f, 0.969347f, 0.969095f, 0.970186f, 0.974328f, 0.978449f, 0.980971f,
+	0.997636f, 0.929718f, 0.898196f, 0.878368f, 0.868246f, 0.865425f, 0.867639f, 0.872877f,
+	0.879960f, 0.887824f, 0.895804f, 0.903527f, 0.910771f, 0.917453f, 0.923440f, 0.928808f,
+	0.933628f, 0.937932f, 0.941709f, 0.945046f, 0.947906f, 0.950393f, 0.952463f, 0.954138f,
+	0.955370f, 0.956144f, 0.956595f, 0.957080f, 0.959096f, 0.963759f, 0.968782f, 0.972282f,
+	0.997545f, 0.928975f, 0.898959f, 0.878261f, 0.865449f, 0.859116f, 0.857573f, 0.859486f,
+	0.863733f, 0.869410f, 0.875855f, 0.882598f, 0.889287f, 0.895735f, 0.901756f, 0.907414f,
+	0.912593f, 0.917354f, 0.921702f, 0.925554f, 0.928978f, 0.931989f, 0.934518f, 0.936650f,
+	0.938347f, 0.939651f, 0.940692f, 0.942116f, 0.945051f, 0.950286f, 0.956202f, 0.960808f,
+	0.997386f, 0.926588f, 0.897924f, 0.876961f, 0.862498f, 0.853557f, 0.848985f, 0.847900f,
+	0.849334f, 0.852582f, 0.857055f, 0.862228f, 0.867804f, 0.873352f, 0.878898f, 0.884230f,
+	0.889319f, 0.894213f, 0.898698f, 0.902900f, 0.906694f, 0.910060f, 0.913022f, 0.915561f,
+	0.917682f, 0.919610f, 0.921432f, 0.923839f, 0.927671f, 0.933515f, 0.940266f, 0.946056f,
+	0.997170f, 0.922851f, 0.895096f, 0.874078f, 0.858612f, 0.847826f, 0.840969f, 0.837287f,
+	0.836141f, 0.836995f, 0.839257f, 0.842595f, 0.846601f, 0.850952f, 0.855338f, 0.859918f,
+	0.864533f, 0.869019f, 0.873404f, 0.877543f, 0.881324f, 0.884883f, 0.888077f, 0.890945f,
+	0.893571f, 0.896015f, 0.898644f, 0.901996f, 0.906714f, 0.913140f, 0.920627f, 0.927579f,
+	0.996904f, 0.917913f, 0.890672f, 0.869606f, 0.853407f, 0.841303f, 0.832664f, 0.826934f,
+	0.823606f, 0.822193f, 0.822356f, 0.823679f, 0.825834f, 0.828613f, 0.831632f, 0.835008f,
+	0.838685f, 0.842385f, 0.846237f, 0.849960f, 0.853528f, 0.856951f, 0.860210f, 0.863227f,
+	0.866173f, 0.869113f, 0.872496f, 0.876653f, 0.882052f, 0.888955f, 0.897042f, 0.905028f,
+	0.996597f, 0.912059f, 0.884808f, 0.863523f, 0.846775f, 0.833667f, 0.823634f, 0.816215f,
+	0.810974f, 0.807618f, 0.805802f, 0.805182f, 0.805494f, 0.806495f, 0.807820f, 0.809766f,
+	0.812188f, 0.814855f, 0.817767f, 0.820800f, 0.823812f, 0.826865f, 0.829853f, 0.832846f,
+	0.835900f, 0.839243f, 0.843138f, 0.847849f, 0.853720f, 0.860953f, 0.869419f, 0.878204f,
+	0.996258f, 0.905193f, 0.877602f, 0.855999f, 0.838663f, 0.824653f, 0.813450f, 0.804653f,
+	0.797863f, 0.792778f, 0.789182f, 0.786785f, 0.785297f, 0.784479f, 0.784097f, 0.784445f,
+	0.785295f, 0.786691f, 0.788472f, 0.790516f, 0.792718f, 0.795096f, 0.797661f, 0.800385f,
+	0.803362f, 0.806793f, 0.810884f, 0.815913f, 0.821965f, 0.829269f, 0.837861f, 0.847101f,
+	0.995874f, 0.897577f, 0.869316f, 0.847092f, 0.829071f, 0.814255f, 0.802070f, 0.792106f,
+	0.783937f, 0.777421f, 0.772219f, 0.768159f, 0.764981f, 0.762452f, 0.760309f, 0.759013f,
+	0.758347f, 0.758264f, 0.758658f, 0.759543f, 0.760827f, 0.762350f, 0.764183f, 0.766370f,
+	0.769020f, 0.772252f, 0.776312f, 0.781223f, 0.787163f, 0.794285f, 0.802642f, 0.811928f,
+	0.995466f, 0.889205f, 0.859941f, 0.836935f, 0.818138f, 0.802498f, 0.789412f, 0.778382f,
+	0.769060f, 0.761259f, 0.754661f, 0.749097f, 0.744430f, 0.740237f, 0.736424f, 0.733378f,
+	0.731146f, 0.729613f, 0.728689f, 0.728331f, 0.728389f, 0.728917f, 0.729904f, 0.731355f,
+	0.733435f, 0.736194f, 0.739852f, 0.744350f, 0.749861f, 0.756443f, 0.764231f, 0.773109f,
+	0.995031f, 0.880224f, 0.849670f, 0.825656f, 0.806022f, 0.789487f, 0.775511f, 0.763491f,
+	0.753193f, 0.744177f, 0.736422f, 0.729579f, 0.723421f, 0.717802f, 0.712327f, 0.707757f,
+	0.704044f, 0.700987f, 0.698677f, 0.696958f, 0.695842f, 0.695267f, 0.695269f, 0.695875f,
+	0.697106f, 0.699175f, 0.702098f, 0.705874f, 0.710603f, 0.716336f, 0.723220f, 0.731256f,
+	0.994572f, 0.870672f, 0.838576f, 0.813419f, 0.792767f, 0.775362f, 0.760438f, 0.747543f,
+	0.736276f, 0.726296f, 0.717413f, 0.709434f, 0.702086f, 0.695089f, 0.688151f, 0.682089f,
+	0.676915f, 0.672532f, 0.668851f, 0.665838f, 0.663504f, 0.661767f, 0.660667f, 0.660291f,
+	0.660506f, 0.661646f, 0.663579f, 0.666383f, 0.670053f, 0.674658f, 0.680340f, 0.687122f,
+	0.994091f, 0.860622f, 0.826806f, 0.800346f, 0.778634f, 0.760233f, 0.744416f, 0.730647f,
+	0.718481f, 0.707634f, 0.697790f, 0.688787f, 0.680321f, 0.672094f, 0.663808f, 0.656433f,
+	0.649921f, 0.644179f, 0.639248f, 0.635022f, 0.631506f, 0.628587f, 0.626409f, 0.624844f,
+	0.623993f, 0.623974f, 0.624787f, 0.626411f, 0.628815f, 0.632091f, 0.636306f, 0.641543f,
+	0.993591f, 0.850108f, 0.814393f, 0.786570f, 0.763678f, 0.744305f, 0.727574f, 0.712941f,
+	0.699949f, 0.688263f, 0.677611f, 0.667714f, 0.658293f, 0.649026f, 0.639524f, 0.630909f,
+	0.623156f, 0.616236f, 0.610097f, 0.604722f, 0.599978f, 0.595980f, 0.592591f, 0.589862f,
+	0.587891f, 0.586653f, 0.586219f, 0.586489f, 0.587523f, 0.589275f, 0.591876f, 0.595371f,
+	0.993071f, 0.839218f, 0.801466f, 0.772165f, 0.748078f, 0.727703f, 0.710127f, 0.694680f,
+	0.680935f, 0.668452f, 0.657010f, 0.646380f, 0.636082f, 0.625916f, 0.615296f, 0.605589f,
+	0.596741f, 0.588731f, 0.581497f, 0.574965f, 0.569159f, 0.564013f, 0.559521f, 0.555625f,
+	0.552426f, 0.549976f, 0.548186f, 0.547091f, 0.546676f, 0.546836f, 0.547764f, 0.549420f,
+	0.992535f, 0.827942f, 0.788180f, 0.757282f, 0.731986f, 0.710621f, 0.692149f, 0.675918f,
+	0.661468f, 0.648382f, 0.636301f, 0.624926f, 0.613951f, 0.602948f, 0.591362f, 0.580580f,
+	0.570756f, 0.561732f, 0.553528f, 0.545956f, 0.539086f, 0.532868f, 0.527277f, 0.522257f,
+	0.517856f, 0.514134f, 0.511069f, 0.508602f, 0.506694f, 0.505335f, 0.504556f, 0.504417f,
+	0.991983f, 0.816521f, 0.774534f, 0.742067f, 0.715520f, 0.693126f, 0.673835f, 0.656925f,
+	0.641829f, 0.628185f, 0.615511f, 0.603614f, 0.592047f, 0.580250f, 0.567709f, 0.556099f,
+	0.545345f, 0.535391f, 0.526215f, 0.517755f, 0.509927f, 0.502681f, 0.495996f, 0.489909f,
+	0.484347f, 0.479426f, 0.475110f, 0.471300f, 0.467974f, 0.465156f, 0.462823f, 0.460974f,
+	0.991417f, 0.804786f, 0.760635f, 0.726588f, 0.698848f, 0.675505f, 0.655412f, 0.637800f,
+	0.622180f, 0.607968f, 0.594874f, 0.582478f, 0.570418f, 0.558038f, 0.544692f, 0.532158f,
+	0.520590f, 0.509869f, 0.499775f, 0.490440f, 0.481684f, 0.473479f, 0.465825f, 0.458646f,
+	0.452026f, 0.445983f, 0.440504f, 0.435441f, 0.430893f, 0.426702f, 0.422938f, 0.419571f,
+	0.990837f, 0.792957f, 0.746571f, 0.710963f, 0.682028f, 0.657758f, 0.636972f, 0.618808f,
+	0.602666f, 0.588074f, 0.574598f, 0.561809f, 0.549286f, 0.536348f, 0.522297f, 0.509023f,
+	0.496693f, 0.485072f, 0.474201f, 0.463997f, 0.454407f, 0.445335f, 0.436753f, 0.428661f,
+	0.421048f, 0.413978f, 0.407374f, 0.401281f, 0.395565f, 0.390238f, 0.385215f, 0.380557f,
+	0.990245f, 0.780932f, 0.732355f, 0.695265f, 0.665182f, 0.640065f, 0.618635f, 0.599939f,
+	0.583430f, 0.568507f, 0.554755f, 0.541672f, 0.528821f, 0.515379f, 0.500596f, 0.486619f,
+	0.473529f, 0.461160f, 0.449622f, 0.438637f, 0.428238f, 0.418339f, 0.408928f, 0.399895f,
+	0.391414f, 0.383422f, 0.375949f, 0.368882f, 0.362193f, 0.355872f, 0.349866f, 0.344153f,
+	0.989641f, 0.768928f, 0.718147f, 0.679533f, 0.648433f, 0.622587f, 0.600585f, 0.581468f,
+	0.564653f, 0.549470f, 0.535451f, 0.522201f, 0.509044f, 0.495163f, 0.479767f, 0.465081f,
+	0.451335f, 0.438328f, 0.426001f, 0.414291f, 0.403129f, 0.392495f, 0.382305f, 0.372561f,
+	0.363250f, 0.354441f, 0.346160f, 0.338329f, 0.330893f, 0.323782f, 0.316982f, 0.310475f,
+	0.994179f, 0.999982f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.893198f, 0.999421f, 0.999853f, 0.999941f, 0.999969f, 0.999975f, 0.999978f, 0.999980f,
+	0.999981f, 0.999982f, 0.999982f, 0.999983f, 0.999998f, 0.999999f, 0.999999f, 0.999999f,
+	0.999999f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 0.999999f, 1.000000f, 1.000000f,
+	0.954779f, 0.990082f, 0.997693f, 0.998981f, 0.999413f, 0.999663f, 0.999763f, 0.999826f,
+	0.999862f, 0.999891f, 0.999916f, 0.999938f, 0.999945f, 0.999954f, 0.999968f, 0.999970f,
+	0.999973f, 0.999975f, 0.999976f, 0.999978f, 0.999979f, 0.999980f, 0.999980f, 0.999971f,
+	0.999982f, 0.999982f, 0.999983f, 0.999970f, 0.999972f, 0.999974f, 0.999982f, 0.999985f,
+	0.978868f, 0.954557f, 0.987278f, 0.994465f, 0.996993f, 0.998073f, 0.998670f, 0.999013f,
+	0.999255f, 0.999381f, 0.999480f, 0.999591f, 0.999631f, 0.999681f, 0.999749f, 0.999773f,
+	0.999785f, 0.999807f, 0.999841f, 0.999831f, 0.999823f, 0.999840f, 0.999832f, 0.999848f,
+	0.999864f, 0.999846f, 0.999840f, 0.999835f, 0.999823f, 0.999866f, 0.999912f, 0.999923f,
+	0.988063f, 0.910703f, 0.962151f, 0.981931f, 0.989803f, 0.993566f, 0.995575f, 0.996734f,
+	0.997507f, 0.998029f, 0.998399f, 0.998661f, 0.998845f, 0.998984f, 0.999113f, 0.999221f,
+	0.999288f, 0.999350f, 0.999404f, 0.999434f, 0.999488f, 0.999475f, 0.999520f, 0.999544f,
+	0.999596f, 0.999586f, 0.999591f, 0.999566f, 0.999371f, 0.999522f, 0.999704f, 0.999722f,
+	0.992381f, 0.890523f, 0.928593f, 0.959087f, 0.975211f, 0.983746f, 0.988613f, 0.991596f,
+	0.993588f, 0.994900f, 0.995858f, 0.996549f, 0.997036f, 0.997440f, 0.997723f, 0.997960f,
+	0.998190f, 0.998343f, 0.998528f, 0.998604f, 0.998680f, 0.998710f, 0.998815f, 0.998841f,
+	0.998879f, 0.998947f, 0.998942f, 0.998875f, 0.998327f, 0.998815f, 0.999207f, 0.999305f,
+	0.994698f, 0.891657f, 0.901696f, 0.931015f, 0.953103f, 0.967350f, 0.976414f, 0.982316f,
+	0.986276f, 0.989043f, 0.991054f, 0.992518f, 0.993629f, 0.994459f, 0.995141f, 0.995689f,
+	0.996127f, 0.996450f, 0.996716f, 0.996939f, 0.997211f, 0.997313f, 0.997460f, 0.997586f,
+	0.997680f, 0.997699f, 0.997731f, 0.997581f, 0.996619f, 0.997505f, 0.998296f, 0.998523f,
+	0.996037f, 0.901392f, 0.888158f, 0.906310f, 0.928092f, 0.945749f, 0.958720f, 0.967954f,
+	0.974616f, 0.979476f, 0.983034f, 0.985735f, 0.987811f, 0.989366f, 0.990674f, 0.991695f,
+	0.992533f, 0.993163f, 0.993781f, 0.994213f, 0.994613f, 0.994906f, 0.995215f, 0.995420f,
+	0.995524f, 0.995667f, 0.995613f, 0.995281f, 0.994047f, 0.995374f, 0.996744f, 0.997198f,
+	0.996834f, 0.912049f, 0.885293f, 0.889991f, 0.905762f, 0.922732f, 0.937500f, 0.949303f,
+	0.958531f, 0.965667f, 0.971170f, 0.975475f, 0.978845f, 0.981520f, 0.983672f, 0.985434f,
+	0.986852f, 0.988033f, 0.988992f, 0.989835f, 0.990486f, 0.991055f, 0.991535f, 0.991918f,
+	0.992167f, 0.992347f, 0.992285f, 0.991769f, 0.990409f, 0.992220f, 0.994320f, 0.995095f,
+	0.997308f, 0.920760f, 0.888163f, 0.881747f, 0.889320f, 0.902164f, 0.915898f, 0.928485f,
+	0.939230f, 0.948159f, 0.955487f, 0.961461f, 0.966323f, 0.970308f, 0.973572f, 0.976254f,
+	0.978467f, 0.980344f, 0.981917f, 0.983237f, 0.984335f, 0.985254f, 0.986039f, 0.986605f,
+	0.987102f, 0.987306f, 0.987239f, 0.986600f, 0.985542f, 0.987776f, 0.990652f, 0.991923f,
+	0.997569f, 0.926921f, 0.892826f, 0.879072f, 0.878870f, 0.886146f, 0.896605f, 0.907905f,
+	0.918676f, 0.928407f, 0.936896f, 0.944217f, 0.950419f, 0.955642f, 0.960056f, 0.963760f,
+	0.967008f, 0.969638f, 0.971958f, 0.973921f, 0.975539f, 0.976948f, 0.978127f, 0.979018f,
+	0.979730f, 0.980134f, 0.980111f, 0.979522f, 0.979001f, 0.981694f, 0.985376f, 0.987328f,
+	0.997682f, 0.930626f, 0.897168f, 0.879092f, 0.872909f, 0.874582f, 0.880856f, 0.889403f,
+	0.898769f, 0.908055f, 0.916735f, 0.924655f, 0.931732f, 0.937858f, 0.943322f, 0.947961f,
+	0.952069f, 0.955647f, 0.958729f, 0.961370f, 0.963721f, 0.965708f, 0.967309f, 0.968653f,
+	0.969649f, 0.970284f, 0.970486f, 0.970187f, 0.970404f, 0.973603f, 0.978086f, 0.980890f,
+	0.997684f, 0.932192f, 0.900124f, 0.879967f, 0.869572f, 0.866494f, 0.868549f, 0.873698f,
+	0.880635f, 0.888375f, 0.896287f, 0.903990f, 0.911178f, 0.917793f, 0.923711f, 0.929135f,
+	0.934043f, 0.938247f, 0.942171f, 0.945533f, 0.948427f, 0.951014f, 0.953180f, 0.954964f,
+	0.956374f, 0.957385f, 0.957861f, 0.958148f, 0.959292f, 0.963075f, 0.968317f, 0.972141f,
+	0.997603f, 0.931902f, 0.901373f, 0.880281f, 0.867120f, 0.860515f, 0.858770f, 0.860516f,
+	0.864608f, 0.870180f, 0.876557f, 0.883198f, 0.889856f, 0.896183f, 0.902216f, 0.907851f,
+	0.913085f, 0.917918f, 0.922298f, 0.926182f, 0.929671f, 0.932767f, 0.935460f, 0.937741f,
+	0.939616f, 0.941006f, 0.942111f, 0.943146f, 0.945220f, 0.949655f, 0.955638f, 0.960578f,
+	0.997454f, 0.930154f, 0.900870f, 0.879422f, 0.864633f, 0.855321f, 0.850555f, 0.849294f,
+	0.850514f, 0.853629f, 0.857980f, 0.863095f, 0.868557f, 0.873967f, 0.879438f, 0.884797f,
+	0.890004f, 0.894959f, 0.899491f, 0.903747f, 0.907604f, 0.911075f, 0.914183f, 0.916811f,
+	0.919157f, 0.921119f, 0.922828f, 0.924790f, 0.927859f, 0.932937f, 0.939611f, 0.945704f,
+	0.997249f, 0.926979f, 0.898601f, 0.877084f, 0.861217f, 0.850060f, 0.842888f, 0.839014f,
+	0.837692f, 0.838361f, 0.840528f, 0.843620f, 0.847521f, 0.851661f, 0.856144f, 0.860718f,
+	0.865369f, 0.869915f, 0.874343f, 0.878564f, 0.882457f, 0.886134f, 0.889463f, 0.892445f,
+	0.895156f, 0.897631f, 0.900082f, 0.902909f, 0.906872f, 0.912587f, 0.919881f, 0.927069f,
+	0.996995f, 0.922698f, 0.894788f, 0.873173f, 0.856571f, 0.844038f, 0.835062f, 0.829049f,
+	0.825488f, 0.823883f, 0.823841f, 0.825038f, 0.826974f, 0.829517f, 0.832572f, 0.836010f,
+	0.839701f, 0.843528f, 0.847389f, 0.851182f, 0.854887f, 0.858385f, 0.861681f, 0.864825f,
+	0.867817f, 0.870721f, 0.873830f, 0.877452f, 0.882185f, 0.888416f, 0.896209f, 0.904326f,
+	0.996701f, 0.917434f, 0.889527f, 0.867678f, 0.850424f, 0.836911f, 0.826508f, 0.818786f,
+	0.813277f, 0.809678f, 0.807647f, 0.806851f, 0.806921f, 0.807554f, 0.808972f, 0.810964f,
+	0.813382f, 0.816148f, 0.819091f, 0.822203f, 0.825330f, 0.828395f, 0.831465f, 0.834507f,
+	0.837594f, 0.840763f, 0.844335f, 0.848520f, 0.853791f, 0.860411f, 0.868486f, 0.877281f,
+	0.996375f, 0.911294f, 0.883015f, 0.860761f, 0.842895f, 0.828459f, 0.816865f, 0.807673f,
+	0.800590f, 0.795235f, 0.791361f, 0.788631f, 0.786954f, 0.785780f, 0.785377f, 0.785789f,
+	0.786718f, 0.788118f, 0.789945f, 0.792087f, 0.794346f, 0.796749f, 0.799345f, 0.802020f,
+	0.804914f, 0.808202f, 0.811923f, 0.816413f, 0.821933f, 0.828690f, 0.836810f, 0.845936f,
+	0.996005f, 0.904356f, 0.875301f, 0.852499f, 0.833925f, 0.818584f, 0.805986f, 0.795618f,
+	0.787146f, 0.780249f, 0.774751f, 0.770397f, 0.766863f, 0.763889f, 0.761717f, 0.760446f,
+	0.759780f, 0.759778f, 0.760310f, 0.761218f, 0.762416f, 0.763949f, 0.765724f, 0.767883f,
+	0.770430f, 0.773467f, 0.777144f, 0.781583f, 0.787023f, 0.793602f, 0.801465f, 0.810511f,
+	0.995612f, 0.896687f, 0.866640f, 0.842936f, 0.823577f, 0.807447f, 0.793818f, 0.782403f,
+	0.772680f, 0.764502f, 0.757559f, 0.751595f, 0.746546f, 0.741825f, 0.737954f, 0.734967f,
+	0.732771f, 0.731245f, 0.730335f, 0.729904f, 0.729896f, 0.730399f, 0.731323f, 0.732670f,
+	0.734620f, 0.737135f, 0.740415f, 0.744529f, 0.749531f, 0.755615f, 0.762903f, 0.771441f,
+	0.995192f, 0.888467f, 0.857016f, 0.832348f, 0.812058f, 0.794971f, 0.780462f, 0.767972f,
+	0.757203f, 0.747821f, 0.739638f, 0.732327f, 0.725763f, 0.719496f, 0.713962f, 0.709382f,
+	0.705591f, 0.702570f, 0.700206f, 0.698456f, 0.697292f, 0.696581f, 0.696495f, 0.696859f,
+	0.698016f, 0.699815f, 0.702403f, 0.705809f, 0.710098f, 0.715319f, 0.721732f, 0.729348f,
+	0.994748f, 0.879613f, 0.846644f, 0.820736f, 0.799430f, 0.781425f, 0.765918f, 0.752493f,
+	0.740736f, 0.730248f, 0.720935f, 0.712419f, 0.704504f, 0.696754f, 0.689694f, 0.683635f,
+	0.678390f, 0.673943f, 0.670183f, 0.667098f, 0.664674f, 0.662781f, 0.661539f, 0.660920f,
+	0.660993f, 0.661901f, 0.663578f, 0.666014f, 0.669304f, 0.673462f, 0.678659f, 0.684997f,
+	0.994282f, 0.870316f, 0.835548f, 0.808301f, 0.785807f, 0.766862f, 0.750427f, 0.736031f,
+	0.723359f, 0.711874f, 0.701451f, 0.691878f, 0.682769f, 0.673663f, 0.665239f, 0.657784f,
+	0.651209f, 0.645386f, 0.640328f, 0.636000f, 0.632258f, 0.629190f, 0.626786f, 0.625038f,
+	0.624064f, 0.623860f, 0.624395f, 0.625752f, 0.627789f, 0.630668f, 0.634431f, 0.639229f,
+	0.993798f, 0.860585f, 0.823799f, 0.795106f, 0.771460f, 0.751401f, 0.734048f, 0.718770f,
+	0.705137f, 0.692823f, 0.681516f, 0.670921f, 0.660696f, 0.650353f, 0.640688f, 0.631925f,
+	0.624053f, 0.617073f, 0.610782f, 0.605233f, 0.600327f, 0.596066f, 0.592536f, 0.589636f,
+	0.587492f, 0.586116f, 0.585430f, 0.585477f, 0.586189f, 0.587630f, 0.589839f, 0.592901f,
+	0.993294f, 0.850425f, 0.811604f, 0.781367f, 0.756400f, 0.735255f, 0.716906f, 0.700766f,
+	0.686314f, 0.673147f, 0.661048f, 0.649565f, 0.638424f, 0.626963f, 0.616078f, 0.606230f,
+	0.597270f, 0.589055f, 0.581668f, 0.574973f, 0.568996f, 0.563611f, 0.558864f, 0.554864f,
+	0.551546f, 0.548945f, 0.547001f, 0.545730f, 0.545044f, 0.544953f, 0.545534f, 0.546829f,
+	0.992773f, 0.839977f, 0.798981f, 0.767071f, 0.740824f, 0.718568f, 0.699299f, 0.682273f,
+	0.667048f, 0.653148f, 0.640307f, 0.628068f, 0.616089f, 0.603506f, 0.591684f, 0.580727f,
+	0.570746f, 0.561558f, 0.553091f, 0.545354f, 0.538296f, 0.531893f, 0.526070f, 0.520910f,
+	0.516461f, 0.512656f, 0.509466f, 0.506882f, 0.504764f, 0.503191f, 0.502192f, 0.501739f,
+	0.992238f, 0.829204f, 0.785944f, 0.752360f, 0.724797f, 0.701485f, 0.681280f, 0.663505f,
+	0.647503f, 0.633000f, 0.619464f, 0.606529f, 0.593787f, 0.580351f, 0.567504f, 0.555670f,
+	0.544740f, 0.534601f, 0.525170f, 0.516530f, 0.508478f, 0.501067f, 0.494201f, 0.487989f,
+	0.482425f, 0.477443f, 0.473119f, 0.469197f, 0.465808f, 0.462837f, 0.460316f, 0.458243f,
+	0.991688f, 0.818251f, 0.772649f, 0.737412f, 0.708528f, 0.684128f, 0.663061f, 0.644502f,
+	0.627931f, 0.612774f, 0.598667f, 0.585174f, 0.571747f, 0.557495f, 0.543778f, 0.531077f,
+	0.519274f, 0.508308f, 0.498028f, 0.488468f, 0.479533f, 0.471185f, 0.463420f, 0.456153f,
+	0.449575f, 0.443568f, 0.438033f, 0.433059f, 0.428434f, 0.424168f, 0.420301f, 0.416818f,
+	0.991125f, 0.807041f, 0.759112f, 0.722217f, 0.692088f, 0.666673f, 0.644747f, 0.625529f,
+	0.608348f, 0.592670f, 0.578089f, 0.564115f, 0.550152f, 0.535139f, 0.520615f, 0.507147f,
+	0.494536f, 0.482765f, 0.471723f, 0.461396f, 0.451633f, 0.442395f, 0.433732f, 0.425607f,
+	0.418058f, 0.411084f, 0.404628f, 0.398524f, 0.392841f, 0.387534f, 0.382512f, 0.377809f,
+	0.990549f, 0.795787f, 0.745428f, 0.706866f, 0.675497f, 0.649190f, 0.626497f, 0.606683f,
+	0.589040f, 0.572897f, 0.557940f, 0.543512f, 0.529091f, 0.513403f, 0.498166f, 0.483927f,
+	0.470652f, 0.458127f, 0.446399f, 0.435234f, 0.424700f, 0.414734f, 0.405252f, 0.396352f,
+	0.387965f, 0.380188f, 0.372846f, 0.365892f, 0.359314f, 0.353057f, 0.347106f, 0.341434f,
+	0.989961f, 0.784320f, 0.731753f, 0.691515f, 0.658994f, 0.631731f, 0.608446f, 0.588098f,
+	0.569993f, 0.553573f, 0.538246f, 0.523513f, 0.508644f, 0.492337f, 0.476399f, 0.461554f,
+	0.447603f, 0.434395f, 0.421972f, 0.410146f, 0.398897f, 0.388217f, 0.378081f, 0.368446f,
+	0.359328f, 0.350822f, 0.342770f, 0.335125f, 0.327815f, 0.320856f, 0.314198f, 0.307806f,
+	0.994180f, 0.999982f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.893214f, 0.999421f, 0.999853f, 0.999941f, 0.999969f, 0.999975f, 0.999978f, 0.999980f,
+	0.999981f, 0.999982f, 0.999982f, 0.999983f, 0.999998f, 0.999999f, 0.999999f, 0.999999f,
+	0.999999f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 0.999999f, 1.000000f, 1.000000f,
+	0.954796f, 0.990082f, 0.997693f, 0.998981f, 0.999413f, 0.999655f, 0.999751f, 0.999826f,
+	0.999862f, 0.999891f, 0.999916f, 0.999938f, 0.999945f, 0.999954f, 0.999968f, 0.999970f,
+	0.999973f, 0.999975f, 0.999976f, 0.999978f, 0.999979f, 0.999980f, 0.999980f, 0.999981f,
+	0.999982f, 0.999982f, 0.999983f, 0.999983f, 0.999982f, 0.999967f, 0.999982f, 0.999985f,
+	0.978884f, 0.954574f, 0.987282f, 0.994497f, 0.997005f, 0.998084f, 0.998681f, 0.999024f,
+	0.999255f, 0.999386f, 0.999485f, 0.999594f, 0.999632f, 0.999682f, 0.999750f, 0.999773f,
+	0.999773f, 0.999805f, 0.999832f, 0.999840f, 0.999828f, 0.999832f, 0.999831f, 0.999843f,
+	0.999871f, 0.999881f, 0.999878f, 0.999867f, 0.999861f, 0.999828f, 0.999910f, 0.999923f,
+	0.988078f, 0.910755f, 0.962166f, 0.981925f, 0.989811f, 0.993539f, 0.995563f, 0.996743f,
+	0.997514f, 0.998037f, 0.998408f, 0.998671f, 0.998860f, 0.998997f, 0.999112f, 0.999208f,
+	0.999298f, 0.999351f, 0.999412f, 0.999456f, 0.999461f, 0.999512f, 0.999534f, 0.999536f,
+	0.999586f, 0.999598f, 0.999610f, 0.999587f, 0.999503f, 0.999400f, 0.999698f, 0.999722f,
+	0.992397f, 0.890659f, 0.928629f, 0.959123f, 0.975208f, 0.983760f, 0.988633f, 0.991649f,
+	0.993589f, 0.994917f, 0.995899f, 0.996584f, 0.997064f, 0.997470f, 0.997754f, 0.997967f,
+	0.998185f, 0.998353f, 0.998493f, 0.998619f, 0.998669f, 0.998752f, 0.998813f, 0.998877f,
+	0.998971f, 0.998961f, 0.998961f, 0.998916f, 0.998713f, 0.998544f, 0.999191f, 0.999304f,
+	0.994715f, 0.891983f, 0.901842f, 0.931079f, 0.953160f, 0.967455f, 0.976477f, 0.982351f,
+	0.986341f, 0.989097f, 0.991075f, 0.992523f, 0.993633f, 0.994454f, 0.995156f, 0.995695f,
+	0.996136f, 0.996485f, 0.996758f, 0.996977f, 0.997188f, 0.997402f, 0.997547f, 0.997634f,
+	0.997696f, 0.997737f, 0.997785f, 0.997756f, 0.997200f, 0.997067f, 0.998259f, 0.998522f,
+	0.996055f, 0.901848f, 0.888415f, 0.906510f, 0.928213f, 0.945866f, 0.958778f, 0.968064f,
+	0.974698f, 0.979548f, 0.983096f, 0.985781f, 0.987846f, 0.989463f, 0.990730f, 0.991718f,
+	0.992528f, 0.993202f, 0.993802f, 0.994268f, 0.994671f, 0.995021f, 0.995245f, 0.995504f,
+	0.995615f, 0.995758f, 0.995788f, 0.995626f, 0.994738f, 0.994810f, 0.996670f, 0.997194f,
+	0.996856f, 0.912728f, 0.885772f, 0.890321f, 0.905990f, 0.922931f, 0.937603f, 0.949438f,
+	0.958625f, 0.965718f, 0.971238f, 0.975526f, 0.978889f, 0.981562f, 0.983706f, 0.985474f,
+	0.986917f, 0.988087f, 0.989059f, 0.989880f, 0.990614f, 0.991143f, 0.991599f, 0.992059f,
+	0.992322f, 0.992523f, 0.992560f, 0.992256f, 0.991098f, 0.991601f, 0.994192f, 0.995086f,
+	0.997333f, 0.921732f, 0.888801f, 0.882276f, 0.889684f, 0.902505f, 0.916151f, 0.928615f,
+	0.939398f, 0.948312f, 0.955669f, 0.961594f, 0.966437f, 0.970397f, 0.973604f, 0.976303f,
+	0.978551f, 0.980442f, 0.982030f, 0.983365f, 0.984468f, 0.985444f, 0.986187f, 0.986838f,
+	0.987348f, 0.987710f, 0.987734f, 0.987280f, 0.986206f, 0.987163f, 0.990452f, 0.991904f,
+	0.997599f, 0.928206f, 0.893772f, 0.879765f, 0.879447f, 0.886569f, 0.896980f, 0.908173f,
+	0.918953f, 0.928642f, 0.937122f, 0.944388f, 0.950588f, 0.955737f, 0.960153f, 0.963943f,
+	0.967095f, 0.969800f, 0.972119f, 0.974119f, 0.975757f, 0.977205f, 0.978419f, 0.979386f,
+	0.980144f, 0.980632f, 0.980803f, 0.980393f, 0.979598f, 0.981118f, 0.985093f, 0.987287f,
+	0.997717f, 0.932265f, 0.898395f, 0.880088f, 0.873693f, 0.875246f, 0.881367f, 0.889831f,
+	0.899111f, 0.908329f, 0.916999f, 0.924900f, 0.931839f, 0.938045f, 0.943439f, 0.948159f,
+	0.952276f, 0.955892f, 0.958996f, 0.961655f, 0.964009f, 0.966044f, 0.967725f, 0.969141f,
+	0.970264f, 0.971001f, 0.971325f, 0.971142f, 0.970934f, 0.973113f, 0.977720f, 0.980815f,
+	0.997726f, 0.934234f, 0.901721f, 0.881265f, 0.870580f, 0.867367f, 0.869249f, 0.874293f,
+	0.881142f, 0.888849f, 0.896676f, 0.904347f, 0.911471f, 0.918002f, 0.924018f, 0.929442f,
+	0.934235f, 0.938638f, 0.942532f, 0.945862f, 0.948900f, 0.951465f, 0.953747f, 0.955635f,
+	0.957198f, 0.958285f, 0.958975f, 0.959210f, 0.959791f, 0.962642f, 0.967881f, 0.972013f,
+	0.997653f, 0.934387f, 0.903365f, 0.881924f, 0.868507f, 0.861642f, 0.859755f, 0.861339f,
+	0.865326f, 0.870774f, 0.877076f, 0.883669f, 0.890203f, 0.896518f, 0.902571f, 0.908279f,
+	0.913494f, 0.918354f, 0.922765f, 0.926731f, 0.930296f, 0.933454f, 0.936214f, 0.938618f,
+	0.940600f, 0.942163f, 0.943318f, 0.944170f, 0.945676f, 0.949281f, 0.955132f, 0.960374f,
+	0.997512f, 0.933016f, 0.903282f, 0.881424f, 0.866342f, 0.856781f, 0.851825f, 0.850342f,
+	0.851466f, 0.854472f, 0.858694f, 0.863685f, 0.868977f, 0.874422f, 0.879916f, 0.885354f,
+	0.890571f, 0.895514f, 0.900138f, 0.904445f, 0.908339f, 0.911900f, 0.915103f, 0.917912f,
+	0.920382f, 0.922396f, 0.924159f, 0.925829f, 0.928285f, 0.932633f, 0.939054f, 0.945398f,
+	0.997316f, 0.930339f, 0.901478f, 0.879538f, 0.863318f, 0.851853f, 0.844486f, 0.840395f,
+	0.838914f, 0.839412f, 0.841450f, 0.844457f, 0.848150f, 0.852261f, 0.856724f, 0.861348f,
+	0.866040f, 0.870700f, 0.875136f, 0.879412f, 0.883408f, 0.887180f, 0.890609f, 0.893705f,
+	0.896557f, 0.899076f, 0.901362f, 0.903911f, 0.907284f, 0.912331f, 0.919286f, 0.926635f,
+	0.997072f, 0.926583f, 0.898145f, 0.876065f, 0.859049f, 0.846256f, 0.837024f, 0.830764f,
+	0.827001f, 0.825239f, 0.825028f, 0.826003f, 0.827829f, 0.830244f, 0.833316f, 0.836803f,
+	0.840526f, 0.844431f, 0.848347f, 0.852240f, 0.855981f, 0.859591f, 0.863029f, 0.866314f,
+	0.869313f, 0.872239f, 0.875146f, 0.878416f, 0.882568f, 0.888189f, 0.895583f, 0.903742f,
+	0.996788f, 0.921875f, 0.893390f, 0.871072f, 0.853377f, 0.839495f, 0.828792f, 0.820788f,
+	0.815038f, 0.811303f, 0.809046f, 0.808050f, 0.807876f, 0.808431f, 0.809881f, 0.811945f,
+	0.814350f, 0.817226f, 0.820220f, 0.823372f, 0.826579f, 0.829771f, 0.832910f, 0.836047f,
+	0.839135f, 0.842294f, 0.845582f, 0.849424f, 0.854133f, 0.860149f, 0.867804f, 0.876530f,
+	0.996474f, 0.916259f, 0.887389f, 0.864635f, 0.846337f, 0.831511f, 0.819557f, 0.810058f,
+	0.802742f, 0.797130f, 0.793072f, 0.790123f, 0.788065f, 0.786770f, 0.786454f, 0.786842f,
+	0.787876f, 0.789328f, 0.791209f, 0.793393f, 0.795693f, 0.798232f, 0.800829f, 0.803595f,
+	0.806490f, 0.809604f, 0.813135f, 0.817213f, 0.822232f, 0.828401f, 0.836083f, 0.845009f,
+	0.996116f, 0.909888f, 0.880246f, 0.856860f, 0.837841f, 0.822092f, 0.809112f, 0.798429f,
+	0.789594f, 0.782450f, 0.776742f, 0.772082f, 0.768129f, 0.765041f, 0.762924f, 0.761661f,
+	0.761088f, 0.761093f, 0.761629f, 0.762521f, 0.763842f, 0.765398f, 0.767228f, 0.769383f,
+	0.771902f, 0.774750f, 0.778146f, 0.782224f, 0.787191f, 0.793268f, 0.800659f, 0.809408f,
+	0.995735f, 0.902877f, 0.872098f, 0.847869f, 0.828000f, 0.811384f, 0.797405f, 0.785597f,
+	0.775526f, 0.767034f, 0.759787f, 0.753500f, 0.747965f, 0.743073f, 0.739256f, 0.736297f,
+	0.734124f, 0.732576f, 0.731716f, 0.731320f, 0.731391f, 0.731847f, 0.732778f, 0.734118f,
+	0.735917f, 0.738282f, 0.741283f, 0.745003f, 0.749603f, 0.755178f, 0.762001f, 0.770168f,
+	0.995327f, 0.895212f, 0.863048f, 0.837773f, 0.816921f, 0.799386f, 0.784464f, 0.771557f,
+	0.760371f, 0.750643f, 0.742079f, 0.734414f, 0.727340f, 0.720771f, 0.715285f, 0.710668f,
+	0.707022f, 0.703918f, 0.701580f, 0.699839f, 0.698594f, 0.697892f, 0.697717f, 0.698138f,
+	0.699091f, 0.700711f, 0.703042f, 0.706100f, 0.709979f, 0.714809f, 0.720722f, 0.727922f,
+	0.994896f, 0.887006f, 0.853268f, 0.826719f, 0.804821f, 0.786289f, 0.770332f, 0.756470f,
+	0.744248f, 0.733380f, 0.723615f, 0.714669f, 0.706067f, 0.698013f, 0.690981f, 0.684902f,
+	0.679673f, 0.675201f, 0.671486f, 0.668312f, 0.665815f, 0.663893f, 0.662517f, 0.661863f,
+	0.661815f, 0.662548f, 0.663926f, 0.666089f, 0.669029f, 0.672788f, 0.677525f, 0.683435f,
+	0.994444f, 0.878355f, 0.842751f, 0.814813f, 0.791732f, 0.772172f, 0.755191f, 0.740353f,
+	0.727148f, 0.715236f, 0.704377f, 0.694257f, 0.684357f, 0.674847f, 0.666452f, 0.658988f,
+	0.652306f, 0.646503f, 0.641403f, 0.636970f, 0.633179f, 0.630023f, 0.627514f, 0.625687f,
+	0.624590f, 0.624212f, 0.624511f, 0.625560f, 0.627316f, 0.629819f, 0.633198f, 0.637554f,
+	0.993973f, 0.869226f, 0.831627f, 0.802133f, 0.777796f, 0.757143f, 0.739185f, 0.723379f,
+	0.709199f, 0.696352f, 0.684503f, 0.673327f, 0.662255f, 0.651415f, 0.641720f, 0.632962f,
+	0.625020f, 0.617917f, 0.611564f, 0.605923f, 0.600885f, 0.596519f, 0.592879f, 0.589889f,
+	0.587643f, 0.586089f, 0.585233f, 0.585048f, 0.585466f, 0.586613f, 0.588455f, 0.591138f,
+	0.993482f, 0.859715f, 0.819996f, 0.788831f, 0.763242f, 0.741407f, 0.722416f, 0.705698f,
+	0.690631f, 0.676876f, 0.664121f, 0.651957f, 0.639785f, 0.627793f, 0.616927f, 0.606906f,
+	0.597853f, 0.589597f, 0.582048f, 0.575257f, 0.569119f, 0.563664f, 0.558802f, 0.554684f,
+	0.551319f, 0.548564f, 0.546475f, 0.545000f, 0.544091f, 0.543778f, 0.544044f, 0.545001f,
+	0.992976f, 0.849905f, 0.807858f, 0.775072f, 0.748034f, 0.725106f, 0.705097f, 0.687442f,
+	0.671551f, 0.656998f, 0.643366f, 0.630314f, 0.617167f, 0.604072f, 0.592138f, 0.581070f,
+	0.570943f, 0.561617f, 0.553062f, 0.545191f, 0.537995f, 0.531450f, 0.525536f, 0.520365f,
+	0.515811f, 0.511913f, 0.508634f, 0.505852f, 0.503622f, 0.501835f, 0.500582f, 0.499870f,
+	0.992454f, 0.839792f, 0.795392f, 0.760850f, 0.732452f, 0.708288f, 0.687349f, 0.668814f,
+	0.652119f, 0.636789f, 0.622449f, 0.608618f, 0.594584f, 0.580507f, 0.567493f, 0.555546f,
+	0.544458f, 0.534182f, 0.524662f, 0.515839f, 0.507644f, 0.500099f, 0.493224f, 0.486996f,
+	0.481401f, 0.476344f, 0.471905f, 0.467944f, 0.464388f, 0.461308f, 0.458599f, 0.456353f,
+	0.991918f, 0.829409f, 0.782579f, 0.746289f, 0.716495f, 0.691265f, 0.669348f, 0.649923f,
+	0.632550f, 0.616537f, 0.601541f, 0.587023f, 0.572152f, 0.557151f, 0.543304f, 0.530405f,
+	0.518445f, 0.507335f, 0.496947f, 0.487210f, 0.478161f, 0.469752f, 0.461872f, 0.454686f,
+	0.448125f, 0.442101f, 0.436575f, 0.431534f, 0.426832f, 0.422526f, 0.418533f, 0.414926f,
+	0.991368f, 0.818809f, 0.769578f, 0.731502f, 0.700302f, 0.673972f, 0.651168f, 0.631054f,
+	0.612936f, 0.596364f, 0.580756f, 0.565635f, 0.550055f, 0.534214f, 0.519578f, 0.505908f,
+	0.493147f, 0.481213f, 0.470047f, 0.459557f, 0.449703f, 0.440401f, 0.431751f, 0.423662f,
+	0.416203f, 0.409284f, 0.402826f, 0.396757f, 0.391077f, 0.385714f, 0.380684f, 0.375931f,
+	0.990806f, 0.808093f, 0.756323f, 0.716547f, 0.684042f, 0.656663f, 0.633004f, 0.612218f,
+	0.593527f, 0.576415f, 0.560318f, 0.544701f, 0.528433f, 0.511788f, 0.496409f, 0.482038f,
+	0.468606f, 0.455893f, 0.444035f, 0.432804f, 0.422238f, 0.412192f, 0.402763f, 0.393959f,
+	0.385725f, 0.378000f, 0.370718f, 0.363873f, 0.357356f, 0.351154f, 0.345241f, 0.339585f,
+	0.990233f, 0.797255f, 0.743093f, 0.701523f, 0.667759f, 0.639377f, 0.614959f, 0.593530f,
+	0.574358f, 0.556868f, 0.540352f, 0.524255f, 0.507387f, 0.490081f, 0.473991f, 0.458926f,
+	0.444813f, 0.431538f, 0.418990f, 0.407062f, 0.395865f, 0.385205f, 0.375127f, 0.365656f,
+	0.356753f, 0.348410f, 0.340495f, 0.332960f, 0.325775f, 0.318910f, 0.312306f, 0.305996f,
+	0.994181f, 0.999982f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.893231f, 0.999421f, 0.999853f, 0.999941f, 0.999969f, 0.999975f, 0.999978f, 0.999980f,
+	0.999981f, 0.999982f, 0.999982f, 0.999983f, 0.999998f, 0.999999f, 0.999999f, 0.999999f,
+	0.999999f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 0.999997f, 1.000000f, 1.000000f,
+	0.954814f, 0.990083f, 0.997694f, 0.998982f, 0.999413f, 0.999655f, 0.999751f, 0.999814f,
+	0.999862f, 0.999891f, 0.999916f, 0.999938f, 0.999945f, 0.999954f, 0.999968f, 0.999970f,
+	0.999973f, 0.999975f, 0.999976f, 0.999978f, 0.999979f, 0.999980f, 0.999980f, 0.999981f,
+	0.999972f, 0.999967f, 0.999983f, 0.999983f, 0.999982f, 0.999942f, 0.999982f, 0.999985f,
+	0.978900f, 0.954592f, 0.987298f, 0.994507f, 0.997005f, 0.998084f, 0.998682f, 0.999025f,
+	0.999258f, 0.999390f, 0.999490f, 0.999606f, 0.999644f, 0.999684f, 0.999751f, 0.999774f,
+	0.999772f, 0.999783f, 0.999832f, 0.999840f, 0.999846f, 0.999827f, 0.999832f, 0.999860f,
+	0.999858f, 0.999858f, 0.999882f, 0.999866f, 0.999864f, 0.999705f, 0.999907f, 0.999923f,
+	0.988094f, 0.910819f, 0.962181f, 0.981940f, 0.989822f, 0.993557f, 0.995570f, 0.996737f,
+	0.997504f, 0.998025f, 0.998410f, 0.998674f, 0.998862f, 0.998997f, 0.999131f, 0.999219f,
+	0.999279f, 0.999361f, 0.999390f, 0.999458f, 0.999461f, 0.999503f, 0.999529f, 0.999550f,
+	0.999601f, 0.999609f, 0.999606f, 0.999572f, 0.999565f, 0.999105f, 0.999690f, 0.999722f,
+	0.992413f, 0.890759f, 0.928713f, 0.959165f, 0.975232f, 0.983786f, 0.988687f, 0.991681f,
+	0.993618f, 0.994914f, 0.995880f, 0.996581f, 0.997048f, 0.997478f, 0.997769f, 0.997981f,
+	0.998188f, 0.998366f, 0.998488f, 0.998643f, 0.998720f, 0.998749f, 0.998825f, 0.998892f,
+	0.998919f, 0.999001f, 0.998986f, 0.999012f, 0.998879f, 0.998105f, 0.999170f, 0.999304f,
+	0.994731f, 0.892172f, 0.901976f, 0.931187f, 0.953272f, 0.967498f, 0.976507f, 0.982408f,
+	0.986362f, 0.989136f, 0.991103f, 0.992528f, 0.993628f, 0.994490f, 0.995155f, 0.995705f,
+	0.996163f, 0.996488f, 0.996772f, 0.996984f, 0.997197f, 0.997398f, 0.997533f, 0.997637f,
+	0.997741f, 0.997797f, 0.997871f, 0.997842f, 0.997543f, 0.996567f, 0.998212f, 0.998521f,
+	0.996073f, 0.902270f, 0.888680f, 0.906692f, 0.928358f, 0.945917f, 0.958860f, 0.968096f,
+	0.974724f, 0.979547f, 0.983123f, 0.985805f, 0.987838f, 0.989450f, 0.990747f, 0.991782f,
+	0.992551f, 0.993238f, 0.993811f, 0.994303f, 0.994713f, 0.995007f, 0.995321f, 0.995519f,
+	0.995676f, 0.995840f, 0.995907f, 0.995803f, 0.995245f, 0.994321f, 0.996581f, 0.997191f,
+	0.996876f, 0.913353f, 0.886141f, 0.890552f, 0.906166f, 0.923070f, 0.937747f, 0.949508f,
+	0.958708f, 0.965811f, 0.971303f, 0.975585f, 0.978943f, 0.981570f, 0.983734f, 0.985489f,
+	0.986956f, 0.988140f, 0.989123f, 0.989945f, 0.990651f, 0.991252f, 0.991767f, 0.992174f,
+	0.992512f, 0.992689f, 0.992812f, 0.992614f, 0.991749f, 0.991162f, 0.994043f, 0.995078f,
+	0.997356f, 0.922591f, 0.889383f, 0.882622f, 0.889993f, 0.902735f, 0.916345f, 0.928836f,
+	0.939499f, 0.948454f, 0.955728f, 0.961703f, 0.966478f, 0.970459f, 0.973719f, 0.976387f,
+	0.978662f, 0.980516f, 0.982078f, 0.983464f, 0.984598f, 0.985498f, 0.986358f, 0.987030f,
+	0.987580f, 0.987913f, 0.988069f, 0.987854f, 0.986926f, 0.986786f, 0.990229f, 0.991885f,
+	0.997625f, 0.929293f, 0.894547f, 0.880332f, 0.879873f, 0.886914f, 0.897261f, 0.908451f,
+	0.919128f, 0.928777f, 0.937225f, 0.944496f, 0.950614f, 0.955834f, 0.960307f, 0.964016f,
+	0.967195f, 0.969929f, 0.972232f, 0.974253f, 0.975925f, 0.977372f, 0.978630f, 0.979680f,
+	0.980482f, 0.981063f, 0.981321f, 0.981153f, 0.980282f, 0.980810f, 0.984793f, 0.987249f,
+	0.997748f, 0.933650f, 0.899456f, 0.880871f, 0.874334f, 0.875716f, 0.881793f, 0.890180f,
+	0.899414f, 0.908587f, 0.917206f, 0.925070f, 0.932062f, 0.938194f, 0.943581f, 0.948333f,
+	0.952453f, 0.956063f, 0.959166f, 0.961899f, 0.964253f, 0.966323f, 0.968046f, 0.969517f,
+	0.970703f, 0.971614f, 0.972056f, 0.972007f, 0.971636f, 0.972852f, 0.977357f, 0.980746f,
+	0.997763f, 0.935904f, 0.903047f, 0.882260f, 0.871450f, 0.868034f, 0.869828f, 0.874772f,
+	0.881566f, 0.889198f, 0.897011f, 0.904572f, 0.911655f, 0.918236f, 0.924215f, 0.929635f,
+	0.934497f, 0.938877f, 0.942778f, 0.946204f, 0.949227f, 0.951908f, 0.954232f, 0.956213f,
+	0.957860f, 0.959089f, 0.959875f, 0.960155f, 0.960411f, 0.962459f, 0.967467f, 0.971896f,
+	0.997695f, 0.936429f, 0.905029f, 0.883271f, 0.869605f, 0.862559f, 0.860545f, 0.862023f,
+	0.865917f, 0.871275f, 0.877450f, 0.884038f, 0.890485f, 0.896850f, 0.902865f, 0.908575f,
+	0.913820f, 0.918696f, 0.923169f, 0.927172f, 0.930758f, 0.933973f, 0.936843f, 0.939347f,
+	0.941458f, 0.943131f, 0.944372f, 0.945205f, 0.946304f, 0.949166f, 0.954697f, 0.960191f,
+	0.997562f, 0.935408f, 0.905248f, 0.883125f, 0.867716f, 0.857950f, 0.852800f, 0.851232f,
+	0.852183f, 0.855098f, 0.859210f, 0.864171f, 0.869353f, 0.874806f, 0.880311f, 0.885812f,
+	0.891010f, 0.895968f, 0.900651f, 0.904951f, 0.908973f, 0.912599f, 0.915919f, 0.918846f,
+	0.921452f, 0.923556f, 0.925332f, 0.926872f, 0.928905f, 0.932546f, 0.938605f, 0.945129f,
+	0.997373f, 0.933168f, 0.903821f, 0.881559f, 0.864999f, 0.853345f, 0.845763f, 0.841505f,
+	0.839861f, 0.840218f, 0.842160f, 0.845062f, 0.848623f, 0.852748f, 0.857224f, 0.861906f,
+	0.866624f, 0.871278f, 0.875776f, 0.880119f, 0.884195f, 0.888025f, 0.891584f, 0.894842f,
+	0.897744f, 0.900346f, 0.902629f, 0.904973f, 0.907870f, 0.912290f, 0.918833f, 0.926263f,
+	0.997138f, 0.929817f, 0.900869f, 0.878460f, 0.861157f, 0.848067f, 0.838553f, 0.832103f,
+	0.828154f, 0.826241f, 0.825896f, 0.826785f, 0.828402f, 0.830821f, 0.833953f, 0.837452f,
+	0.841239f, 0.845179f, 0.849145f, 0.853044f, 0.856909f, 0.860664f, 0.864191f, 0.867529f,
+	0.870653f, 0.873557f, 0.876416f, 0.879439f, 0.883139f, 0.888173f, 0.895113f, 0.903253f,
+	0.996863f, 0.925532f, 0.896539f, 0.873847f, 0.855832f, 0.841635f, 0.830677f, 0.822447f,
+	0.816526f, 0.812511f, 0.810100f, 0.808915f, 0.808614f, 0.809189f, 0.810672f, 0.812719f,
+	0.815205f, 0.818107f, 0.821227f, 0.824419f, 0.827674f, 0.830964f, 0.834186f, 0.837413f,
+	0.840557f, 0.843658f, 0.846853f, 0.850365f, 0.854635f, 0.860159f, 0.867342f, 0.875915f,
+	0.996558f, 0.920366f, 0.890969f, 0.867840f, 0.849152f, 0.833939f, 0.821727f, 0.812038f,
+	0.804463f, 0.798655f, 0.794399f, 0.791203f, 0.788893f, 0.787638f, 0.787354f, 0.787777f,
+	0.788875f, 0.790419f, 0.792292f, 0.794519f, 0.796907f, 0.799502f, 0.802180f, 0.805015f,
+	0.807906f, 0.810983f, 0.814308f, 0.818106f, 0.822675f, 0.828364f, 0.835585f, 0.844268f,
+	0.996211f, 0.914496f, 0.884263f, 0.860479f, 0.841006f, 0.824972f, 0.811644f, 0.800621f,
+	0.791598f, 0.784240f, 0.778221f, 0.773292f, 0.769113f, 0.766033f, 0.763924f, 0.762705f,
+	0.762176f, 0.762265f, 0.762836f, 0.763783f, 0.765090f, 0.766777f, 0.768689f, 0.770869f,
+	0.773314f, 0.776097f, 0.779250f, 0.783029f, 0.787584f, 0.793175f, 0.800117f, 0.808545f,
+	0.995840f, 0.907920f, 0.876615f, 0.851909f, 0.831610f, 0.814596f, 0.800322f, 0.788158f,
+	0.777815f, 0.769035f, 0.761478f, 0.754944f, 0.748956f, 0.744144f, 0.740297f, 0.737377f,
+	0.735224f, 0.733775f, 0.732942f, 0.732570f, 0.732644f, 0.733171f, 0.734104f, 0.735483f,
+	0.737245f, 0.739447f, 0.742219f, 0.745650f, 0.749899f, 0.755051f, 0.761420f, 0.769195f,
+	0.995443f, 0.900790f, 0.868051f, 0.842295f, 0.820981f, 0.803054f, 0.787745f, 0.774459f,
+	0.762991f, 0.752891f, 0.744029f, 0.735950f, 0.728337f, 0.721873f, 0.716379f, 0.711852f,
+	0.708134f, 0.705140f, 0.702852f, 0.701044f, 0.699886f, 0.699173f, 0.699022f, 0.699400f,
+	0.700285f, 0.701742f, 0.703836f, 0.706605f, 0.710160f, 0.714572f, 0.720062f, 0.726851f,
+	0.995023f, 0.893210f, 0.858717f, 0.831662f, 0.809286f, 0.790244f, 0.773963f, 0.759686f,
+	0.747073f, 0.735855f, 0.725731f, 0.716283f, 0.707176f, 0.699155f, 0.692128f, 0.686038f,
+	0.680847f, 0.676342f, 0.672598f, 0.669473f, 0.666947f, 0.664957f, 0.663654f, 0.662940f,
+	0.662853f, 0.663399f, 0.664541f, 0.666426f, 0.669044f, 0.672456f, 0.676804f, 0.682285f,
+	0.994582f, 0.885024f, 0.848713f, 0.820183f, 0.796570f, 0.776529f, 0.759138f, 0.743810f,
+	0.730221f, 0.717888f, 0.706624f, 0.695948f, 0.685474f, 0.676002f, 0.667517f, 0.660041f,
+	0.653393f, 0.647574f, 0.642460f, 0.637973f, 0.634116f, 0.630941f, 0.628382f, 0.626582f,
+	0.625323f, 0.624797f, 0.624912f, 0.625691f, 0.627185f, 0.629373f, 0.632365f, 0.636341f,
+	0.994123f, 0.876410f, 0.838046f, 0.807958f, 0.783074f, 0.761835f, 0.743412f, 0.727131f,
+	0.712497f, 0.699210f, 0.686817f, 0.675029f, 0.663201f, 0.652413f, 0.642643f, 0.633881f,
+	0.625901f, 0.618762f, 0.612366f, 0.606669f, 0.601623f, 0.597202f, 0.593500f, 0.590487f,
+	0.588131f, 0.586426f, 0.585404f, 0.584958f, 0.585158f, 0.586040f, 0.587557f, 0.589879f,
+	0.993644f, 0.867486f, 0.826882f, 0.795079f, 0.768840f, 0.746460f, 0.726946f, 0.709650f,
+	0.694079f, 0.679852f, 0.666506f, 0.653614f, 0.640564f, 0.628603f, 0.617623f, 0.607670f,
+	0.598525f, 0.590198f, 0.582598f, 0.575758f, 0.569505f, 0.564022f, 0.559107f, 0.554986f,
+	0.551469f, 0.548609f, 0.546365f, 0.544715f, 0.543633f, 0.543059f, 0.543065f, 0.543713f,
+	0.993149f, 0.858195f, 0.815253f, 0.781720f, 0.754014f, 0.730424f, 0.709854f, 0.691595f,
+	0.675173f, 0.660009f, 0.645768f, 0.631876f, 0.617760f, 0.604670f, 0.592580f, 0.581488f,
+	0.571274f, 0.561913f, 0.553249f, 0.545292f, 0.538055f, 0.531403f, 0.525538f, 0.520268f,
+	0.515696f, 0.511675f, 0.508253f, 0.505368f, 0.502947f, 0.500991f, 0.499517f, 0.498566f,
+	0.992639f, 0.848584f, 0.803223f, 0.767877f, 0.738737f, 0.713926f, 0.692353f, 0.673173f,
+	0.655838f, 0.639830f, 0.624741f, 0.609969f, 0.594841f, 0.580718f, 0.567690f, 0.555583f,
+	0.544403f, 0.534060f, 0.524433f, 0.515511f, 0.507258f, 0.499666f, 0.492735f, 0.486540f,
+	0.480886f, 0.475838f, 0.471296f, 0.467204f, 0.463554f, 0.460308f, 0.457486f, 0.455047f,
+	0.992115f, 0.838755f, 0.790882f, 0.753694f, 0.723117f, 0.697085f, 0.674433f, 0.654371f,
+	0.636277f, 0.619525f, 0.603750f, 0.588164f, 0.572076f, 0.556953f, 0.543030f, 0.530079f,
+	0.517981f, 0.506822f, 0.496295f, 0.486485f, 0.477348f, 0.468847f, 0.461041f, 0.453907f,
+	0.447324f, 0.441274f, 0.435737f, 0.430559f, 0.425792f, 0.421407f, 0.417370f, 0.413629f,
+	0.991578f, 0.828683f, 0.778287f, 0.739256f, 0.707206f, 0.679994f, 0.656448f, 0.635545f,
+	0.616664f, 0.599302f, 0.582787f, 0.566510f, 0.549522f, 0.533599f, 0.518821f, 0.505008f,
+	0.492162f, 0.480191f, 0.468904f, 0.458329f, 0.448414f, 0.439116f, 0.430512f, 0.422509f,
+	0.415090f, 0.408122f, 0.401687f, 0.395617f, 0.389914f, 0.384570f, 0.379450f, 0.374651f,
+	0.991028f, 0.818458f, 0.765477f, 0.724618f, 0.691193f, 0.662827f, 0.638365f, 0.616694f,
+	0.597159f, 0.579151f, 0.562109f, 0.545142f, 0.527416f, 0.510723f, 0.495180f, 0.480668f,
+	0.467143f, 0.454380f, 0.442379f, 0.431086f, 0.420501f, 0.410456f, 0.401167f, 0.392445f,
+	0.384302f, 0.376640f, 0.369417f, 0.362589f, 0.356085f, 0.349878f, 0.343988f, 0.338330f,
+	0.990466f, 0.808047f, 0.752547f, 0.709878f, 0.675097f, 0.645712f, 0.620331f, 0.598032f,
+	0.577895f, 0.559379f, 0.541800f, 0.524320f, 0.505844f, 0.488435f, 0.472203f, 0.456991f,
+	0.442810f, 0.429439f, 0.416859f, 0.404930f, 0.393641f, 0.383075f, 0.373128f, 0.363808f,
+	0.355057f, 0.346766f, 0.338936f, 0.331486f, 0.324384f, 0.317547f, 0.311025f, 0.304773f,
+	0.994181f, 0.999982f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.893248f, 0.999421f, 0.999853f, 0.999941f, 0.999969f, 0.999975f, 0.999978f, 0.999980f,
+	0.999981f, 0.999982f, 0.999982f, 0.999983f, 0.999998f, 0.999999f, 0.999999f, 0.999999f,
+	0.999999f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 0.999999f, 1.000000f, 1.000000f,
+	0.954833f, 0.990084f, 0.997694f, 0.998982f, 0.999414f, 0.999655f, 0.999751f, 0.999815f,
+	0.999850f, 0.999891f, 0.999916f, 0.999938f, 0.999945f, 0.999954f, 0.999968f, 0.999970f,
+	0.999973f, 0.999975f, 0.999976f, 0.999978f, 0.999979f, 0.999980f, 0.999980f, 0.999981f,
+	0.999982f, 0.999982f, 0.999983f, 0.999983f, 0.999976f, 0.999939f, 0.999981f, 0.999985f,
+	0.978918f, 0.954604f, 0.987310f, 0.994508f, 0.997006f, 0.998085f, 0.998683f, 0.999030f,
+	0.999270f, 0.999400f, 0.999495f, 0.999610f, 0.999653f, 0.999701f, 0.999755f, 0.999775f,
+	0.999766f, 0.999773f, 0.999831f, 0.999840f, 0.999846f, 0.999835f, 0.999830f, 0.999867f,
+	0.999862f, 0.999872f, 0.999868f, 0.999862f, 0.999857f, 0.999647f, 0.999905f, 0.999923f,
+	0.988111f, 0.910863f, 0.962224f, 0.981963f, 0.989819f, 0.993557f, 0.995585f, 0.996739f,
+	0.997501f, 0.998030f, 0.998403f, 0.998685f, 0.998871f, 0.999008f, 0.999135f, 0.999233f,
+	0.999277f, 0.999338f, 0.999391f, 0.999467f, 0.999490f, 0.999485f, 0.999554f, 0.999567f,
+	0.999596f, 0.999598f, 0.999615f, 0.999606f, 0.999605f, 0.999016f, 0.999680f, 0.999722f,
+	0.992429f, 0.890896f, 0.928756f, 0.959223f, 0.975278f, 0.983819f, 0.988721f, 0.991705f,
+	0.993630f, 0.994927f, 0.995881f, 0.996577f, 0.997034f, 0.997457f, 0.997765f, 0.998003f,
+	0.998208f, 0.998375f, 0.998504f, 0.998615f, 0.998721f, 0.998754f, 0.998860f, 0.998898f,
+	0.998941f, 0.999000f, 0.998990f, 0.999023f, 0.998951f, 0.998011f, 0.999143f, 0.999304f,
+	0.994748f, 0.892425f, 0.902116f, 0.931266f, 0.953312f, 0.967528f, 0.976548f, 0.982411f,
+	0.986388f, 0.989139f, 0.991126f, 0.992546f, 0.993651f, 0.994502f, 0.995160f, 0.995721f,
+	0.996155f, 0.996503f, 0.996779f, 0.997037f, 0.997244f, 0.997408f, 0.997589f, 0.997697f,
+	0.997750f, 0.997825f, 0.997907f, 0.997924f, 0.997754f, 0.996486f, 0.998155f, 0.998520f,
+	0.996090f, 0.902570f, 0.888874f, 0.906805f, 0.928447f, 0.946006f, 0.958924f, 0.968138f,
+	0.974723f, 0.979557f, 0.983107f, 0.985792f, 0.987821f, 0.989438f, 0.990741f, 0.991771f,
+	0.992630f, 0.993236f, 0.993813f, 0.994345f, 0.994756f, 0.995061f, 0.995370f, 0.995553f,
+	0.995778f, 0.995912f, 0.996021f, 0.995985f, 0.995589f, 0.994239f, 0.996473f, 0.997188f,
+	0.996894f, 0.913790f, 0.886471f, 0.890779f, 0.906370f, 0.923207f, 0.937832f, 0.949581f,
+	0.958772f, 0.965894f, 0.971369f, 0.975645f, 0.978980f, 0.981653f, 0.983778f, 0.985521f,
+	0.986971f, 0.988171f, 0.989186f, 0.990012f, 0.990683f, 0.991301f, 0.991810f, 0.992241f,
+	0.992603f, 0.992814f, 0.992935f, 0.992854f, 0.992263f, 0.991087f, 0.993867f, 0.995070f,
+	0.997376f, 0.923240f, 0.889837f, 0.882999f, 0.890227f, 0.902939f, 0.916528f, 0.928922f,
+	0.939632f, 0.948501f, 0.955781f, 0.961724f, 0.966538f, 0.970499f, 0.973725f, 0.976430f,
+	0.978709f, 0.980626f, 0.982157f, 0.983536f, 0.984660f, 0.985626f, 0.986501f, 0.987185f,
+	0.987745f, 0.988138f, 0.988352f, 0.988242f, 0.987505f, 0.986720f, 0.989982f, 0.991867f,
+	0.997649f, 0.930191f, 0.895176f, 0.880839f, 0.880283f, 0.887245f, 0.897490f, 0.908598f,
+	0.919315f, 0.928945f, 0.937378f, 0.944569f, 0.950702f, 0.955957f, 0.960333f, 0.964105f,
+	0.967343f, 0.970011f, 0.972342f, 0.974366f, 0.976079f, 0.977535f, 0.978803f, 0.979871f,
+	0.980763f, 0.981380f, 0.981746f, 0.981683f, 0.981012f, 0.980781f, 0.984487f, 0.987214f,
+	0.997776f, 0.934770f, 0.900283f, 0.881542f, 0.874832f, 0.876126f, 0.882134f, 0.890449f,
+	0.899634f, 0.908807f, 0.917420f, 0.925196f, 0.932141f, 0.938309f, 0.943711f, 0.948467f,
+	0.952635f, 0.956179f, 0.959358f, 0.962061f, 0.964461f, 0.966560f, 0.968354f, 0.969875f,
+	0.971128f, 0.972058f, 0.972629f, 0.972701f, 0.972327f, 0.972841f, 0.977006f, 0.980681f,
+	0.997795f, 0.937298f, 0.904166f, 0.883130f, 0.872178f, 0.868652f, 0.870281f, 0.875158f,
+	0.881894f, 0.889480f, 0.897209f, 0.904743f, 0.911764f, 0.918389f, 0.924365f, 0.929832f,
+	0.934733f, 0.939110f, 0.942985f, 0.946490f, 0.949568f, 0.952242f, 0.954614f, 0.956631f,
+	0.958380f, 0.959678f, 0.960613f, 0.960999f, 0.961130f, 0.962481f, 0.967093f, 0.971789f,
+	0.997733f, 0.938101f, 0.906375f, 0.884390f, 0.870507f, 0.863284f, 0.861145f, 0.862544f,
+	0.866348f, 0.871687f, 0.877854f, 0.884249f, 0.890738f, 0.897029f, 0.903099f, 0.908762f,
+	0.914155f, 0.918999f, 0.923483f, 0.927547f, 0.931156f, 0.934479f, 0.937405f, 0.939936f,
+	0.942137f, 0.943897f, 0.945268f, 0.946130f, 0.947033f, 0.949224f, 0.954335f, 0.960027f,
+	0.997605f, 0.937393f, 0.906932f, 0.884470f, 0.868874f, 0.858918f, 0.853629f, 0.851874f,
+	0.852824f, 0.855615f, 0.859681f, 0.864432f, 0.869667f, 0.875086f, 0.880696f, 0.886096f,
+	0.891374f, 0.896373f, 0.901072f, 0.905458f, 0.909528f, 0.913252f, 0.916660f, 0.919612f,
+	0.922271f, 0.924532f, 0.926328f, 0.927869f, 0.929617f, 0.932653f, 0.938249f, 0.944893f,
+	0.997423f, 0.935491f, 0.905778f, 0.883221f, 0.866436f, 0.854554f, 0.846805f, 0.842418f,
+	0.840619f, 0.840915f, 0.842728f, 0.845465f, 0.848978f, 0.853125f, 0.857619f, 0.862375f,
+	0.867084f, 0.871798f, 0.876322f, 0.880717f, 0.884904f, 0.888802f, 0.892419f, 0.895760f,
+	0.898757f, 0.901433f, 0.903736f, 0.905976f, 0.908530f, 0.912414f, 0.918499f, 0.925943f,
+	0.997196f, 0.932481f, 0.903183f, 0.880440f, 0.862813f, 0.849479f, 0.839775f, 0.833146f,
+	0.829072f, 0.827040f, 0.826587f, 0.827271f, 0.828839f, 0.831366f, 0.834505f, 0.838018f,
+	0.841814f, 0.845773f, 0.849809f, 0.853848f, 0.857736f, 0.861507f, 0.865207f, 0.868621f,
+	0.871788f, 0.874793f, 0.877567f, 0.880422f, 0.883750f, 0.888320f, 0.894790f, 0.902841f,
+	0.996928f, 0.928549f, 0.899192f, 0.876128f, 0.857812f, 0.843370f, 0.832160f, 0.823758f,
+	0.817682f, 0.813559f, 0.810969f, 0.809582f, 0.809155f, 0.809773f, 0.811278f, 0.813367f,
+	0.815913f, 0.818857f, 0.821980f, 0.825288f, 0.828589f, 0.831957f, 0.835334f, 0.838580f,
+	0.841801f, 0.844898f, 0.847989f, 0.851314f, 0.855269f, 0.860288f, 0.867014f, 0.875410f,
+	0.996632f, 0.923821f, 0.893985f, 0.870446f, 0.851435f, 0.836034f, 0.823559f, 0.813591f,
+	0.805805f, 0.799844f, 0.795329f, 0.791925f, 0.789609f, 0.788353f, 0.788038f, 0.788581f,
+	0.789661f, 0.791279f, 0.793211f, 0.795473f, 0.797962f, 0.800669f, 0.803405f, 0.806306f,
+	0.809230f, 0.812271f, 0.815447f, 0.818982f, 0.823230f, 0.828520f, 0.835260f, 0.843674f,
+	0.996293f, 0.918331f, 0.887681f, 0.863462f, 0.843683f, 0.827274f, 0.813710f, 0.802474f,
+	0.793231f, 0.785601f, 0.779336f, 0.774112f, 0.769871f, 0.766865f, 0.764794f, 0.763580f,
+	0.763058f, 0.763186f, 0.763790f, 0.764885f, 0.766265f, 0.768014f, 0.769961f, 0.772189f,
+	0.774633f, 0.777325f, 0.780346f, 0.783876f, 0.788082f, 0.793281f, 0.799788f, 0.807869f,
+	0.995931f, 0.912193f, 0.880374f, 0.855285f, 0.834599f, 0.817278f, 0.802611f, 0.790194f,
+	0.779666f, 0.770618f, 0.762847f, 0.755832f, 0.749829f, 0.745049f, 0.741201f, 0.738333f,
+	0.736246f, 0.734810f, 0.734051f, 0.733710f, 0.733836f, 0.734432f, 0.735475f, 0.736806f,
+	0.738555f, 0.740651f, 0.743241f, 0.746430f, 0.750302f, 0.755095f, 0.761050f, 0.768450f,
+	0.995544f, 0.905508f, 0.872212f, 0.845961f, 0.824334f, 0.806005f, 0.790344f, 0.776838f,
+	0.765016f, 0.754713f, 0.745438f, 0.736942f, 0.729287f, 0.722777f, 0.717396f, 0.712867f,
+	0.709197f, 0.706212f, 0.703932f, 0.702209f, 0.701063f, 0.700364f, 0.700285f, 0.700615f,
+	0.701488f, 0.702851f, 0.704715f, 0.707243f, 0.710499f, 0.714572f, 0.719657f, 0.726050f,
+	0.995133f, 0.898313f, 0.863328f, 0.835731f, 0.812920f, 0.793570f, 0.776842f, 0.762276f,
+	0.749338f, 0.737800f, 0.727253f, 0.717345f, 0.708119f, 0.700076f, 0.693106f, 0.687087f,
+	0.681898f, 0.677405f, 0.673657f, 0.670560f, 0.668044f, 0.666141f, 0.664813f, 0.664089f,
+	0.663909f, 0.664304f, 0.665290f, 0.666891f, 0.669260f, 0.672332f, 0.676354f, 0.681440f,
+	0.994702f, 0.890598f, 0.853691f, 0.824642f, 0.800606f, 0.780149f, 0.762353f, 0.746679f,
+	0.732697f, 0.720001f, 0.708250f, 0.696946f, 0.686316f, 0.676847f, 0.668465f, 0.661012f,
+	0.654354f, 0.648494f, 0.643333f, 0.638932f, 0.635099f, 0.631929f, 0.629435f, 0.627502f,
+	0.626216f, 0.625502f, 0.625468f, 0.626032f, 0.627275f, 0.629203f, 0.631863f, 0.635467f,
+	0.994253f, 0.882491f, 0.843425f, 0.812782f, 0.787396f, 0.765728f, 0.746868f, 0.730169f,
+	0.715135f, 0.701422f, 0.688565f, 0.676008f, 0.664068f, 0.653304f, 0.643499f, 0.634742f,
+	0.626759f, 0.619624f, 0.613200f, 0.607412f, 0.602356f, 0.598017f, 0.594249f, 0.591263f,
+	0.588791f, 0.586950f, 0.585775f, 0.585119f, 0.585150f, 0.585775f, 0.586996f, 0.588986f,
+	0.993784f, 0.873986f, 0.832709f, 0.800287f, 0.773489f, 0.750614f, 0.730637f, 0.712933f,
+	0.696921f, 0.682176f, 0.668252f, 0.654502f, 0.641373f, 0.629321f, 0.618362f, 0.608367f,
+	0.599182f, 0.590826f, 0.583193f, 0.576308f, 0.570079f, 0.564516f, 0.559713f, 0.555469f,
+	0.551929f, 0.548936f, 0.546548f, 0.544735f, 0.543423f, 0.542670f, 0.542438f, 0.542811f,
+	0.993299f, 0.865165f, 0.821455f, 0.787241f, 0.758991f, 0.734851f, 0.713778f, 0.695035f,
+	0.678097f, 0.662355f, 0.647527f, 0.632658f, 0.618372f, 0.605187f, 0.593115f, 0.581932f,
+	0.571747f, 0.562283f, 0.553592f, 0.545609f, 0.538288f, 0.531702f, 0.525762f, 0.520510f,
+	0.515844f, 0.511760f, 0.508197f, 0.505159f, 0.502593f, 0.500508f, 0.498854f, 0.497665f,
+	0.992800f, 0.856056f, 0.809825f, 0.773764f, 0.744001f, 0.718589f, 0.696462f, 0.676700f,
+	0.658788f, 0.642230f, 0.626426f, 0.610650f, 0.595206f, 0.581012f, 0.567920f, 0.555786f,
+	0.544543f, 0.534131f, 0.524429f, 0.515477f, 0.507228f, 0.499648f, 0.492736f, 0.486477f,
+	0.480773f, 0.475650f, 0.471012f, 0.466790f, 0.463074f, 0.459730f, 0.456737f, 0.454153f,
+	0.992286f, 0.846669f, 0.797862f, 0.759894f, 0.728625f, 0.702003f, 0.678741f, 0.658049f,
+	0.639243f, 0.621918f, 0.605302f, 0.588551f, 0.572122f, 0.557027f, 0.542975f, 0.529905f,
+	0.517762f, 0.506482f, 0.495938f, 0.486109f, 0.476931f, 0.468514f, 0.460696f, 0.453566f,
+	0.446951f, 0.440798f, 0.435215f, 0.430013f, 0.425231f, 0.420742f, 0.416562f, 0.412748f,
+	0.991759f, 0.837019f, 0.785647f, 0.745787f, 0.713015f, 0.685094f, 0.660829f, 0.639271f,
+	0.619689f, 0.601566f, 0.584180f, 0.566591f, 0.549245f, 0.533228f, 0.518358f, 0.504510f,
+	0.491563f, 0.479507f, 0.468167f, 0.457534f, 0.447629f, 0.438362f, 0.429795f, 0.421848f,
+	0.414446f, 0.407516f, 0.400999f, 0.394910f, 0.389190f, 0.383794f, 0.378633f, 0.373788f,
+	0.991220f, 0.827256f, 0.773234f, 0.731396f, 0.697150f, 0.668052f, 0.642817f, 0.620400f,
+	0.600099f, 0.581299f, 0.563274f, 0.544892f, 0.526757f, 0.509933f, 0.494336f, 0.479708f,
+	0.466052f, 0.453241f, 0.441283f, 0.429923f, 0.419323f, 0.409381f, 0.400169f, 0.391509f,
+	0.383372f, 0.375747f, 0.368561f, 0.361712f, 0.355234f, 0.349027f, 0.343132f, 0.337489f,
+	0.990669f, 0.817333f, 0.760600f, 0.716970f, 0.681210f, 0.651022f, 0.624830f, 0.601658f,
+	0.580721f, 0.561349f, 0.542717f, 0.523653f, 0.504708f, 0.487160f, 0.470854f, 0.455635f,
+	0.441342f, 0.427902f, 0.415277f, 0.403366f, 0.392143f, 0.381684f, 0.371804f, 0.362614f,
+	0.353894f, 0.345696f, 0.337924f, 0.330503f, 0.323446f, 0.316670f, 0.310192f, 0.303956f,
+	0.994182f, 0.999982f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.893267f, 0.999421f, 0.999853f, 0.999941f, 0.999969f, 0.999975f, 0.999978f, 0.999980f,
+	0.999981f, 0.999982f, 0.999982f, 0.999983f, 0.999998f, 0.999999f, 0.999999f, 0.999999f,
+	0.999999f, 0.999999f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f, 1.000000f,
+	0.954852f, 0.990084f, 0.997694f, 0.998982f, 0.999414f, 0.999655f, 0.999751f, 0.999815f,
+	0.999851f, 0.999880f, 0.999915f, 0.999938f, 0.999945f, 0.999954f, 0.999968f, 0.999970f,
+	0.999973f, 0.999975f, 0.999976f, 0.999978f, 0.999979f, 0.999980f, 0.999980f, 0.999981f,
+	0.999982f, 0.999982f, 0.999983f, 0.999978f, 0.999984f, 0.999976f, 0.999980f, 0.999985f,
+	0.978936f, 0.954609f, 0.987318f, 0.994508f, 0.997006f, 0.998086f, 0.998685f, 0.999047f,
+	0.999277f, 0.999400f, 0.999495f, 0.999604f, 0.999652f, 0.999703f, 0.999771f, 0.999781f,
+	0.999764f, 0.999773f, 0.999817f, 0.999840f, 0.999846f, 0.999848f, 0.999819f, 0.999867f,
+	0.999865f, 0.999881f, 0.999884f, 0.999855f, 0.999894f, 0.999838f, 0.999901f, 0.999923f,
+	0.988128f, 0.910900f, 0.962238f, 0.981980f, 0.989829f, 0.993559f, 0.995579f, 0.996743f,
+	0.997516f, 0.998030f, 0.998410f, 0.998680f, 0.998863f, 0.999018f, 0.999144f, 0.999244f,
+	0.999295f, 0.999329f, 0.999384f, 0.999461f, 0.999499f, 0.999491f, 0.999557f, 0.999557f,
+	0.999591f, 0.999613f, 0.999620f, 0.999615f, 0.999594f, 0.999375f, 0.999667f, 0.999722f,
+	0.992445f, 0.890991f, 0.928810f, 0.959258f, 0.975303f, 0.983864f, 0.988736f, 0.991708f,
+	0.993639f, 0.994950f, 0.995905f, 0.996555f, 0.997048f, 0.997459f, 0.997766f, 0.998005f,
+	0.998209f, 0.998374f, 0.998528f, 0.998618f, 0.998730f, 0.998790f, 0.998852f, 0.998903f,
+	0.998983f, 0.999019f, 0.999002f, 0.999035f, 0.999023f, 0.998413f, 0.999109f, 0.999304f,
+	0.994764f, 0.892596f, 0.902182f, 0.931321f, 0.953352f, 0.967551f, 0.976572f, 0.982433f,
+	0.986383f, 0.989141f, 0.991128f, 0.992555f, 0.993659f, 0.994498f, 0.995197f, 0.995696f,
+	0.996194f, 0.996515f, 0.996767f, 0.997008f, 0.997263f, 0.997410f, 0.997576f, 0.997659f,
+	0.997765f, 0.997881f, 0.997944f, 0.997983f, 0.997799f, 0.996848f, 0.998081f, 0.998519f,
+	0.996107f, 0.902872f, 0.889021f, 0.906923f, 0.928509f, 0.946102f, 0.958975f, 0.968144f,
+	0.974791f, 0.979617f, 0.983169f, 0.985838f, 0.987891f, 0.989438f, 0.990729f, 0.991790f,
+	0.992604f, 0.993273f, 0.993881f, 0.994349f, 0.994794f, 0.995103f, 0.995368f, 0.995639f,
+	0.995790f, 0.996002f, 0.996090f, 0.996105f, 0.995837f, 0.994521f, 0.996340f, 0.997184f,
+	0.996912f, 0.914229f, 0.886707f, 0.890980f, 0.906481f, 0.923307f, 0.937914f, 0.949690f,
+	0.958843f, 0.965877f, 0.971354f, 0.975620f, 0.978979f, 0.981681f, 0.983841f, 0.985586f,
+	0.987007f, 0.988229f, 0.989182f, 0.990057f, 0.990747f, 0.991360f, 0.991911f, 0.992337f,
+	0.992680f, 0.992968f, 0.993083f, 0.993088f, 0.992639f, 0.991319f, 0.993665f, 0.995062f,
+	0.997396f, 0.923796f, 0.890229f, 0.883263f, 0.890486f, 0.903087f, 0.916610f, 0.929044f,
+	0.939729f, 0.948593f, 0.955886f, 0.961777f, 0.966590f, 0.970540f, 0.973815f, 0.976505f,
+	0.978733f, 0.980624f, 0.982260f, 0.983592f, 0.984747f, 0.985736f, 0.986552f, 0.987306f,
+	0.987888f, 0.988285f, 0.988554f, 0.988586f, 0.988028f, 0.986938f, 0.989719f, 0.991849f,
+	0.997671f, 0.930975f, 0.895726f, 0.881211f, 0.880533f, 0.887472f, 0.897703f, 0.908801f,
+	0.919430f, 0.929039f, 0.937460f, 0.944637f, 0.950786f, 0.955987f, 0.960401f, 0.964216f,
+	0.967375f, 0.970126f, 0.972458f, 0.974443f, 0.976180f, 0.977729f, 0.978956f, 0.980029f,
+	0.980997f, 0.981625f, 0.982088f, 0.982132f, 0.981596f, 0.980966f, 0.984178f, 0.987179f,
+	0.997800f, 0.935784f, 0.901032f, 0.882108f, 0.875300f, 0.876518f, 0.882406f, 0.890706f,
+	0.899833f, 0.908953f, 0.917491f, 0.925277f, 0.932232f, 0.938406f, 0.943802f, 0.948573f,
+	0.952725f, 0.956405f, 0.959500f, 0.962234f, 0.964680f, 0.966741f, 0.968565f, 0.970192f,
+	0.971419f, 0.972448f, 0.973137f, 0.973307f, 0.972995f, 0.973036f, 0.976684f, 0.980621f,
+	0.997824f, 0.938476f, 0.905108f, 0.883859f, 0.872749f, 0.869123f, 0.870654f, 0.875522f,
+	0.882160f, 0.889663f, 0.897404f, 0.904822f, 0.911922f, 0.918556f, 0.924542f, 0.930001f,
+	0.934918f, 0.939270f, 0.943247f, 0.946691f, 0.949812f, 0.952566f, 0.954952f, 0.957051f,
+	0.958839f, 0.960213f, 0.961235f, 0.961728f, 0.961829f, 0.962673f, 0.966781f, 0.971690f,
+	0.997766f, 0.939550f, 0.907542f, 0.885309f, 0.871296f, 0.863948f, 0.861631f, 0.862987f,
+	0.866721f, 0.872000f, 0.878075f, 0.884466f, 0.890886f, 0.897249f, 0.903305f, 0.909044f,
+	0.914361f, 0.919247f, 0.923749f, 0.927820f, 0.931519f, 0.934906f, 0.937831f, 0.940477f,
+	0.942726f, 0.944608f, 0.945988f, 0.946975f, 0.947730f, 0.949443f, 0.954028f, 0.959878f,
+	0.997644f, 0.939095f, 0.908298f, 0.885620f, 0.869809f, 0.859731f, 0.854305f, 0.852419f,
+	0.853307f, 0.856001f, 0.859991f, 0.864636f, 0.869890f, 0.875419f, 0.880946f, 0.886384f,
+	0.891710f, 0.896684f, 0.901450f, 0.905878f, 0.910001f, 0.913769f, 0.917198f, 0.920287f,
+	0.922972f, 0.925365f, 0.927238f, 0.928808f, 0.930296f, 0.932864f, 0.937986f, 0.944683f,
+	0.997467f, 0.937469f, 0.907456f, 0.884617f, 0.867583f, 0.855512f, 0.847605f, 0.843052f,
+	0.841180f, 0.841385f, 0.843078f, 0.845743f, 0.849316f, 0.853523f, 0.857987f, 0.862752f,
+	0.867498f, 0.872220f, 0.876817f, 0.881265f, 0.885423f, 0.889442f, 0.893154f, 0.896544f,
+	0.899625f, 0.902349f, 0.904744f, 0.906861f, 0.909227f, 0.912671f, 0.918254f, 0.925666f,
+	0.997246f, 0.934753f, 0.905123f, 0.882097f, 0.864209f, 0.850676f, 0.840833f, 0.834068f,
+	0.829864f, 0.827696f, 0.827073f, 0.827681f, 0.829259f, 0.831774f, 0.834935f, 0.838484f,
+	0.842368f, 0.846296f, 0.850437f, 0.854469f, 0.858484f, 0.862330f, 0.866042f, 0.869566f,
+	0.872856f, 0.875826f, 0.878610f, 0.881360f, 0.884441f, 0.888539f, 0.894580f, 0.902494f,
+	0.996986f, 0.931153f, 0.901384f, 0.878073f, 0.859505f, 0.844799f, 0.833420f, 0.824837f,
+	0.818586f, 0.814312f, 0.811563f, 0.810010f, 0.809662f, 0.810371f, 0.811876f, 0.813938f,
+	0.816553f, 0.819463f, 0.822665f, 0.826075f, 0.829435f, 0.832910f, 0.836378f, 0.839682f,
+	0.842904f, 0.846045f, 0.849114f, 0.852280f, 0.855948f, 0.860561f, 0.866836f, 0.874996f,
+	0.996696f, 0.926748f, 0.896499f, 0.872709f, 0.853372f, 0.837657f, 0.825016f, 0.814925f,
+	0.806919f, 0.800782f, 0.796059f, 0.792480f, 0.790184f, 0.788952f, 0.788730f, 0.789237f,
+	0.790344f, 0.792022f, 0.793998f, 0.796369f, 0.798909f, 0.801683f, 0.804525f, 0.807456f,
+	0.810450f, 0.813414f, 0.816532f, 0.819915f, 0.823853f, 0.828762f, 0.835081f, 0.843198f,
+	0.996365f, 0.921640f, 0.890503f, 0.865998f, 0.845863f, 0.829231f, 0.815427f, 0.803986f,
+	0.794483f, 0.786740f, 0.780260f, 0.774747f, 0.770601f, 0.767513f, 0.765506f, 0.764338f,
+	0.763890f, 0.764076f, 0.764730f, 0.765774f, 0.767315f, 0.769111f, 0.771136f, 0.773408f,
+	0.775807f, 0.778505f, 0.781377f, 0.784698f, 0.788655f, 0.793511f, 0.799608f, 0.807342f,
+	0.996011f, 0.915851f, 0.883541f, 0.858052f, 0.837094f, 0.819495f, 0.804595f, 0.791911f,
+	0.781114f, 0.771857f, 0.763769f, 0.756512f, 0.750568f, 0.745810f, 0.742016f, 0.739170f,
+	0.737116f, 0.735745f, 0.734932f, 0.734732f, 0.734953f, 0.735584f, 0.736675f, 0.738039f,
+	0.739750f, 0.741784f, 0.744238f, 0.747179f, 0.750823f, 0.755298f, 0.760855f, 0.767882f,
+	0.995632f, 0.909537f, 0.875761f, 0.849129f, 0.827068f, 0.808476f, 0.792528f, 0.778726f,
+	0.766690f, 0.756041f, 0.746548f, 0.737673f, 0.730086f, 0.723606f, 0.718216f, 0.713721f,
+	0.710103f, 0.707180f, 0.704884f, 0.703244f, 0.702130f, 0.701567f, 0.701460f, 0.701809f,
+	0.702604f, 0.703878f, 0.705603f, 0.707917f, 0.710945f, 0.714678f, 0.719447f, 0.725454f,
+	0.995230f, 0.902638f, 0.867171f, 0.839151f, 0.815960f, 0.796283f, 0.779300f, 0.764396f,
+	0.751165f, 0.739382f, 0.728467f, 0.718091f, 0.708943f, 0.700934f, 0.693939f, 0.687963f,
+	0.682799f, 0.678359f, 0.674643f, 0.671528f, 0.669076f, 0.667267f, 0.665978f, 0.665210f,
+	0.664943f, 0.665212f, 0.666077f, 0.667510f, 0.669589f, 0.672446f, 0.676094f, 0.680826f,
+	0.994807f, 0.895357f, 0.857889f, 0.828370f, 0.803955f, 0.783080f, 0.764976f, 0.749016f,
+	0.734669f, 0.721710f, 0.709563f, 0.697738f, 0.687176f, 0.677712f, 0.669328f, 0.661872f,
+	0.655267f, 0.649425f, 0.644338f, 0.639866f, 0.636084f, 0.632931f, 0.630436f, 0.628482f,
+	0.627128f, 0.626328f, 0.626131f, 0.626499f, 0.627500f, 0.629200f, 0.631569f, 0.634843f,
+	0.994367f, 0.887627f, 0.848026f, 0.816856f, 0.791014f, 0.768973f, 0.749748f, 0.732683f,
+	0.717326f, 0.703175f, 0.689871f, 0.676784f, 0.664797f, 0.654008f, 0.644312f, 0.635531f,
+	0.627555f, 0.620403f, 0.614038f, 0.608317f, 0.603209f, 0.598866f, 0.595176f, 0.592030f,
+	0.589532f, 0.587616f, 0.586262f, 0.585463f, 0.585296f, 0.585662f, 0.586664f, 0.588361f,
+	0.993907f, 0.879522f, 0.837593f, 0.804670f, 0.777424f, 0.754096f, 0.733693f, 0.715564f,
+	0.699150f, 0.684025f, 0.669518f, 0.655201f, 0.642061f, 0.630004f, 0.619004f, 0.608993f,
+	0.599871f, 0.591476f, 0.583866f, 0.576972f, 0.570741f, 0.565211f, 0.560366f, 0.556130f,
+	0.552458f, 0.549389f, 0.546870f, 0.544888f, 0.543441f, 0.542493f, 0.542051f, 0.542190f,
+	0.993431f, 0.871131f, 0.826714f, 0.791941f, 0.763162f, 0.738566f, 0.717026f, 0.697822f,
+	0.680425f, 0.664187f, 0.648722f, 0.633251f, 0.618873f, 0.605730f, 0.593598f, 0.582434f,
+	0.572191f, 0.562757f, 0.554018f, 0.546013f, 0.538740f, 0.532184f, 0.526257f, 0.520940f,
+	0.516181f, 0.512027f, 0.508368f, 0.505171f, 0.502482f, 0.500247f, 0.498412f, 0.497053f,
+	0.992941f, 0.862349f, 0.815430f, 0.778759f, 0.748418f, 0.722509f, 0.699860f, 0.679620f,
+	0.661219f, 0.644094f, 0.627594f, 0.611040f, 0.595586f, 0.581326f, 0.568236f, 0.556035f,
+	0.544776f, 0.534337f, 0.524606f, 0.515664f, 0.507444f, 0.499836f, 0.492927f, 0.486656f,
+	0.480938f, 0.475692f, 0.470994f, 0.466688f, 0.462865f, 0.459398f, 0.456298f, 0.453553f,
+	0.992436f, 0.853383f, 0.803801f, 0.765173f, 0.733287f, 0.706068f, 0.682264f, 0.661072f,
+	0.641761f, 0.623708f, 0.606377f, 0.588715f, 0.572269f, 0.557093f, 0.543020f, 0.529905f,
+	0.517751f, 0.506404f, 0.495831f, 0.485997f, 0.476825f, 0.468478f, 0.460694f, 0.453485f,
+	0.446833f, 0.440679f, 0.435020f, 0.429739f, 0.424870f, 0.420336f, 0.416084f, 0.412162f,
+	0.991919f, 0.844141f, 0.791910f, 0.751314f, 0.717865f, 0.689344f, 0.664475f, 0.642306f,
+	0.622075f, 0.603301f, 0.585028f, 0.566489f, 0.549119f, 0.533004f, 0.518148f, 0.504187f,
+	0.491208f, 0.479111f, 0.467749f, 0.457136f, 0.447247f, 0.438059f, 0.429531f, 0.421536f,
+	0.414126f, 0.407148f, 0.400640f, 0.394543f, 0.388790f, 0.383304f, 0.378135f, 0.373219f,
+	0.991388f, 0.834727f, 0.779795f, 0.737195f, 0.702187f, 0.672434f, 0.646534f, 0.623496f,
+	0.602504f, 0.582937f, 0.563964f, 0.544499f, 0.526253f, 0.509382f, 0.493725f, 0.479071f,
+	0.465365f, 0.452545f, 0.440492f, 0.429205f, 0.418666f, 0.408784f, 0.399614f, 0.390968f,
+	0.382865f, 0.375254f, 0.368017f, 0.361201f, 0.354728f, 0.348485f, 0.342609f, 0.336938f,
+	0.990847f, 0.825171f, 0.767501f, 0.722952f, 0.686422f, 0.655464f, 0.628602f, 0.604721f,
+	0.582999f, 0.562778f, 0.543119f, 0.522868f, 0.503854f, 0.486275f, 0.469847f, 0.454578f,
+	0.440240f, 0.426781f, 0.414154f, 0.402275f, 0.391139f, 0.380782f, 0.370982f, 0.361884f,
+	0.353181f, 0.344974f, 0.337248f, 0.329847f, 0.322818f, 0.316088f, 0.309633f, 0.303423f,
+};
+
@@ -0,0 +1,142 @@
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+
+#include "node_cache.h"
+
+struct NodeCacheEntry
+{
+	uint64_t paramHash = 0;
+	uint32_t revision = 0;
+
+	// sources this node was built from, with their revisions at build time
+	std::vector<std::pair<const AtNode*, uint32_t>> sources;
+	std::vector<AtNode*> dependents;
+	NodeRebuildFunc rebuild = nullptr;
+};
+
+static std::recursive_mutex CacheMutex;
+static std::unordered_map<const AtNode*, NodeCacheEntry> Cache;
+static uint32_t NextRevision = 1;
+
+bool UpdateNodeRevision(const AtNode* node, uint64_t paramHash)
+{
+	std::lock_guard<std::recursive_mutex> lock(CacheMutex);
+	auto& entry = Cache[node];
+
+	if (entry.revision != 0 && entry.paramHash == paramHash)
+		return false;
+
+	entry.paramHash = paramHash;
+	entry.revision = NextRevision++;
+	return true;
+}
+
+uint32_t GetNodeRevision(const AtNode* node)
+{
+	std::lock_guard<std::recursive_mutex> lock(CacheMutex);
+	auto it = Cache.find(node);
+	return (it == Cache.end()) ? 0 : it->second.revision;
+}
+
+static void RemoveDependent(const AtNode* source, const AtNode* dependent)
+{
+	auto it = Cache.find(source);
+	if (it == Cache.end())
+		return;
+
+	auto& dependents = it->second.dependents;
+	dependents.erase(std::remove(dependents.begin(), dependents.end(), dependent), dependents.end());
+}
+
+void RebuildNode(AtNode* node, NodeRebuildFunc rebuild)
+{
+	std::lock_guard<std::recursive_mutex> lock(CacheMutex);
+	std::vector<const AtNode*> sources = rebuild(node);
+
+	auto& entry = Cache[node];
+	for (const auto& source : entry.sources)
+		RemoveDependent(source.first, node);
+
+	entry.rebuild = rebuild;
+	entry.sources.clear();
+
+	for (const AtNode* source : sources)
+	{
+		auto& sourceEntry = Cache[source];
+		entry.sources.push_back({ source, sourceEntry.revision });
+
+		if (std::find(sourceEntry.dependents.begin(), sourceEntry.dependents.end(), node) == sourceEntry.dependents.end())
+			sourceEntry.dependents.push_back(node);
+	}
+}
+
+bool AreNodeSourcesCurrent(const AtNode* node)
+{
+	std::lock_guard<std::recursive_mutex> lock(CacheMutex);
+	auto it = Cache.find(node);
+	if (it == Cache.end())
+		return false;
+
+	for (const auto& source : it->second.sources)
+	{
+		auto sourceIt = Cache.find(source.first);
+		if (sourceIt == Cache.end() || sourceIt->second.revision != source.second)
+			return false;
+	}
+	return true;
+}
+
+void RebuildStaleDependents(const AtNode* node)
+{
+	std::lock_guard<std::recursive_mutex> lock(CacheMutex);
+	auto it = Cache.find(node);
+	if (it == Cache.end())
+		return;
+
+	uint32_t revision = it->second.revision;
+	// rebuilding edits the dependent lists, iterate over a copy
+	std::vector<AtNode*> dependents = it->second.dependents;
+
+	for (AtNode* dependent : dependents)
+	{
+		const auto& entry = Cache[dependent];
+		bool stale = std::any_of(entry.sources.begin(), entry.sources.end(),
+			[&](const auto& source) { return source.first == node && source.second != revision; });
+
+		if (stale)
+			RebuildNode(dependent, entry.rebuild);
+	}
+}
+
+void RemoveNodeFromCache(const AtNode* node)
+{
+	std::lock_guard<std::recursive_mutex> lock(CacheMutex);
+	auto it = Cache.find(node);
+	if (it == Cache.end())
+		return;
+
+	for (const auto& source : it->second.sources)
+		RemoveDependent(source.first, node);
+
+	// invalidate the recorded revision so dependents are rebuilt on their next node_update
+	for (AtNode* dependent : it->second.dependents)
+	{
+		auto depIt = Cache.find(dependent);
+		if (depIt == Cache.end())
+			continue;
+
+		auto& sources = depIt->second.sources;
+		for (auto& source : sources)
+		{
+			if (source.first == node)
+				source.second = 0;
+		}
+	}
+	Cache.erase(it);
+}
+
+std::unique_lock<std::recursive_mutex> LockNodeCache()
+{
+	return std::unique_lock<std::recursive_mutex>(CacheMutex);
+}
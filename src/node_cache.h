@@ -0,0 +1,52 @@
+#pragma once
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "common.h"
+
+// Parameter revisions of plugin nodes and the derived data built from them.
+// In IPR only data whose source nodes actually changed is rebuilt on node_update
+
+struct ParamHasher
+{
+	void Add(uint64_t v)
+	{
+		if (content)
+			content->push_back(v);
+		hash ^= v + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+	}
+
+	void Add(float v) { Add(uint64_t(FloatBitsToInt(v))); }
+	void Add(bool v) { Add(uint64_t(v)); }
+	void Add(AtRGB v) { Add(v.r), Add(v.g), Add(v.b); }
+	void Add(const void* p) { Add(uint64_t(reinterpret_cast<uintptr_t>(p))); }
+
+	void Add(const char* s)
+	{
+		for (; s && *s; s++)
+			Add(uint64_t(uint8_t(*s)));
+	}
+
+	uint64_t hash = 0xcbf29ce484222325ull;
+	// every word added, if set, to tell apart content of equal hashes
+	std::vector<uint64_t>* content = nullptr;
+};
+
+// Returns the sources the derived data of node was built from
+using NodeRebuildFunc = std::vector<const AtNode*>(*)(AtNode* node);
+
+// Records the hash of node's parameters, returns true and bumps the revision if it changed
+bool UpdateNodeRevision(const AtNode* node, uint64_t paramHash);
+uint32_t GetNodeRevision(const AtNode* node);
+
+// Runs rebuild under the cache lock and remembers the revisions of the sources it returns
+void RebuildNode(AtNode* node, NodeRebuildFunc rebuild);
+bool AreNodeSourcesCurrent(const AtNode* node);
+// Rebuilds the nodes built from node whose recorded revision of it is out of date
+void RebuildStaleDependents(const AtNode* node);
+
+void RemoveNodeFromCache(const AtNode* node);
+
+// Held while reading or replacing derived data, which rebuilds of other nodes' dependents may replace
+std::unique_lock<std::recursive_mutex> LockNodeCache();
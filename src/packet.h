@@ -0,0 +1,119 @@
+#pragma once
+
+#include "common.h"
+#include "packet_types.h"
+
+inline Vec3f Vec3Packet::Get(int i) const
+{
+	return Vec3f(x[i], y[i], z[i]);
+}
+
+inline void Vec3Packet::Set(int i, Vec3f w)
+{
+	x[i] = w.x, y[i] = w.y, z[i] = w.z;
+}
+
+inline AtRGB RGBPacket::Get(int i) const
+{
+	return AtRGB(r[i], g[i], b[i]);
+}
+
+inline void RGBPacket::Set(int i, AtRGB c)
+{
+	r[i] = c.r, g[i] = c.g, b[i] = c.b;
+}
+
+inline void Fill(FloatPacket& p, float v)
+{
+	for (int i = 0; i < PacketWidth; i++)
+		p[i] = v;
+}
+
+inline void Fill(RGBPacket& p, AtRGB c)
+{
+	Fill(p.r, c.r), Fill(p.g, c.g), Fill(p.b, c.b);
+}
+
+extern const PacketKernels* ActiveKernels;
+
+// Picks the widest variant the CPU and OS support. LAYERMAT_ISA=scalar|avx2|avx512 overrides
+// the choice for testing, falling back to detection if the requested variant is unsupported
+const PacketKernels* SelectPacketKernels();
+
+// whether the CPU and OS can run the variant
+bool IsPacketISASupported(PacketISA isa);
+
+inline void GTR2(const FloatPacket& cosTheta, float alpha, FloatPacket& d)
+{
+	ActiveKernels->GTR2(cosTheta, alpha, d);
+}
+
+inline void SchlickG(const FloatPacket& cosTheta, float alpha, FloatPacket& g)
+{
+	ActiveKernels->SchlickG(cosTheta, alpha, g);
+}
+
+inline void SmithG(const FloatPacket& cosThetaO, const FloatPacket& cosThetaI, float alpha, FloatPacket& g)
+{
+	ActiveKernels->SmithG(cosThetaO, cosThetaI, alpha, g);
+}
+
+inline void SmithLambda(const FloatPacket& cosTheta, float alpha, FloatPacket& lambda)
+{
+	ActiveKernels->SmithLambda(cosTheta, alpha, lambda);
+}
+
+inline void FresnelDielectric(const FloatPacket& cosThetaI, float eta, FloatPacket& fr)
+{
+	ActiveKernels->FresnelDielectric(cosThetaI, eta, fr);
+}
+
+inline void FresnelConductor(const FloatPacket& cosThetaI, float eta, float k, FloatPacket& fr)
+{
+	ActiveKernels->FresnelConductor(cosThetaI, eta, k, fr);
+}
+
+// fast uses FastExp and FastLog from fastmath.h
+inline void Transmittance(float dz, const FloatPacket& cosTheta, FloatPacket& tr, bool fast = false)
+{
+	ActiveKernels->Transmittance(dz, cosTheta, fast, tr);
+}
+
+// exponential free-flight distance along z with unit extinction, SampleExponential(1 / |cos|, u)
+inline void FreeFlightDistance(const FloatPacket& u, const FloatPacket& cosTheta, FloatPacket& dz, bool fast = false)
+{
+	ActiveKernels->FreeFlightDistance(u, cosTheta, fast, dz);
+}
+
+// Henyey-Greenstein directions around wo and their densities, HGPhaseSample over a packet
+inline void SampleHGPhase(const Vec3Packet& wo, const FloatPacket& u0, const FloatPacket& u1, float g, Vec3Packet& wi,
+	FloatPacket& p, bool fast = false)
+{
+	ActiveKernels->SampleHGPhase(wo, u0, u1, g, fast, wi, p);
+}
+
+// cosine weighted directions on the side of the sign of side, as LambertBSDF::Sample
+inline void SampleCosineHemisphere(const FloatPacket& u0, const FloatPacket& u1, const FloatPacket& side, Vec3Packet& wi)
+{
+	ActiveKernels->SampleCosineHemisphere(u0, u1, side, wi);
+}
+
+inline void FastExp(const FloatPacket& x, FloatPacket& r)
+{
+	ActiveKernels->Exp(x, r);
+}
+
+inline void FastLog(const FloatPacket& x, FloatPacket& r)
+{
+	ActiveKernels->Log(x, r);
+}
+
+inline void FastSinCos(const FloatPacket& x, FloatPacket& s, FloatPacket& c)
+{
+	ActiveKernels->SinCos(x, s, c);
+}
+
+inline void FastPow(const FloatPacket& x, float y, FloatPacket& r)
+{
+	ActiveKernels->Pow(x, y, r);
+}
@@ -0,0 +1,356 @@
+#include "bsdfs.h"
+#include "layered_walk.h"
+#include "microfacet.h"
+#include "energy_compensation.h"
+
+// Half vectors and the cosines with them for a packet of directions
+struct HalfVectorPacket
+{
+	void Reflect(Vec3f wo, const Vec3Packet& wi)
+	{
+		for (int i = 0; i < PacketWidth; i++)
+		{
+			Vec3f h = Normalize(wo + wi.Get(i));
+			wh.Set(i, h);
+			cosWo[i] = Dot(h, wo);
+			cosWi[i] = Dot(h, wi.Get(i));
+		}
+	}
+
+	Vec3Packet wh;
+	FloatPacket cosWo;
+	FloatPacket cosWi;
+};
+
+void LambertBSDF::F(Vec3f, const Vec3Packet&, RGBPacket& f) const
+{
+	Fill(f, albedo * AI_ONEOVERPI);
+}
+
+void LambertBSDF::PDF(Vec3f, const Vec3Packet& wi, FloatPacket& pdf) const
+{
+	for (int i = 0; i < PacketWidth; i++)
+		pdf[i] = Abs(wi.z[i]) * AI_ONEOVERPI;
+}
+
+// Generalized half vectors of a dielectric, see DielectricHalfVector in bsdfs.cpp
+struct DielectricHalfPacket
+{
+	DielectricHalfPacket(const DielectricBSDF& bsdf, Vec3f wo, const Vec3Packet& wi)
+	{
+		float ior = bsdf.ior;
+		float alpha = bsdf.alpha;
+
+		for (int i = 0; i < PacketWidth; i++)
+		{
+			Vec3f w = wi.Get(i);
+			bool refl = wo.z * w.z > 0;
+			etap[i] = refl ? 1.f : (wo.z > 0 ? ior : 1.f / ior);
+
+			Vec3f h = w * etap[i] + wo;
+			valid[i] = wo.z != 0 && w.z != 0 && Dot(h, h) != 0;
+			h = valid[i] ? Normalize(h) : LocalUp;
+			if (h.z < 0)
+				h = -h;
+
+			cosWo[i] = Dot(h, wo);
+			cosWi[i] = Dot(h, w);
+			valid[i] = valid[i] && cosWi[i] * w.z > 0 && cosWo[i] * wo.z > 0;
+			whZ[i] = h.z;
+		}
+
+		FloatPacket woZ;
+		Fill(woZ, wo.z);
+		GTR2(whZ, alpha, d);
+		SmithLambda(woZ, alpha, lambdaO);
+		SmithLambda(wi.z, alpha, lambdaI);
+
+		if (bsdf.fresnel)
+		{
+			for (int i = 0; i < PacketWidth; i++)
+				fr[i] = bsdf.fresnel->Eval(cosWo[i]).r;
+		}
+		else
+			FresnelDielectric(cosWo, ior, fr);
+	}
+
+	FloatPacket whZ;
+	FloatPacket cosWo;
+	FloatPacket cosWi;
+	FloatPacket etap;
+	FloatPacket d;
+	FloatPacket lambdaO;
+	FloatPacket lambdaI;
+	FloatPacket fr;
+	bool valid[PacketWidth];
+};
+
+void DielectricBSDF::F(Vec3f wo, const Vec3Packet& wi, bool adjoint, RGBPacket& f) const
+{
+	if (ApproxDelta())
+	{
+		Fill(f, AtRGB(0.f));
+		return;
+	}
+
+	DielectricHalfPacket h(*this, wo, wi);
+
+	for (int i = 0; i < PacketWidth; i++)
+	{
+		float dg = h.d[i] / (1.f + h.lambdaO[i] + h.lambdaI[i]) * Compensation(wo.z, wi.z[i]);
+		float value;
+
+		if (wo.z * wi.z[i] > 0)
+			value = dg * h.fr[i] / Abs(4.f * wi.z[i] * wo.z);
+		else
+		{
+			float denom = Sqr(h.cosWi[i] + h.cosWo[i] / h.etap[i]) * wi.z[i] * wo.z;
+			float factor = adjoint ? 1.f : Sqr(1.f / h.etap[i]);
+			value = dg * (1.f - h.fr[i]) * Abs(h.cosWi[i] * h.cosWo[i] / denom) * factor;
+		}
+		value = h.valid[i] ? value : 0.f;
+		f.r[i] = f.g[i] = f.b[i] = value;
+	}
+}
+
+void DielectricBSDF::PDF(Vec3f wo, const Vec3Packet& wi, bool, BSDFFlag flag, FloatPacket& pdf) const
+{
+	if (ApproxDelta() || wo.z == 0)
+	{
+		Fill(pdf, 0.f);
+		return;
+	}
+
+	DielectricHalfPacket h(*this, wo, wi);
+	float g1 = 1.f / (1.f + h.lambdaO[0]);
+
+	for (int i = 0; i < PacketWidth; i++)
+	{
+		float refl = flag.refl ? h.fr[i] : 0;
+		float tran = flag.tran ? 1.f - h.fr[i] : 0;
+		// GTR2VisibleSmith(wh, wo)
+		float pdfWm = h.d[i] * g1 * Abs(h.cosWo[i] / wo.z);
+		float value;
+
+		if (wo.z * wi.z[i] > 0)
+			value = pdfWm / (4.f * Abs(h.cosWo[i])) * refl / (refl + tran);
+		else
+		{
+			float dWmdWi = Abs(h.cosWi[i]) / Sqr(h.cosWi[i] + h.cosWo[i] / h.etap[i]);
+			value = pdfWm * dWmdWi * tran / (refl + tran);
+		}
+		pdf[i] = (h.valid[i] && refl + tran > 0) ? value : 0.f;
+	}
+}
+
+void MetalBSDF::F(Vec3f wo, const Vec3Packet& wi, RGBPacket& f) const
+{
+	if (ApproxDelta())
+	{
+		Fill(f, AtRGB(0.f));
+		return;
+	}
+
+	HalfVectorPacket h;
+	h.Reflect(wo, wi);
+
+	FloatPacket d, g, cosH, woZ;
+	Fill(woZ, wo.z);
+	GTR2(h.wh.z, alpha, d);
+
+	if (multiScatter)
+	{
+		FloatPacket lambdaO, lambdaI;
+		SmithLambda(woZ, alpha, lambdaO);
+		SmithLambda(wi.z, alpha, lambdaI);
+		for (int i = 0; i < PacketWidth; i++)
+			g[i] = 1.f / (1.f + lambdaO[i] + lambdaI[i]);
+	}
+	else
+		SmithG(woZ, wi.z, alpha, g);
+
+	for (int i = 0; i < PacketWidth; i++)
+		cosH[i] = Abs(h.cosWo[i]);
+
+	RGBPacket fr;
+	if (SchlickFresnel || fresnel)
+	{
+		for (int i = 0; i < PacketWidth; i++)
+			fr.Set(i, Fresnel(cosH[i]));
+	}
+	else
+	{
+		FresnelConductor(cosH, ior.r, k.r, fr.r);
+		FresnelConductor(cosH, ior.g, k.g, fr.g);
+		FresnelConductor(cosH, ior.b, k.b, fr.b);
+	}
+
+	AtRGB msScale = multiScatter ? MultiScatterScale() : AtRGB(0.f);
+	float msWo = multiScatter ? 1.f - ConductorAlbedo(Abs(wo.z), alpha) : 0;
+
+	for (int i = 0; i < PacketWidth; i++)
+	{
+		float cosWo = Abs(wo.z);
+		float cosWi = Abs(wi.z[i]);
+		bool valid = wo.z * wi.z[i] > 0 && cosWo * cosWi >= 1e-7f;
+
+		AtRGB value = albedo * d[i] * fr.Get(i) * g[i] / (4.f * cosWo * cosWi);
+		if (multiScatter)
+			value += msScale * msWo * (1.f - ConductorAlbedo(cosWi, alpha));
+		f.Set(i, valid ? value : AtRGB(0.f));
+	}
+}
+
+void MetalBSDF::PDF(Vec3f wo, const Vec3Packet& wi, FloatPacket& pdf) const
+{
+	if (ApproxDelta())
+	{
+		Fill(pdf, 0.f);
+		return;
+	}
+
+	HalfVectorPacket h;
+	h.Reflect(wo, wi);
+
+	FloatPacket d, lambdaO, woZ;
+	GTR2(h.wh.z, alpha, d);
+	Fill(woZ, wo.z);
+	SmithLambda(woZ, alpha, lambdaO);
+	float pMs = MultiScatterProb(Abs(wo.z));
+
+	for (int i = 0; i < PacketWidth; i++)
+	{
+		// GTR2VisibleSmith(wh, wo) / (4 |wh.wo|), mixed with the cosine lobe of MultiScatterF
+		float value = d[i] / ((1.f + lambdaO[i]) * 4.f * Abs(wo.z));
+		value = value * (1.f - pMs) + Abs(wi.z[i]) * AI_ONEOVERPI * pMs;
+		pdf[i] = (wo.z * wi.z[i] > 0) ? value : 0.f;
+	}
+}
+
+static Vec3Packet ToLocal(Vec3f n, const Vec3Packet& w)
+{
+	Vec3Packet local;
+	for (int i = 0; i < PacketWidth; i++)
+		local.Set(i, ToLocal(n, w.Get(i)));
+	return local;
+}
+
+void F(const BSDF* bsdf, Vec3f n, Vec3f wo, const Vec3Packet& wi, const BSDFState& s, RandomEngine& rng, bool adjoint, RGBPacket& f)
+{
+	if (!IsLocalUp(n))
+		return F(bsdf, LocalUp, ToLocal(n, wo), ToLocal(n, wi), s, rng, adjoint, f);
+
+	if (auto lambert = std::get_if<LambertBSDF>(bsdf))
+		lambert->F(wo, wi, f);
+	else if (auto dielectric = std::get_if<DielectricBSDF>(bsdf))
+	{
+		DielectricBSDF storage;
+		Roughen(*dielectric, s, storage).F(wo, wi, adjoint, f);
+	}
+	else if (auto metal = std::get_if<MetalBSDF>(bsdf))
+	{
+		MetalBSDF storage;
+		Roughen(*metal, s, storage).F(wo, wi, f);
+	}
+	else if (auto layered = std::get_if<LayeredBSDF>(bsdf))
+		layered->F(wo, wi, s, rng, adjoint, f);
+	else
+		Fill(f, AtRGB(0.f));
+}
+
+void PDF(const BSDF* bsdf, Vec3f n, Vec3f wo, const Vec3Packet& wi, const BSDFState& s, RandomEngine& rng, bool adjoint, FloatPacket& pdf, BSDFFlag flag)
+{
+	if (!IsLocalUp(n))
+		return PDF(bsdf, LocalUp, ToLocal(n, wo), ToLocal(n, wi), s, rng, adjoint, pdf, flag);
+
+	if (auto lambert = std::get_if<LambertBSDF>(bsdf))
+		lambert->PDF(wo, wi, pdf);
+	else if (auto dielectric = std::get_if<DielectricBSDF>(bsdf))
+	{
+		DielectricBSDF storage;
+		Roughen(*dielectric, s, storage).PDF(wo, wi, adjoint, flag, pdf);
+	}
+	else if (auto metal = std::get_if<MetalBSDF>(bsdf))
+	{
+		MetalBSDF storage;
+		Roughen(*metal, s, storage).PDF(wo, wi, pdf);
+	}
+	else
+	{
+		for (int i = 0; i < PacketWidth; i++)
+			pdf[i] = ::PDF(bsdf, wo, wi.Get(i), s, rng, adjoint, flag);
+	}
+}
+
+// The directions leaving on each side share nSamples walks, see LayeredSharedWalk. Every lane has the
+// expectation and the estimator of the scalar F, which the bake and the lobe fit take as the F that renders
+void LayeredBSDF::F(Vec3f wo, const Vec3Packet& wi, const BSDFState& state, RandomEngine& rng, bool adjoint, RGBPacket& f) const
+{
+	// tabulated and closed form stacks have no walks to share
+	if (baked || UsesClosedForm(state))
+	{
+		for (int i = 0; i < PacketWidth; i++)
+			f.Set(i, F(wo, wi.Get(i), state, rng, adjoint));
+		return;
+	}
+
+	Vec3Packet wiFlipped = wi;
+	if (twoSided && wo.z < 0)
+	{
+		for (int i = 0; i < PacketWidth; i++)
+			wiFlipped.Set(i, -wi.Get(i));
+	}
+
+	int numGroups = (estimator == LayeredEstimator::MedianOfMeans && nSamples >= MedianGroups) ? MedianGroups : 1;
+
+	for (bool refl : { true, false })
+	{
+		bool lanes[PacketWidth];
+		int first = -1;
+
+		for (int i = 0; i < PacketWidth; i++)
+		{
+			lanes[i] = SameHemisphere(wo, wi.Get(i)) == refl;
+			if (lanes[i] && first < 0)
+				first = i;
+		}
+		if (first < 0)
+			continue;
+
+		// each side starts its own budget, as the scalar F of its directions would
+		BSDFState s = state;
+		Bind(s);
+		WalkBudgetScope budget(s, maxDepth * nSamples);
+		LayeredEvalSetup e(*this, s, wo, wi.Get(first), adjoint);
+
+		RGBPacket fEnt;
+		if (e.extIsEnt && !splitCoat)
+			::F(e.ent, e.entNorm, e.wo, wiFlipped, s, rng, adjoint, fEnt);
+		else
+			Fill(fEnt, AtRGB(0.f));
+
+		AtRGB groupSums[PacketWidth][MedianGroups] = {};
+
+		for (int j = 0, group = 0; j < nSamples; j++)
+		{
+			if (numGroups > 1 && j == MedianGroupBegin(nSamples, group + 1))
+				group++;
+
+			LayeredSharedWalk walk;
+			walk.path.parentThroughput = budget.parentThroughput;
+
+			if (!walk.Start(e, wiFlipped, lanes, s, rng))
+				continue;
+			while (walk.Advance(e, wiFlipped, s, rng));
+
+			for (int i = 0; i < PacketWidth; i++)
+				groupSums[i][group] += walk.f.Get(i);
+		}
+
+		for (int i = 0; i < PacketWidth; i++)
+		{
+			if (lanes[i])
+				f.Set(i, fEnt.Get(i) + ((numGroups == 1) ? groupSums[i][0] / float(nSamples) : MedianOfMeans(groupSums[i])));
+		}
+	}
+}
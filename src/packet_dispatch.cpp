@@ -0,0 +1,103 @@
+#include <cstdlib>
+#include <cstring>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+
+#include "packet.h"
+
+const PacketKernels* ActiveKernels = &scalar::Kernels;
+
+static void CpuId(int leaf, int subleaf, unsigned int regs[4])
+{
+#ifdef _MSC_VER
+	int r[4];
+	__cpuidex(r, leaf, subleaf);
+	for (int i = 0; i < 4; i++)
+		regs[i] = r[i];
+#else
+	__cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+static unsigned long long XGetBV()
+{
+#ifdef _MSC_VER
+	return _xgetbv(0);
+#else
+	unsigned int lo, hi;
+	__asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+	return (unsigned long long)hi << 32 | lo;
+#endif
+}
+
+bool IsPacketISASupported(PacketISA isa)
+{
+	if (isa == PacketISA::Scalar)
+		return true;
+
+	unsigned int r[4];
+	CpuId(0, 0, r);
+	if (r[0] < 7)
+		return false;
+
+	CpuId(1, 0, r);
+	bool osxsave = r[2] & (1u << 27);
+	bool fma = r[2] & (1u << 12);
+	bool avx = r[2] & (1u << 28);
+	if (!osxsave || !avx || !fma)
+		return false;
+
+	// the OS has to save the wide registers on context switches
+	unsigned long long xcr0 = XGetBV();
+	if ((xcr0 & 0x6) != 0x6)
+		return false;
+
+	CpuId(7, 0, r);
+	bool avx2 = r[1] & (1u << 5);
+	if (isa == PacketISA::AVX2)
+		return avx2;
+
+	// F, DQ and VL, with opmask and upper ZMM state enabled
+	bool avx512 = (r[1] & (1u << 16)) && (r[1] & (1u << 17)) && (r[1] & (1u << 31));
+	return avx2 && avx512 && (xcr0 & 0xe6) == 0xe6;
+}
+
+const PacketKernels* SelectPacketKernels()
+{
+	const PacketKernels* variants[] = { &avx512::Kernels, &avx2::Kernels, &scalar::Kernels };
+
+	const char* requested = std::getenv("LAYERMAT_ISA");
+	const PacketKernels* selected = nullptr;
+
+	if (requested && std::strcmp(requested, "") != 0)
+	{
+		for (auto kernels : variants)
+		{
+			if (std::strcmp(requested, kernels->name) == 0 && IsPacketISASupported(kernels->isa))
+				selected = kernels;
+		}
+
+		if (!selected)
+			AiMsgWarning("[LayerMatNode] LAYERMAT_ISA=%s is unknown or not supported by this CPU", requested);
+	}
+
+	if (!selected)
+	{
+		for (auto kernels : variants)
+		{
+			if (IsPacketISASupported(kernels->isa))
+			{
+				selected = kernels;
+				break;
+			}
+		}
+	}
+
+	ActiveKernels = selected;
+	AiMsgInfo("[LayerMatNode] using %s BSDF kernels", selected->name);
+	return selected;
+}
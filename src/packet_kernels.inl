@@ -0,0 +1,218 @@
+// Packet kernel bodies, included once per instruction set by packet_kernels_*.cpp with
+// PACKET_ISA_NAMESPACE and PACKET_ISA set. The including file is compiled with that ISA enabled,
+// so everything here is static in the ISA namespace and uses only local helpers, raw packet arrays,
+// the C math library and fastmath.h, which has internal linkage. Arnold's headers and common.h stay
+// out: their inline functions and static initializers could be emitted with wide instructions and
+// picked by the linker, or run at load, on CPUs without them
+#include <math.h>
+
+#include "fastmath.h"
+#include "packet_types.h"
+
+namespace PACKET_ISA_NAMESPACE
+{
+static inline float Clamp(float v, float lo, float hi) { return v < lo ? lo : (v > hi ? hi : v); }
+static inline float Max(float a, float b) { return a > b ? a : b; }
+static inline float Abs(float v) { return v < 0.f ? -v : v; }
+
+static const float Pi = 3.14159265358979323846f;
+static const float InvPi = 0.318309886183790671538f;
+
+static void GTR2(const FloatPacket& cosTheta, float alpha, FloatPacket& d)
+{
+	float a2 = alpha * alpha;
+	for (int i = 0; i < PacketWidth; i++)
+	{
+		float c = cosTheta.v[i];
+		float denom = c * c * (a2 - 1.f) + 1.f;
+		denom = denom * denom * Pi;
+		d.v[i] = (c < 1e-6f) ? 0.f : a2 / denom;
+	}
+}
+
+static void SchlickG(const FloatPacket& cosTheta, float alpha, FloatPacket& g)
+{
+	float k = alpha * .5f;
+	for (int i = 0; i < PacketWidth; i++)
+		g.v[i] = cosTheta.v[i] / (cosTheta.v[i] * (1.f - k) + k);
+}
+
+static void SmithG(const FloatPacket& cosThetaO, const FloatPacket& cosThetaI, float alpha, FloatPacket& g)
+{
+	float k = alpha * .5f;
+	for (int i = 0; i < PacketWidth; i++)
+	{
+		float co = Abs(cosThetaO.v[i]);
+		float ci = Abs(cosThetaI.v[i]);
+		g.v[i] = co / (co * (1.f - k) + k) * ci / (ci * (1.f - k) + k);
+	}
+}
+
+static void SmithLambda(const FloatPacket& cosTheta, float alpha, FloatPacket& lambda)
+{
+	float a2 = alpha * alpha;
+	for (int i = 0; i < PacketWidth; i++)
+	{
+		float cos2 = cosTheta.v[i] * cosTheta.v[i];
+		float tan2 = Max(0.f, 1.f - cos2) / cos2;
+		lambda.v[i] = cos2 < 1e-12f ? HUGE_VALF : (sqrtf(1.f + a2 * tan2) - 1.f) * .5f;
+	}
+}
+
+static void FresnelDielectric(const FloatPacket& cosThetaI, float eta, FloatPacket& fr)
+{
+	for (int i = 0; i < PacketWidth; i++)
+	{
+		float cosTi = Clamp(cosThetaI.v[i], -1.f, 1.f);
+		float e = (cosTi < 0.f) ? 1.f / eta : eta;
+		cosTi = Abs(cosTi);
+
+		float sinTt = sqrtf(Max(1.f - cosTi * cosTi, 0.f)) / e;
+		float cosTt = sqrtf(Max(1.f - sinTt * sinTt, 0.f));
+
+		float rPa = (cosTi - e * cosTt) / (cosTi + e * cosTt);
+		float rPe = (e * cosTi - cosTt) / (e * cosTi + cosTt);
+		fr.v[i] = (sinTt >= 1.f) ? 1.f : (rPa * rPa + rPe * rPe) * .5f;
+	}
+}
+
+static void FresnelConductor(const FloatPacket& cosThetaI, float eta, float k, FloatPacket& fr)
+{
+	// real-valued form of the complex Fresnel equations
+	float eta2 = eta * eta;
+	float k2 = k * k;
+
+	for (int i = 0; i < PacketWidth; i++)
+	{
+		float cos2 = Clamp(cosThetaI.v[i], 0.f, 1.f) * Clamp(cosThetaI.v[i], 0.f, 1.f);
+		float sin2 = 1.f - cos2;
+
+		float t0 = eta2 - k2 - sin2;
+		float a2b2 = sqrtf(t0 * t0 + 4.f * eta2 * k2);
+		float t1 = a2b2 + cos2;
+		float a = sqrtf(Max(.5f * (a2b2 + t0), 0.f));
+		float t2 = 2.f * sqrtf(cos2) * a;
+		float rs = (t1 - t2) / (t1 + t2);
+
+		float t3 = cos2 * a2b2 + sin2 * sin2;
+		float t4 = t2 * sin2;
+		float rp = rs * (t3 - t4) / (t3 + t4);
+		fr.v[i] = .5f * (rp + rs);
+	}
+}
+
+static void Transmittance(float dz, const FloatPacket& cosTheta, bool fast, FloatPacket& tr)
+{
+	if (fast)
+	{
+		for (int i = 0; i < PacketWidth; i++)
+			tr.v[i] = FastExp(-Abs(dz / cosTheta.v[i]));
+		return;
+	}
+	for (int i = 0; i < PacketWidth; i++)
+		tr.v[i] = expf(-Abs(dz / cosTheta.v[i]));
+}
+
+static void FreeFlightDistance(const FloatPacket& u, const FloatPacket& cosTheta, bool fast, FloatPacket& dz)
+{
+	if (fast)
+	{
+		for (int i = 0; i < PacketWidth; i++)
+			dz.v[i] = -FastLog(1.f - u.v[i]) * Abs(cosTheta.v[i]);
+		return;
+	}
+	for (int i = 0; i < PacketWidth; i++)
+		dz.v[i] = -logf(1.f - u.v[i]) * Abs(cosTheta.v[i]);
+}
+
+static void SampleHGPhase(const Vec3Packet& wo, const FloatPacket& u0, const FloatPacket& u1, float g, bool fast,
+	Vec3Packet& wi, FloatPacket& p)
+{
+	FloatPacket sinPhi, cosPhi;
+	if (fast)
+	{
+		for (int i = 0; i < PacketWidth; i++)
+			FastSinCos(Pi * 2.f * u1.v[i], sinPhi.v[i], cosPhi.v[i]);
+	}
+	else
+	{
+		for (int i = 0; i < PacketWidth; i++)
+			sinPhi.v[i] = sinf(Pi * 2.f * u1.v[i]), cosPhi.v[i] = cosf(Pi * 2.f * u1.v[i]);
+	}
+
+	float g2 = g * g;
+	bool isotropic = Abs(g) < 1e-3f;
+	for (int i = 0; i < PacketWidth; i++)
+	{
+		float t = (1.f - g2) / (1.f + g - 2.f * g * u0.v[i]);
+		float cosTheta = isotropic ? 1.f - 2.f * u0.v[i] : -(1.f + g2 - t * t) / (2.f * g);
+		float sinTheta = sqrtf(Max(1.f - cosTheta * cosTheta, 0.f));
+
+		// around wo in the branchless frame of Duff et al., as AroundAxis in bsdfs.cpp
+		float x = wo.x.v[i], y = wo.y.v[i], z = wo.z.v[i];
+		float sign = copysignf(1.f, z);
+		float a = -1.f / (sign + z);
+		float b = x * y * a;
+		float st = sinTheta * cosPhi.v[i];
+		float ss = sinTheta * sinPhi.v[i];
+		wi.x.v[i] = (1.f + sign * x * x * a) * st + b * ss + x * cosTheta;
+		wi.y.v[i] = sign * b * st + (sign + y * y * a) * ss + y * cosTheta;
+		wi.z.v[i] = -sign * x * st - y * ss + z * cosTheta;
+
+		float denom = 1.f + g * (g + 2.f * cosTheta);
+		p.v[i] = .25f * InvPi * (1.f - g2) / (denom * sqrtf(denom));
+	}
+}
+
+static void SampleCosineHemisphere(const FloatPacket& u0, const FloatPacket& u1, const FloatPacket& side, Vec3Packet& wi)
+{
+	for (int i = 0; i < PacketWidth; i++)
+	{
+		// concentric disk mapping, as ToConcentricDisk
+		float vx = u0.v[i] * 2.f - 1.f;
+		float vy = u1.v[i] * 2.f - 1.f;
+		bool xMajor = vx * vx > vy * vy;
+		float r = xMajor ? vx : vy;
+		float phi = (r == 0.f) ? 0.f : (xMajor ? Pi * .25f * vy / vx : Pi * .5f - Pi * .25f * vx / vy);
+
+		float x = r * cosf(phi);
+		float y = r * sinf(phi);
+		float z = sqrtf(Max(1.f - x * x - y * y, 0.f));
+		wi.x.v[i] = x;
+		wi.y.v[i] = y;
+		wi.z.v[i] = (side.v[i] < 0.f) ? -z : z;
+	}
+}
+
+static void Exp(const FloatPacket& x, FloatPacket& r)
+{
+	for (int i = 0; i < PacketWidth; i++)
+		r.v[i] = FastExp(x.v[i]);
+}
+
+static void Log(const FloatPacket& x, FloatPacket& r)
+{
+	for (int i = 0; i < PacketWidth; i++)
+		r.v[i] = FastLog(x.v[i]);
+}
+
+static void SinCos(const FloatPacket& x, FloatPacket& s, FloatPacket& c)
+{
+	for (int i = 0; i < PacketWidth; i++)
+		FastSinCos(x.v[i], s.v[i], c.v[i]);
+}
+
+static void Pow(const FloatPacket& x, float y, FloatPacket& r)
+{
+	for (int i = 0; i < PacketWidth; i++)
+		r.v[i] = FastPow(x.v[i], y);
+}
+
+extern const PacketKernels Kernels =
+{
+	PACKET_ISA, PACKET_ISA_LABEL,
+	GTR2, SchlickG, SmithG, SmithLambda, FresnelDielectric, FresnelConductor, Transmittance, FreeFlightDistance,
+	SampleHGPhase, SampleCosineHemisphere,
+	Exp, Log, SinCos, Pow
+};
+}
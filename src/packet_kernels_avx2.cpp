@@ -0,0 +1,6 @@
+// Compiled with AVX2 and FMA, see CMakeLists.txt
+#define PACKET_ISA_NAMESPACE avx2
+#define PACKET_ISA PacketISA::AVX2
+#define PACKET_ISA_LABEL "avx2"
+
+#include "packet_kernels.inl"
@@ -0,0 +1,6 @@
+// Compiled with AVX-512 (F, DQ, VL) and FMA, see CMakeLists.txt
+#define PACKET_ISA_NAMESPACE avx512
+#define PACKET_ISA PacketISA::AVX512
+#define PACKET_ISA_LABEL "avx512"
+
+#include "packet_kernels.inl"
@@ -0,0 +1,6 @@
+// Baseline variant, compiled with the default flags of the library
+#define PACKET_ISA_NAMESPACE scalar
+#define PACKET_ISA PacketISA::Scalar
+#define PACKET_ISA_LABEL "scalar"
+
+#include "packet_kernels.inl"
@@ -0,0 +1,74 @@
+#pragma once
+
+// Packet layout and the kernel table, without Arnold or common.h so the per-ISA kernel files
+// include nothing with external inline definitions. Get and Set are defined in packet.h
+struct AtVector;
+struct AtRGB;
+
+// SoA packets for evaluating one closure against many directions at once.
+// Kernels loop over whole packets with no cross-lane dependencies so they vectorize
+const int PacketWidth = 8;
+
+struct FloatPacket
+{
+	float& operator [] (int i) { return v[i]; }
+	float operator [] (int i) const { return v[i]; }
+
+	alignas(32) float v[PacketWidth];
+};
+
+struct Vec3Packet
+{
+	AtVector Get(int i) const;
+	void Set(int i, AtVector w);
+
+	FloatPacket x;
+	FloatPacket y;
+	FloatPacket z;
+};
+
+struct RGBPacket
+{
+	AtRGB Get(int i) const;
+	void Set(int i, AtRGB c);
+
+	FloatPacket r;
+	FloatPacket g;
+	FloatPacket b;
+};
+
+// Kernels are compiled once per instruction set (packet_kernels_*.cpp) and called through
+// the table picked by SelectPacketKernels when the plugin is loaded. The walk's SoA stages, free
+// flights, transmittance, phase and Lambertian sampling, are kernels too; LayeredWalkPacket itself
+// only masks lanes and calls into scalar code per lane, and is built for the baseline ISA.
+// This header is all the kernels include: inline functions of Arnold and common.h, or their static
+// initializers, compiled into a wide ISA file could be the copy the linker keeps for the whole plugin
+enum class PacketISA { Scalar, AVX2, AVX512 };
+
+struct PacketKernels
+{
+	PacketISA isa;
+	const char* name;
+
+	void (*GTR2)(const FloatPacket& cosTheta, float alpha, FloatPacket& d);
+	void (*SchlickG)(const FloatPacket& cosTheta, float alpha, FloatPacket& g);
+	void (*SmithG)(const FloatPacket& cosThetaO, const FloatPacket& cosThetaI, float alpha, FloatPacket& g);
+	void (*SmithLambda)(const FloatPacket& cosTheta, float alpha, FloatPacket& lambda);
+	void (*FresnelDielectric)(const FloatPacket& cosThetaI, float eta, FloatPacket& fr);
+	void (*FresnelConductor)(const FloatPacket& cosThetaI, float eta, float k, FloatPacket& fr);
+	void (*Transmittance)(float dz, const FloatPacket& cosTheta, bool fast, FloatPacket& tr);
+	void (*FreeFlightDistance)(const FloatPacket& u, const FloatPacket& cosTheta, bool fast, FloatPacket& dz);
+	void (*SampleHGPhase)(const Vec3Packet& wo, const FloatPacket& u0, const FloatPacket& u1, float g, bool fast,
+		Vec3Packet& wi, FloatPacket& p);
+	void (*SampleCosineHemisphere)(const FloatPacket& u0, const FloatPacket& u1, const FloatPacket& side, Vec3Packet& wi);
+
+	// fastmath.h over packets
+	void (*Exp)(const FloatPacket& x, FloatPacket& r);
+	void (*Log)(const FloatPacket& x, FloatPacket& r);
+	void (*SinCos)(const FloatPacket& x, FloatPacket& s, FloatPacket& c);
+	void (*Pow)(const FloatPacket& x, float y, FloatPacket& r);
+};
+
+namespace scalar { extern const PacketKernels Kernels; }
+namespace avx2 { extern const PacketKernels Kernels; }
+namespace avx512 { extern const PacketKernels Kernels; }
@@ -0,0 +1,86 @@
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "phase_table.h"
+
+bool PhaseTable::Build(const float* degrees, const float* values, int count)
+{
+	if (count < 2)
+		return false;
+
+	// linear in the angle between the samples, clamped outside them
+	double sum = 0;
+	for (int i = 0; i < Size; i++)
+	{
+		float cosScatter = -1.f + (i + .5f) * (2.f / Size);
+		float angle = std::acos(cosScatter) * (180.f / AI_PI);
+
+		int j = 0;
+		while (j < count - 2 && degrees[j + 1] < angle)
+			j++;
+
+		float width = degrees[j + 1] - degrees[j];
+		float t = (width > 0) ? AiClamp((angle - degrees[j]) / width, 0.f, 1.f) : 0.f;
+		this->values[i] = AiMax(values[j] * (1.f - t) + values[j + 1] * t, 0.f);
+		sum += this->values[i];
+	}
+	if (sum <= 0)
+		return false;
+
+	// every bin covers a solid angle of 4 pi / Size
+	for (int i = 0; i < Size; i++)
+		this->values[i] = float(this->values[i] / sum * Size * .25 * AI_ONEOVERPI);
+
+	// Vose's alias method over the bin probabilities scaled to a mean of 1
+	std::vector<int> small, large;
+	float scaled[Size];
+	for (int i = 0; i < Size; i++)
+	{
+		scaled[i] = this->values[i] * 4.f * AI_PI;
+		alias[i] = i;
+		aliasProb[i] = 1.f;
+		(scaled[i] < 1.f ? small : large).push_back(i);
+	}
+
+	while (!small.empty() && !large.empty())
+	{
+		int s = small.back(), l = large.back();
+		small.pop_back();
+		aliasProb[s] = scaled[s];
+		alias[s] = l;
+
+		scaled[l] -= 1.f - scaled[s];
+		if (scaled[l] < 1.f)
+		{
+			large.pop_back();
+			small.push_back(l);
+		}
+	}
+	return true;
+}
+
+bool ReadPhaseTable(const char* path, PhaseTable& table)
+{
+	std::ifstream file(path);
+	if (!file)
+		return false;
+
+	std::vector<float> degrees, values;
+	std::string line;
+	while (std::getline(file, line))
+	{
+		std::istringstream in(line.substr(0, line.find('#')));
+		float angle, value;
+		if (!(in >> angle))
+			continue;
+		if (!(in >> value) || (!degrees.empty() && angle <= degrees.back()))
+			return false;
+
+		degrees.push_back(angle);
+		values.push_back(value);
+	}
+	return table.Build(degrees.data(), values.data(), int(degrees.size()));
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "common.h"
+
+// Phase function tabulated over the cosine of the scattering angle, for media of measured or fitted
+// pigments. Bins are uniform in the cosine, so a bin's constant value is also the density of picking
+// it and sampling uniformly inside: an alias table picks the bin in O(1) and p / pdf is exactly 1
+struct PhaseTable
+{
+	static const int Size = 256;
+
+	// from samples of p over the scattering angle in degrees, ascending, normalized here over the sphere
+	bool Build(const float* degrees, const float* values, int count);
+
+	float Eval(float cosScatter) const
+	{
+		return values[Bin(cosScatter)];
+	}
+
+	// cosine of the scattering angle, u.x picks the bin and is reused for the offset inside it
+	float Sample(float u) const
+	{
+		float x = u * Size;
+		int i = AiMin(int(x), Size - 1);
+		float v = x - float(i);
+
+		if (v < aliasProb[i])
+			v /= aliasProb[i];
+		else
+		{
+			v = (v - aliasProb[i]) / (1.f - aliasProb[i]);
+			i = alias[i];
+		}
+		return AiClamp(-1.f + (float(i) + v) * (2.f / Size), -1.f, 1.f);
+	}
+
+	static int Bin(float cosScatter)
+	{
+		return AiClamp(int((cosScatter + 1.f) * (.5f * Size)), 0, Size - 1);
+	}
+
+	float values[Size];
+	float aliasProb[Size];
+	int alias[Size];
+};
+
+// Reads lines of "<scattering angle in degrees> <value>", # starts a comment
+bool ReadPhaseTable(const char* path, PhaseTable& table);
@@ -0,0 +1,105 @@
+#include <unordered_map>
+
+#include "progressive_passes.h"
+
+// lower hints are clamped, so that pass numbers fit the pixels' bytes
+const int MinProgressiveAA = -16;
+
+static std::mutex PassesMutex;
+static std::unordered_map<const AtUniverse*, std::weak_ptr<ProgressivePasses>> Passes;
+
+void ProgressivePasses::Begin(const AtRenderSession* session, const AtNode* options)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	bool hint = false;
+	progressive = session && AiRenderGetHintBool(session, AtString("progressive"), hint) && hint;
+	if (!progressive || !options)
+	{
+		progressive = false;
+		return;
+	}
+
+	// -4 is Arnold's default
+	minAA = -4;
+	AiRenderGetHintInt(session, AtString("progressive_min_AA_samples"), minAA);
+	minAA = AiClamp(minAA, MinProgressiveAA, 1);
+
+	int w = AiMax(AiNodeGetInt(options, "xres"), 1);
+	int h = AiMax(AiNodeGetInt(options, "yres"), 1);
+	if (w != width || h != height)
+	{
+		width = w;
+		height = h;
+		pixels = std::make_unique<std::atomic<uint8_t>[]>(size_t(w) * h);
+	}
+	// every layered node's update begins again, only the first after shading has pixels to clear
+	else if (shaded.load())
+	{
+		for (size_t i = 0; i < size_t(width) * height; i++)
+			pixels[i].store(0, std::memory_order_relaxed);
+	}
+
+	shaded.store(false);
+	pass.store(0);
+}
+
+int ProgressivePasses::Observe(const AtShaderGlobals* sg)
+{
+	if (!progressive)
+		return 1;
+
+	// passes minAA, ..., -1 are followed by 1, which is where tracking stops
+	int current = pass.load(std::memory_order_relaxed);
+	if (current >= -minAA)
+		return 1;
+
+	// only passes of whole samples have more than one per pixel
+	if (sg->si > 0)
+	{
+		pass.store(-minAA, std::memory_order_relaxed);
+		return 1;
+	}
+
+	bool first = (sg->Rt & AI_RAY_CAMERA) && sg->transp_index == 0;
+	if (first && sg->x >= 0 && sg->x < width && sg->y >= 0 && sg->y < height)
+	{
+		std::atomic<uint8_t>& pixel = pixels[size_t(sg->y) * width + sg->x];
+		if (!shaded.load(std::memory_order_relaxed))
+			shaded.store(true, std::memory_order_relaxed);
+		uint8_t mark = uint8_t(current + 1);
+
+		if (pixel.exchange(mark, std::memory_order_relaxed) == mark)
+		{
+			// shaded in this pass already, so the next one has begun
+			if (pass.compare_exchange_strong(current, current + 1, std::memory_order_relaxed))
+			{
+				current++;
+				int aa = minAA + current;
+				AiMsgInfo("[LayerMatNode] progressive pass %d, layered walks at AA_samples %d quality", current + 1,
+					(aa < 0) ? aa : 1);
+			}
+			pixel.store(uint8_t(current + 1), std::memory_order_relaxed);
+		}
+	}
+
+	return (current < -minAA) ? minAA + current : 1;
+}
+
+std::shared_ptr<ProgressivePasses> AcquireProgressivePasses(const AtNode* node)
+{
+	std::lock_guard<std::mutex> lock(PassesMutex);
+	auto& entry = Passes[AiNodeGetUniverse(node)];
+
+	auto passes = entry.lock();
+	if (!passes)
+	{
+		passes = std::make_shared<ProgressivePasses>();
+		entry = passes;
+	}
+
+	// drop the entries of universes whose nodes are all gone
+	for (auto it = Passes.begin(); it != Passes.end();)
+		it = it->second.expired() ? Passes.erase(it) : std::next(it);
+	return passes;
+}
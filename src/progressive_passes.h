@@ -0,0 +1,35 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+#include "common.h"
+
+// Pass of a progressive render as seen from shading. Arnold renders all passes of a progressive
+// render, from the progressive_min_AA_samples hint up, without re-running node_update or changing
+// options.AA_samples, and tells shaders nothing about the pass. A pass is over once a pixel's first
+// camera sample is shaded again, which is watched for with the number of the last pass per pixel
+struct ProgressivePasses
+{
+	// Restarts at the first pass if the session renders progressively. In IPR every update that
+	// reaches a layered node restarts the passes, other updates leave them at full quality
+	void Begin(const AtRenderSession* session, const AtNode* options);
+	// AA_samples of the pass sg belongs to, 1 from the first pass of whole samples on and outside
+	// progressive renders
+	int Observe(const AtShaderGlobals* sg);
+
+	std::mutex mutex;
+	bool progressive = false;
+	int minAA = 1;
+	int width = 0;
+	int height = 0;
+	// 1 + the last pass that shaded each pixel's first camera sample, 0 for none
+	std::unique_ptr<std::atomic<uint8_t>[]> pixels;
+	std::atomic<int> pass{ 0 };
+	// whether pixels were marked since the last Begin
+	std::atomic<bool> shaded{ false };
+};
+
+// Passes of node's universe, shared by its layered nodes and freed with the last of them
+std::shared_ptr<ProgressivePasses> AcquireProgressivePasses(const AtNode* node);
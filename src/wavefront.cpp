@@ -0,0 +1,137 @@
+#include "wavefront.h"
+#include "layered_walk.h"
+#include "baked_table.h"
+
+void ShadingPointBatch::Resize(size_t size)
+{
+	for (auto v : { &woX, &woY, &woZ, &wiX, &wiY, &wiZ })
+		v->resize(size);
+	f.resize(size);
+}
+
+void ShadingPointBatch::SetDirections(size_t i, Vec3f wo, Vec3f wi)
+{
+	woX[i] = wo.x, woY[i] = wo.y, woZ[i] = wo.z;
+	wiX[i] = wi.x, wiY[i] = wi.y, wiZ[i] = wi.z;
+}
+
+void EvalLayeredBatch(const LayeredBSDF& bsdf, const BSDFState& state, ShadingPointBatch& batch, RandomEngine& rng, bool adjoint)
+{
+	size_t size = batch.Size();
+	int nSamples = bsdf.nSamples;
+
+	// tabulated and closed form stacks have no walks to batch
+	if (bsdf.baked || bsdf.UsesClosedForm(state))
+	{
+		for (size_t i = 0; i < size; i++)
+		{
+			Vec3f wo(batch.woX[i], batch.woY[i], batch.woZ[i]);
+			Vec3f wi(batch.wiX[i], batch.wiY[i], batch.wiZ[i]);
+			batch.f[i] = bsdf.F(wo, wi, state, rng, adjoint);
+		}
+		return;
+	}
+
+	BSDFState s = state;
+	bsdf.Bind(s);
+
+	// median of means keeps the sum of each group of walks per point, a plain mean one group
+	int numGroups = (bsdf.estimator == LayeredEstimator::MedianOfMeans && nSamples >= MedianGroups) ? MedianGroups : 1;
+
+	std::vector<LayeredEvalSetup> setups;
+	std::vector<WalkBudget> budgets(size, WalkBudget(bsdf.maxDepth * nSamples));
+	std::vector<LayeredWalk> walks;
+	// group of each walk, indexed as walks
+	std::vector<int> groups;
+	std::vector<AtRGB> groupSums(size * numGroups, AtRGB(0.f));
+
+	setups.reserve(size);
+	walks.reserve(size * nSamples);
+	groups.reserve(size * nSamples);
+
+	for (size_t i = 0; i < size; i++)
+	{
+		Vec3f wo(batch.woX[i], batch.woY[i], batch.woZ[i]);
+		Vec3f wi(batch.wiX[i], batch.wiY[i], batch.wiZ[i]);
+		setups.emplace_back(bsdf, s, wo, wi, adjoint);
+
+		const LayeredEvalSetup& e = setups.back();
+		s.budget = &budgets[i];
+
+		batch.f[i] = (e.extIsEnt && !bsdf.splitCoat) ? ::F(e.ent, e.entNorm, e.wo, e.wi, s, rng, adjoint) : AtRGB(0.f);
+
+		for (int j = 0, group = 0; j < nSamples; j++)
+		{
+			if (numGroups > 1 && j == MedianGroupBegin(nSamples, group + 1))
+				group++;
+
+			LayeredWalk walk;
+			walk.point = int(i);
+
+			if (walk.Start(e, s, rng))
+			{
+				walks.push_back(walk);
+				groups.push_back(group);
+			}
+		}
+	}
+
+	std::vector<int> active(walks.size());
+	std::vector<int> next, scatter, interf;
+
+	for (int i = 0; i < int(walks.size()); i++)
+		active[i] = i;
+
+	while (!active.empty())
+	{
+		next.clear();
+		scatter.clear();
+		interf.clear();
+
+		for (int i : active)
+		{
+			LayeredWalk& walk = walks[i];
+			s.budget = &budgets[walk.point];
+
+			switch (walk.FreeFlight(setups[walk.point], s, rng))
+			{
+			case WalkEvent::Scatter:
+				scatter.push_back(i);
+				break;
+			case WalkEvent::Interface:
+				interf.push_back(i);
+				break;
+			case WalkEvent::Null:
+				next.push_back(i);
+				break;
+			default:
+				break;
+			}
+		}
+
+		for (int i : scatter)
+		{
+			LayeredWalk& walk = walks[i];
+			s.budget = &budgets[walk.point];
+
+			if (walk.Scatter(setups[walk.point], s, rng))
+				next.push_back(i);
+		}
+
+		for (int i : interf)
+		{
+			LayeredWalk& walk = walks[i];
+			s.budget = &budgets[walk.point];
+
+			if (walk.Interface(setups[walk.point], s, rng))
+				next.push_back(i);
+		}
+		active.swap(next);
+	}
+
+	for (size_t i = 0; i < walks.size(); i++)
+		groupSums[walks[i].point * numGroups + groups[i]] += walks[i].f;
+
+	for (size_t i = 0; i < size; i++)
+		batch.f[i] += (numGroups == 1) ? groupSums[i] / float(nSamples) : bsdf.MedianOfMeans(&groupSums[i * numGroups]);
+}
@@ -0,0 +1,25 @@
+#pragma once
+#include <vector>
+
+#include "bsdfs.h"
+
+// Shading points of one material in SoA layout, evaluated with a shared BSDFState.
+// Points of different materials go into separate batches
+struct ShadingPointBatch
+{
+	void Resize(size_t size);
+	size_t Size() const { return woX.size(); }
+
+	void SetDirections(size_t i, Vec3f wo, Vec3f wi);
+
+	std::vector<float> woX, woY, woZ;
+	std::vector<float> wiX, wiY, wiZ;
+	// output of EvalLayeredBatch
+	std::vector<AtRGB> f;
+};
+
+// Evaluates LayeredBSDF::F for every point of the batch. All nSamples walks of all points are advanced
+// in lockstep: free-flight for every live walk, then medium events, then interface events,
+// with terminated walks compacted out between stages. Median of means stacks take the median over the
+// same groups of walks as the scalar F
+void EvalLayeredBatch(const LayeredBSDF& bsdf, const BSDFState& state, ShadingPointBatch& batch, RandomEngine& rng, bool adjoint);
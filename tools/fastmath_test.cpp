@@ -0,0 +1,204 @@
+// Checks the error bounds documented in src/fastmath.h against double precision libm, for the
+// scalar functions and the packet kernels of every instruction set the CPU supports.
+// usage: fastmath_test, exits with 1 if any bound is exceeded
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "fastmath.h"
+#include "packet.h"
+
+const int NumSweep = 1 << 22;
+
+// Evaluates the function under test over a packet, scalar when kernels is null
+struct Function
+{
+	const char* name;
+	double (*reference)(double x, float y);
+	void (*eval)(const PacketKernels* kernels, const FloatPacket& x, float y, FloatPacket& r);
+};
+
+static void EvalExp(const PacketKernels* kernels, const FloatPacket& x, float, FloatPacket& r)
+{
+	if (kernels)
+		return kernels->Exp(x, r);
+	for (int i = 0; i < PacketWidth; i++)
+		r[i] = FastExp(x[i]);
+}
+
+static void EvalLog(const PacketKernels* kernels, const FloatPacket& x, float, FloatPacket& r)
+{
+	if (kernels)
+		return kernels->Log(x, r);
+	for (int i = 0; i < PacketWidth; i++)
+		r[i] = FastLog(x[i]);
+}
+
+static void EvalSin(const PacketKernels* kernels, const FloatPacket& x, float, FloatPacket& r)
+{
+	FloatPacket c;
+	if (kernels)
+		return kernels->SinCos(x, r, c);
+	for (int i = 0; i < PacketWidth; i++)
+		FastSinCos(x[i], r[i], c[i]);
+}
+
+static void EvalCos(const PacketKernels* kernels, const FloatPacket& x, float, FloatPacket& r)
+{
+	FloatPacket s;
+	if (kernels)
+		return kernels->SinCos(x, s, r);
+	for (int i = 0; i < PacketWidth; i++)
+		FastSinCos(x[i], s[i], r[i]);
+}
+
+static void EvalPow(const PacketKernels* kernels, const FloatPacket& x, float y, FloatPacket& r)
+{
+	if (kernels)
+		return kernels->Pow(x, y, r);
+	for (int i = 0; i < PacketWidth; i++)
+		r[i] = FastPow(x[i], y);
+}
+
+const Function ExpTest = { "exp", [](double x, float) { return std::exp(x); }, EvalExp };
+const Function LogTest = { "log", [](double x, float) { return std::log(x); }, EvalLog };
+const Function SinTest = { "sin", [](double x, float) { return std::sin(x); }, EvalSin };
+const Function CosTest = { "cos", [](double x, float) { return std::cos(x); }, EvalCos };
+const Function PowTest = { "pow", [](double x, float y) { return std::pow(x, double(y)); }, EvalPow };
+
+// Floats ordered as integers, so sweeps are dense in every binade rather than in value
+static int64_t Order(float f)
+{
+	uint32_t i = FastAsUint(f);
+	return (i & 0x80000000u) ? -int64_t(i & 0x7fffffffu) : int64_t(i);
+}
+
+static float Unorder(int64_t k)
+{
+	return (k < 0) ? FastAsFloat(uint32_t(-k) | 0x80000000u) : FastAsFloat(uint32_t(k));
+}
+
+static std::vector<float> Sweep(float lo, float hi)
+{
+	int64_t klo = Order(lo), khi = Order(hi);
+	int64_t stride = (khi - klo) / NumSweep + 1;
+
+	std::vector<float> xs;
+	for (int64_t k = klo; k < khi; k += stride)
+		xs.push_back(Unorder(k));
+	xs.push_back(hi);
+	return xs;
+}
+
+static double Ulp(double ref)
+{
+	return std::ldexp(1., std::max(std::ilogb(ref), FLT_MIN_EXP - 1) - (FLT_MANT_DIG - 1));
+}
+
+// Error in units of bound(x, ref), which is 1 at the documented bound
+struct Error
+{
+	double max = 0;
+	float at = 0;
+};
+
+template<typename Bound>
+static Error MaxError(const PacketKernels* kernels, const Function& f, const std::vector<float>& xs, float y,
+	Bound bound)
+{
+	Error e;
+	for (size_t i = 0; i < xs.size(); i += PacketWidth)
+	{
+		FloatPacket x, r;
+		for (int j = 0; j < PacketWidth; j++)
+			x[j] = xs[std::min(i + j, xs.size() - 1)];
+
+		f.eval(kernels, x, y, r);
+
+		for (int j = 0; j < PacketWidth; j++)
+		{
+			double ref = f.reference(x[j], y);
+			double error = std::isnan(r[j]) ? INFINITY : std::abs(double(r[j]) - ref) / bound(double(x[j]), ref);
+			if (error > e.max)
+				e.max = error, e.at = x[j];
+		}
+	}
+	return e;
+}
+
+static bool Check(const char* isa, const Function& f, const char* domain, Error e, float y = 0)
+{
+	bool pass = e.max <= 1.;
+	if (f.eval == EvalPow)
+		printf("%-8s %-4s y = %-6g %-26s %6.3f of bound at %g  %s\n", isa, f.name, y, domain, e.max, e.at,
+			pass ? "ok" : "FAIL");
+	else
+		printf("%-8s %-4s %-37s %6.3f of bound at %g  %s\n", isa, f.name, domain, e.max, e.at, pass ? "ok" : "FAIL");
+	return pass;
+}
+
+static bool Test(const char* isa, const PacketKernels* kernels)
+{
+	bool pass = true;
+
+	auto ulps = [](double bound) { return [bound](double, double ref) { return bound * Ulp(ref); }; };
+
+	std::vector<float> xs = Sweep(-87.f, 88.f);
+	pass &= Check(isa, ExpTest, "[-87, 88], 1.1 ulp", MaxError(kernels, ExpTest, xs, 0, ulps(1.1)));
+
+	xs = Sweep(FLT_MIN, FLT_MAX);
+	pass &= Check(isa, LogTest, "normal > 0, 1 ulp", MaxError(kernels, LogTest, xs, 0, ulps(1.)));
+
+	// 1.6 ulp, or 8e-8 absolute where the result is close to 0
+	auto sinCosBound = [](double, double ref) { return std::max(1.6 * Ulp(ref), 8e-8); };
+	xs = Sweep(-8192.f, 8192.f);
+	pass &= Check(isa, SinTest, "|x| <= 8192, 1.6 ulp", MaxError(kernels, SinTest, xs, 0, sinCosBound));
+	pass &= Check(isa, CosTest, "|x| <= 8192, 1.6 ulp", MaxError(kernels, CosTest, xs, 0, sinCosBound));
+
+	for (float y : { -4.f, -1.f, -.37f, .5f, 1.f, 2.2f, 5.f, 32.f })
+	{
+		// x > 0 with the result normal and finite
+		float limit = float(std::exp(80. / std::abs(y)));
+		auto bound = [y](double x, double ref) { return 1.2e-7 * (1. + std::abs(y * std::log(x))) * std::abs(ref); };
+		xs = Sweep(std::max(1.f / limit, FLT_MIN), std::min(limit, FLT_MAX));
+		pass &= Check(isa, PowTest, "x > 0, 1.2e-7 (1 + |y log x|)", MaxError(kernels, PowTest, xs, y, bound), y);
+	}
+
+	// the special values documented next to the bounds
+	FloatPacket x, r;
+	auto special = [&](const Function& f, bool ok, const char* what)
+	{
+		if (!ok)
+			printf("%-8s %-4s %s, got %g  FAIL\n", isa, f.name, what, r[0]);
+		pass &= ok;
+	};
+
+	Fill(x, -100.f), EvalExp(kernels, x, 0, r);
+	special(ExpTest, r[0] == 0.f, "0 below the domain");
+	Fill(x, 100.f), EvalExp(kernels, x, 0, r);
+	special(ExpTest, std::isinf(r[0]) && r[0] > 0.f, "+inf above the domain");
+	Fill(x, 0.f), EvalLog(kernels, x, 0, r);
+	special(LogTest, std::isinf(r[0]) && r[0] < 0.f, "-inf at 0");
+	Fill(x, -1.f), EvalLog(kernels, x, 0, r);
+	special(LogTest, std::isnan(r[0]), "NaN below 0");
+
+	return pass;
+}
+
+int main()
+{
+	bool pass = Test("fastmath", nullptr);
+
+	for (const PacketKernels* kernels : { &scalar::Kernels, &avx2::Kernels, &avx512::Kernels })
+	{
+		if (IsPacketISASupported(kernels->isa))
+			pass &= Test(kernels->name, kernels);
+		else
+			printf("%-8s not supported by this CPU, skipped\n", kernels->name);
+	}
+
+	printf(pass ? "all bounds hold\n" : "bounds exceeded\n");
+	return pass ? 0 : 1;
+}
@@ -0,0 +1,252 @@
+// Tabulates a layered BSDF for the baked_file parameter of LayerMatNode, see src/baked_table.h.
+// usage: layer_bake <stack description> <output table>
+//
+// The description has one setting per line, # starts a comment:
+//   thickness 0.1
+//   g 0.4
+//   albedo 0.8 0.8 0.8
+//   top dielectric ior 1.5 roughness 0.1
+//   bottom metal albedo 0.9 0.6 0.3 roughness 0.3 ior 0.2 0.9 1.3 k 3 2.5 2
+//   bottom lambert albedo 0.8 0.8 0.8
+//   resolution 32 64 32       cells over cos theta_o, cos theta_i and phi
+//   samples 1024              walks per cell, the noise of a cell falls with its square root
+// Interfaces are none, lambert, dielectric (ior, roughness) or metal (albedo, roughness, ior, k,
+// schlick), all with multiple_scattering 1 like the nodes
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bsdfs.h"
+#include "baked_table.h"
+#include "material_program.h"
+#include "packet.h"
+
+struct BakeSettings
+{
+	BSDF top = FakeBSDF();
+	BSDF bottom = FakeBSDF();
+	LayeredBSDF layered;
+	int nCosO = 32;
+	int nCosI = 64;
+	int nPhi = 32;
+	int samples = 1024;
+};
+
+static bool ReadRGB(std::istringstream& in, AtRGB& c)
+{
+	in >> c.r;
+	if (!(in >> c.g >> c.b))
+	{
+		c.g = c.b = c.r;
+		in.clear();
+	}
+	return !in.fail();
+}
+
+static bool ParseInterface(std::istringstream& in, BSDF& bsdf)
+{
+	std::string type, key;
+	in >> type;
+
+	if (type == "none")
+		bsdf = FakeBSDF();
+	else if (type == "lambert")
+		bsdf = LambertBSDF();
+	else if (type == "dielectric")
+	{
+		DielectricBSDF dielectric;
+		dielectric.multiScatter = true;
+		bsdf = dielectric;
+	}
+	else if (type == "metal")
+	{
+		MetalBSDF metal;
+		metal.multiScatter = true;
+		bsdf = metal;
+	}
+	else
+		return false;
+
+	while (in >> key)
+	{
+		float roughness;
+		bool ok = true;
+
+		if (auto lambert = std::get_if<LambertBSDF>(&bsdf); lambert && key == "albedo")
+			ok = ReadRGB(in, lambert->albedo);
+		else if (auto dielectric = std::get_if<DielectricBSDF>(&bsdf))
+		{
+			if (key == "ior")
+				ok = bool(in >> dielectric->ior);
+			else if (key == "roughness" && (ok = bool(in >> roughness)))
+				dielectric->alpha = AiSqr(roughness);
+			else if (key == "multiple_scattering")
+				ok = bool(in >> dielectric->multiScatter);
+			else
+				ok = false;
+		}
+		else if (auto metal = std::get_if<MetalBSDF>(&bsdf))
+		{
+			if (key == "albedo")
+				ok = ReadRGB(in, metal->albedo);
+			else if (key == "ior")
+				ok = ReadRGB(in, metal->ior);
+			else if (key == "k")
+				ok = ReadRGB(in, metal->k);
+			else if (key == "schlick")
+				ok = bool(in >> metal->SchlickFresnel);
+			else if (key == "roughness" && (ok = bool(in >> roughness)))
+				metal->alpha = AiSqr(roughness);
+			else if (key == "multiple_scattering")
+				ok = bool(in >> metal->multiScatter);
+			else
+				ok = false;
+		}
+		else
+			ok = false;
+
+		if (!ok)
+		{
+			fprintf(stderr, "bad %s parameter %s\n", type.c_str(), key.c_str());
+			return false;
+		}
+	}
+	return true;
+}
+
+static bool ParseSettings(const char* path, BakeSettings& settings)
+{
+	std::ifstream file(path);
+	if (!file)
+	{
+		fprintf(stderr, "cannot read %s\n", path);
+		return false;
+	}
+
+	std::string line;
+	for (int lineNumber = 1; std::getline(file, line); lineNumber++)
+	{
+		line = line.substr(0, line.find('#'));
+		std::istringstream in(line);
+		std::string key;
+		if (!(in >> key))
+			continue;
+
+		bool ok;
+		if (key == "thickness")
+			ok = bool(in >> settings.layered.thickness);
+		else if (key == "g")
+			ok = bool(in >> settings.layered.g);
+		else if (key == "albedo")
+			ok = ReadRGB(in, settings.layered.albedo);
+		else if (key == "top")
+			ok = ParseInterface(in, settings.top);
+		else if (key == "bottom")
+			ok = ParseInterface(in, settings.bottom);
+		else if (key == "resolution")
+			ok = bool(in >> settings.nCosO >> settings.nCosI >> settings.nPhi) &&
+				settings.nCosO > 0 && settings.nCosI > 0 && settings.nPhi > 0;
+		else if (key == "samples")
+			ok = bool(in >> settings.samples) && settings.samples > 0;
+		else
+			ok = false;
+
+		if (!ok)
+		{
+			fprintf(stderr, "%s:%d: cannot parse \"%s\"\n", path, lineNumber, line.c_str());
+			return false;
+		}
+	}
+	return true;
+}
+
+// Cell averages of F for the cos theta_o row o, evaluated in packets of 8 jittered cells
+static void BakeRow(const BakeSettings& settings, const LayeredBSDF& layered, const BSDFState& state, int o,
+	AtRGB* row)
+{
+	int nCosI = settings.nCosI, nPhi = settings.nPhi;
+	int cells = nCosI * nPhi;
+	RandomEngine rng(o * 7919 + 1);
+
+	std::vector<AtRGB> sum(cells, AtRGB(0.f));
+
+	for (int n = 0; n < settings.samples; n++)
+	{
+		for (int c = 0; c < cells; c += PacketWidth)
+		{
+			float cosO = -1.f + (o + Sample1D(rng)) * 2.f / settings.nCosO;
+			Vec3f wo(Sqrt(1.f - cosO * cosO), 0.f, cosO);
+
+			Vec3Packet wi;
+			for (int k = 0; k < PacketWidth; k++)
+			{
+				int cell = AiMin(c + k, cells - 1);
+				float cosI = -1.f + (cell / nPhi + Sample1D(rng)) * 2.f / nCosI;
+				float phi = (cell % nPhi + Sample1D(rng)) * AI_PI / nPhi;
+				float sinI = Sqrt(1.f - cosI * cosI);
+				wi.Set(k, Vec3f(sinI * std::cos(phi), sinI * std::sin(phi), cosI));
+			}
+
+			RGBPacket f;
+			layered.F(wo, wi, state, rng, false, f);
+			for (int k = 0; k < PacketWidth && c + k < cells; k++)
+				sum[c + k] += f.Get(k);
+		}
+	}
+
+	for (int c = 0; c < cells; c++)
+		row[c] = sum[c] / float(settings.samples);
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 3)
+	{
+		fprintf(stderr, "usage: layer_bake <stack description> <output table>\n");
+		return 1;
+	}
+
+	BakeSettings settings;
+	if (!ParseSettings(argv[1], settings))
+		return 1;
+
+	SelectPacketKernels();
+
+	MaterialProgram program;
+	program.interfaces.push_back(ProgramInterface(settings.top));
+	program.interfaces.push_back(ProgramInterface(settings.bottom));
+
+	LayeredBSDF layered = settings.layered;
+	layered.program = &program;
+	layered.medium = 0;
+	program.media.push_back({ layered, 0, 1 });
+
+	BSDFState state;
+	program.Bind(state, 0);
+
+	size_t rowSize = size_t(settings.nCosI) * settings.nPhi;
+	std::vector<AtRGB> values(settings.nCosO * rowSize);
+	std::vector<std::thread> threads;
+	int nThreads = AiMax(int(std::thread::hardware_concurrency()), 1);
+
+	for (int t = 0; t < nThreads; t++)
+	{
+		threads.emplace_back([&, t]()
+		{
+			for (int o = t; o < settings.nCosO; o += nThreads)
+				BakeRow(settings, layered, state, o, &values[o * rowSize]);
+		});
+	}
+	for (auto& thread : threads)
+		thread.join();
+
+	if (!WriteBakedTable(argv[2], settings.nCosO, settings.nCosI, settings.nPhi, values))
+	{
+		fprintf(stderr, "cannot write %s\n", argv[2]);
+		return 1;
+	}
+	return 0;
+}
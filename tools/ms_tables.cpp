@@ -0,0 +1,148 @@
+// Generates src/ms_tables.h, the directional and average albedo of the single-scattering GTR2
+// interfaces used for multiple scattering compensation (see src/energy_compensation.h).
+// usage: ms_tables <output header>
+#include <cstdio>
+#include <vector>
+
+#include "microfacet.h"
+#include "energy_compensation.h"
+
+const int NumSamples = 1 << 16;
+
+static Vec2f Hammersley(uint32_t i)
+{
+	uint32_t bits = i;
+	bits = (bits << 16u) | (bits >> 16u);
+	bits = ((bits & 0x55555555u) << 1u) | ((bits & 0xAAAAAAAAu) >> 1u);
+	bits = ((bits & 0x33333333u) << 2u) | ((bits & 0xCCCCCCCCu) >> 2u);
+	bits = ((bits & 0x0F0F0F0Fu) << 4u) | ((bits & 0xF0F0F0F0u) >> 4u);
+	bits = ((bits & 0x00FF00FFu) << 8u) | ((bits & 0xFF00FF00u) >> 8u);
+	return Vec2f((i + .5f) / NumSamples, float(bits) * 2.3283064365386963e-10f);
+}
+
+static Vec3f Direction(float cosTheta)
+{
+	cosTheta = (cosTheta < 0) ? AiMin(cosTheta, -1e-3f) : AiMax(cosTheta, 1e-3f);
+	return Vec3f(Sqrt(1.f - cosTheta * cosTheta), 0.f, cosTheta);
+}
+
+// With visible normal sampling f |cos| / pdf reduces to G2 / G1(wo) for every scattered direction
+static float Weight(Vec3f wo, Vec3f wi, float alpha)
+{
+	return SmithGCorrelated(wo.z, wi.z, alpha) / SmithG1(wo.z, alpha);
+}
+
+// Reflectance with F = 1
+static float IntegrateConductor(float cosTheta, float alpha)
+{
+	Vec3f wo = Direction(cosTheta);
+	double sum = 0;
+
+	for (int i = 0; i < NumSamples; i++)
+	{
+		Vec3f wm = GTR2SampleVisibleCap(wo, Hammersley(i), alpha);
+		Vec3f wi = -AiReflect(wo, wm);
+		if (wi.z > 0)
+			sum += Weight(wo, wi, alpha);
+	}
+	return float(sum / NumSamples);
+}
+
+// Reflectance plus transmittance without the radiance scaling of transmission, which is 1 without
+// single-scattering losses. cosTheta < 0 from the inside
+static float IntegrateDielectric(float cosTheta, float alpha, float ior)
+{
+	Vec3f wo = Direction(cosTheta);
+	double sum = 0;
+
+	for (int i = 0; i < NumSamples; i++)
+	{
+		Vec3f wm = GTR2SampleVisibleCap(wo, Hammersley(i), alpha);
+		float cosWo = Dot(wo, wm);
+		float fr = FresnelDielectric(cosWo, ior);
+
+		Vec3f wr = -AiReflect(wo, wm);
+		if (wr.z * wo.z > 0)
+			sum += fr * Weight(wo, wr, alpha);
+
+		float eta = (cosWo > 0) ? ior : 1.f / ior;
+		Vec3f n = (cosWo > 0) ? wm : -wm;
+		float c = std::abs(cosWo);
+		float sin2Tt = (1.f - c * c) / (eta * eta);
+		if (sin2Tt >= 1.f)
+			continue;
+
+		Vec3f wt = Normalize(-wo / eta + n * (c / eta - Sqrt(1.f - sin2Tt)));
+		if (wt.z * wo.z < 0)
+			sum += (1.f - fr) * Weight(wo, wt, alpha);
+	}
+	return float(sum / NumSamples);
+}
+
+static void WriteTable(FILE* file, const char* name, const std::vector<float>& values)
+{
+	fprintf(file, "static const float %s[%d] =\n{", name, int(values.size()));
+	for (size_t i = 0; i < values.size(); i++)
+		fprintf(file, "%s%.6ff,", (i % 8 == 0) ? "\n\t" : " ", values[i]);
+	fprintf(file, "\n};\n\n");
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		fprintf(stderr, "usage: ms_tables <output header>\n");
+		return 1;
+	}
+
+	std::vector<float> conductor, conductorAvg, dielectricEnter, dielectricExit;
+
+	for (int r = 0; r < MSTableRoughness; r++)
+	{
+		float alpha = AiMax(Sqr(float(r) / (MSTableRoughness - 1)), 1e-4f);
+		double avg = 0;
+
+		for (int c = 0; c < MSTableCos; c++)
+		{
+			float e = IntegrateConductor(float(c) / (MSTableCos - 1), alpha);
+			conductor.push_back(e);
+			// 2 integral of E(mu) mu, trapezoidal
+			float w = (c == 0 || c == MSTableCos - 1) ? .5f : 1.f;
+			avg += 2. * w * e * (float(c) / (MSTableCos - 1)) / (MSTableCos - 1);
+		}
+		conductorAvg.push_back(float(avg));
+	}
+
+	for (int k = 0; k < MSTableIor; k++)
+	{
+		float ior = MSTableIorMin + (MSTableIorMax - MSTableIorMin) * k / (MSTableIor - 1);
+		for (int r = 0; r < MSTableRoughness; r++)
+		{
+			float alpha = AiMax(Sqr(float(r) / (MSTableRoughness - 1)), 1e-4f);
+			for (int c = 0; c < MSTableCos; c++)
+			{
+				float cosTheta = float(c) / (MSTableCos - 1);
+				dielectricEnter.push_back(IntegrateDielectric(cosTheta, alpha, ior));
+				dielectricExit.push_back(IntegrateDielectric(-cosTheta, alpha, ior));
+			}
+		}
+		fprintf(stderr, "ior %d/%d\n", k + 1, MSTableIor);
+	}
+
+	FILE* file = fopen(argv[1], "w");
+	if (!file)
+	{
+		fprintf(stderr, "cannot write %s\n", argv[1]);
+		return 1;
+	}
+
+	fprintf(file, "// Generated by tools/ms_tables.cpp, do not edit\n");
+	fprintf(file, "// %d samples per entry, see energy_compensation.h for the layout\n", NumSamples);
+	fprintf(file, "#pragma once\n\n");
+	WriteTable(file, "ConductorAlbedoTable", conductor);
+	WriteTable(file, "ConductorAverageAlbedoTable", conductorAvg);
+	WriteTable(file, "DielectricEnterAlbedoTable", dielectricEnter);
+	WriteTable(file, "DielectricExitAlbedoTable", dielectricExit);
+	fclose(file);
+	return 0;
+}
@@ -0,0 +1,190 @@
+// First and second moments of the slopes of a tangent space normal map, for the top_normal_moments
+// and bottom_normal_moments parameters of LayerMatNode (LEAN mapping).
+// usage: normal_moments [-gamma] <normal map> <output moments>
+//
+// The normal map is a binary PPM (8 or 16 bit) or an RGB PFM, decoded like the node's normal inputs,
+// with -gamma for maps the node reads with correct_normal. The output is an RGB PFM holding
+// (sx, sy, sx^2 + sy^2) per texel for the slopes s = (nx / nz, ny / nz). Convert it with maketx as
+// linear data: mip levels average the moments, so at any footprint the node gets E[s] and E[|s|^2]
+// over it and adds the variance E[|s|^2] - |E[s]|^2 to the interface's alpha^2
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+struct Image
+{
+	int width = 0;
+	int height = 0;
+	// RGB in [0, 1], rows from top to bottom
+	std::vector<float> pixels;
+};
+
+static bool IsLittleEndian()
+{
+	uint16_t one = 1;
+	return *reinterpret_cast<uint8_t*>(&one) == 1;
+}
+
+static void SwapBytes(float& f)
+{
+	uint8_t* b = reinterpret_cast<uint8_t*>(&f);
+	std::swap(b[0], b[3]);
+	std::swap(b[1], b[2]);
+}
+
+// skips whitespace and comments of a PNM header
+static void SkipSpace(FILE* file)
+{
+	int c;
+	while ((c = fgetc(file)) != EOF)
+	{
+		if (c == '#')
+		{
+			while ((c = fgetc(file)) != EOF && c != '\n');
+		}
+		else if (!isspace(c))
+		{
+			ungetc(c, file);
+			return;
+		}
+	}
+}
+
+static bool ReadPPM(FILE* file, Image& image)
+{
+	int maxValue;
+	SkipSpace(file);
+	if (fscanf(file, "%d", &image.width) != 1)
+		return false;
+	SkipSpace(file);
+	if (fscanf(file, "%d", &image.height) != 1)
+		return false;
+	SkipSpace(file);
+	if (fscanf(file, "%d", &maxValue) != 1 || maxValue <= 0 || maxValue > 65535)
+		return false;
+	fgetc(file);
+
+	size_t count = size_t(image.width) * image.height * 3;
+	int bytes = (maxValue > 255) ? 2 : 1;
+	std::vector<uint8_t> data(count * bytes);
+	if (fread(data.data(), 1, data.size(), file) != data.size())
+		return false;
+
+	image.pixels.resize(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		int v = (bytes == 2) ? (data[i * 2] << 8 | data[i * 2 + 1]) : data[i];
+		image.pixels[i] = float(v) / maxValue;
+	}
+	return true;
+}
+
+static bool ReadPFM(FILE* file, Image& image)
+{
+	float scale;
+	if (fscanf(file, "%d %d %f", &image.width, &image.height, &scale) != 3)
+		return false;
+	fgetc(file);
+
+	size_t rowSize = size_t(image.width) * 3;
+	image.pixels.resize(rowSize * image.height);
+	bool swap = (scale < 0) != IsLittleEndian();
+
+	// rows are stored from the bottom up
+	for (int y = image.height - 1; y >= 0; y--)
+	{
+		float* row = &image.pixels[y * rowSize];
+		if (fread(row, sizeof(float), rowSize, file) != rowSize)
+			return false;
+		if (swap)
+		{
+			for (size_t i = 0; i < rowSize; i++)
+				SwapBytes(row[i]);
+		}
+	}
+	return true;
+}
+
+static bool ReadImage(const char* path, Image& image)
+{
+	FILE* file = fopen(path, "rb");
+	if (!file)
+		return false;
+
+	char magic[3] = {};
+	bool ok = fread(magic, 1, 2, file) == 2;
+	if (ok && std::strcmp(magic, "P6") == 0)
+		ok = ReadPPM(file, image);
+	else if (ok && std::strcmp(magic, "PF") == 0)
+		ok = ReadPFM(file, image);
+	else
+		ok = false;
+
+	fclose(file);
+	return ok && image.width > 0 && image.height > 0;
+}
+
+static bool WritePFM(const char* path, const Image& image)
+{
+	FILE* file = fopen(path, "wb");
+	if (!file)
+		return false;
+
+	fprintf(file, "PF\n%d %d\n%s\n", image.width, image.height, IsLittleEndian() ? "-1.0" : "1.0");
+
+	size_t rowSize = size_t(image.width) * 3;
+	bool ok = true;
+	for (int y = image.height - 1; y >= 0 && ok; y--)
+		ok = fwrite(&image.pixels[y * rowSize], sizeof(float), rowSize, file) == rowSize;
+	return fclose(file) == 0 && ok;
+}
+
+int main(int argc, char** argv)
+{
+	bool gamma = argc > 1 && std::strcmp(argv[1], "-gamma") == 0;
+	if (argc - gamma < 3)
+	{
+		fprintf(stderr, "usage: normal_moments [-gamma] <normal map> <output moments>\n");
+		return 1;
+	}
+	const char* input = argv[1 + gamma];
+	const char* output = argv[2 + gamma];
+
+	Image normals;
+	if (!ReadImage(input, normals))
+	{
+		fprintf(stderr, "cannot read %s, expected a binary PPM or an RGB PFM\n", input);
+		return 1;
+	}
+
+	Image moments = normals;
+	for (size_t i = 0; i < normals.pixels.size(); i += 3)
+	{
+		float n[3];
+		for (int c = 0; c < 3; c++)
+		{
+			float v = normals.pixels[i + c];
+			n[c] = (gamma ? std::pow(v, 1.f / 2.2f) : v) * 2.f - 1.f;
+		}
+
+		// normals at or below the surface have unbounded slopes, keep them steep but finite
+		float z = std::fmax(n[2], 1e-2f);
+		float sx = n[0] / z;
+		float sy = n[1] / z;
+
+		moments.pixels[i + 0] = sx;
+		moments.pixels[i + 1] = sy;
+		moments.pixels[i + 2] = sx * sx + sy * sy;
+	}
+
+	if (!WritePFM(output, moments))
+	{
+		fprintf(stderr, "cannot write %s\n", output);
+		return 1;
+	}
+	return 0;
+}